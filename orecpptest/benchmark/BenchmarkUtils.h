@@ -0,0 +1,135 @@
+#ifndef _BENCHMARK_UTILS_H_
+#define _BENCHMARK_UTILS_H_
+
+#include <stddef.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+/** Helpers shared by the benchmark executables.
+ * <p>Each measurement is repeated several times and printed as one JSON
+ * object per line on the standard output, so results can be collected by
+ * scripts and compared between builds. The reported time per operation is
+ * the minimum over the repetitions, which is the most stable figure for
+ * regression tracking, the median is reported too, as well as the matching
+ * number of operations per second.</p>
+ * <p>All benchmark executables accept the following arguments:</p>
+ * <ul>
+ *   <li><code>--repetitions=N</code> number of repetitions of each measurement (default 5),</li>
+ *   <li><code>--filter=TEXT</code> run only the measurements whose name contains TEXT.</li>
+ * </ul>
+ */
+namespace Benchmark
+{
+
+    /** Run settings. */
+    struct Settings
+    {
+        /** Number of repetitions of each measurement. */
+        int repetitions = 5;
+
+        /** Name filter (null to run all measurements). */
+        const char* filter = nullptr;
+    };
+
+    /** Get the run settings.
+     * @return run settings
+     */
+    inline Settings& getSettings()
+    {
+        static Settings settings;
+        return settings;
+    }
+
+    /** Parse the command line arguments.
+     * @param argc number of arguments
+     * @param argv arguments
+     * @return false if an argument is not recognized
+     */
+    inline bool parseArguments(int argc, char** argv)
+    {
+        Settings& settings = getSettings();
+        for (int i = 1; i < argc; ++i) {
+            if (std::strncmp(argv[i], "--repetitions=", 14) == 0) {
+                settings.repetitions = std::max(1, std::atoi(argv[i] + 14));
+            }
+            else if (std::strncmp(argv[i], "--filter=", 9) == 0) {
+                settings.filter = argv[i] + 9;
+            }
+            else {
+                std::fprintf(stderr, "usage: %s [--repetitions=N] [--filter=TEXT]\n", argv[0]);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** Check if a measurement is selected by the name filter.
+     * @param name measurement name
+     * @return true if the measurement must be run
+     */
+    inline bool isSelected(const char* name)
+    {
+        const char* filter = getSettings().filter;
+        return filter == nullptr || std::strstr(name, filter) != nullptr;
+    }
+
+    /** Print one result line.
+     * @param name measurement name
+     * @param operations number of operations per repetition
+     * @param seconds elapsed time of each repetition
+     * @param checksum value depending on all results, to prevent dead code elimination
+     */
+    inline void report(const char* name, size_t operations, std::vector<double> seconds, long long checksum)
+    {
+        std::sort(seconds.begin(), seconds.end());
+        const double scale = 1.0e9 / static_cast<double>(operations);
+        std::printf("{\"benchmark\":\"%s\",\"operations\":%zu,\"repetitions\":%zu,"
+                    "\"ns_per_op\":%.3f,\"ns_per_op_median\":%.3f,\"ops_per_s\":%.0f,\"checksum\":%lld}\n",
+                    name, operations, seconds.size(),
+                    scale * seconds.front(), scale * seconds[seconds.size() / 2],
+                    1.0e9 / (scale * seconds.front()), checksum);
+        std::fflush(stdout);
+    }
+
+    /** Measure a loop.
+     * @param name measurement name
+     * @param operations number of operations performed by one call to body
+     * @param setup function called before each repetition, not timed
+     * @param body timed function, returning a checksum
+     */
+    template<typename Setup, typename Body>
+    void measure(const char* name, size_t operations, Setup setup, Body body)
+    {
+        if (!isSelected(name)) {
+            return;
+        }
+        std::vector<double> seconds;
+        long long checksum = 0;
+        for (int r = 0; r < getSettings().repetitions; ++r) {
+            setup();
+            const auto start = std::chrono::steady_clock::now();
+            checksum = body();
+            const auto end = std::chrono::steady_clock::now();
+            seconds.push_back(std::chrono::duration<double>(end - start).count());
+        }
+        report(name, operations, seconds, checksum);
+    }
+
+    /** Measure a loop without setup.
+     * @param name measurement name
+     * @param operations number of operations performed by one call to body
+     * @param body timed function, returning a checksum
+     */
+    template<typename Body>
+    void measure(const char* name, size_t operations, Body body)
+    {
+        measure(name, operations, [] {}, body);
+    }
+
+}
+
+#endif
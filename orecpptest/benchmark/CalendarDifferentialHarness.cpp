@@ -0,0 +1,446 @@
+#include <stdint.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+#include "time/BasicDateComponents.h"
+#include "time/DateComponents.h"
+
+/** Differential correctness and throughput harness for calendar conversions.
+ * <p>Every implementation registered in {@link IMPLEMENTATIONS} converts day
+ * offsets with respect to J2000 into year/month/day, day of week, ISO calendar
+ * week and back to a day offset. The results are compared with an independent
+ * reference calendar computed with 64 bits floor divisions (julian calendar
+ * before 1582-10-15, gregorian calendar afterwards, astronomical year
+ * numbering, or proleptic gregorian calendar for implementations using it),
+ * and the conversion throughput of each implementation is reported as one
+ * JSON object per line.</p>
+ * <p>Usage:</p>
+ * <ul>
+ *   <li><code>--exhaustive</code> walk every offset in the range (default is stochastic),</li>
+ *   <li><code>--range=MIN:MAX</code> offsets range (default is the full
+ *       {@link DateComponents#MIN_EPOCH} to {@link DateComponents#MAX_EPOCH} range),</li>
+ *   <li><code>--samples=N</code> number of offsets drawn in stochastic mode (default 2^24),</li>
+ *   <li><code>--seed=N</code> seed of the stochastic mode,</li>
+ *   <li><code>--threads=N</code> number of worker threads (default is one per core).</li>
+ * </ul>
+ * <p>The exit status is non-zero if any mismatch is found, so the harness can be
+ * used as a regression gate.</p>
+ */
+
+namespace {
+
+    /** Calendar fields computed for one day offset. */
+    struct CalendarFields
+    {
+        long long year;
+        int month;
+        int day;
+        int dayOfWeek;
+        int calendarWeek;
+        long long j2000Day;
+    };
+
+    /** Conversion of a block of day offsets.
+     * @param offsets day offsets with respect to J2000
+     * @param count number of offsets
+     * @param fields array where to store the computed fields
+     */
+    typedef void (*Conversion)(const int* offsets, size_t count, CalendarFields* fields);
+
+    /** Implementation under test. */
+    struct Implementation
+    {
+        /** Name used in reports. */
+        const char* name;
+
+        /** Conversion function. */
+        Conversion convert;
+
+        /** Index of the reference implementation to compare with (own index for references). */
+        size_t reference;
+    };
+
+    /** Julian day number of J2000 day 0. */
+    const long long JDN_J2000 = 2451545;
+
+    /** First julian day number of the gregorian calendar (1582-10-15). */
+    const long long JDN_GREGORIAN_START = 2299161;
+
+    /** First gregorian year of the astronomical convention. */
+    const long long GREGORIAN_START_YEAR = 1583;
+
+    /** Floor division.
+     * @param a dividend
+     * @param b positive divisor
+     * @return largest integer not greater than a / b
+     */
+    long long floorDiv(long long a, long long b)
+    {
+        const long long q = a / b;
+        return (a % b < 0) ? q - 1 : q;
+    }
+
+    /** Reference conversion from julian day number to calendar date.
+     * <p>Both calendars are handled with days counted from March 1st of
+     * year 0, so the leap day is the last day of a year.</p>
+     * @param jdn julian day number
+     * @param gregorianStart first julian day number of the gregorian calendar
+     * @param year placeholder for the year
+     * @param month placeholder for the month
+     * @param day placeholder for the day
+     */
+    void referenceDate(long long jdn, long long gregorianStart, long long& year, int& month, int& day)
+    {
+        long long yearOfEra;
+        long long dayOfEra;
+        long long era;
+        if (jdn >= gregorianStart) {
+            // gregorian 400 years eras starting on 0000-03-01
+            const long long z = jdn - 1721120;
+            era = floorDiv(z, 146097);
+            dayOfEra = z - era * 146097;
+            yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+            era *= 400;
+            dayOfEra -= 365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100;
+        }
+        else {
+            // julian 4 years eras starting on 0000-03-01
+            const long long z = jdn - 1721118;
+            era = floorDiv(z, 1461);
+            dayOfEra = z - era * 1461;
+            yearOfEra = (dayOfEra - dayOfEra / 1460) / 365;
+            era *= 4;
+            dayOfEra -= 365 * yearOfEra;
+        }
+        const long long mp = (5 * dayOfEra + 2) / 153;
+        day   = static_cast<int>(dayOfEra - (153 * mp + 2) / 5 + 1);
+        month = static_cast<int>(mp < 10 ? mp + 3 : mp - 9);
+        year  = era + yearOfEra + (month <= 2 ? 1 : 0);
+    }
+
+    /** Reference julian day number of January 1st.
+     * @param year year number
+     * @param gregorianStartYear first year of the gregorian calendar
+     * @return julian day number of January 1st of the year
+     */
+    long long referenceNewYear(long long year, long long gregorianStartYear)
+    {
+        // January 1st is day 306 of the March-based previous year
+        const long long y = year - 1;
+        if (year >= gregorianStartYear) {
+            const long long era = floorDiv(y, 400);
+            const long long yearOfEra = y - era * 400;
+            return 1721120 + era * 146097 + 365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100 + 306;
+        }
+        const long long era = floorDiv(y, 4);
+        const long long yearOfEra = y - era * 4;
+        return 1721118 + era * 1461 + 365 * yearOfEra + 306;
+    }
+
+    /** Reference conversion.
+     * @param offsets day offsets with respect to J2000
+     * @param count number of offsets
+     * @param fields array where to store the computed fields
+     * @param gregorianStart first julian day number of the gregorian calendar
+     * @param gregorianStartYear first year of the gregorian calendar
+     */
+    void referenceConvert(const int* offsets, size_t count, CalendarFields* fields,
+                          long long gregorianStart, long long gregorianStartYear)
+    {
+        for (size_t i = 0; i < count; ++i) {
+            const long long jdn = JDN_J2000 + offsets[i];
+            CalendarFields& f = fields[i];
+            referenceDate(jdn, gregorianStart, f.year, f.month, f.day);
+
+            // julian day number 0 is a Monday
+            f.dayOfWeek = static_cast<int>(jdn - 7 * floorDiv(jdn, 7)) + 1;
+
+            // ISO week: the week belongs to the year containing its Thursday
+            const long long thursday = jdn - (f.dayOfWeek - 1) + 3;
+            long long weekYear;
+            int m;
+            int d;
+            referenceDate(thursday, gregorianStart, weekYear, m, d);
+            f.calendarWeek = static_cast<int>((thursday - referenceNewYear(weekYear, gregorianStartYear)) / 7) + 1;
+
+            f.j2000Day = offsets[i];
+        }
+    }
+
+    /** Reference conversion for the astronomical convention.
+     * {@inheritDoc}
+     */
+    void astronomicalReferenceConvert(const int* offsets, size_t count, CalendarFields* fields)
+    {
+        referenceConvert(offsets, count, fields, JDN_GREGORIAN_START, GREGORIAN_START_YEAR);
+    }
+
+    /** Reference conversion for the proleptic gregorian calendar.
+     * {@inheritDoc}
+     */
+    void gregorianReferenceConvert(const int* offsets, size_t count, CalendarFields* fields)
+    {
+        referenceConvert(offsets, count, fields, LLONG_MIN, LLONG_MIN);
+    }
+
+    /** Conversion using the factory-based {@link DateComponents}.
+     * {@inheritDoc}
+     */
+    void dateComponentsConvert(const int* offsets, size_t count, CalendarFields* fields)
+    {
+        for (size_t i = 0; i < count; ++i) {
+            const DateComponents date(offsets[i]);
+            CalendarFields& f = fields[i];
+            f.year         = date.getYear();
+            f.month        = date.getMonth();
+            f.day          = date.getDay();
+            f.dayOfWeek    = date.getDayOfWeek();
+            f.calendarWeek = date.getCalendarWeek();
+            f.j2000Day     = DateComponents(date.getYear(), date.getMonth(), date.getDay()).getJ2000Day();
+        }
+    }
+
+    /** Conversion using a policy-based {@link BasicDateComponents}.
+     * {@inheritDoc}
+     */
+    template <typename Policy>
+    void basicDateComponentsConvert(const int* offsets, size_t count, CalendarFields* fields)
+    {
+        for (size_t i = 0; i < count; ++i) {
+            const BasicDateComponents<Policy> date(offsets[i]);
+            CalendarFields& f = fields[i];
+            f.year         = date.getYear();
+            f.month        = date.getMonth();
+            f.day          = date.getDay();
+            f.dayOfWeek    = date.getDayOfWeek();
+            f.calendarWeek = date.getCalendarWeek();
+            f.j2000Day     = BasicDateComponents<Policy>(date.getYear(), date.getMonth(), date.getDay()).getJ2000Day();
+        }
+    }
+
+    /** Implementations under test, each one compared with its reference. */
+    const Implementation IMPLEMENTATIONS[] = {
+        { "reference",                    astronomicalReferenceConvert,                     0 },
+        { "reference (gregorian)",        gregorianReferenceConvert,                        1 },
+        { "DateComponents",               dateComponentsConvert,                            0 },
+        { "AstronomicalDateComponents",   basicDateComponentsConvert<AstronomicalCalendar>, 0 },
+        { "GregorianDateComponents",      basicDateComponentsConvert<GregorianOnly>,        1 }
+    };
+
+    /** Number of implementations. */
+    const size_t NB_IMPLEMENTATIONS = sizeof(IMPLEMENTATIONS) / sizeof(IMPLEMENTATIONS[0]);
+
+    /** Number of offsets converted at once. */
+    const size_t BLOCK = 4096;
+
+    /** Maximum number of mismatches printed. */
+    const long MAX_PRINTED = 20;
+
+    /** Harness settings. */
+    struct Settings
+    {
+        bool exhaustive = false;
+        long long min = INT_MIN;
+        long long max = INT_MAX;
+        unsigned long long samples = 1ull << 24;
+        unsigned long long seed = 20240401;
+        unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    };
+
+    /** Shared results. */
+    struct Results
+    {
+        /** Elapsed conversion time of each implementation, in nanoseconds summed over threads. */
+        std::atomic<long long> nanos[NB_IMPLEMENTATIONS];
+
+        /** Number of mismatches of each implementation. */
+        std::atomic<long> mismatches[NB_IMPLEMENTATIONS];
+
+        /** Lock for printing mismatches. */
+        std::mutex printLock;
+
+        /** Number of mismatches printed. */
+        long printed = 0;
+    };
+
+    /** Convert and compare one block of offsets.
+     * @param offsets day offsets
+     * @param count number of offsets
+     * @param buffers per-implementation fields buffers
+     * @param results shared results
+     */
+    void processBlock(const int* offsets, size_t count,
+                      std::vector<std::vector<CalendarFields>>& buffers, Results& results)
+    {
+        for (size_t k = 0; k < NB_IMPLEMENTATIONS; ++k) {
+            const auto start = std::chrono::steady_clock::now();
+            IMPLEMENTATIONS[k].convert(offsets, count, buffers[k].data());
+            const auto end = std::chrono::steady_clock::now();
+            results.nanos[k] += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        }
+
+        for (size_t k = 0; k < NB_IMPLEMENTATIONS; ++k) {
+            if (IMPLEMENTATIONS[k].reference == k) {
+                continue;
+            }
+            const std::vector<CalendarFields>& expected = buffers[IMPLEMENTATIONS[k].reference];
+            const std::vector<CalendarFields>& actual = buffers[k];
+            for (size_t i = 0; i < count; ++i) {
+                const CalendarFields& e = expected[i];
+                const CalendarFields& a = actual[i];
+                if (e.year == a.year && e.month == a.month && e.day == a.day &&
+                    e.dayOfWeek == a.dayOfWeek && e.calendarWeek == a.calendarWeek &&
+                    e.j2000Day == a.j2000Day) {
+                    continue;
+                }
+                ++results.mismatches[k];
+                std::lock_guard<std::mutex> lock(results.printLock);
+                if (results.printed++ < MAX_PRINTED) {
+                    std::fprintf(stderr,
+                                 "%s mismatch at offset %d: expected %lld-%02d-%02d dow %d week %d day %lld,"
+                                 " got %lld-%02d-%02d dow %d week %d day %lld\n",
+                                 IMPLEMENTATIONS[k].name, offsets[i],
+                                 e.year, e.month, e.day, e.dayOfWeek, e.calendarWeek, e.j2000Day,
+                                 a.year, a.month, a.day, a.dayOfWeek, a.calendarWeek, a.j2000Day);
+                }
+            }
+        }
+    }
+
+    /** Worker walking a partition of the offsets.
+     * @param settings harness settings
+     * @param index index of the worker
+     * @param results shared results
+     */
+    void work(const Settings& settings, unsigned index, Results& results)
+    {
+        std::vector<std::vector<CalendarFields>> buffers(NB_IMPLEMENTATIONS, std::vector<CalendarFields>(BLOCK));
+        std::vector<int> offsets(BLOCK);
+
+        if (settings.exhaustive) {
+            // contiguous partitions, one per thread
+            const unsigned long long total = static_cast<unsigned long long>(settings.max - settings.min) + 1;
+            const long long first = settings.min + static_cast<long long>(total * index / settings.threads);
+            const long long last  = settings.min + static_cast<long long>(total * (index + 1) / settings.threads);
+            for (long long start = first; start < last; start += BLOCK) {
+                const size_t count = static_cast<size_t>(std::min<long long>(BLOCK, last - start));
+                for (size_t i = 0; i < count; ++i) {
+                    offsets[i] = static_cast<int>(start + static_cast<long long>(i));
+                }
+                processBlock(offsets.data(), count, buffers, results);
+            }
+        }
+        else {
+            // random offsets, concentrated around calendar switches and range bounds
+            std::mt19937_64 rng(settings.seed + index);
+            const long long hotSpots[] = {
+                settings.min, settings.max, -730122, -152384, 0
+            };
+            std::uniform_int_distribution<long long> anywhere(settings.min, settings.max);
+            std::uniform_int_distribution<long long> nearby(-50000, 50000);
+            std::uniform_int_distribution<int> selector(0, 3);
+            std::uniform_int_distribution<size_t> hotSpot(0, sizeof(hotSpots) / sizeof(hotSpots[0]) - 1);
+            const unsigned long long nbSamples = settings.samples / settings.threads;
+            for (unsigned long long done = 0; done < nbSamples; done += BLOCK) {
+                const size_t count = static_cast<size_t>(std::min<unsigned long long>(BLOCK, nbSamples - done));
+                for (size_t i = 0; i < count; ++i) {
+                    long long offset = anywhere(rng);
+                    if (selector(rng) == 0) {
+                        offset = std::min(settings.max, std::max(settings.min, hotSpots[hotSpot(rng)] + nearby(rng)));
+                    }
+                    offsets[i] = static_cast<int>(offset);
+                }
+                processBlock(offsets.data(), count, buffers, results);
+            }
+        }
+    }
+
+    /** Parse the command line arguments.
+     * @param argc number of arguments
+     * @param argv arguments
+     * @param settings placeholder for the settings
+     * @return false if an argument is not recognized
+     */
+    bool parseArguments(int argc, char** argv, Settings& settings)
+    {
+        for (int i = 1; i < argc; ++i) {
+            const char* arg = argv[i];
+            if (std::strcmp(arg, "--exhaustive") == 0) {
+                settings.exhaustive = true;
+            }
+            else if (std::strncmp(arg, "--range=", 8) == 0 &&
+                     std::sscanf(arg + 8, "%lld:%lld", &settings.min, &settings.max) == 2 &&
+                     settings.min <= settings.max && settings.min >= INT_MIN && settings.max <= INT_MAX) {
+                continue;
+            }
+            else if (std::strncmp(arg, "--samples=", 10) == 0) {
+                settings.samples = std::strtoull(arg + 10, nullptr, 10);
+            }
+            else if (std::strncmp(arg, "--seed=", 7) == 0) {
+                settings.seed = std::strtoull(arg + 7, nullptr, 10);
+            }
+            else if (std::strncmp(arg, "--threads=", 10) == 0) {
+                settings.threads = std::max(1, std::atoi(arg + 10));
+            }
+            else {
+                std::fprintf(stderr,
+                             "usage: %s [--exhaustive] [--range=MIN:MAX] [--samples=N] [--seed=N] [--threads=N]\n",
+                             argv[0]);
+                return false;
+            }
+        }
+        return true;
+    }
+
+}
+
+int main(int argc, char** argv)
+{
+    Settings settings;
+    if (!parseArguments(argc, argv, settings)) {
+        return 2;
+    }
+
+    Results results;
+    for (size_t k = 0; k < NB_IMPLEMENTATIONS; ++k) {
+        results.nanos[k]      = 0;
+        results.mismatches[k] = 0;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < settings.threads; ++t) {
+        workers.emplace_back(work, std::cref(settings), t, std::ref(results));
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    const double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    const unsigned long long checked = settings.exhaustive ?
+                                       static_cast<unsigned long long>(settings.max - settings.min) + 1 :
+                                       settings.samples / settings.threads * settings.threads;
+    long total = 0;
+    for (size_t k = 0; k < NB_IMPLEMENTATIONS; ++k) {
+        const double seconds = 1.0e-9 * static_cast<double>(results.nanos[k].load());
+        std::printf("{\"implementation\":\"%s\",\"mode\":\"%s\",\"offsets\":%llu,\"threads\":%u,"
+                    "\"ns_per_op\":%.3f,\"mops_per_s\":%.3f,\"mismatches\":%ld}\n",
+                    IMPLEMENTATIONS[k].name, settings.exhaustive ? "exhaustive" : "stochastic",
+                    checked, settings.threads,
+                    1.0e9 * seconds / static_cast<double>(checked),
+                    1.0e-6 * static_cast<double>(checked) * settings.threads / seconds,
+                    results.mismatches[k].load());
+        total += results.mismatches[k];
+    }
+    std::fprintf(stderr, "%llu offsets checked in %.1f s, %ld mismatches\n", checked, wall, total);
+
+    return (total == 0) ? 0 : 1;
+}
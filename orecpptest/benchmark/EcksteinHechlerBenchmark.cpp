@@ -0,0 +1,209 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "forces/ZonalKernels.h"
+#include "orbits/CircularOrbit.h"
+#include "propagation/EcksteinHechlerBatchPropagator.h"
+#include "propagation/EcksteinHechlerPropagator.h"
+#include "utils/EarthModels.h"
+#include "utils/MathUtils.h"
+#include "BenchmarkUtils.h"
+
+/** Accuracy and throughput benchmark of Eckstein-Hechler propagation of a fleet.
+ * <p>A fleet of random near circular low Earth orbits with epochs spread
+ * over one day is propagated over one day with one minute steps, with the
+ * {@link EIGEN5C} zonal coefficients: with one {@link
+ * EcksteinHechlerPropagator} per satellite, one date or all dates at a
+ * time, and with {@link EcksteinHechlerBatchPropagator}. Accuracy lines give
+ * the largest position difference between the analytical model and a
+ * numerical integration of the same J2 to J6 field for a few satellites,
+ * and between the batch propagator and the single orbit one for the whole
+ * fleet. Results are printed as one JSON object per line.</p>
+ */
+
+namespace {
+
+    /** Number of satellites. */
+    const size_t SATELLITES = 1000;
+
+    /** Number of dates. */
+    const size_t DATES = 1440;
+
+    /** Zonal model. */
+    typedef ZonalModel<EIGEN5C> Model;
+
+    /** Compute the time derivative of a state in the zonal field.
+     * @param state position and velocity
+     * @param derivative placeholder for velocity and acceleration
+     */
+    void derivative(const double* state, double* derivative)
+    {
+        double j[Model::MAX_DEGREE + 1];
+        for (int n = 0; n <= Model::MAX_DEGREE; ++n) {
+            j[n] = Model::getJ(n);
+        }
+        double ax, ay, az;
+        ZonalKernels::acceleration<6>(Model::EQUATORIAL_RADIUS, Model::MU, j, state[0], state[1], state[2],
+                                      ax, ay, az);
+        const double r2 = state[0] * state[0] + state[1] * state[1] + state[2] * state[2];
+        const double k  = -Model::MU / (r2 * std::sqrt(r2));
+        derivative[0] = state[3];
+        derivative[1] = state[4];
+        derivative[2] = state[5];
+        derivative[3] = k * state[0] + ax;
+        derivative[4] = k * state[1] + ay;
+        derivative[5] = k * state[2] + az;
+    }
+
+    /** Compare the analytical model with a numerical integration.
+     * <p>The reference is a classical Runge-Kutta integration with 1 s
+     * steps, whose own error is negligible in front of the model one.</p>
+     * @param propagator propagator to check
+     * @param duration propagation duration (s)
+     * @return largest position difference, every minute (m)
+     */
+    double numericalDifference(const EcksteinHechlerPropagator& propagator, double duration)
+    {
+        const PVCoordinates initial = propagator.getInitialOrbit().getPVCoordinates();
+        double state[6] = {
+            initial.getPosition().getX(), initial.getPosition().getY(), initial.getPosition().getZ(),
+            initial.getVelocity().getX(), initial.getVelocity().getY(), initial.getVelocity().getZ()
+        };
+        const LinearTime& epoch = propagator.getInitialOrbit().getDate();
+        const int steps = static_cast<int>(duration);
+        double maxDifference = 0;
+        for (int step = 1; step <= steps; ++step) {
+            double k1[6], k2[6], k3[6], k4[6], t[6];
+            derivative(state, k1);
+            for (int i = 0; i < 6; ++i) {
+                t[i] = state[i] + 0.5 * k1[i];
+            }
+            derivative(t, k2);
+            for (int i = 0; i < 6; ++i) {
+                t[i] = state[i] + 0.5 * k2[i];
+            }
+            derivative(t, k3);
+            for (int i = 0; i < 6; ++i) {
+                t[i] = state[i] + k3[i];
+            }
+            derivative(t, k4);
+            for (int i = 0; i < 6; ++i) {
+                state[i] += (k1[i] + 2.0 * (k2[i] + k3[i]) + k4[i]) / 6.0;
+            }
+            if (step % 60 == 0) {
+                const PVCoordinates pv = propagator.getPVCoordinates(epoch.shiftedBy(step));
+                maxDifference = std::max(maxDifference,
+                                         pv.getPosition().distance(Vector3D(state[0], state[1], state[2])));
+            }
+        }
+        return maxDifference;
+    }
+
+}
+
+int main(int argc, char** argv)
+{
+    if (!Benchmark::parseArguments(argc, argv)) {
+        return 1;
+    }
+
+    const LinearTime start(DateComponents(2024, 6, 1), TimeComponents(0, 0, 0.0));
+    std::mt19937_64 rng(20241201);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::vector<EcksteinHechlerPropagator> propagators;
+    EcksteinHechlerBatchPropagator batch = EcksteinHechlerBatchPropagator::create<EIGEN5C>();
+    batch.reserve(SATELLITES);
+    while (propagators.size() < SATELLITES) {
+        const double a = 6.7e6 + 1.5e6 * uniform(rng);
+        const double e = 0.005 * uniform(rng);
+        const double w = MathUtils::TWO_PI * uniform(rng);
+        const CircularOrbit orbit(a, e * std::cos(w), e * std::sin(w), 0.1 + 2.9 * uniform(rng),
+                                  MathUtils::TWO_PI * uniform(rng), MathUtils::TWO_PI * uniform(rng),
+                                  Orbit::MEAN_ANOMALY, start.shiftedBy(86400.0 * uniform(rng)), Model::MU);
+        const EcksteinHechlerPropagator propagator = EcksteinHechlerPropagator::create<EIGEN5C>(orbit);
+        if (propagator.isValid() && batch.addOrbit(orbit)) {
+            propagators.push_back(propagator);
+        }
+    }
+    std::vector<LinearTime> dates;
+    for (size_t k = 0; k < DATES; ++k) {
+        dates.push_back(start.shiftedBy(60.0 * k));
+    }
+
+    const size_t size = SATELLITES * DATES;
+    std::vector<double> x(size), y(size), z(size), vx(size), vy(size), vz(size);
+    auto checksum = [&x, &vz] {
+        return static_cast<long long>(x[x.size() / 3] + 1.0e3 * vz.back());
+    };
+
+    double maxNumerical = 0;
+    for (size_t s = 0; s < 4; ++s) {
+        maxNumerical = std::max(maxNumerical, numericalDifference(propagators[s], 86400.0));
+    }
+    std::printf("{\"accuracy\":\"EcksteinHechlerPropagator::getPVCoordinates\",\"satellites\":4,\"duration_s\":86400,"
+                "\"max_position_difference_with_numerical_J2_J6_m\":%.3e}\n", maxNumerical);
+
+    batch.propagate(dates.data(), DATES, x.data(), y.data(), z.data(), vx.data(), vy.data(), vz.data());
+    double maxBatch = 0;
+    for (size_t s = 0; s < SATELLITES; ++s) {
+        for (size_t k = 0; k < DATES; k += 7) {
+            const size_t i = s * DATES + k;
+            maxBatch = std::max(maxBatch,
+                                propagators[s].getPVCoordinates(dates[k]).getPosition().distance(Vector3D(x[i], y[i], z[i])));
+        }
+    }
+    std::printf("{\"accuracy\":\"EcksteinHechlerBatchPropagator::propagate\",\"satellites\":%zu,\"dates\":%zu,"
+                "\"max_position_difference_with_single_m\":%.3e}\n", SATELLITES, DATES, maxBatch);
+    std::fflush(stdout);
+
+    Benchmark::measure("EcksteinHechlerPropagator::propagate(date)", size, [&] {
+        for (size_t s = 0; s < SATELLITES; ++s) {
+            for (size_t k = 0; k < DATES; ++k) {
+                const CircularOrbit orbit = propagators[s].propagate(dates[k]);
+                const size_t i = s * DATES + k;
+                x[i]  = orbit.getA();
+                vz[i] = orbit.getAlphaM();
+            }
+        }
+        return checksum();
+    });
+
+    Benchmark::measure("EcksteinHechlerPropagator::getPVCoordinates(date)", size, [&] {
+        for (size_t s = 0; s < SATELLITES; ++s) {
+            for (size_t k = 0; k < DATES; ++k) {
+                const PVCoordinates pv = propagators[s].getPVCoordinates(dates[k]);
+                const size_t i = s * DATES + k;
+                x[i]  = pv.getPosition().getX();
+                vz[i] = pv.getVelocity().getZ();
+            }
+        }
+        return checksum();
+    });
+
+    Benchmark::measure("EcksteinHechlerPropagator::getPVCoordinates(dates)", size, [&] {
+        for (size_t s = 0; s < SATELLITES; ++s) {
+            const size_t i = s * DATES;
+            propagators[s].getPVCoordinates(dates.data(), DATES, x.data() + i, y.data() + i, z.data() + i,
+                                            vx.data() + i, vy.data() + i, vz.data() + i);
+        }
+        return checksum();
+    });
+
+    Benchmark::measure("EcksteinHechlerBatchPropagator::propagate(dates)", size, [&] {
+        batch.propagate(dates.data(), DATES, x.data(), y.data(), z.data(), vx.data(), vy.data(), vz.data());
+        return checksum();
+    });
+
+    Benchmark::measure("EcksteinHechlerBatchPropagator::propagate(date)", size, [&] {
+        for (size_t k = 0; k < DATES; ++k) {
+            const size_t i = k * SATELLITES;
+            batch.propagate(dates[k], x.data() + i, y.data() + i, z.data() + i,
+                            vx.data() + i, vy.data() + i, vz.data() + i);
+        }
+        return checksum();
+    });
+
+    return 0;
+}
@@ -0,0 +1,237 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "bodies/OneAxisEllipsoid.h"
+#include "bodies/ReferenceEllipsoid.h"
+#include "utils/MathUtils.h"
+#include "BenchmarkUtils.h"
+
+/** Accuracy and throughput benchmark of the geodetic conversions.
+ * <p>The closed-form cartesian to geodetic conversion is compared with an
+ * iterative reference (fixed point iteration on latitude until it stops
+ * changing) on WGS84, for points near the surface, in orbit up to beyond
+ * geostationary altitude and deep inside the body. Accuracy results are
+ * printed as one JSON object per line with the maximum latitude and altitude
+ * differences with the reference and the maximum round trip position error
+ * (geodetic then back to cartesian), followed by the usual timing lines.</p>
+ */
+
+namespace {
+
+    /** Number of points of each workload. */
+    const size_t SIZE = 1 << 20;
+
+    /** Points in structure of arrays layout. */
+    struct Points
+    {
+        /** Abscissas (m). */
+        std::vector<double> x;
+
+        /** Ordinates (m). */
+        std::vector<double> y;
+
+        /** Heights (m). */
+        std::vector<double> z;
+
+        /** Geodetic latitudes (rad). */
+        std::vector<double> latitudes;
+
+        /** Longitudes (rad). */
+        std::vector<double> longitudes;
+
+        /** Altitudes (m). */
+        std::vector<double> altitudes;
+
+        /** Resize all arrays.
+         * @param size number of points
+         */
+        void resize(size_t size)
+        {
+            x.resize(size);
+            y.resize(size);
+            z.resize(size);
+            latitudes.resize(size);
+            longitudes.resize(size);
+            altitudes.resize(size);
+        }
+    };
+
+    /** Build random points.
+     * @param seed random generator seed
+     * @param minAltitude smallest altitude (m)
+     * @param maxAltitude largest altitude (m)
+     * @return points, with both cartesian and geodetic coordinates filled in
+     */
+    Points buildPoints(unsigned long long seed, double minAltitude, double maxAltitude)
+    {
+        std::mt19937_64 rng(seed);
+        std::uniform_real_distribution<double> sinLatitude(-1.0, 1.0);
+        std::uniform_real_distribution<double> longitude(-MathUtils::PI, MathUtils::PI);
+        std::uniform_real_distribution<double> altitude(minAltitude, maxAltitude);
+        Points points;
+        points.resize(SIZE);
+        for (size_t i = 0; i < SIZE; ++i) {
+            points.latitudes[i]  = std::asin(sinLatitude(rng));
+            points.longitudes[i] = longitude(rng);
+            points.altitudes[i]  = altitude(rng);
+        }
+        WGS84Ellipsoid::toCartesian(points.latitudes.data(), points.longitudes.data(), points.altitudes.data(), SIZE,
+                                    points.x.data(), points.y.data(), points.z.data());
+        return points;
+    }
+
+    /** Iterative reference conversion from cartesian to geodetic coordinates.
+     * @param a equatorial radius (m)
+     * @param e2 square of the first eccentricity
+     * @param x abscissa (m)
+     * @param y ordinate (m)
+     * @param z height (m)
+     * @param latitude placeholder for the geodetic latitude (rad)
+     * @param longitude placeholder for the longitude (rad)
+     * @param altitude placeholder for the altitude (m)
+     */
+    void iterativeToGeodetic(double a, double e2, double x, double y, double z,
+                             double& latitude, double& longitude, double& altitude)
+    {
+        const double rho = std::sqrt(x * x + y * y);
+        longitude = std::atan2(y, x);
+        double phi = std::atan2(z, rho * (1.0 - e2));
+        for (int i = 0; i < 100; ++i) {
+            const double sinPhi = std::sin(phi);
+            const double n = a / std::sqrt(1.0 - e2 * sinPhi * sinPhi);
+            const double next = std::atan2(z + e2 * n * sinPhi, rho);
+            if (next == phi) {
+                break;
+            }
+            phi = next;
+        }
+        const double sinPhi = std::sin(phi);
+        const double cosPhi = std::cos(phi);
+        const double n = a / std::sqrt(1.0 - e2 * sinPhi * sinPhi);
+        latitude = phi;
+        altitude = rho * cosPhi + (z + e2 * n * sinPhi) * sinPhi - n;
+    }
+
+    /** Check the accuracy of the closed-form conversion on one workload.
+     * @param name workload name
+     * @param points points
+     * @param compareWithReference if true, compare with the iterative reference
+     */
+    void checkAccuracy(const char* name, const Points& points, bool compareWithReference)
+    {
+        const double a  = Ellipsoid<WGS84>::EQUATORIAL_RADIUS;
+        const double e2 = Ellipsoid<WGS84>::E2;
+        Points converted;
+        converted.resize(SIZE);
+        WGS84Ellipsoid::toGeodetic(points.x.data(), points.y.data(), points.z.data(), SIZE,
+                                   converted.latitudes.data(), converted.longitudes.data(),
+                                   converted.altitudes.data());
+        WGS84Ellipsoid::toCartesian(converted.latitudes.data(), converted.longitudes.data(),
+                                    converted.altitudes.data(), SIZE,
+                                    converted.x.data(), converted.y.data(), converted.z.data());
+
+        double maxLatitudeError = 0;
+        double maxAltitudeError = 0;
+        double maxRoundTripError = 0;
+        for (size_t i = 0; i < SIZE; ++i) {
+            if (compareWithReference) {
+                double latitude, longitude, altitude;
+                iterativeToGeodetic(a, e2, points.x[i], points.y[i], points.z[i], latitude, longitude, altitude);
+                maxLatitudeError = std::max(maxLatitudeError, std::abs(converted.latitudes[i] - latitude));
+                maxAltitudeError = std::max(maxAltitudeError, std::abs(converted.altitudes[i] - altitude));
+            }
+            const double dx = converted.x[i] - points.x[i];
+            const double dy = converted.y[i] - points.y[i];
+            const double dz = converted.z[i] - points.z[i];
+            maxRoundTripError = std::max(maxRoundTripError, std::sqrt(dx * dx + dy * dy + dz * dz));
+        }
+        std::printf("{\"accuracy\":\"WGS84Ellipsoid::toGeodetic/%s\",\"points\":%zu,"
+                    "\"max_latitude_error_rad\":%.3e,\"max_altitude_error_m\":%.3e,"
+                    "\"max_round_trip_error_m\":%.3e}\n",
+                    name, SIZE, maxLatitudeError, maxAltitudeError, maxRoundTripError);
+        std::fflush(stdout);
+    }
+
+    /** Checksum of geodetic coordinates.
+     * @param points points
+     * @return checksum
+     */
+    long long geodeticChecksum(const Points& points)
+    {
+        return static_cast<long long>(1.0e6 * points.latitudes[SIZE / 3]) +
+               static_cast<long long>(points.altitudes.back());
+    }
+
+}
+
+int main(int argc, char** argv)
+{
+    if (!Benchmark::parseArguments(argc, argv)) {
+        return 1;
+    }
+
+    const Points surface = buildPoints(20240801, -1.0e4, 1.0e5);
+    const Points orbits  = buildPoints(20240802, 1.0e5, 5.0e7);
+    const Points deep    = buildPoints(20240803, -6.35e6, -6.0e6);
+    checkAccuracy("surface", surface, true);
+    checkAccuracy("orbits", orbits, true);
+    checkAccuracy("deep", deep, false);
+
+    const double a  = Ellipsoid<WGS84>::EQUATORIAL_RADIUS;
+    const double e2 = Ellipsoid<WGS84>::E2;
+    const OneAxisEllipsoid shape = OneAxisEllipsoid::create<WGS84>();
+    Points out;
+    out.resize(SIZE);
+
+    Benchmark::measure("iterative toGeodetic/orbits", SIZE, [&] {
+        for (size_t i = 0; i < SIZE; ++i) {
+            iterativeToGeodetic(a, e2, orbits.x[i], orbits.y[i], orbits.z[i],
+                                out.latitudes[i], out.longitudes[i], out.altitudes[i]);
+        }
+        return geodeticChecksum(out);
+    });
+
+    Benchmark::measure("OneAxisEllipsoid::transform(Vector3D)/orbits", SIZE, [&] {
+        for (size_t i = 0; i < SIZE; ++i) {
+            const GeodeticPoint point = shape.transform(Vector3D(orbits.x[i], orbits.y[i], orbits.z[i]));
+            out.latitudes[i]  = point.getLatitude();
+            out.longitudes[i] = point.getLongitude();
+            out.altitudes[i]  = point.getAltitude();
+        }
+        return geodeticChecksum(out);
+    });
+
+    Benchmark::measure("OneAxisEllipsoid::toGeodetic/orbits", SIZE, [&] {
+        shape.toGeodetic(orbits.x.data(), orbits.y.data(), orbits.z.data(), SIZE,
+                         out.latitudes.data(), out.longitudes.data(), out.altitudes.data());
+        return geodeticChecksum(out);
+    });
+
+    Benchmark::measure("WGS84Ellipsoid::toGeodetic/orbits", SIZE, [&] {
+        WGS84Ellipsoid::toGeodetic(orbits.x.data(), orbits.y.data(), orbits.z.data(), SIZE,
+                                   out.latitudes.data(), out.longitudes.data(), out.altitudes.data());
+        return geodeticChecksum(out);
+    });
+
+    Benchmark::measure("WGS84Ellipsoid::toGeodetic/surface", SIZE, [&] {
+        WGS84Ellipsoid::toGeodetic(surface.x.data(), surface.y.data(), surface.z.data(), SIZE,
+                                   out.latitudes.data(), out.longitudes.data(), out.altitudes.data());
+        return geodeticChecksum(out);
+    });
+
+    Benchmark::measure("OneAxisEllipsoid::toCartesian/orbits", SIZE, [&] {
+        shape.toCartesian(orbits.latitudes.data(), orbits.longitudes.data(), orbits.altitudes.data(), SIZE,
+                          out.x.data(), out.y.data(), out.z.data());
+        return static_cast<long long>(out.x.back());
+    });
+
+    Benchmark::measure("WGS84Ellipsoid::toCartesian/orbits", SIZE, [&] {
+        WGS84Ellipsoid::toCartesian(orbits.latitudes.data(), orbits.longitudes.data(), orbits.altitudes.data(), SIZE,
+                                    out.x.data(), out.y.data(), out.z.data());
+        return static_cast<long long>(out.x.back());
+    });
+
+    return 0;
+}
@@ -0,0 +1,137 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "forces/ReferenceZonalField.h"
+#include "forces/ZonalGravityField.h"
+#include "BenchmarkUtils.h"
+
+/** Accuracy and throughput benchmark of the zonal gravity accelerations.
+ * <p>Accelerations up to J6 of EGM96 are computed at random positions
+ * between 6500 km and 42500 km from the Earth center, one at a time, with
+ * the runtime field batch method, with the compile-time field batch method
+ * and with Jacobians. Accuracy lines compare the J2 accelerations with the
+ * analytic formula, and the Jacobians with central finite differences of
+ * the accelerations. Results are printed as one JSON object per line.</p>
+ */
+
+namespace {
+
+    /** Number of positions. */
+    const size_t SIZE = 1 << 20;
+
+    /** Number of positions of the finite differences check. */
+    const size_t CHECKED = 4096;
+
+    /** Relative finite differences step, with respect to the radius. */
+    const double RELATIVE_STEP = 1.0e-6;
+
+}
+
+int main(int argc, char** argv)
+{
+    if (!Benchmark::parseArguments(argc, argv)) {
+        return 1;
+    }
+
+    std::mt19937_64 rng(20240901);
+    std::normal_distribution<double> direction(0.0, 1.0);
+    std::uniform_real_distribution<double> radius(6.5e6, 4.25e7);
+    std::vector<double> x(SIZE), y(SIZE), z(SIZE);
+    for (size_t i = 0; i < SIZE; ++i) {
+        const double dx = direction(rng);
+        const double dy = direction(rng);
+        const double dz = direction(rng);
+        const double scale = radius(rng) / std::sqrt(dx * dx + dy * dy + dz * dz);
+        x[i] = scale * dx;
+        y[i] = scale * dy;
+        z[i] = scale * dz;
+    }
+    std::vector<double> ax(SIZE), ay(SIZE), az(SIZE), jacobians(9 * SIZE);
+    auto checksum = [&ax, &az] {
+        return static_cast<long long>(1.0e9 * (ax[SIZE / 2] + az.back()));
+    };
+
+    const ZonalGravityField field = ZonalGravityField::create<EGM96>();
+
+    // analytic J2 acceleration
+    ReferenceZonalField<EGM96, 2>::getAccelerations(x.data(), y.data(), z.data(), SIZE, ax.data(), ay.data(), az.data());
+    const double j2Factor = -1.5 * field.getJ(2) * field.getMu() * field.getEquatorialRadius() * field.getEquatorialRadius();
+    double maxJ2 = 0;
+    for (size_t i = 0; i < SIZE; ++i) {
+        const double r2    = x[i] * x[i] + y[i] * y[i] + z[i] * z[i];
+        const double r     = std::sqrt(r2);
+        const double zr2   = 5.0 * z[i] * z[i] / r2;
+        const double scale = j2Factor / (r2 * r2 * r);
+        const Vector3D expected(scale * x[i] * (1.0 - zr2), scale * y[i] * (1.0 - zr2), scale * z[i] * (3.0 - zr2));
+        maxJ2 = std::max(maxJ2, expected.distance(Vector3D(ax[i], ay[i], az[i])) / expected.getNorm());
+    }
+    std::printf("{\"accuracy\":\"ReferenceZonalField<EGM96,2>::getAccelerations/J2\",\"points\":%zu,"
+                "\"max_relative_difference_with_analytic\":%.3e}\n", SIZE, maxJ2);
+
+    // Jacobians from central finite differences of the accelerations
+    EGM96ZonalField::getAccelerations(x.data(), y.data(), z.data(), SIZE, ax.data(), ay.data(), az.data(),
+                                      jacobians.data());
+    double maxJacobian = 0;
+    for (size_t i = 0; i < SIZE; i += SIZE / CHECKED) {
+        const Vector3D position(x[i], y[i], z[i]);
+        const double h = RELATIVE_STEP * position.getNorm();
+        const double* jacobian = jacobians.data() + 9 * i;
+        double maxElement = 0;
+        double maxError   = 0;
+        for (int c = 0; c < 3; ++c) {
+            const Vector3D step(c == 0 ? h : 0.0, c == 1 ? h : 0.0, c == 2 ? h : 0.0);
+            const Vector3D plus  = field.getAcceleration(position.add(step));
+            const Vector3D minus = field.getAcceleration(position.subtract(step));
+            const double difference[3] = {
+                (plus.getX() - minus.getX()) / (2.0 * h),
+                (plus.getY() - minus.getY()) / (2.0 * h),
+                (plus.getZ() - minus.getZ()) / (2.0 * h)
+            };
+            for (int k = 0; k < 3; ++k) {
+                maxElement = std::max(maxElement, std::fabs(jacobian[3 * k + c]));
+                maxError   = std::max(maxError, std::fabs(jacobian[3 * k + c] - difference[k]));
+            }
+        }
+        maxJacobian = std::max(maxJacobian, maxError / maxElement);
+    }
+    std::printf("{\"accuracy\":\"EGM96ZonalField::getAccelerations(jacobians)/J6\",\"points\":%zu,"
+                "\"relative_step\":%g,\"max_relative_difference_with_finite_differences\":%.3e}\n",
+                CHECKED, RELATIVE_STEP, maxJacobian);
+    std::fflush(stdout);
+
+    Benchmark::measure("ZonalGravityField::getAcceleration/J6", SIZE, [&] {
+        for (size_t i = 0; i < SIZE; ++i) {
+            const Vector3D a = field.getAcceleration(Vector3D(x[i], y[i], z[i]));
+            ax[i] = a.getX();
+            ay[i] = a.getY();
+            az[i] = a.getZ();
+        }
+        return checksum();
+    });
+
+    Benchmark::measure("ZonalGravityField::getAccelerations/J6", SIZE, [&] {
+        field.getAccelerations(x.data(), y.data(), z.data(), SIZE, ax.data(), ay.data(), az.data());
+        return checksum();
+    });
+
+    Benchmark::measure("EGM96ZonalField::getAccelerations/J6", SIZE, [&] {
+        EGM96ZonalField::getAccelerations(x.data(), y.data(), z.data(), SIZE, ax.data(), ay.data(), az.data());
+        return checksum();
+    });
+
+    Benchmark::measure("ReferenceZonalField<EGM96,2>::getAccelerations/J2", SIZE, [&] {
+        ReferenceZonalField<EGM96, 2>::getAccelerations(x.data(), y.data(), z.data(), SIZE,
+                                                        ax.data(), ay.data(), az.data());
+        return checksum();
+    });
+
+    Benchmark::measure("EGM96ZonalField::getAccelerations(jacobians)/J6", SIZE, [&] {
+        EGM96ZonalField::getAccelerations(x.data(), y.data(), z.data(), SIZE, ax.data(), ay.data(), az.data(),
+                                          jacobians.data());
+        return checksum() + static_cast<long long>(1.0e15 * jacobians[4]);
+    });
+
+    return 0;
+}
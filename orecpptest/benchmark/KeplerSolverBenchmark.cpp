@@ -0,0 +1,279 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "orbits/KeplerSolver.h"
+#include "utils/MathUtils.h"
+#include "BenchmarkUtils.h"
+
+/** Accuracy and throughput benchmark of the Kepler equation solvers.
+ * <p>For several eccentricity ranges, the fixed cost solvers (scalar and
+ * batch) are compared with a Newton solver converged in extended precision,
+ * on random mean anomalies: in [-π, π] for elliptic orbits, and spread over
+ * 10 decades on each side of 0 for hyperbolic orbits. Accuracy results are
+ * printed as one JSON object per line with the maximum error on the
+ * eccentric anomaly (relative to max(1, |H|) for hyperbolic orbits),
+ * followed by the usual timing lines, where the fixed cost solvers are
+ * compared with a classical Halley solver iterating until convergence.</p>
+ */
+
+namespace {
+
+    /** Number of anomalies of the timing workloads. */
+    const size_t SIZE = 1 << 20;
+
+    /** Number of anomalies of the accuracy workloads. */
+    const size_t ACCURACY_SIZE = 1 << 18;
+
+    /** Anomalies problems in structure of arrays layout. */
+    struct Problems
+    {
+        /** Eccentricities. */
+        std::vector<double> e;
+
+        /** Mean anomalies. */
+        std::vector<double> M;
+
+        /** Eccentric anomalies. */
+        std::vector<double> E;
+    };
+
+    /** Build random problems.
+     * @param seed random generator seed
+     * @param size number of problems
+     * @param eMin smallest eccentricity
+     * @param eMax largest eccentricity
+     * @return problems, with eccentric anomalies set to 0
+     */
+    Problems buildProblems(unsigned long long seed, size_t size, double eMin, double eMax)
+    {
+        std::mt19937_64 rng(seed);
+        std::uniform_real_distribution<double> eccentricity(eMin, eMax);
+        std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+        Problems problems;
+        problems.e.resize(size);
+        problems.M.resize(size);
+        problems.E.resize(size);
+        for (size_t i = 0; i < size; ++i) {
+            problems.e[i] = eccentricity(rng);
+            const double u = uniform(rng);
+            if (eMax < 1.0) {
+                problems.M[i] = MathUtils::PI * u;
+            }
+            else {
+                problems.M[i] = ((u < 0) ? -1.0e-6 : 1.0e-6) * std::pow(10.0, 10.0 * std::abs(u));
+            }
+        }
+        return problems;
+    }
+
+    /** Reference elliptic solver, Newton iterations in extended precision.
+     * @param e eccentricity
+     * @param M mean anomaly (rad)
+     * @return eccentric anomaly (rad)
+     */
+    long double referenceElliptic(long double e, long double M)
+    {
+        long double E = M + ((M < 0) ? -0.85L : 0.85L) * e;
+        for (int i = 0; i < 200; ++i) {
+            const long double shift = (E - e * std::sin(E) - M) / (1.0L - e * std::cos(E));
+            E -= shift;
+            if (std::abs(shift) <= 1.0e-19L) {
+                break;
+            }
+        }
+        return E;
+    }
+
+    /** Reference hyperbolic solver, Newton iterations in extended precision.
+     * @param e eccentricity
+     * @param M mean anomaly
+     * @return hyperbolic eccentric anomaly
+     */
+    long double referenceHyperbolic(long double e, long double M)
+    {
+        long double H = ((M < 0) ? -1.0L : 1.0L) * std::log(2.0L * std::abs(M) / e + 1.8L);
+        for (int i = 0; i < 500; ++i) {
+            const long double shift = (e * std::sinh(H) - H - M) / (e * std::cosh(H) - 1.0L);
+            H -= shift;
+            if (std::abs(shift) <= 1.0e-19L * std::max(1.0L, std::abs(H))) {
+                break;
+            }
+        }
+        return H;
+    }
+
+    /** Classical elliptic solver, Halley iterations until convergence.
+     * @param e eccentricity
+     * @param M mean anomaly, in [-π, π] (rad)
+     * @return eccentric anomaly (rad)
+     */
+    double iterativeElliptic(double e, double M)
+    {
+        double E = M + ((M < 0) ? -0.85 : 0.85) * e;
+        for (int i = 0; i < 50; ++i) {
+            const double sinE = std::sin(E);
+            const double f0 = E - e * sinE - M;
+            const double f1 = 1.0 - e * std::cos(E);
+            const double f2 = e * sinE;
+            const double shift = 2.0 * f0 * f1 / (2.0 * f1 * f1 - f0 * f2);
+            E -= shift;
+            if (std::abs(shift) <= 1.0e-15 * std::max(1.0, std::abs(E))) {
+                break;
+            }
+        }
+        return E;
+    }
+
+    /** Classical hyperbolic solver, Halley iterations until convergence.
+     * @param e eccentricity
+     * @param M mean anomaly
+     * @return hyperbolic eccentric anomaly
+     */
+    double iterativeHyperbolic(double e, double M)
+    {
+        double H = ((M < 0) ? -1.0 : 1.0) * std::log(2.0 * std::abs(M) / e + 1.8);
+        for (int i = 0; i < 50; ++i) {
+            const double sinhH = std::sinh(H);
+            const double f0 = e * sinhH - H - M;
+            const double f1 = e * std::cosh(H) - 1.0;
+            const double f2 = e * sinhH;
+            const double shift = 2.0 * f0 * f1 / (2.0 * f1 * f1 - f0 * f2);
+            H -= shift;
+            if (std::abs(shift) <= 1.0e-15 * std::max(1.0, std::abs(H))) {
+                break;
+            }
+        }
+        return H;
+    }
+
+    /** Check the accuracy of the solvers on one eccentricity range.
+     * @param seed random generator seed
+     * @param eMin smallest eccentricity
+     * @param eMax largest eccentricity
+     */
+    void checkAccuracy(unsigned long long seed, double eMin, double eMax)
+    {
+        const bool elliptic = eMax < 1.0;
+        Problems problems = buildProblems(seed, ACCURACY_SIZE, eMin, eMax);
+        if (elliptic) {
+            KeplerSolver::ellipticMeanToEccentric(problems.e.data(), problems.M.data(), ACCURACY_SIZE,
+                                                  problems.E.data());
+        }
+        else {
+            KeplerSolver::hyperbolicMeanToEccentric(problems.e.data(), problems.M.data(), ACCURACY_SIZE,
+                                                    problems.E.data());
+        }
+
+        double maxError      = 0;
+        double maxBatchError = 0;
+        for (size_t i = 0; i < ACCURACY_SIZE; ++i) {
+            const double e = problems.e[i];
+            const double M = problems.M[i];
+            const long double reference = elliptic ? referenceElliptic(e, M) : referenceHyperbolic(e, M);
+            const double scalar = elliptic ?
+                                  KeplerSolver::ellipticMeanToEccentric(e, M) :
+                                  KeplerSolver::hyperbolicMeanToEccentric(e, M);
+            const double scale = elliptic ? 1.0 : std::max(1.0, std::abs(scalar));
+            maxError      = std::max(maxError, static_cast<double>(std::abs(scalar - reference)) / scale);
+            maxBatchError = std::max(maxBatchError,
+                                     static_cast<double>(std::abs(problems.E[i] - reference)) / scale);
+        }
+        std::printf("{\"accuracy\":\"KeplerSolver::%s\",\"e_min\":%g,\"e_max\":%g,\"anomalies\":%zu,"
+                    "\"max_error\":%.3e,\"max_batch_error\":%.3e}\n",
+                    elliptic ? "ellipticMeanToEccentric" : "hyperbolicMeanToEccentric",
+                    eMin, eMax, ACCURACY_SIZE, maxError, maxBatchError);
+        std::fflush(stdout);
+    }
+
+    /** Checksum of eccentric anomalies.
+     * @param problems problems
+     * @return checksum
+     */
+    long long anomaliesChecksum(const Problems& problems)
+    {
+        return static_cast<long long>(1.0e6 * problems.E[SIZE / 3]) +
+               static_cast<long long>(1.0e6 * problems.E.back());
+    }
+
+}
+
+int main(int argc, char** argv)
+{
+    if (!Benchmark::parseArguments(argc, argv)) {
+        return 1;
+    }
+
+    const double elliptic[] = { 0.0, 0.01, 0.1, 0.3, 0.5, 0.8, 0.9, 0.95, 0.99, 0.999, 0.9999, 0.999999 };
+    for (size_t r = 0; r + 1 < sizeof(elliptic) / sizeof(elliptic[0]); ++r) {
+        checkAccuracy(20241001 + r, elliptic[r], elliptic[r + 1]);
+    }
+    const double hyperbolic[] = { 1.000001, 1.001, 1.01, 1.1, 2.0, 10.0, 100.0 };
+    for (size_t r = 0; r + 1 < sizeof(hyperbolic) / sizeof(hyperbolic[0]); ++r) {
+        checkAccuracy(20241101 + r, hyperbolic[r], hyperbolic[r + 1]);
+    }
+
+    Problems low  = buildProblems(20241201, SIZE, 0.0, 0.1);
+    Problems high = buildProblems(20241202, SIZE, 0.9, 0.99);
+    Problems hyp  = buildProblems(20241203, SIZE, 1.01, 10.0);
+
+    Benchmark::measure("iterative elliptic/e in [0, 0.1]", SIZE, [&] {
+        for (size_t i = 0; i < SIZE; ++i) {
+            low.E[i] = iterativeElliptic(low.e[i], low.M[i]);
+        }
+        return anomaliesChecksum(low);
+    });
+
+    Benchmark::measure("KeplerSolver::ellipticMeanToEccentric(e, M)/e in [0, 0.1]", SIZE, [&] {
+        for (size_t i = 0; i < SIZE; ++i) {
+            low.E[i] = KeplerSolver::ellipticMeanToEccentric(low.e[i], low.M[i]);
+        }
+        return anomaliesChecksum(low);
+    });
+
+    Benchmark::measure("KeplerSolver::ellipticMeanToEccentric(batch)/e in [0, 0.1]", SIZE, [&] {
+        KeplerSolver::ellipticMeanToEccentric(low.e.data(), low.M.data(), SIZE, low.E.data());
+        return anomaliesChecksum(low);
+    });
+
+    Benchmark::measure("iterative elliptic/e in [0.9, 0.99]", SIZE, [&] {
+        for (size_t i = 0; i < SIZE; ++i) {
+            high.E[i] = iterativeElliptic(high.e[i], high.M[i]);
+        }
+        return anomaliesChecksum(high);
+    });
+
+    Benchmark::measure("KeplerSolver::ellipticMeanToEccentric(e, M)/e in [0.9, 0.99]", SIZE, [&] {
+        for (size_t i = 0; i < SIZE; ++i) {
+            high.E[i] = KeplerSolver::ellipticMeanToEccentric(high.e[i], high.M[i]);
+        }
+        return anomaliesChecksum(high);
+    });
+
+    Benchmark::measure("KeplerSolver::ellipticMeanToEccentric(batch)/e in [0.9, 0.99]", SIZE, [&] {
+        KeplerSolver::ellipticMeanToEccentric(high.e.data(), high.M.data(), SIZE, high.E.data());
+        return anomaliesChecksum(high);
+    });
+
+    Benchmark::measure("iterative hyperbolic/e in [1.01, 10]", SIZE, [&] {
+        for (size_t i = 0; i < SIZE; ++i) {
+            hyp.E[i] = iterativeHyperbolic(hyp.e[i], hyp.M[i]);
+        }
+        return anomaliesChecksum(hyp);
+    });
+
+    Benchmark::measure("KeplerSolver::hyperbolicMeanToEccentric(e, M)/e in [1.01, 10]", SIZE, [&] {
+        for (size_t i = 0; i < SIZE; ++i) {
+            hyp.E[i] = KeplerSolver::hyperbolicMeanToEccentric(hyp.e[i], hyp.M[i]);
+        }
+        return anomaliesChecksum(hyp);
+    });
+
+    Benchmark::measure("KeplerSolver::hyperbolicMeanToEccentric(batch)/e in [1.01, 10]", SIZE, [&] {
+        KeplerSolver::hyperbolicMeanToEccentric(hyp.e.data(), hyp.M.data(), SIZE, hyp.E.data());
+        return anomaliesChecksum(hyp);
+    });
+
+    return 0;
+}
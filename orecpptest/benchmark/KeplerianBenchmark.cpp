@@ -0,0 +1,133 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "orbits/KeplerianOrbit.h"
+#include "propagation/KeplerianBatchPropagator.h"
+#include "propagation/KeplerianPropagator.h"
+#include "utils/Constants.h"
+#include "utils/MathUtils.h"
+#include "BenchmarkUtils.h"
+
+/** Throughput benchmark of Keplerian propagation of a fleet.
+ * <p>A fleet of random elliptic orbits (mostly near circular, from low Earth
+ * orbit to geostationary altitude, a few of them highly eccentric) with
+ * epochs spread over one day is propagated over one day with one minute
+ * steps: object by object with {@link KeplerianOrbit#shiftedBy(double)},
+ * with one {@link KeplerianPropagator} per satellite, one date or all dates
+ * at a time, and with {@link KeplerianBatchPropagator}. An accuracy line
+ * gives the largest position difference between the batch propagator and
+ * the object by object propagation. Results are printed as one JSON object
+ * per line.</p>
+ */
+
+namespace {
+
+    /** Number of satellites. */
+    const size_t SATELLITES = 1000;
+
+    /** Number of dates. */
+    const size_t DATES = 1440;
+
+}
+
+int main(int argc, char** argv)
+{
+    if (!Benchmark::parseArguments(argc, argv)) {
+        return 1;
+    }
+
+    const double mu = Constants::IERS2010_EARTH_MU;
+    const LinearTime start(DateComponents(2024, 6, 1), TimeComponents(0, 0, 0.0));
+    std::mt19937_64 rng(20241101);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::vector<KeplerianOrbit> orbits;
+    std::vector<KeplerianPropagator> propagators;
+    KeplerianBatchPropagator batch;
+    batch.reserve(SATELLITES);
+    for (size_t s = 0; s < SATELLITES; ++s) {
+        const double a = 6.7e6 + 3.55e7 * uniform(rng);
+        const double e = (s % 20 == 0) ? 0.7 * uniform(rng) : 0.02 * uniform(rng);
+        const KeplerianOrbit orbit(a, e, MathUtils::PI * uniform(rng), MathUtils::TWO_PI * uniform(rng),
+                                   MathUtils::TWO_PI * uniform(rng), MathUtils::TWO_PI * uniform(rng),
+                                   Orbit::MEAN_ANOMALY, start.shiftedBy(86400.0 * uniform(rng)), mu);
+        orbits.push_back(orbit);
+        propagators.push_back(KeplerianPropagator(orbit));
+        batch.addOrbit(orbit);
+    }
+    std::vector<LinearTime> dates;
+    for (size_t k = 0; k < DATES; ++k) {
+        dates.push_back(start.shiftedBy(60.0 * k));
+    }
+
+    const size_t size = SATELLITES * DATES;
+    std::vector<double> x(size), y(size), z(size), vx(size), vy(size), vz(size);
+    auto checksum = [&x, &vz] {
+        return static_cast<long long>(x[x.size() / 3] + 1.0e3 * vz.back());
+    };
+
+    batch.propagate(dates.data(), DATES, x.data(), y.data(), z.data(), vx.data(), vy.data(), vz.data());
+    double maxError = 0;
+    for (size_t s = 0; s < SATELLITES; ++s) {
+        for (size_t k = 0; k < DATES; k += 7) {
+            const KeplerianOrbit shifted = orbits[s].shiftedBy(dates[k].durationFrom(orbits[s].getDate()));
+            const size_t i = s * DATES + k;
+            maxError = std::max(maxError,
+                                shifted.getPVCoordinates().getPosition().distance(Vector3D(x[i], y[i], z[i])));
+        }
+    }
+    std::printf("{\"accuracy\":\"KeplerianBatchPropagator::propagate\",\"satellites\":%zu,\"dates\":%zu,"
+                "\"max_position_difference_with_shiftedBy_m\":%.3e}\n", SATELLITES, DATES, maxError);
+    std::fflush(stdout);
+
+    Benchmark::measure("KeplerianOrbit::shiftedBy", size, [&] {
+        for (size_t s = 0; s < SATELLITES; ++s) {
+            for (size_t k = 0; k < DATES; ++k) {
+                const PVCoordinates pv =
+                    orbits[s].shiftedBy(dates[k].durationFrom(orbits[s].getDate())).getPVCoordinates();
+                const size_t i = s * DATES + k;
+                x[i]  = pv.getPosition().getX();
+                vz[i] = pv.getVelocity().getZ();
+            }
+        }
+        return checksum();
+    });
+
+    Benchmark::measure("KeplerianPropagator::getPVCoordinates(date)", size, [&] {
+        for (size_t s = 0; s < SATELLITES; ++s) {
+            for (size_t k = 0; k < DATES; ++k) {
+                const PVCoordinates pv = propagators[s].getPVCoordinates(dates[k]);
+                const size_t i = s * DATES + k;
+                x[i]  = pv.getPosition().getX();
+                vz[i] = pv.getVelocity().getZ();
+            }
+        }
+        return checksum();
+    });
+
+    Benchmark::measure("KeplerianPropagator::getPVCoordinates(dates)", size, [&] {
+        for (size_t s = 0; s < SATELLITES; ++s) {
+            const size_t i = s * DATES;
+            propagators[s].getPVCoordinates(dates.data(), DATES, x.data() + i, y.data() + i, z.data() + i,
+                                            vx.data() + i, vy.data() + i, vz.data() + i);
+        }
+        return checksum();
+    });
+
+    Benchmark::measure("KeplerianBatchPropagator::propagate(dates)", size, [&] {
+        batch.propagate(dates.data(), DATES, x.data(), y.data(), z.data(), vx.data(), vy.data(), vz.data());
+        return checksum();
+    });
+
+    Benchmark::measure("KeplerianBatchPropagator::propagate(date)", size, [&] {
+        for (size_t k = 0; k < DATES; ++k) {
+            const size_t i = k * SATELLITES;
+            batch.propagate(dates[k], x.data() + i, y.data() + i, z.data() + i,
+                            vx.data() + i, vy.data() + i, vz.data() + i);
+        }
+        return checksum();
+    });
+
+    return 0;
+}
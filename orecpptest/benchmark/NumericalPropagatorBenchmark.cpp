@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "forces/AtmosphericDrag.h"
+#include "forces/SolarRadiationPressure.h"
+#include "forces/ThirdBodyAttraction.h"
+#include "forces/ZonalAttraction.h"
+#include "orbits/KeplerianOrbit.h"
+#include "propagation/ClassicalRungeKuttaIntegrator.h"
+#include "propagation/DormandPrince853Integrator.h"
+#include "propagation/KeplerianPropagator.h"
+#include "propagation/NumericalPropagator.h"
+#include "utils/Constants.h"
+#include "utils/MathUtils.h"
+#include "BenchmarkUtils.h"
+
+/** Accuracy and throughput benchmark of {@link NumericalPropagator}.
+ * <p>A fixed reference low Earth orbit is propagated over one day with
+ * outputs every minute, with {@link DormandPrince853Integrator} and {@link
+ * ClassicalRungeKuttaIntegrator}, under three force sets: central
+ * attraction only, J2 and a full set adding drag, Sun and Moon attraction
+ * and solar radiation pressure. Accuracy lines give the largest position
+ * difference with {@link KeplerianPropagator} for the first set and with a
+ * tight tolerance Dormand-Prince propagation for the others, together with
+ * the number of evaluations of the equations of motion. Results are printed
+ * as one JSON object per line.</p>
+ * <p>With the full set, the Dormand-Prince steps stop at the shadow
+ * boundaries (see {@link SolarRadiationPressure#getMaxStep}): at the
+ * benchmark tolerances it stays within about 1 cm of the reference, as in
+ * the J2 case, for about 1.7 times the evaluations. Without these stops, it
+ * stepped over the penumbra and was 2.6 m away, worse than the fixed step
+ * Runge-Kutta integrator.</p>
+ */
+
+namespace {
+
+    /** Number of output dates. */
+    const size_t DATES = 1441;
+
+    /** Output sampling (s). */
+    const double SAMPLING = 60.0;
+
+    /** Output buffers. */
+    struct Ephemeris
+    {
+        std::vector<double> x, y, z, vx, vy, vz;
+
+        Ephemeris() : x(DATES), y(DATES), z(DATES), vx(DATES), vy(DATES), vz(DATES) { }
+    };
+
+    /** Propagate an orbit through dates.
+     * @param orbit initial orbit
+     * @param integrator integrator
+     * @param models force models
+     * @param dates output dates
+     * @param ephemeris placeholder for the outputs
+     * @return number of evaluations of the equations of motion
+     */
+    long long propagate(const Orbit& orbit, ODEIntegrator& integrator, const std::vector<const ForceModel*>& models,
+                        const std::vector<LinearTime>& dates, Ephemeris& ephemeris)
+    {
+        NumericalPropagator propagator(orbit, integrator);
+        for (size_t i = 0; i < models.size(); ++i) {
+            propagator.addForceModel(*models[i]);
+        }
+        if (propagator.propagate(dates.data(), dates.size(), ephemeris.x.data(), ephemeris.y.data(),
+                                 ephemeris.z.data(), ephemeris.vx.data(), ephemeris.vy.data(),
+                                 ephemeris.vz.data()) != NumericalPropagator::VALID) {
+            std::fprintf(stderr, "numerical propagation failed\n");
+        }
+        return propagator.getEvaluations();
+    }
+
+    /** Compute the largest position difference between two ephemerides.
+     * @param a first ephemeris
+     * @param b second ephemeris
+     * @return largest position difference (m)
+     */
+    double maxDifference(const Ephemeris& a, const Ephemeris& b)
+    {
+        double maxError = 0;
+        for (size_t k = 0; k < DATES; ++k) {
+            maxError = std::max(maxError, Vector3D(a.x[k], a.y[k], a.z[k]).distance(Vector3D(b.x[k], b.y[k], b.z[k])));
+        }
+        return maxError;
+    }
+
+}
+
+int main(int argc, char** argv)
+{
+    if (!Benchmark::parseArguments(argc, argv)) {
+        return 1;
+    }
+
+    const double deg = MathUtils::PI / 180.0;
+    const LinearTime start(DateComponents(2024, 6, 1), TimeComponents(0, 0, 0.0));
+    const KeplerianOrbit orbit(7.0e6, 1.0e-3, 98.0 * deg, 90.0 * deg, 30.0 * deg, 0.0,
+                               Orbit::MEAN_ANOMALY, start, Constants::IERS2010_EARTH_MU);
+    std::vector<LinearTime> dates;
+    for (size_t k = 0; k < DATES; ++k) {
+        dates.push_back(start.shiftedBy(SAMPLING * k));
+    }
+
+    // force sets
+    double zonals[3] = { 0.0, 0.0, Constants::EGM96_EARTH_C20 };
+    const ZonalAttraction j2(ZonalGravityField(Constants::EGM96_EARTH_EQUATORIAL_RADIUS,
+                                               Constants::IERS2010_EARTH_MU, zonals, 2));
+    const AtmosphericDrag drag(Constants::EGM96_EARTH_EQUATORIAL_RADIUS, Constants::IERS2010_EARTH_ANGULAR_VELOCITY,
+                               3.725e-12, 600.0e3, 71.835e3, 2.2, 1.0, 100.0);
+    const ThirdBodyAttraction sun  = ThirdBodyAttraction::sun();
+    const ThirdBodyAttraction moon = ThirdBodyAttraction::moon();
+    const SolarRadiationPressure srp(1.5, 1.0, 100.0, Constants::EGM96_EARTH_EQUATORIAL_RADIUS);
+    const std::vector<const ForceModel*> keplerOnly;
+    const std::vector<const ForceModel*> j2Only  = { &j2 };
+    const std::vector<const ForceModel*> fullSet = { &j2, &drag, &sun, &moon, &srp };
+    struct ForceSet { const char* name; const std::vector<const ForceModel*>* models; };
+    const ForceSet forceSets[] = { { "kepler", &keplerOnly }, { "j2", &j2Only }, { "full", &fullSet } };
+
+    DormandPrince853Integrator reference(1.0e-3, 300.0, 1.0e-7, 1.0e-14);
+    DormandPrince853Integrator dp853(1.0e-3, 300.0, 1.0e-3, 1.0e-11);
+    ClassicalRungeKuttaIntegrator rk4(10.0);
+    struct Integrator { const char* name; ODEIntegrator* integrator; };
+    const Integrator integrators[] = { { "DormandPrince853", &dp853 }, { "ClassicalRungeKutta", &rk4 } };
+
+    // accuracy
+    const KeplerianPropagator kepler(orbit);
+    Ephemeris keplerEphemeris;
+    kepler.getPVCoordinates(dates.data(), DATES, keplerEphemeris.x.data(), keplerEphemeris.y.data(),
+                            keplerEphemeris.z.data(), keplerEphemeris.vx.data(), keplerEphemeris.vy.data(),
+                            keplerEphemeris.vz.data());
+    Ephemeris referenceEphemeris;
+    Ephemeris ephemeris;
+    for (const ForceSet& forceSet : forceSets) {
+        const char* referenceName = "KeplerianPropagator";
+        const Ephemeris* expected = &keplerEphemeris;
+        if (!forceSet.models->empty()) {
+            const long long evaluations = propagate(orbit, reference, *forceSet.models, dates, referenceEphemeris);
+            std::printf("{\"accuracy\":\"NumericalPropagator reference\",\"forces\":\"%s\",\"evaluations\":%lld,"
+                        "\"position_change_from_kepler_m\":%.3e}\n",
+                        forceSet.name, evaluations, maxDifference(referenceEphemeris, keplerEphemeris));
+            referenceName = "tight_DormandPrince853";
+            expected = &referenceEphemeris;
+        }
+        for (const Integrator& integrator : integrators) {
+            const long long evaluations = propagate(orbit, *integrator.integrator, *forceSet.models, dates, ephemeris);
+            std::printf("{\"accuracy\":\"NumericalPropagator %s\",\"forces\":\"%s\",\"evaluations\":%lld,"
+                        "\"max_position_difference_with_%s_m\":%.3e}\n",
+                        integrator.name, forceSet.name, evaluations, referenceName,
+                        maxDifference(ephemeris, *expected));
+        }
+    }
+    std::fflush(stdout);
+
+    // throughput
+    char name[128];
+    for (const ForceSet& forceSet : forceSets) {
+        for (const Integrator& integrator : integrators) {
+            std::snprintf(name, sizeof(name), "NumericalPropagator::propagate(dates) %s %s",
+                          integrator.name, forceSet.name);
+            Benchmark::measure(name, DATES, [&] {
+                propagate(orbit, *integrator.integrator, *forceSet.models, dates, ephemeris);
+                return static_cast<long long>(ephemeris.x.back() + 1.0e3 * ephemeris.vz.back());
+            });
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,117 @@
+#include <stdint.h>
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+#include "time/ParallelConversions.h"
+#include "utils/ThreadPool.h"
+#include "BenchmarkUtils.h"
+
+/** Scaling benchmark of the parallel bulk time conversions.
+ * <p>Each conversion is measured with thread pools of 1, 2, 4... threads up
+ * to the number of hardware threads, on the same fixed-seed workload.
+ * Results are printed as one JSON object per line, with the thread count in
+ * the measurement name.</p>
+ */
+
+namespace {
+
+    /** Number of elements converted per repetition. */
+    const size_t SIZE = 1 << 22;
+
+    /** Workload shared by all thread counts. */
+    struct Workload
+    {
+        /** Day offsets from 1950 to 2050. */
+        std::vector<int> offsets;
+
+        /** Dates for the offsets. */
+        std::vector<DateComponents> dates;
+
+        /** Date/times on the same days. */
+        std::vector<DateTimeComponents> dateTimes;
+
+        /** Sorted TAI times from 1972 to 2024. */
+        std::vector<LinearTime> tai;
+    };
+
+    /** Build the workload.
+     * @return workload
+     */
+    Workload buildWorkload()
+    {
+        Workload workload;
+        std::mt19937_64 rng(20240601);
+        std::uniform_int_distribution<int> days(-18262, 18627);
+        std::uniform_real_distribution<double> seconds(0.0, 86400.0);
+        std::uniform_int_distribution<long long> taiSeconds(-10227 * 86400LL, 8766 * 86400LL);
+        for (size_t i = 0; i < SIZE; ++i) {
+            const int offset = days(rng);
+            workload.offsets.push_back(offset);
+            workload.dates.push_back(DateComponents(offset));
+            workload.dateTimes.push_back(DateTimeComponents(workload.dates.back(), TimeComponents(seconds(rng))));
+            workload.tai.push_back(LinearTime(INT64_C(1000000000) * taiSeconds(rng)));
+        }
+        std::sort(workload.tai.begin(), workload.tai.end(),
+                  [](const LinearTime& a, const LinearTime& b) { return a.getNanos() < b.getNanos(); });
+        return workload;
+    }
+
+    /** Run all measurements with one thread count.
+     * @param workload workload
+     * @param nbThreads number of threads
+     */
+    void run(const Workload& workload, unsigned nbThreads)
+    {
+        ThreadPool pool(nbThreads);
+        const UTCScale utc;
+        std::vector<DateComponents> dates(SIZE);
+        std::vector<DateTimeComponents> dateTimes(SIZE, DateTimeComponents::JULIAN_EPOCH);
+        std::vector<double> offsets(SIZE);
+        std::vector<uint64_t> keys(SIZE);
+        char name[128];
+
+        std::snprintf(name, sizeof(name), "ParallelConversions::toDateComponents/threads=%u", nbThreads);
+        Benchmark::measure(name, SIZE, [&] {
+            ParallelConversions::toDateComponents(pool, workload.offsets.data(), SIZE, dates.data());
+            return static_cast<long long>(dates.back().getYear());
+        });
+
+        std::snprintf(name, sizeof(name), "ParallelConversions::offsetFrom/threads=%u", nbThreads);
+        Benchmark::measure(name, SIZE, [&] {
+            ParallelConversions::offsetFrom(pool, workload.dateTimes.data(), SIZE, DateTimeComponents::JULIAN_EPOCH,
+                                            offsets.data());
+            return static_cast<long long>(offsets.back());
+        });
+
+        std::snprintf(name, sizeof(name), "ParallelConversions::getComponents(UTC)/threads=%u", nbThreads);
+        Benchmark::measure(name, SIZE, [&] {
+            ParallelConversions::getComponents(pool, utc, workload.tai.data(), SIZE, dateTimes.data());
+            return static_cast<long long>(dateTimes.back().getDate().getDay());
+        });
+
+        std::snprintf(name, sizeof(name), "ParallelConversions::toKeys64/threads=%u", nbThreads);
+        Benchmark::measure(name, SIZE, [&] {
+            ParallelConversions::toKeys64(pool, workload.dateTimes.data(), SIZE, keys.data());
+            return static_cast<long long>(keys.back() % 1000000007);
+        });
+    }
+
+}
+
+int main(int argc, char** argv)
+{
+    if (!Benchmark::parseArguments(argc, argv)) {
+        return 1;
+    }
+
+    const Workload workload = buildWorkload();
+    const unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned nbThreads = 1; nbThreads < hardware; nbThreads *= 2) {
+        run(workload, nbThreads);
+    }
+    run(workload, hardware);
+
+    return 0;
+}
@@ -0,0 +1,217 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+#include "propagation/SGP4CatalogPropagator.h"
+#include "propagation/SGP4Propagator.h"
+#include "utils/MathUtils.h"
+#include "utils/ThreadPool.h"
+#include "BenchmarkUtils.h"
+
+/** Accuracy and throughput benchmark of SGP4/SDP4 catalog propagation.
+ * <p>A synthetic catalog with the mix of a public one (mostly low Earth
+ * orbits, plus eccentric near Earth orbits, geosynchronous, Molniya and
+ * transfer orbits using the deep space model) is propagated over one hour
+ * with one minute steps. Accuracy lines compare the propagator with the
+ * verification vectors of "Revisiting Spacetrack Report #3", and the
+ * catalog propagator with one {@link SGP4Propagator} per satellite. Timed
+ * measurements propagate the catalog with one propagator per satellite,
+ * then with {@link SGP4CatalogPropagator} with 1, 2, 4... threads; the
+ * ops_per_s field of the one date measurements is the number of satellites
+ * per second. Results are printed as one JSON object per line.</p>
+ */
+
+namespace {
+
+    /** Number of satellites. */
+    const size_t SATELLITES = 30000;
+
+    /** Number of dates. */
+    const size_t DATES = 60;
+
+    /** Conversion from degrees to radians. */
+    const double DEG = MathUtils::PI / 180.0;
+
+    /** Conversion from revolutions per day to radians per second. */
+    const double REV_PER_DAY = MathUtils::TWO_PI / 86400.0;
+
+    /** Verification vector. */
+    struct Reference
+    {
+        /** Elements. */
+        TLE tle;
+
+        /** Offset from epoch (min). */
+        double tsince;
+
+        /** Position in TEME frame (km). */
+        double position[3];
+    };
+
+    /** Build a random catalog.
+     * @param epoch latest epoch of the elements
+     * @return elements of the catalog
+     */
+    std::vector<TLE> buildCatalog(const LinearTime& epoch)
+    {
+        std::mt19937_64 rng(20240915);
+        std::uniform_real_distribution<double> uniform(0.0, 1.0);
+        const DateTimeComponents components = epoch.getComponents();
+        std::vector<TLE> catalog;
+        for (size_t s = 0; s < SATELLITES; ++s) {
+            const double kind = uniform(rng);
+            double n, e, i;
+            if (kind < 0.80) {
+                // low Earth orbits
+                n = 11.5 + 4.5 * uniform(rng);
+                e = 0.02 * uniform(rng) * uniform(rng);
+                i = 180.0 * uniform(rng);
+            }
+            else if (kind < 0.85) {
+                // eccentric near Earth orbits
+                n = 7.0 + 4.0 * uniform(rng);
+                e = 0.02 + 0.15 * uniform(rng);
+                i = 180.0 * uniform(rng);
+            }
+            else if (kind < 0.93) {
+                // geosynchronous orbits, one day resonance
+                n = 1.0027 + 0.001 * (uniform(rng) - 0.5);
+                e = 0.001 * uniform(rng);
+                i = 15.0 * uniform(rng);
+            }
+            else if (kind < 0.97) {
+                // Molniya orbits, half day resonance
+                n = 2.0 + 0.01 * uniform(rng);
+                e = 0.6 + 0.14 * uniform(rng);
+                i = 63.4 + uniform(rng) - 0.5;
+            }
+            else {
+                // transfer and high eccentricity orbits
+                n = 2.3 + 3.7 * uniform(rng);
+                e = 0.3 + 0.4 * uniform(rng);
+                i = 60.0 * uniform(rng);
+            }
+            const double day = components.getDate().getDayOfYear() - 3.0 * uniform(rng) +
+                               components.getTime().getSecondsInLocalDay() / 86400.0;
+            catalog.push_back(TLE(static_cast<int>(s + 1), components.getDate().getYear(), day,
+                                  n * REV_PER_DAY, 0.0, 0.0, e, i * DEG,
+                                  360.0 * DEG * uniform(rng), 360.0 * DEG * uniform(rng), 360.0 * DEG * uniform(rng),
+                                  1.0e-5 + 4.0e-4 * uniform(rng) * uniform(rng)));
+        }
+        return catalog;
+    }
+
+}
+
+int main(int argc, char** argv)
+{
+    if (!Benchmark::parseArguments(argc, argv)) {
+        return 1;
+    }
+
+    // verification vectors of Vanguard 1 (near Earth), of a Molniya satellite (half day resonance)
+    // and of a geostationary satellite (one day resonance); the deep space vectors are at epoch,
+    // they check the lunisolar and resonance initialization and the lunisolar periodics, but
+    // neither the secular rates nor the resonance integration, which only act after epoch
+    const Reference references[] = {
+        { TLE(5, 2000, 179.78495062, 10.82419157 * REV_PER_DAY, 0.0, 0.0, 0.1859667, 34.2682 * DEG,
+              331.7664 * DEG, 348.7242 * DEG, 19.3264 * DEG, 0.28098e-4),
+          0.0, { 7022.46529266, -1400.08296755, 0.03995155 } },
+        { TLE(5, 2000, 179.78495062, 10.82419157 * REV_PER_DAY, 0.0, 0.0, 0.1859667, 34.2682 * DEG,
+              331.7664 * DEG, 348.7242 * DEG, 19.3264 * DEG, 0.28098e-4),
+          360.0, { -7154.03120202, -3783.17682504, -3536.19412294 } },
+        { TLE(8195, 2006, 176.33215444, 2.00491383 * REV_PER_DAY, 0.0, 0.0, 0.6877146, 64.1586 * DEG,
+              264.7651 * DEG, 279.0717 * DEG, 20.2257 * DEG, 0.11873e-3),
+          0.0, { 2349.89483350, -14785.93811562, 0.02119378 } },
+        { TLE(28626, 2006, 176.46683397, 1.00270176 * REV_PER_DAY, 0.0, 0.0, 0.0000335, 0.0019 * DEG,
+              13.7918 * DEG, 286.9433 * DEG, 55.6504 * DEG, 0.1e-3),
+          0.0, { 42080.71852213, -2646.86387436, 0.81851294 } }
+    };
+    double maxReference = 0;
+    for (const Reference& reference : references) {
+        const SGP4Propagator propagator(reference.tle);
+        const Vector3D position = propagator.getPVCoordinates(reference.tle.getDate().shiftedBy(60.0 * reference.tsince)).getPosition();
+        const Vector3D expected(1000.0 * reference.position[0], 1000.0 * reference.position[1], 1000.0 * reference.position[2]);
+        maxReference = std::max(maxReference, position.distance(expected));
+    }
+    std::printf("{\"accuracy\":\"SGP4Propagator::getPVCoordinates\",\"vectors\":%zu,"
+                "\"max_position_difference_with_reference_m\":%.3e}\n",
+                sizeof(references) / sizeof(references[0]), maxReference);
+
+    const LinearTime start(DateComponents(2024, 9, 15), TimeComponents(12, 0, 0.0));
+    const std::vector<TLE> catalog = buildCatalog(start);
+    std::vector<SGP4Propagator> propagators;
+    SGP4CatalogPropagator propagator;
+    propagator.reserve(SATELLITES);
+    for (const TLE& tle : catalog) {
+        if (propagator.addTLE(tle)) {
+            propagators.push_back(SGP4Propagator(tle));
+        }
+    }
+    const size_t satellites = propagator.getSize();
+    std::vector<LinearTime> dates;
+    for (size_t k = 0; k < DATES; ++k) {
+        dates.push_back(start.shiftedBy(60.0 * k));
+    }
+
+    const size_t size = satellites * DATES;
+    std::vector<double> x(size), y(size), z(size), vx(size), vy(size), vz(size);
+    auto checksum = [&x, &vz] {
+        return static_cast<long long>(x[x.size() / 3] + 1.0e3 * vz[vz.size() / 5]);
+    };
+
+    ThreadPool single(1);
+    propagator.propagate(single, dates.data(), DATES, x.data(), y.data(), z.data(), vx.data(), vy.data(), vz.data());
+    double maxCatalog = 0;
+    size_t invalid = 0;
+    for (size_t s = 0; s < satellites; ++s) {
+        for (size_t k = 0; k < DATES; k += 7) {
+            const size_t i = s * DATES + k;
+            const Vector3D position = propagators[s].getPVCoordinates(dates[k]).getPosition();
+            if (std::isnan(position.getX()) || std::isnan(x[i])) {
+                invalid += (std::isnan(position.getX()) && std::isnan(x[i])) ? 1 : SATELLITES;
+                continue;
+            }
+            maxCatalog = std::max(maxCatalog, position.distance(Vector3D(x[i], y[i], z[i])));
+        }
+    }
+    std::printf("{\"accuracy\":\"SGP4CatalogPropagator::propagate\",\"satellites\":%zu,\"deep_space\":%zu,"
+                "\"dates\":%zu,\"invalid_states\":%zu,\"max_position_difference_with_single_m\":%.3e}\n",
+                satellites, propagator.getDeepSpaceSize(), DATES, invalid, maxCatalog);
+    std::fflush(stdout);
+
+    Benchmark::measure("SGP4Propagator::getPVCoordinates(dates)", size, [&] {
+        for (size_t s = 0; s < satellites; ++s) {
+            const size_t i = s * DATES;
+            propagators[s].getPVCoordinates(dates.data(), DATES, x.data() + i, y.data() + i, z.data() + i,
+                                            vx.data() + i, vy.data() + i, vz.data() + i);
+        }
+        return checksum();
+    });
+
+    const unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned nbThreads = 1; ; nbThreads = std::min(2 * nbThreads, hardware)) {
+        ThreadPool pool(nbThreads);
+        char name[128];
+
+        std::snprintf(name, sizeof(name), "SGP4CatalogPropagator::propagate(date)/threads=%u", nbThreads);
+        Benchmark::measure(name, satellites, [&] {
+            propagator.propagate(pool, dates[DATES / 2], x.data(), y.data(), z.data(), vx.data(), vy.data(), vz.data());
+            return static_cast<long long>(x[satellites / 3] + 1.0e3 * vz[satellites / 5]);
+        });
+
+        std::snprintf(name, sizeof(name), "SGP4CatalogPropagator::propagate(dates)/threads=%u", nbThreads);
+        Benchmark::measure(name, size, [&] {
+            propagator.propagate(pool, dates.data(), DATES, x.data(), y.data(), z.data(), vx.data(), vy.data(), vz.data());
+            return checksum();
+        });
+
+        if (nbThreads == hardware) {
+            break;
+        }
+    }
+
+    return 0;
+}
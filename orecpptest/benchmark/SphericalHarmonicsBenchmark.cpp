@@ -0,0 +1,149 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "forces/GravityFieldReader.h"
+#include "forces/SphericalHarmonicsField.h"
+#include "BenchmarkUtils.h"
+
+/** Throughput benchmark of the spherical harmonics gravity field.
+ * <p>A synthetic degree and order 120 field in ICGEM format (coefficients
+ * with a Kaula-like decay) is written in the working directory, then the
+ * benchmark times reading it, and computing accelerations at random
+ * positions between 6500 km and 42500 km from the Earth center one at a
+ * time and with the batch method, for the full field and truncated to
+ * degree and order 20. An accuracy line gives the largest difference between
+ * the batch and the single position results. Results are printed as one JSON
+ * object per line.</p>
+ */
+
+namespace {
+
+    /** Number of positions. */
+    const size_t SIZE = 1 << 14;
+
+    /** Degree and order of the synthetic field. */
+    const int DEGREE = 120;
+
+    /** Name of the synthetic field file. */
+    const char* const FILE_NAME = "SphericalHarmonicsBenchmark.gfc";
+
+    /** Write the synthetic field file.
+     * @return true if the file could be written
+     */
+    bool writeField()
+    {
+        std::FILE* file = std::fopen(FILE_NAME, "w");
+        if (file == nullptr) {
+            return false;
+        }
+        std::fprintf(file, "synthetic field for benchmarks\n"
+                           "begin_of_head ===============================\n"
+                           "product_type              gravity_field\n"
+                           "modelname                 synthetic\n"
+                           "earth_gravity_constant    0.3986004415E+15\n"
+                           "radius                    0.6378136300E+07\n"
+                           "max_degree                %d\n"
+                           "errors                    no\n"
+                           "norm                      fully_normalized\n"
+                           "key    L    M         C                  S\n"
+                           "end_of_head =================================\n", DEGREE);
+        std::mt19937_64 rng(20241001);
+        std::normal_distribution<double> coefficient(0.0, 1.0);
+        for (int n = 0; n <= DEGREE; ++n) {
+            for (int m = 0; m <= n; ++m) {
+                const double kaula = (n == 0) ? 1.0 : 1.0e-5 / (n * n);
+                const double c = (n == 2 && m == 0) ? -4.841651437908e-04 : kaula * coefficient(rng);
+                const double s = (m == 0) ? 0.0 : kaula * coefficient(rng);
+                std::fprintf(file, "gfc %4d %4d %19.12E %19.12E\n", n, m, c, s);
+            }
+        }
+        return std::fclose(file) == 0;
+    }
+
+}
+
+int main(int argc, char** argv)
+{
+    if (!Benchmark::parseArguments(argc, argv)) {
+        return 1;
+    }
+    if (!writeField()) {
+        std::fprintf(stderr, "cannot write %s\n", FILE_NAME);
+        return 1;
+    }
+
+    SphericalHarmonicsField full;
+    if (!GravityFieldReader::read(FILE_NAME, GravityFieldReader::AUTO, DEGREE, DEGREE, full)) {
+        std::fprintf(stderr, "cannot read %s\n", FILE_NAME);
+        return 1;
+    }
+    const SphericalHarmonicsField truncated = full.truncate(20, 20);
+
+    std::mt19937_64 rng(20241002);
+    std::normal_distribution<double> direction(0.0, 1.0);
+    std::uniform_real_distribution<double> radius(6.5e6, 4.25e7);
+    std::vector<double> x(SIZE), y(SIZE), z(SIZE);
+    for (size_t i = 0; i < SIZE; ++i) {
+        const double dx = direction(rng);
+        const double dy = direction(rng);
+        const double dz = direction(rng);
+        const double scale = radius(rng) / std::sqrt(dx * dx + dy * dy + dz * dz);
+        x[i] = scale * dx;
+        y[i] = scale * dy;
+        z[i] = scale * dz;
+    }
+    std::vector<double> ax(SIZE), ay(SIZE), az(SIZE);
+    auto checksum = [&ax, &az] {
+        return static_cast<long long>(1.0e12 * (ax[SIZE / 2] + az.back()));
+    };
+
+    full.getAccelerations(x.data(), y.data(), z.data(), SIZE, ax.data(), ay.data(), az.data());
+    double maxError = 0;
+    for (size_t i = 0; i < SIZE; ++i) {
+        const Vector3D a = full.getAcceleration(Vector3D(x[i], y[i], z[i]));
+        maxError = std::max(maxError, Vector3D(ax[i], ay[i], az[i]).distance(a) / a.getNorm());
+    }
+    std::printf("{\"accuracy\":\"SphericalHarmonicsField::getAccelerations/120x120\",\"points\":%zu,"
+                "\"max_relative_difference_with_single\":%.3e}\n", SIZE, maxError);
+    std::fflush(stdout);
+
+    Benchmark::measure("GravityFieldReader::read/ICGEM/120x120", (DEGREE + 1) * (DEGREE + 2) / 2, [&] {
+        SphericalHarmonicsField field;
+        GravityFieldReader::read(FILE_NAME, GravityFieldReader::ICGEM, DEGREE, DEGREE, field);
+        return static_cast<long long>(1.0e15 * field.getNormalizedC(DEGREE, DEGREE));
+    });
+
+    Benchmark::measure("SphericalHarmonicsField::getAcceleration/120x120", SIZE, [&] {
+        for (size_t i = 0; i < SIZE; ++i) {
+            const Vector3D a = full.getAcceleration(Vector3D(x[i], y[i], z[i]));
+            ax[i] = a.getX();
+            ay[i] = a.getY();
+            az[i] = a.getZ();
+        }
+        return checksum();
+    });
+
+    Benchmark::measure("SphericalHarmonicsField::getAccelerations/120x120", SIZE, [&] {
+        full.getAccelerations(x.data(), y.data(), z.data(), SIZE, ax.data(), ay.data(), az.data());
+        return checksum();
+    });
+
+    Benchmark::measure("SphericalHarmonicsField::getAcceleration/20x20", SIZE, [&] {
+        for (size_t i = 0; i < SIZE; ++i) {
+            const Vector3D a = truncated.getAcceleration(Vector3D(x[i], y[i], z[i]));
+            ax[i] = a.getX();
+            ay[i] = a.getY();
+            az[i] = a.getZ();
+        }
+        return checksum();
+    });
+
+    Benchmark::measure("SphericalHarmonicsField::getAccelerations/20x20", SIZE, [&] {
+        truncated.getAccelerations(x.data(), y.data(), z.data(), SIZE, ax.data(), ay.data(), az.data());
+        return checksum();
+    });
+
+    return 0;
+}
@@ -0,0 +1,287 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "propagation/SGP4Propagator.h"
+#include "propagation/TLECatalog.h"
+#include "utils/MathUtils.h"
+#include "utils/ThreadPool.h"
+#include "BenchmarkUtils.h"
+
+/** Accuracy and throughput benchmark of the TLE catalog parser.
+ * <p>A synthetic catalog in the three lines format (name line, then the two
+ * element lines) is generated in the working directory, with one record in
+ * a thousand having a wrong checksum. Accuracy lines compare the parsed
+ * table with the generated elements, the parallel parse with the serial
+ * one, and propagate the parsed Vanguard 1 lines of "Revisiting Spacetrack
+ * Report #3" against its verification vector. Timed measurements parse the
+ * file with a line by line reader allocating strings, then map and parse it
+ * with {@link TLECatalog} with 1, 2, 4... threads. Results are printed as
+ * one JSON object per line, operations being records.</p>
+ */
+
+namespace {
+
+    /** Number of records of the generated file. */
+    const size_t NB_RECORDS = 1 << 16;
+
+    /** Path of the generated file. */
+    const char* const INPUT = "TLECatalogBenchmark.tmp.tle";
+
+    /** Generated record. */
+    struct Record
+    {
+        /** Satellite number. */
+        int number;
+
+        /** Year of the epoch. */
+        int year;
+
+        /** Day of the epoch. */
+        double day;
+
+        /** Mean motion (rev/day). */
+        double n;
+
+        /** Eccentricity. */
+        double e;
+
+        /** Inclination (deg). */
+        double i;
+
+        /** Ballistic coefficient. */
+        double bStar;
+    };
+
+    /** Compute the checksum character of a line.
+     * @param line first 68 characters of the line
+     * @return checksum character
+     */
+    char checksum(const char* line)
+    {
+        int sum = 0;
+        for (int k = 0; k < 68; ++k) {
+            sum += (line[k] >= '0' && line[k] <= '9') ? line[k] - '0' : (line[k] == '-' ? 1 : 0);
+        }
+        return static_cast<char>('0' + sum % 10);
+    }
+
+    /** Format a value with assumed leading decimal point and exponent.
+     * @param value value to format
+     * @param field placeholder for the eight characters and a null terminator
+     * @return formatted value
+     */
+    double formatExponent(double value, char* field)
+    {
+        int exponent = 0;
+        long mantissa = 0;
+        if (value != 0.0) {
+            exponent = static_cast<int>(std::floor(std::log10(std::fabs(value)))) + 1;
+            mantissa = std::lround(std::fabs(value) * std::pow(10.0, 5 - exponent));
+            if (mantissa == 100000) {
+                mantissa = 10000;
+                ++exponent;
+            }
+        }
+        std::snprintf(field, 9, "%c%05ld%c%d", value < 0 ? '-' : ' ', mantissa,
+                      exponent < 0 ? '-' : '+', std::abs(exponent));
+        return (value < 0 ? -1.0 : 1.0) * mantissa * std::pow(10.0, exponent - 5);
+    }
+
+    /** Generate the input file.
+     * @param records placeholder for the generated elements
+     * @return true if the file was written
+     */
+    bool generate(std::vector<Record>& records)
+    {
+        FILE* out = std::fopen(INPUT, "w");
+        if (out == nullptr) {
+            return false;
+        }
+        std::mt19937_64 rng(20240916);
+        std::uniform_real_distribution<double> uniform(0.0, 1.0);
+        char line1[80];
+        char line2[80];
+        char nddot[9];
+        char bStar[9];
+        for (size_t k = 0; k < NB_RECORDS; ++k) {
+            Record record;
+            record.number = static_cast<int>(k + 1);
+            record.year   = 2024;
+            record.day    = std::floor(1.0e8 * (200.0 + 60.0 * uniform(rng))) * 1.0e-8;
+            record.n      = std::floor(1.0e8 * (1.0 + 15.0 * uniform(rng))) * 1.0e-8;
+            record.e      = std::floor(1.0e7 * 0.3 * uniform(rng) * uniform(rng)) * 1.0e-7;
+            record.i      = std::floor(1.0e4 * 180.0 * uniform(rng)) * 1.0e-4;
+            formatExponent(-1.0e-11 * uniform(rng), nddot);
+            record.bStar = formatExponent(1.0e-5 + 4.0e-4 * uniform(rng) * uniform(rng), bStar);
+            std::snprintf(line1, sizeof(line1), "1 %05dU 24%03dA   %02d%012.8f %c.%08d %s %s 0 %4d",
+                          record.number, static_cast<int>(k % 1000), record.year % 100, record.day,
+                          (k % 3 == 0) ? '-' : ' ', static_cast<int>(1.0e5 * uniform(rng)), nddot, bStar,
+                          static_cast<int>(k % 10000));
+            std::snprintf(line2, sizeof(line2), "2 %05d %8.4f %8.4f %07d %8.4f %8.4f %11.8f%5d",
+                          record.number, record.i, 360.0 * uniform(rng), static_cast<int>(std::lround(1.0e7 * record.e)),
+                          360.0 * uniform(rng), 360.0 * uniform(rng), record.n, static_cast<int>(k % 100000));
+            line1[68] = checksum(line1);
+            line2[68] = (k % 1000 == 999) ? static_cast<char>('0' + (checksum(line2) - '0' + 1) % 10) : checksum(line2);
+            line1[69] = '\0';
+            line2[69] = '\0';
+            std::fprintf(out, "SATELLITE %zu\n%s\n%s\n", k + 1, line1, line2);
+            records.push_back(record);
+        }
+        return std::fclose(out) == 0;
+    }
+
+    /** Parse the file line by line, the way a straightforward reader would.
+     * @param numbers placeholder for the satellite numbers
+     * @param meanMotions placeholder for the mean motions
+     * @return number of records
+     */
+    size_t parseLines(std::vector<int>& numbers, std::vector<double>& meanMotions)
+    {
+        numbers.clear();
+        meanMotions.clear();
+        std::ifstream in(INPUT);
+        std::string line;
+        std::string first;
+        while (std::getline(in, line)) {
+            if (line.size() >= 69 && line[0] == '1') {
+                first = line;
+            }
+            else if (line.size() >= 69 && line[0] == '2' && !first.empty()) {
+                numbers.push_back(std::stoi(first.substr(2, 5)));
+                meanMotions.push_back(std::stod(line.substr(52, 11)));
+                std::stod(first.substr(20, 12));
+                std::stod(line.substr(8, 8));
+                std::stod(line.substr(17, 8));
+                std::stod("0." + line.substr(26, 7));
+                std::stod(line.substr(34, 8));
+                std::stod(line.substr(43, 8));
+                first.clear();
+            }
+        }
+        return numbers.size();
+    }
+
+    /** Check if two catalogs hold the same table.
+     * @param a first catalog
+     * @param b second catalog
+     * @return true if the tables are identical
+     */
+    bool identical(const TLECatalog& a, const TLECatalog& b)
+    {
+        const size_t n = a.getSize();
+        return n == b.getSize() && a.getRejected() == b.getRejected() &&
+               std::equal(a.getSatelliteNumbers(), a.getSatelliteNumbers() + n, b.getSatelliteNumbers()) &&
+               std::equal(a.getEpochDays(), a.getEpochDays() + n, b.getEpochDays()) &&
+               std::equal(a.getMeanMotions(), a.getMeanMotions() + n, b.getMeanMotions()) &&
+               std::equal(a.getE(), a.getE() + n, b.getE()) &&
+               std::equal(a.getMeanAnomalies(), a.getMeanAnomalies() + n, b.getMeanAnomalies()) &&
+               std::equal(a.getBStars(), a.getBStars() + n, b.getBStars());
+    }
+
+}
+
+int main(int argc, char** argv)
+{
+    if (!Benchmark::parseArguments(argc, argv)) {
+        return 1;
+    }
+
+    // Vanguard 1, from the verification file of "Revisiting Spacetrack Report #3"
+    const char* const vanguard =
+        "1 00005U 58002B   00179.78495062  .00000023  00000-0  28098-4 0  4753\n"
+        "2 00005  34.2682 348.7242 1859667 331.7664  19.3264 10.82419157413667\n";
+    TLECatalog single;
+    single.parse(vanguard, vanguard + std::strlen(vanguard));
+    double vanguardError = NAN;
+    if (single.getSize() == 1) {
+        const TLE tle = single.getTLE(0);
+        const SGP4Propagator propagator(tle);
+        const Vector3D position = propagator.getPVCoordinates(tle.getDate().shiftedBy(360.0 * 60.0)).getPosition();
+        vanguardError = position.distance(Vector3D(-7154031.20202, -3783176.82504, -3536194.12294));
+    }
+    std::printf("{\"accuracy\":\"TLECatalog::parse/vanguard\",\"records\":%zu,\"rejected\":%zu,"
+                "\"position_difference_with_reference_m\":%.3e}\n",
+                single.getSize(), single.getRejected(), vanguardError);
+
+    std::vector<Record> records;
+    if (!generate(records)) {
+        std::fprintf(stderr, "cannot write %s\n", INPUT);
+        return 1;
+    }
+
+    TLECatalog catalog;
+    catalog.read(INPUT);
+    double maxDay = 0;
+    double maxN   = 0;
+    double maxE   = 0;
+    double maxI   = 0;
+    double maxB   = 0;
+    double maxEpoch = 0;
+    size_t mismatches = 0;
+    for (size_t k = 0, r = 0; k < catalog.getSize(); ++k, ++r) {
+        while (r < records.size() && records[r].number != catalog.getSatelliteNumbers()[k]) {
+            ++r;
+        }
+        if (r == records.size()) {
+            ++mismatches;
+            break;
+        }
+        const Record& record = records[r];
+        maxDay = std::max(maxDay, std::fabs(catalog.getEpochDays()[k] - record.day));
+        maxN   = std::max(maxN, std::fabs(catalog.getMeanMotions()[k] * 86400.0 / MathUtils::TWO_PI - record.n));
+        maxE   = std::max(maxE, std::fabs(catalog.getE()[k] - record.e));
+        maxI   = std::max(maxI, std::fabs(catalog.getI()[k] * 180.0 / MathUtils::PI - record.i));
+        maxB   = std::max(maxB, std::fabs(catalog.getBStars()[k] - record.bStar));
+        maxEpoch = std::max(maxEpoch, std::fabs(catalog.getEpochs()[k].durationFrom(TLE::computeDate(record.year, record.day))));
+    }
+    std::printf("{\"accuracy\":\"TLECatalog::read\",\"records\":%zu,\"rejected\":%zu,\"mismatches\":%zu,"
+                "\"max_day_difference\":%.3e,\"max_mean_motion_difference_rev_per_day\":%.3e,"
+                "\"max_e_difference\":%.3e,\"max_i_difference_deg\":%.3e,\"max_bstar_difference\":%.3e,"
+                "\"max_epoch_difference_s\":%.3e}\n",
+                catalog.getSize(), catalog.getRejected(), mismatches,
+                maxDay, maxN, maxE, maxI, maxB, maxEpoch);
+
+    const unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+    {
+        ThreadPool pool(std::max(2u, hardware));
+        TLECatalog parallel;
+        parallel.read(pool, INPUT);
+        std::printf("{\"accuracy\":\"TLECatalog::read(pool)\",\"threads\":%u,\"records\":%zu,"
+                    "\"identical_to_serial\":%s}\n",
+                    pool.getNbThreads(), parallel.getSize(), identical(catalog, parallel) ? "true" : "false");
+    }
+    std::fflush(stdout);
+
+    std::vector<int> numbers;
+    std::vector<double> meanMotions;
+    Benchmark::measure("getline+stod", NB_RECORDS, [&] {
+        return static_cast<long long>(parseLines(numbers, meanMotions));
+    });
+
+    Benchmark::measure("TLECatalog::read", NB_RECORDS, [&] {
+        catalog.read(INPUT);
+        return static_cast<long long>(catalog.getSize());
+    });
+
+    for (unsigned nbThreads = 1; ; nbThreads = std::min(2 * nbThreads, hardware)) {
+        ThreadPool pool(nbThreads);
+        char name[128];
+        std::snprintf(name, sizeof(name), "TLECatalog::read(pool)/threads=%u", nbThreads);
+        Benchmark::measure(name, NB_RECORDS, [&] {
+            catalog.read(pool, INPUT);
+            return static_cast<long long>(catalog.getSize());
+        });
+        if (nbThreads == hardware) {
+            break;
+        }
+    }
+
+    std::remove(INPUT);
+    return 0;
+}
@@ -0,0 +1,405 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "time/BasicDateComponents.h"
+#include "time/ChronoConversions.h"
+#include "time/DateComponents.h"
+#include "time/DateTimeComponents.h"
+#include "time/DateTimeSorter.h"
+#include "time/TimeComponents.h"
+#include "time/UTCScale.h"
+#include "time/WallClock.h"
+#include "utils/Instrumentation.h"
+#include "BenchmarkUtils.h"
+
+/** Benchmark of the time subsystem core operations.
+ * <p>Each operation is measured on fixed-seed workloads drawn from two
+ * distributions of dates: a modern one (1950 to 2050, all gregorian) and
+ * a historical one (from the julian epoch on, exercising the proleptic
+ * julian, julian and gregorian calendars).</p>
+ * <p>Results are printed as one JSON object per line.</p>
+ */
+
+namespace {
+
+    /** Number of elements in each workload. */
+    const size_t SIZE = 1 << 20;
+
+    /** Distribution of dates. */
+    struct Distribution
+    {
+        /** Name used in results. */
+        const char* name;
+
+        /** Seed of the random generator. */
+        unsigned long long seed;
+
+        /** Smallest day offset with respect to J2000. */
+        int minOffset;
+
+        /** Largest day offset with respect to J2000. */
+        int maxOffset;
+    };
+
+    /** Workload for one distribution. */
+    struct Workload
+    {
+        /** Day offsets with respect to J2000. */
+        std::vector<int> offsets;
+
+        /** Dates corresponding to the offsets. */
+        std::vector<DateComponents> dates;
+
+        /** Seconds in day. */
+        std::vector<double> seconds;
+
+        /** Date/times built from dates and seconds. */
+        std::vector<DateTimeComponents> dateTimes;
+    };
+
+    /** Build a workload.
+     * @param distribution distribution of dates
+     * @return workload
+     */
+    Workload buildWorkload(const Distribution& distribution)
+    {
+        std::mt19937_64 rng(distribution.seed);
+        std::uniform_int_distribution<int> days(distribution.minOffset, distribution.maxOffset);
+        std::uniform_real_distribution<double> seconds(0.0, 86400.0);
+
+        Workload workload;
+        workload.offsets.reserve(SIZE);
+        workload.dates.reserve(SIZE);
+        workload.seconds.reserve(SIZE);
+        workload.dateTimes.reserve(SIZE);
+        for (size_t i = 0; i < SIZE; ++i) {
+            const int offset = days(rng);
+            const double second = seconds(rng);
+            workload.offsets.push_back(offset);
+            workload.dates.push_back(DateComponents(offset));
+            workload.seconds.push_back(second);
+            workload.dateTimes.push_back(DateTimeComponents(workload.dates.back(), TimeComponents(second)));
+        }
+        return workload;
+    }
+
+    /** Build a measurement name.
+     * @param buffer buffer where to store the name
+     * @param size buffer size
+     * @param operation operation name
+     * @param distribution distribution of dates
+     * @return name
+     */
+    const char* name(char* buffer, size_t size, const char* operation, const Distribution& distribution)
+    {
+        std::snprintf(buffer, size, "%s/%s", operation, distribution.name);
+        return buffer;
+    }
+
+    /** Run all date-dependent measurements for one distribution.
+     * @param distribution distribution of dates
+     */
+    void runDistribution(const Distribution& distribution)
+    {
+        const Workload workload = buildWorkload(distribution);
+        char buffer[128];
+
+        Benchmark::measure(name(buffer, sizeof(buffer), "DateComponents(offset)", distribution), SIZE,
+                           [&workload] {
+                               long long checksum = 0;
+                               for (int offset : workload.offsets) {
+                                   const DateComponents date(offset);
+                                   checksum += date.getYear() * 512 + date.getMonth() * 32 + date.getDay();
+                               }
+                               return checksum;
+                           });
+
+        Benchmark::measure(name(buffer, sizeof(buffer), "GregorianDateComponents(offset)", distribution), SIZE,
+                           [&workload] {
+                               long long checksum = 0;
+                               for (int offset : workload.offsets) {
+                                   const GregorianDateComponents date(offset);
+                                   checksum += date.getYear() * 512 + date.getMonth() * 32 + date.getDay();
+                               }
+                               return checksum;
+                           });
+
+        Benchmark::measure(name(buffer, sizeof(buffer), "DateComponents::getJ2000Day", distribution), SIZE,
+                           [&workload] {
+                               long long checksum = 0;
+                               for (const DateComponents& date : workload.dates) {
+                                   checksum += date.getJ2000Day();
+                               }
+                               return checksum;
+                           });
+
+        std::vector<int> years;
+        std::vector<int> dayNumbers;
+        for (const DateComponents& date : workload.dates) {
+            years.push_back(date.getYear());
+            dayNumbers.push_back(date.getDayOfYear());
+        }
+        Benchmark::measure(name(buffer, sizeof(buffer), "DateComponents(year, dayNumber)", distribution), SIZE,
+                           [&years, &dayNumbers] {
+                               long long checksum = 0;
+                               for (size_t i = 0; i < SIZE; ++i) {
+                                   const DateComponents date(years[i], dayNumbers[i]);
+                                   checksum += date.getMonth() * 32 + date.getDay();
+                               }
+                               return checksum;
+                           });
+
+        std::vector<DateComponents> ordinalDates(SIZE);
+        Benchmark::measure(name(buffer, sizeof(buffer), "DateComponents::createFromOrdinalDates", distribution), SIZE,
+                           [&years, &dayNumbers, &ordinalDates] {
+                               DateComponents::createFromOrdinalDates(years.data(), dayNumbers.data(), SIZE,
+                                                                      ordinalDates.data());
+                               return static_cast<long long>(ordinalDates.back().getDay());
+                           });
+
+        Benchmark::measure(name(buffer, sizeof(buffer), "DateComponents::getDayOfYear", distribution), SIZE,
+                           [&workload] {
+                               long long checksum = 0;
+                               for (const DateComponents& date : workload.dates) {
+                                   checksum += date.getDayOfYear();
+                               }
+                               return checksum;
+                           });
+
+        std::vector<int> daysOfYear(SIZE);
+        Benchmark::measure(name(buffer, sizeof(buffer), "DateComponents::getDaysOfYear", distribution), SIZE,
+                           [&workload, &daysOfYear] {
+                               DateComponents::getDaysOfYear(workload.dates.data(), SIZE, daysOfYear.data());
+                               return static_cast<long long>(daysOfYear.back());
+                           });
+
+        Benchmark::measure(name(buffer, sizeof(buffer), "DateComponents::getCalendarWeek", distribution), SIZE,
+                           [&workload] {
+                               long long checksum = 0;
+                               for (const DateComponents& date : workload.dates) {
+                                   checksum += date.getCalendarWeek();
+                               }
+                               return checksum;
+                           });
+
+        Benchmark::measure(name(buffer, sizeof(buffer), "GregorianDateComponents::getCalendarWeek", distribution), SIZE,
+                           [&workload] {
+                               long long checksum = 0;
+                               for (int offset : workload.offsets) {
+                                   checksum += GregorianDateComponents(offset).getCalendarWeek();
+                               }
+                               return checksum;
+                           });
+
+        Benchmark::measure(name(buffer, sizeof(buffer), "DateTimeComponents::offsetFrom", distribution), SIZE,
+                           [&workload] {
+                               double sum = 0;
+                               const DateTimeComponents* dt = workload.dateTimes.data();
+                               for (size_t i = 1; i < SIZE; ++i) {
+                                   sum += std::abs(dt[i].offsetFrom(dt[i - 1]));
+                               }
+                               sum += std::abs(dt[0].offsetFrom(dt[SIZE - 1]));
+                               return static_cast<long long>(sum);
+                           });
+
+        std::vector<DateTimeComponents> sorted;
+        auto reset = [&sorted, &workload] {
+            sorted = workload.dateTimes;
+        };
+        auto checksum = [&sorted] {
+            return static_cast<long long>(sorted.front().getDate().getJ2000Day()) * 3 +
+                   sorted[SIZE / 2].getDate().getJ2000Day() * 5 +
+                   sorted.back().getDate().getJ2000Day() * 7;
+        };
+        Benchmark::measure(name(buffer, sizeof(buffer), "sort/std::sort", distribution), SIZE, reset,
+                           [&sorted, &checksum] {
+                               std::sort(sorted.begin(), sorted.end());
+                               return checksum();
+                           });
+        Benchmark::measure(name(buffer, sizeof(buffer), "sort/DateTimeSorter", distribution), SIZE, reset,
+                           [&sorted, &checksum] {
+                               DateTimeSorter::sort(sorted.data(), sorted.size());
+                               return checksum();
+                           });
+    }
+
+    /** Run the time of day measurements. */
+    void runTimeOfDay()
+    {
+        std::mt19937_64 rng(20240301);
+        std::uniform_real_distribution<double> seconds(0.0, 86400.0);
+        std::vector<int> wholeSeconds;
+        std::vector<double> fractions;
+        std::vector<double> secondsInDay;
+        for (size_t i = 0; i < SIZE; ++i) {
+            const double s = seconds(rng);
+            wholeSeconds.push_back(static_cast<int>(std::floor(s)));
+            fractions.push_back(s - std::floor(s));
+            secondsInDay.push_back(s);
+        }
+
+        Benchmark::measure("TimeComponents::fromSeconds/uniform", SIZE,
+                           [&wholeSeconds, &fractions] {
+                               long long checksum = 0;
+                               for (size_t i = 0; i < SIZE; ++i) {
+                                   const TimeComponents time =
+                                       TimeComponents::fromSeconds(wholeSeconds[i], fractions[i], 0.0, 60);
+                                   checksum += time.getHour() * 60 + time.getMinute();
+                               }
+                               return checksum;
+                           });
+
+        Benchmark::measure("TimeComponents(secondInDay)/uniform", SIZE,
+                           [&secondsInDay] {
+                               long long checksum = 0;
+                               for (double s : secondsInDay) {
+                                   const TimeComponents time(s);
+                                   checksum += time.getHour() * 60 + time.getMinute();
+                               }
+                               return checksum;
+                           });
+    }
+
+    /** Run the std::chrono conversions measurements. */
+    void runChrono()
+    {
+        // a request stream: about one time stamp every 10 ms, from 2024-01-01
+        std::mt19937_64 rng(20240401);
+        std::exponential_distribution<double> gaps(100.0);
+        std::vector<ChronoConversions::SysNanos> times;
+        ChronoConversions::SysNanos t{ std::chrono::seconds(1704067200) };
+        for (size_t i = 0; i < SIZE; ++i) {
+            times.push_back(t);
+            t += std::chrono::nanoseconds(static_cast<long long>(1.0e9 * gaps(rng)));
+        }
+        std::vector<DateTimeComponents> dateTimes(SIZE, DateTimeComponents::JULIAN_EPOCH);
+        std::vector<ChronoConversions::SysNanos> back(SIZE);
+
+        Benchmark::measure("ChronoConversions::toDateTimeComponents/stream", SIZE,
+                           [&times, &dateTimes] {
+                               for (size_t i = 0; i < SIZE; ++i) {
+                                   dateTimes[i] = ChronoConversions::toDateTimeComponents(times[i]);
+                               }
+                               return static_cast<long long>(dateTimes.back().getDate().getDay());
+                           });
+        Benchmark::measure("ChronoConversions::toDateTimeComponents(batch)/stream", SIZE,
+                           [&times, &dateTimes] {
+                               ChronoConversions::toDateTimeComponents(times.data(), SIZE, dateTimes.data());
+                               return static_cast<long long>(dateTimes.back().getDate().getDay());
+                           });
+        Benchmark::measure("ChronoConversions::toSysTimes(batch)/stream", SIZE,
+                           [&dateTimes, &back] {
+                               ChronoConversions::toSysTimes(dateTimes.data(), SIZE, back.data());
+                               return static_cast<long long>(back.back().time_since_epoch().count() % 1000000007);
+                           });
+    }
+
+    /** Run the leap seconds aware UTC decoding measurements. */
+    void runUTC()
+    {
+        // sorted TAI times from 1972-01-01 to 2024-01-01, crossing all leap seconds
+        const UTCScale utc;
+        std::mt19937_64 rng(20240501);
+        std::uniform_int_distribution<long long> uniform(-10227 * 86400LL, 8766 * 86400LL);
+        std::vector<LinearTime> times;
+        for (size_t i = 0; i < SIZE; ++i) {
+            times.push_back(LinearTime(INT64_C(1000000000) * uniform(rng) + static_cast<int64_t>(rng() % 1000000000)));
+        }
+        std::sort(times.begin(), times.end(),
+                  [](const LinearTime& a, const LinearTime& b) { return a.getNanos() < b.getNanos(); });
+        std::vector<DateTimeComponents> dateTimes(SIZE, DateTimeComponents::JULIAN_EPOCH);
+        std::vector<TimeComponents> timesOfDay(SIZE);
+
+        Benchmark::measure("UTCScale::getComponents/sorted", SIZE,
+                           [&utc, &times, &dateTimes] {
+                               for (size_t i = 0; i < SIZE; ++i) {
+                                   dateTimes[i] = utc.getComponents(times[i]);
+                               }
+                               return static_cast<long long>(dateTimes.back().getTime().getSecond());
+                           });
+        Benchmark::measure("UTCScale::getComponents(batch)/sorted", SIZE,
+                           [&utc, &times, &dateTimes] {
+                               utc.getComponents(times.data(), SIZE, dateTimes.data());
+                               return static_cast<long long>(dateTimes.back().getTime().getSecond());
+                           });
+        Benchmark::measure("UTCScale::getTimeComponents(batch)/sorted", SIZE,
+                           [&utc, &times, &timesOfDay] {
+                               utc.getTimeComponents(times.data(), SIZE, timesOfDay.data());
+                               return static_cast<long long>(timesOfDay.back().getSecond());
+                           });
+    }
+
+    /** Run the current time measurements. */
+    void runWallClock()
+    {
+        const size_t nbCalls = 1 << 22;
+        Benchmark::measure("std::chrono::system_clock::now", nbCalls,
+                           [nbCalls] {
+                               long long checksum = 0;
+                               for (size_t i = 0; i < nbCalls; ++i) {
+                                   checksum += std::chrono::system_clock::now().time_since_epoch().count() & 0xFF;
+                               }
+                               return checksum;
+                           });
+
+        const WallClock::Source sources[] = { WallClock::REALTIME, WallClock::TAI, WallClock::TSC };
+        const char* names[] = { "REALTIME", "TAI", "TSC" };
+        for (int k = 0; k < 3; ++k) {
+            if (!WallClock::isAvailable(sources[k])) {
+                continue;
+            }
+            const WallClock clock(sources[k]);
+            char buffer[128];
+            std::snprintf(buffer, sizeof(buffer), "WallClock::now/%s", names[k]);
+            Benchmark::measure(buffer, nbCalls,
+                               [&clock, nbCalls] {
+                                   long long checksum = 0;
+                                   for (size_t i = 0; i < nbCalls; ++i) {
+                                       checksum += clock.now().getNanos() & 0xFF;
+                                   }
+                                   return checksum;
+                               });
+            std::snprintf(buffer, sizeof(buffer), "WallClock::nowComponents/%s", names[k]);
+            Benchmark::measure(buffer, nbCalls,
+                               [&clock, nbCalls] {
+                                   long long checksum = 0;
+                                   for (size_t i = 0; i < nbCalls; ++i) {
+                                       checksum += clock.nowComponents().getTime().getMinute();
+                                   }
+                                   return checksum;
+                               });
+        }
+    }
+
+}
+
+int main(int argc, char** argv)
+{
+    if (!Benchmark::parseArguments(argc, argv)) {
+        return 1;
+    }
+
+    // 1950-01-01 to 2050-12-31
+    const Distribution modern = { "modern", 20240101, -18262, 18627 };
+    runDistribution(modern);
+
+    // julian epoch (-4712-01-01) to 2099-12-31
+    const Distribution historical = { "historical", 20240201, -2451545, 36524 };
+    runDistribution(historical);
+
+    runTimeOfDay();
+
+    runChrono();
+
+    runUTC();
+
+    runWallClock();
+
+#ifdef ORECPP_INSTRUMENTATION
+    Instrumentation::writeReport(stderr);
+#endif
+
+    return 0;
+}
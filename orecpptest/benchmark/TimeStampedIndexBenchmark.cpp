@@ -0,0 +1,120 @@
+#include <cstdio>
+#include <map>
+#include <random>
+#include <vector>
+#include "time/DateTimeComponents.h"
+#include "time/LinearTime.h"
+#include "time/TimeStampedIndex.h"
+#include "BenchmarkUtils.h"
+
+/** Benchmark of record lookups by epoch: TimeStampedIndex versus std::map.
+ * <p>Results are printed as one JSON object per line.</p>
+ */
+
+namespace {
+
+    /** Time a lookup loop.
+     * @param name benchmark name
+     * @param queries query epochs
+     * @param lookup lookup function returning a record index
+     */
+    template<typename Query, typename Lookup>
+    void run(const char* name, const std::vector<Query>& queries, Lookup lookup)
+    {
+        Benchmark::measure(name, queries.size(), [&queries, &lookup] {
+            long long checksum = 0;
+            for (const Query& q : queries) {
+                checksum += lookup(q);
+            }
+            return checksum;
+        });
+    }
+
+    /** Run all lookups for one records layout.
+     * @param layout layout name
+     * @param stamps sorted record time stamps
+     * @param rng random generator
+     */
+    void runLayout(const char* layout, const std::vector<DateTimeComponents>& stamps, std::mt19937_64& rng)
+    {
+        const size_t nbQueries = 1000000;
+
+        std::map<DateTimeComponents, long> map;
+        std::vector<LinearTime> times;
+        std::vector<long> values;
+        for (size_t i = 0; i < stamps.size(); ++i) {
+            map.emplace(stamps[i], static_cast<long>(i));
+            times.push_back(LinearTime(stamps[i]));
+            values.push_back(static_cast<long>(i));
+        }
+        const TimeStampedIndex<long> index(times, values);
+
+        // random and monotone queries spanning the records
+        const double span = times.back().durationFrom(times.front());
+        std::uniform_real_distribution<double> offsets(0.0, span);
+        std::vector<DateTimeComponents> randomComponents;
+        std::vector<DateTimeComponents> monotoneComponents;
+        for (size_t i = 0; i < nbQueries; ++i) {
+            randomComponents.push_back(times.front().shiftedBy(offsets(rng)).getComponents());
+            monotoneComponents.push_back(times.front().shiftedBy(span * i / nbQueries).getComponents());
+        }
+        std::vector<LinearTime> randomTimes(randomComponents.begin(), randomComponents.end());
+        std::vector<LinearTime> monotoneTimes(monotoneComponents.begin(), monotoneComponents.end());
+
+        auto mapLookup = [&map](const DateTimeComponents& q) {
+            auto it = map.upper_bound(q);
+            return (it == map.begin()) ? -1L : (--it)->second;
+        };
+        auto indexLookup = [&index](const LinearTime& q) {
+            return index.floorIndex(q);
+        };
+        auto hintLookup = [&index](const LinearTime& q) {
+            const long* v = index.findValid(q);
+            return (v == nullptr) ? -1L : *v;
+        };
+
+        char name[128];
+        std::snprintf(name, sizeof(name), "%s/random/std_map", layout);
+        run(name, randomComponents, mapLookup);
+        std::snprintf(name, sizeof(name), "%s/random/index", layout);
+        run(name, randomTimes, indexLookup);
+        std::snprintf(name, sizeof(name), "%s/monotone/std_map", layout);
+        run(name, monotoneComponents, mapLookup);
+        std::snprintf(name, sizeof(name), "%s/monotone/index", layout);
+        run(name, monotoneTimes, indexLookup);
+        std::snprintf(name, sizeof(name), "%s/monotone/index_hint", layout);
+        run(name, monotoneTimes, hintLookup);
+    }
+
+}
+
+int main(int argc, char** argv)
+{
+    if (!Benchmark::parseArguments(argc, argv)) {
+        return 1;
+    }
+
+    std::mt19937_64 rng(20240101);
+    const size_t nbRecords = 20000;
+
+    // daily records, as in EOP tables
+    std::vector<DateTimeComponents> uniform;
+    for (size_t i = 0; i < nbRecords; ++i) {
+        uniform.push_back(DateTimeComponents(DateComponents(DateComponents::MODIFIED_JULIAN_EPOCH,
+                                                            40000 + static_cast<int>(i)),
+                                             TimeComponents::H00));
+    }
+    runLayout("uniform", uniform, rng);
+
+    // irregular records, as in maneuver or ephemeris segment lists
+    std::vector<DateTimeComponents> irregular;
+    std::exponential_distribution<double> gaps(1.0 / 3600.0);
+    DateTimeComponents current(1990, 1, 1);
+    for (size_t i = 0; i < nbRecords; ++i) {
+        irregular.push_back(current);
+        current = DateTimeComponents(current, 1.0 + gaps(rng));
+    }
+    runLayout("irregular", irregular, rng);
+
+    return 0;
+}
@@ -0,0 +1,118 @@
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <fcntl.h>
+#include "time/TimestampTranscoder.h"
+#include "utils/ThreadPool.h"
+#include "BenchmarkUtils.h"
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+/** Throughput benchmark of the timestamp column transcoder.
+ * <p>A synthetic CSV file mixing ISO-8601, year/day and MJD timestamps is
+ * generated in the working directory, then transcoded to the null device as
+ * text and binary, with one thread and with one thread per core. Results are
+ * printed as one JSON object per line, operations being input lines.</p>
+ */
+
+namespace {
+
+    /** Number of lines of the generated file. */
+    const size_t NB_LINES = 1 << 20;
+
+    /** Path of the generated file. */
+    const char* const INPUT = "TranscoderBenchmark.tmp.csv";
+
+    /** Generate the input file.
+     * @return true if the file was written
+     */
+    bool generate()
+    {
+        FILE* out = std::fopen(INPUT, "w");
+        if (out == nullptr) {
+            return false;
+        }
+        std::mt19937_64 rng(20240701);
+        std::uniform_int_distribution<int> years(1990, 2030);
+        std::uniform_int_distribution<int> days(1, 365);
+        std::uniform_int_distribution<int> seconds(0, 86399);
+        std::uniform_int_distribution<int> millis(0, 999);
+        for (size_t i = 0; i < NB_LINES; ++i) {
+            const int s = seconds(rng);
+            switch (i % 3) {
+                case 0:
+                    std::fprintf(out, "%zu,%04d-%02d-%02dT%02d:%02d:%02d.%03dZ,OK\n", i, years(rng),
+                                 1 + days(rng) % 12, 1 + days(rng) % 28, s / 3600, (s / 60) % 60, s % 60, millis(rng));
+                    break;
+                case 1:
+                    std::fprintf(out, "%zu,%04d %03d %02d:%02d:%02d.%03d,OK\n", i, years(rng), days(rng),
+                                 s / 3600, (s / 60) % 60, s % 60, millis(rng));
+                    break;
+                default:
+                    std::fprintf(out, "%zu,%d.%06d,OK\n", i, 47000 + days(rng) * 40, s * 11);
+                    break;
+            }
+        }
+        return std::fclose(out) == 0;
+    }
+
+    /** Measure the transcoding of the file.
+     * @param name measurement name
+     * @param nbThreads number of threads
+     * @param output output kind
+     */
+    void run(const char* name, unsigned nbThreads, TimestampTranscoder::Output output)
+    {
+        ThreadPool pool(nbThreads);
+        TimestampTranscoder transcoder(pool);
+        transcoder.setColumn(1, ',');
+        transcoder.setOutput(output, BinaryTimeFormat::UTC);
+        Benchmark::measure(name, NB_LINES, [&transcoder] {
+#ifdef _WIN32
+            const int fd = _open("NUL", _O_WRONLY);
+#else
+            const int fd = open("/dev/null", O_WRONLY);
+#endif
+            transcoder.transcodeFile(INPUT, fd);
+#ifdef _WIN32
+            _close(fd);
+#else
+            close(fd);
+#endif
+            return static_cast<long long>(transcoder.getStatistics().converted);
+        });
+    }
+
+}
+
+int main(int argc, char** argv)
+{
+    if (!Benchmark::parseArguments(argc, argv)) {
+        return 1;
+    }
+    if (!generate()) {
+        std::fprintf(stderr, "cannot write %s\n", INPUT);
+        return 1;
+    }
+
+    const unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+    char name[128];
+    std::snprintf(name, sizeof(name), "TimestampTranscoder/text/threads=1");
+    run(name, 1, TimestampTranscoder::TEXT);
+    std::snprintf(name, sizeof(name), "TimestampTranscoder/binary/threads=1");
+    run(name, 1, TimestampTranscoder::BINARY);
+    if (hardware > 1) {
+        std::snprintf(name, sizeof(name), "TimestampTranscoder/text/threads=%u", hardware);
+        run(name, hardware, TimestampTranscoder::TEXT);
+        std::snprintf(name, sizeof(name), "TimestampTranscoder/binary/threads=%u", hardware);
+        run(name, hardware, TimestampTranscoder::BINARY);
+    }
+
+    std::remove(INPUT);
+    return 0;
+}
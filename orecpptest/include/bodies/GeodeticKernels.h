@@ -0,0 +1,155 @@
+#ifndef _GEODETIC_KERNELS_H_
+#define _GEODETIC_KERNELS_H_
+
+#include <stddef.h>
+#include <cmath>
+#include "utils/MathUtils.h"
+
+/** Conversion kernels between body-fixed cartesian and geodetic coordinates.
+ * <p>The kernels are inline functions taking the ellipsoid parameters as
+ * arguments, so callers passing compile-time constants (see {@link
+ * ReferenceEllipsoid}) get them folded in, while {@link OneAxisEllipsoid}
+ * passes its fields. Batch kernels use structure of arrays layouts and
+ * straight loops without calls between points, arrays may not overlap.</p>
+ * <p>The cartesian to geodetic conversion is the closed-form method of
+ * H. Vermeille, "An analytical method to transform geocentric into
+ * geodetic coordinates", Journal of Geodesy 85, 2011, which is exact (no
+ * iteration) everywhere including inside the evolute of the meridian
+ * ellipse, near the body center.</p>
+ */
+struct GeodeticKernels
+{
+    /** Convert one geodetic point to cartesian coordinates.
+     * @param a equatorial radius (m)
+     * @param e2 square of the first eccentricity
+     * @param latitude geodetic latitude (rad)
+     * @param longitude longitude (rad)
+     * @param altitude altitude (m)
+     * @param x placeholder for the abscissa (m)
+     * @param y placeholder for the ordinate (m)
+     * @param z placeholder for the height (m)
+     */
+    static inline void toCartesian(double a, double e2,
+                                   double latitude, double longitude, double altitude,
+                                   double& x, double& y, double& z)
+    {
+        const double sinPhi = std::sin(latitude);
+        const double cosPhi = std::cos(latitude);
+        const double n      = a / std::sqrt(1.0 - e2 * sinPhi * sinPhi);
+        const double r      = (n + altitude) * cosPhi;
+        x = r * std::cos(longitude);
+        y = r * std::sin(longitude);
+        z = (n * (1.0 - e2) + altitude) * sinPhi;
+    }
+
+    /** Convert cartesian coordinates to one geodetic point.
+     * @param a equatorial radius (m)
+     * @param e2 square of the first eccentricity
+     * @param x abscissa (m)
+     * @param y ordinate (m)
+     * @param z height (m)
+     * @param latitude placeholder for the geodetic latitude (rad)
+     * @param longitude placeholder for the longitude (rad)
+     * @param altitude placeholder for the altitude (m)
+     */
+    static inline void toGeodetic(double a, double e2,
+                                  double x, double y, double z,
+                                  double& latitude, double& longitude, double& altitude)
+    {
+        const double e4       = e2 * e2;
+        const double invA2    = 1.0 / (a * a);
+        const double rho2     = x * x + y * y;
+        const double p        = rho2 * invA2;
+        const double q        = (1.0 - e2) * z * z * invA2;
+        const double r        = (p + q - e4) / 6.0;
+        const double evolute  = 8.0 * r * r * r + e4 * p * q;
+        longitude = std::atan2(y, x);
+
+        if (evolute > 0.0 || q != 0.0) {
+            double u;
+            if (evolute > 0.0) {
+                // outside of the evolute, the general case
+                const double rad1 = std::sqrt(evolute);
+                const double rad2 = std::sqrt(e4 * p * q);
+                if (evolute > 10.0 * e2) {
+                    const double rad3 = std::cbrt((rad1 + rad2) * (rad1 + rad2));
+                    u = r + 0.5 * rad3 + 2.0 * r * r / rad3;
+                }
+                else {
+                    u = r + 0.5 * std::cbrt((rad1 + rad2) * (rad1 + rad2)) +
+                            0.5 * std::cbrt((rad1 - rad2) * (rad1 - rad2));
+                }
+            }
+            else {
+                // inside of the evolute, less than about 43 km from the body center on earth
+                const double rad1 = std::sqrt(-evolute);
+                const double rad2 = std::sqrt(-8.0 * r * r * r);
+                const double rad3 = std::sqrt(e4 * p * q);
+                const double atanVal = std::atan2(rad3, rad1 + rad2) * 2.0 / 3.0;
+                u = -4.0 * r * std::sin(atanVal) * std::cos(MathUtils::PI / 6.0 + atanVal);
+            }
+            const double v      = std::sqrt(u * u + e4 * q);
+            const double w      = e2 * (u + v - q) / (2.0 * v);
+            const double k      = (u + v) / (std::sqrt(w * w + u + v) + w);
+            const double d      = k * std::sqrt(rho2) / (k + e2);
+            const double sqrtDZ = std::sqrt(d * d + z * z);
+            altitude = (k + e2 - 1.0) * sqrtDZ / k;
+            latitude = 2.0 * std::atan2(z, sqrtDZ + d);
+        }
+        else if (p > 0.0) {
+            // equatorial plane inside the evolute, the closest surface points are off the equator
+            // (one of the two symmetric solutions is returned)
+            const double cos2 = p * (1.0 - e2) / (e2 * (e2 - p));
+            const double cosPhi = std::sqrt(cos2);
+            latitude = std::atan2(std::sqrt(1.0 - cos2), cosPhi);
+            altitude = std::sqrt(rho2) / cosPhi - a / std::sqrt(1.0 - e2 * (1.0 - cos2));
+        }
+        else {
+            // body center, the closest surface points are the poles
+            latitude = MathUtils::SEMI_PI;
+            altitude = -a * std::sqrt(1.0 - e2);
+        }
+    }
+
+    /** Convert geodetic points to cartesian coordinates.
+     * @param a equatorial radius (m)
+     * @param e2 square of the first eccentricity
+     * @param latitudes geodetic latitudes (rad)
+     * @param longitudes longitudes (rad)
+     * @param altitudes altitudes (m)
+     * @param count number of points
+     * @param x placeholder for the abscissas (m)
+     * @param y placeholder for the ordinates (m)
+     * @param z placeholder for the heights (m)
+     */
+    static inline void toCartesian(double a, double e2,
+                                   const double* latitudes, const double* longitudes, const double* altitudes,
+                                   size_t count, double* x, double* y, double* z)
+    {
+        for (size_t i = 0; i < count; ++i) {
+            toCartesian(a, e2, latitudes[i], longitudes[i], altitudes[i], x[i], y[i], z[i]);
+        }
+    }
+
+    /** Convert cartesian coordinates to geodetic points.
+     * @param a equatorial radius (m)
+     * @param e2 square of the first eccentricity
+     * @param x abscissas (m)
+     * @param y ordinates (m)
+     * @param z heights (m)
+     * @param count number of points
+     * @param latitudes placeholder for the geodetic latitudes (rad)
+     * @param longitudes placeholder for the longitudes (rad)
+     * @param altitudes placeholder for the altitudes (m)
+     */
+    static inline void toGeodetic(double a, double e2,
+                                  const double* x, const double* y, const double* z,
+                                  size_t count, double* latitudes, double* longitudes, double* altitudes)
+    {
+        for (size_t i = 0; i < count; ++i) {
+            toGeodetic(a, e2, x[i], y[i], z[i], latitudes[i], longitudes[i], altitudes[i]);
+        }
+    }
+};
+
+#endif
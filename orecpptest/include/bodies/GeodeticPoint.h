@@ -0,0 +1,48 @@
+#ifndef _GEODETIC_POINT_H_
+#define _GEODETIC_POINT_H_
+
+/** Point location relative to a 2D body surface.
+ * <p>This class is a simple container, it does not provide any processing method.</p>
+ * <p>Instances of this class are guaranteed to be immutable.</p>
+ * @see OneAxisEllipsoid
+ */
+class GeodeticPoint
+{
+public:
+    /** Build a new instance.
+     * @param latitude geodetic latitude (rad)
+     * @param longitude geodetic longitude (rad)
+     * @param altitude altitude above the ellipsoid (m)
+     */
+    GeodeticPoint(double latitude, double longitude, double altitude);
+
+    /** Get the latitude.
+     * @return latitude, between -π/2 and +π/2 (rad)
+     */
+    double getLatitude() const;
+
+    /** Get the longitude.
+     * @return longitude, between -π and +π (rad)
+     */
+    double getLongitude() const;
+
+    /** Get the altitude.
+     * @return altitude (m)
+     */
+    double getAltitude() const;
+
+    /** {@inheritDoc} */
+    bool operator == (const GeodeticPoint& other) const;
+
+private:
+    /** Latitude of the point (rad). */
+    double latitude;
+
+    /** Longitude of the point (rad). */
+    double longitude;
+
+    /** Altitude of the point (m). */
+    double altitude;
+};
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef _LOW_PRECISION_EPHEMERIS_H_
+#define _LOW_PRECISION_EPHEMERIS_H_
+
+#include "geometry/Vector3D.h"
+#include "time/LinearTime.h"
+
+/** Analytical low precision Sun and Moon ephemerides.
+ * <p>These are the series of Montenbruck and Gill (Satellite Orbits, 2000,
+ * section 3.3.2), giving geocentric positions with respect to the mean
+ * equator and equinox of J2000 (EME2000). The Sun is accurate to about
+ * 0.1% in distance and 1 arc minute in direction, the Moon to about 500 km
+ * and a few arc minutes, which is enough for third body and solar
+ * radiation pressure perturbations. The difference between the time scale
+ * of the dates and Terrestrial Time is neglected.</p>
+ */
+class LowPrecisionEphemeris
+{
+public:
+    /** Get the position of the Sun.
+     * @param date date
+     * @return geocentric position of the Sun in EME2000 (m)
+     */
+    static Vector3D getSunPosition(const LinearTime& date);
+
+    /** Get the position of the Moon.
+     * @param date date
+     * @return geocentric position of the Moon in EME2000 (m)
+     */
+    static Vector3D getMoonPosition(const LinearTime& date);
+};
+
+#endif
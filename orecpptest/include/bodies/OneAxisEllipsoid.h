@@ -0,0 +1,101 @@
+#ifndef _ONE_AXIS_ELLIPSOID_H_
+#define _ONE_AXIS_ELLIPSOID_H_
+
+#include <stddef.h>
+#include "bodies/GeodeticPoint.h"
+#include "geometry/Vector3D.h"
+#include "utils/EarthModels.h"
+
+/** Modeling of a one-axis ellipsoid.
+ * <p>One-axis ellipsoids is a good approximate model for most planet-size
+ * and larger natural bodies. Coordinates are expressed in the body-fixed
+ * frame, with the Z axis along the rotation axis.</p>
+ * <p>The conversion from cartesian to geodetic coordinates is closed-form
+ * (see {@link GeodeticKernels}). Batch conversions use structure of arrays
+ * layouts. When the ellipsoid is known at compile time, {@link
+ * ReferenceEllipsoid} provides the same batch conversions with the
+ * ellipsoid constants folded in.</p>
+ * <p>Instances of this class are guaranteed to be immutable.</p>
+ */
+class OneAxisEllipsoid
+{
+public:
+    /** Simple constructor.
+     * @param ae equatorial radius (m)
+     * @param f the flattening (f = (a-b)/a)
+     */
+    OneAxisEllipsoid(double ae, double f);
+
+    /** Build the ellipsoid of a model.
+     * @param Model model tag from {@link EarthModels.h}, for example {@link WGS84}
+     * @return ellipsoid of the model
+     */
+    template<typename Model>
+    static OneAxisEllipsoid create()
+    {
+        return OneAxisEllipsoid(Ellipsoid<Model>::EQUATORIAL_RADIUS, Ellipsoid<Model>::FLATTENING);
+    }
+
+    /** Get the equatorial radius of the body.
+     * @return equatorial radius of the body (m)
+     */
+    double getEquatorialRadius() const;
+
+    /** Get the flattening of the body: f = (a-b)/a.
+     * @return the flattening
+     */
+    double getFlattening() const;
+
+    /** Get the polar radius of the body.
+     * @return polar radius of the body (m)
+     */
+    double getPolarRadius() const;
+
+    /** Transform a surface-relative point to a cartesian point.
+     * @param point surface-relative point
+     * @return point at the same location but as a cartesian point
+     */
+    Vector3D transform(const GeodeticPoint& point) const;
+
+    /** Transform a cartesian point to a surface-relative point.
+     * @param point cartesian point
+     * @return point at the same location but as a surface-relative point
+     */
+    GeodeticPoint transform(const Vector3D& point) const;
+
+    /** Transform surface-relative points to cartesian points.
+     * @param latitudes geodetic latitudes (rad)
+     * @param longitudes longitudes (rad)
+     * @param altitudes altitudes (m)
+     * @param count number of points
+     * @param x placeholder for the abscissas (m)
+     * @param y placeholder for the ordinates (m)
+     * @param z placeholder for the heights (m)
+     */
+    void toCartesian(const double* latitudes, const double* longitudes, const double* altitudes, size_t count,
+                     double* x, double* y, double* z) const;
+
+    /** Transform cartesian points to surface-relative points.
+     * @param x abscissas (m)
+     * @param y ordinates (m)
+     * @param z heights (m)
+     * @param count number of points
+     * @param latitudes placeholder for the geodetic latitudes (rad)
+     * @param longitudes placeholder for the longitudes (rad)
+     * @param altitudes placeholder for the altitudes (m)
+     */
+    void toGeodetic(const double* x, const double* y, const double* z, size_t count,
+                    double* latitudes, double* longitudes, double* altitudes) const;
+
+private:
+    /** Equatorial radius. */
+    double ae;
+
+    /** Flattening. */
+    double f;
+
+    /** Eccentricity squared. */
+    double e2;
+};
+
+#endif
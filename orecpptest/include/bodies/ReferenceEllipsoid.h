@@ -0,0 +1,80 @@
+#ifndef _REFERENCE_ELLIPSOID_H_
+#define _REFERENCE_ELLIPSOID_H_
+
+#include <stddef.h>
+#include "bodies/GeodeticKernels.h"
+#include "bodies/OneAxisEllipsoid.h"
+#include "utils/EarthModels.h"
+
+/** Batch geodetic conversions on a reference ellipsoid known at compile time.
+ * <p>This is the counterpart of the {@link OneAxisEllipsoid} batch
+ * conversions for the ellipsoids of {@link EarthModels.h}: the kernels are
+ * instantiated with the radius and eccentricity of the model as constants,
+ * which removes the divisions and the loads of the ellipsoid parameters
+ * from the loops.</p>
+ * @param Model model tag, for example {@link WGS84}
+ */
+template<typename Model>
+class ReferenceEllipsoid
+{
+public:
+    /** Get the ellipsoid as a runtime shape.
+     * @return ellipsoid of the model
+     */
+    static OneAxisEllipsoid getShape()
+    {
+        return OneAxisEllipsoid::create<Model>();
+    }
+
+    /** Transform surface-relative points to cartesian points.
+     * @param latitudes geodetic latitudes (rad)
+     * @param longitudes longitudes (rad)
+     * @param altitudes altitudes (m)
+     * @param count number of points
+     * @param x placeholder for the abscissas (m)
+     * @param y placeholder for the ordinates (m)
+     * @param z placeholder for the heights (m)
+     */
+    static void toCartesian(const double* latitudes, const double* longitudes, const double* altitudes,
+                            size_t count, double* x, double* y, double* z)
+    {
+        GeodeticKernels::toCartesian(Ellipsoid<Model>::EQUATORIAL_RADIUS, Ellipsoid<Model>::E2,
+                                     latitudes, longitudes, altitudes, count, x, y, z);
+    }
+
+    /** Transform cartesian points to surface-relative points.
+     * @param x abscissas (m)
+     * @param y ordinates (m)
+     * @param z heights (m)
+     * @param count number of points
+     * @param latitudes placeholder for the geodetic latitudes (rad)
+     * @param longitudes placeholder for the longitudes (rad)
+     * @param altitudes placeholder for the altitudes (m)
+     */
+    static void toGeodetic(const double* x, const double* y, const double* z, size_t count,
+                           double* latitudes, double* longitudes, double* altitudes)
+    {
+        GeodeticKernels::toGeodetic(Ellipsoid<Model>::EQUATORIAL_RADIUS, Ellipsoid<Model>::E2,
+                                    x, y, z, count, latitudes, longitudes, altitudes);
+    }
+};
+
+/** WGS84 ellipsoid. */
+typedef ReferenceEllipsoid<WGS84> WGS84Ellipsoid;
+
+/** GRS80 ellipsoid. */
+typedef ReferenceEllipsoid<GRS80> GRS80Ellipsoid;
+
+/** GRIM5-C1 ellipsoid. */
+typedef ReferenceEllipsoid<GRIM5C1> GRIM5C1Ellipsoid;
+
+/** IERS 1996 conventions ellipsoid. */
+typedef ReferenceEllipsoid<IERS96> IERS96Ellipsoid;
+
+/** IERS 2003 conventions ellipsoid. */
+typedef ReferenceEllipsoid<IERS2003> IERS2003Ellipsoid;
+
+/** IERS 2010 conventions ellipsoid. */
+typedef ReferenceEllipsoid<IERS2010> IERS2010Ellipsoid;
+
+#endif
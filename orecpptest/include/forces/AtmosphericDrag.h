@@ -0,0 +1,59 @@
+#ifndef _ATMOSPHERIC_DRAG_H_
+#define _ATMOSPHERIC_DRAG_H_
+
+#include "forces/ForceModel.h"
+
+/** Atmospheric drag with an exponential density model.
+ * <p>The density is ρ = ρ₀ exp(-(h - h₀) / H), the altitude h being taken
+ * above a spherical Earth. The atmosphere co-rotates with the Earth, so the
+ * relative velocity is v - ω × r, and the spacecraft is a sphere (cannonball
+ * model): a = -½ ρ Cd (A/m) |v<sub>rel</sub>| v<sub>rel</sub>.</p>
+ * <p>Instances of this class are guaranteed to be immutable.</p>
+ */
+class AtmosphericDrag : public ForceModel
+{
+public:
+    /** Simple constructor.
+     * @param bodyRadius Earth radius (m)
+     * @param rotationRate Earth rotation rate (rad/s)
+     * @param referenceDensity density at the reference altitude (kg/m³)
+     * @param referenceAltitude reference altitude (m)
+     * @param scaleHeight scale height (m)
+     * @param dragCoefficient drag coefficient Cd
+     * @param crossSection cross section (m²)
+     * @param mass spacecraft mass (kg)
+     */
+    AtmosphericDrag(double bodyRadius, double rotationRate,
+                    double referenceDensity, double referenceAltitude, double scaleHeight,
+                    double dragCoefficient, double crossSection, double mass);
+
+    /** Get the density at an altitude.
+     * @param altitude altitude above the spherical Earth (m)
+     * @return density (kg/m³)
+     */
+    double getDensity(double altitude) const;
+
+    /** {@inheritDoc} */
+    void addAcceleration(const LinearTime& date, const double* state, double* acceleration) const override;
+
+private:
+    /** Earth radius. */
+    double bodyRadius;
+
+    /** Earth rotation rate. */
+    double rotationRate;
+
+    /** Density at the reference altitude. */
+    double referenceDensity;
+
+    /** Reference altitude. */
+    double referenceAltitude;
+
+    /** Scale height. */
+    double scaleHeight;
+
+    /** Ballistic factor ½ Cd A / m (m²/kg). */
+    double ballisticFactor;
+};
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef _FORCE_MODEL_H_
+#define _FORCE_MODEL_H_
+
+#include <limits>
+#include "time/LinearTime.h"
+
+/** Perturbing force acting on a spacecraft, for {@link NumericalPropagator}.
+ * <p>The propagator computes the central attraction, then each force model
+ * adds its contribution to the same acceleration buffer, so evaluating the
+ * equations of motion needs no temporary storage.</p>
+ * <p>States are given in an inertial frame centered on the Earth, with its
+ * Z axis along the Earth rotation axis (EME2000 when precession and nutation
+ * are neglected). Force models are called concurrently when several
+ * propagators share them, they must therefore be immutable.</p>
+ */
+class ForceModel
+{
+public:
+    virtual ~ForceModel() = default;
+
+    /** Add the contribution of the force to the acceleration.
+     * @param date current date
+     * @param state position (m) and velocity (m/s), 6 elements
+     * @param acceleration acceleration to add the contribution to (m/s²), 3 elements
+     */
+    virtual void addAcceleration(const LinearTime& date, const double* state, double* acceleration) const = 0;
+
+    /** Get the longest step the integrator may take from a state.
+     * <p>Models whose acceleration changes abruptly, like at shadow
+     * boundaries, return the time left before the next change, so steps
+     * end close to it instead of stepping over it unseen by the error
+     * estimates. The default implementation sets no limit.</p>
+     * @param date current date
+     * @param state position (m) and velocity (m/s), 6 elements
+     * @return longest step duration (s), positive
+     */
+    virtual double getMaxStep(const LinearTime& date, const double* state) const
+    {
+        (void) date;
+        (void) state;
+        return std::numeric_limits<double>::infinity();
+    }
+};
+
+#endif
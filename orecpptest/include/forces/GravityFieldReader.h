@@ -0,0 +1,75 @@
+#ifndef _GRAVITY_FIELD_READER_H_
+#define _GRAVITY_FIELD_READER_H_
+
+#include <stddef.h>
+#include "forces/SphericalHarmonicsField.h"
+
+/** Readers for spherical harmonics gravity field files.
+ * <p>Two formats are supported:</p>
+ * <ul>
+ *   <li>ICGEM, the format of the International Centre for Global Earth
+ *       Models: a header between <code>begin_of_head</code> (optional) and
+ *       <code>end_of_head</code> with at least the
+ *       <code>earth_gravity_constant</code> and <code>radius</code> keywords
+ *       (<code>norm unnormalized</code> is honored), then one
+ *       <code>gfc</code> or <code>gfct</code> line per coefficient. Time
+ *       variable terms (<code>gfct</code> epochs, <code>trnd</code>,
+ *       <code>acos</code>, <code>asin</code>) are ignored, the reference
+ *       coefficients being used,</li>
+ *   <li>SHM, the format of the GFZ EIGEN fields: a first line starting with
+ *       <code>FIRST SHM</code>, an <code>EARTH mu ae</code> line and one
+ *       <code>RECOEF</code> line per normalized coefficient, other lines
+ *       (<code>DOTCOE</code> trends...) being ignored.</li>
+ * </ul>
+ * <p>Files are memory mapped and parsed in a single streaming pass, only the
+ * coefficients up to the requested degree and order are kept. Fortran
+ * exponents (<code>1.0D-06</code>) are accepted.</p>
+ */
+class GravityFieldReader
+{
+public:
+    /** Formats of gravity field files. */
+    enum Format
+    {
+        /** Detect the format from the first lines. */
+        AUTO,
+
+        /** ICGEM format. */
+        ICGEM,
+
+        /** SHM format. */
+        SHM
+    };
+
+    /** Read a gravity field file.
+     * @param path path of the file
+     * @param format file format, {@link #AUTO} for detection
+     * @param maxDegree maximal degree to keep
+     * @param maxOrder maximal order to keep
+     * @param field placeholder for the field, with the degree and order
+     * found in the file up to the maximal ones
+     * @return true if the file could be read and parsed
+     */
+    static bool read(const char* path, Format format, int maxDegree, int maxOrder, SphericalHarmonicsField& field);
+
+    /** Parse gravity field data in memory.
+     * @param begin first character
+     * @param end character after the last one
+     * @param format data format, {@link #AUTO} for detection
+     * @param maxDegree maximal degree to keep
+     * @param maxOrder maximal order to keep
+     * @param field placeholder for the field
+     * @return true if the data could be parsed
+     */
+    static bool parse(const char* begin, const char* end, Format format, int maxDegree, int maxOrder,
+                      SphericalHarmonicsField& field);
+
+    /** Detect the format of gravity field data.
+     * @param begin first character
+     * @param end character after the last one
+     * @return detected format, {@link #AUTO} if none matches
+     */
+    static Format detect(const char* begin, const char* end);
+};
+
+#endif
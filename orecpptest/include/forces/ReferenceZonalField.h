@@ -0,0 +1,83 @@
+#ifndef _REFERENCE_ZONAL_FIELD_H_
+#define _REFERENCE_ZONAL_FIELD_H_
+
+#include <stddef.h>
+#include "forces/ZonalGravityField.h"
+#include "forces/ZonalKernels.h"
+#include "utils/EarthModels.h"
+
+/** Batch zonal accelerations of a gravity field known at compile time.
+ * <p>This is the counterpart of the {@link ZonalGravityField} batch
+ * methods for the fields of {@link EarthModels.h}: the kernels are
+ * instantiated with the radius, gravitational constant and zonal harmonics
+ * of the model as constants.</p>
+ * @param Model model tag, for example {@link EGM96}
+ * @param DEGREE maximal degree, from 2 to the model degree
+ */
+template<typename Model, int DEGREE = ZonalModel<Model>::MAX_DEGREE>
+class ReferenceZonalField
+{
+public:
+    static_assert(DEGREE >= 2 && DEGREE <= ZonalModel<Model>::MAX_DEGREE, "degree not available in the model");
+    static_assert(DEGREE <= ZonalGravityField::MAX_SUPPORTED_DEGREE, "degree not supported by the kernels");
+
+    /** Get the field as a runtime model.
+     * @return zonal field of the model
+     */
+    static ZonalGravityField getField()
+    {
+        return ZonalGravityField::create<Model>(DEGREE);
+    }
+
+    /** Compute the accelerations at several positions.
+     * @param x abscissas (m)
+     * @param y ordinates (m)
+     * @param z heights (m)
+     * @param count number of positions
+     * @param ax placeholder for the accelerations abscissas (m/s²)
+     * @param ay placeholder for the accelerations ordinates (m/s²)
+     * @param az placeholder for the accelerations heights (m/s²)
+     */
+    static void getAccelerations(const double* x, const double* y, const double* z, size_t count,
+                                 double* ax, double* ay, double* az)
+    {
+        ZonalKernels::accelerations<DEGREE>(ZonalModel<Model>::EQUATORIAL_RADIUS, ZonalModel<Model>::MU, J,
+                                            x, y, z, count, ax, ay, az);
+    }
+
+    /** Compute the accelerations and their Jacobians at several positions.
+     * @param x abscissas (m)
+     * @param y ordinates (m)
+     * @param z heights (m)
+     * @param count number of positions
+     * @param ax placeholder for the accelerations abscissas (m/s²)
+     * @param ay placeholder for the accelerations ordinates (m/s²)
+     * @param az placeholder for the accelerations heights (m/s²)
+     * @param jacobians placeholder for the Jacobians (s⁻²), 9 row major elements per position
+     */
+    static void getAccelerations(const double* x, const double* y, const double* z, size_t count,
+                                 double* ax, double* ay, double* az, double* jacobians)
+    {
+        ZonalKernels::accelerations<DEGREE>(ZonalModel<Model>::EQUATORIAL_RADIUS, ZonalModel<Model>::MU, J,
+                                            x, y, z, count, ax, ay, az, jacobians);
+    }
+
+private:
+    /** Zonal harmonics Jn, indexed by degree. */
+    static constexpr double J[] = {
+        0.0, 0.0,
+        ZonalModel<Model>::getJ(2), ZonalModel<Model>::getJ(3), ZonalModel<Model>::getJ(4),
+        ZonalModel<Model>::getJ(5), ZonalModel<Model>::getJ(6)
+    };
+};
+
+/** EGM96 zonal field up to J6. */
+typedef ReferenceZonalField<EGM96> EGM96ZonalField;
+
+/** EIGEN-5C zonal field up to J6. */
+typedef ReferenceZonalField<EIGEN5C> EIGEN5CZonalField;
+
+/** GRIM5-C1 zonal field up to J6. */
+typedef ReferenceZonalField<GRIM5C1> GRIM5C1ZonalField;
+
+#endif
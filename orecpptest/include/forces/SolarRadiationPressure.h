@@ -0,0 +1,68 @@
+#ifndef _SOLAR_RADIATION_PRESSURE_H_
+#define _SOLAR_RADIATION_PRESSURE_H_
+
+#include "forces/ForceModel.h"
+#include "geometry/Vector3D.h"
+
+/** Solar radiation pressure on a spherical spacecraft (cannonball model).
+ * <p>The acceleration is a = Cr (A/m) P₀ (AU / |d|)² d / |d|, d being the
+ * vector from the Sun to the spacecraft and P₀ = 4.56e-6 N/m² the radiation
+ * pressure at one astronomical unit. The acceleration is scaled by the
+ * visible fraction of the solar disk, computed from the overlap of the
+ * apparent disks of the Sun and the Earth (conical shadow with penumbra,
+ * Montenbruck and Gill section 3.4.2), so it is continuous across the
+ * shadow boundaries. The Sun position comes from {@link
+ * LowPrecisionEphemeris}.</p>
+ * <p>The penumbra only lasts a few seconds in low orbits, adaptive steps
+ * much longer than that would step over it without the error estimate
+ * seeing it. {@link #getMaxStep} therefore limits steps to the time left
+ * before the nearest shadow boundary, bounded below by a quarter of the
+ * penumbra crossing time, so steps end at the boundaries and the penumbra
+ * is crossed in a few steps.</p>
+ * <p>Instances of this class are guaranteed to be immutable.</p>
+ */
+class SolarRadiationPressure : public ForceModel
+{
+public:
+    /** Simple constructor.
+     * @param reflectivityCoefficient reflectivity coefficient Cr (1 for a black body, 2 for a mirror)
+     * @param crossSection cross section (m²)
+     * @param mass spacecraft mass (kg)
+     * @param occultingRadius radius of the occulting Earth (m)
+     */
+    SolarRadiationPressure(double reflectivityCoefficient, double crossSection, double mass, double occultingRadius);
+
+    /** Get the visible fraction of the solar disk.
+     * @param position spacecraft position (m)
+     * @param sun Sun position (m)
+     * @return visible fraction of the solar disk, 0 in umbra and 1 in full light
+     */
+    double getLightingRatio(const Vector3D& position, const Vector3D& sun) const;
+
+    /** {@inheritDoc} */
+    void addAcceleration(const LinearTime& date, const double* state, double* acceleration) const override;
+
+    /** {@inheritDoc} */
+    double getMaxStep(const LinearTime& date, const double* state) const override;
+
+    /** Radiation pressure at one astronomical unit (N/m²). */
+    static constexpr double REFERENCE_PRESSURE = 4.56e-6;
+
+private:
+    /** Compute the apparent geometry of the Sun and the Earth.
+     * @param position spacecraft position (m)
+     * @param sun Sun position (m)
+     * @param a placeholder for the apparent radius of the Sun (rad)
+     * @param b placeholder for the apparent radius of the Earth (rad)
+     * @param c placeholder for the apparent separation of their centers (rad)
+     */
+    void computeAngles(const Vector3D& position, const Vector3D& sun, double& a, double& b, double& c) const;
+
+    /** Factor Cr (A/m) P₀ AU² (m⁴/s²). */
+    double factor;
+
+    /** Radius of the occulting Earth. */
+    double occultingRadius;
+};
+
+#endif
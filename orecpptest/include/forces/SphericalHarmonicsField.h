@@ -0,0 +1,180 @@
+#ifndef _SPHERICAL_HARMONICS_FIELD_H_
+#define _SPHERICAL_HARMONICS_FIELD_H_
+
+#include <stddef.h>
+#include <vector>
+#include "geometry/Vector3D.h"
+
+/** Spherical harmonics gravity field, evaluated with the Holmes-Featherstone recursion.
+ * <p>The field holds fully normalized coefficients C̄nm and S̄nm up to some
+ * degree and order and computes the perturbing acceleration, that is the
+ * gradient of the potential without the central (degree 0) and degree 1
+ * terms, in the body-fixed frame.</p>
+ * <p>The evaluation follows S. A. Holmes and W. E. Featherstone, "A unified
+ * approach to the Clenshaw summation and the recursive computation of very
+ * high degree and order normalised associated Legendre functions", Journal
+ * of Geodesy 76, 2002: the Legendre functions are scaled by 1/cos^m(φ) and
+ * by (ae/r)ⁿ, computed column by column (for increasing orders m) with the
+ * standard forward recursion, and the cos^m(φ) factors are applied when the
+ * columns are combined. This keeps high degrees accurate down to the poles,
+ * and longitudes only need one division, cos(mλ) and sin(mλ) being
+ * obtained by recurrence.</p>
+ * <p>The recursion coefficients are computed once, in the constructor, and
+ * stored with the gravity coefficients in contiguous triangular arrays, one
+ * column after the other, so the inner loop of the evaluation reads memory
+ * sequentially. The batch method evaluates {@link #LANES} positions at a
+ * time, sharing all coefficient loads between them, with the lanes as the
+ * innermost loop so the compiler vectorizes it (blocks are wide enough for
+ * that loop not to be fully unrolled, which would defeat vectorization).</p>
+ * <p>Instances of this class are guaranteed to be immutable.</p>
+ * @see GravityFieldReader
+ */
+class SphericalHarmonicsField
+{
+public:
+    /** Build an empty field, with a null acceleration everywhere. */
+    SphericalHarmonicsField();
+
+    /** Simple constructor.
+     * <p>Coefficients are given in triangular arrays, the coefficient of degree
+     * n and order m being at index n (n + 1) / 2 + m. Orders above the
+     * maximal order are ignored.</p>
+     * @param ae equatorial radius (m)
+     * @param mu gravitational constant (m³/s²)
+     * @param degree maximal degree
+     * @param order maximal order, at most degree
+     * @param normalizedC fully normalized cosine coefficients
+     * @param normalizedS fully normalized sine coefficients
+     */
+    SphericalHarmonicsField(double ae, double mu, int degree, int order,
+                            const double* normalizedC, const double* normalizedS);
+
+    /** Get a field with a smaller degree and order.
+     * @param degree maximal degree (clamped to the degree of the instance)
+     * @param order maximal order (clamped to the order of the instance and to degree)
+     * @return truncated field
+     */
+    SphericalHarmonicsField truncate(int degree, int order) const;
+
+    /** Get the equatorial radius.
+     * @return equatorial radius (m)
+     */
+    double getEquatorialRadius() const;
+
+    /** Get the gravitational constant.
+     * @return gravitational constant (m³/s²)
+     */
+    double getMu() const;
+
+    /** Get the maximal degree.
+     * @return maximal degree
+     */
+    int getMaxDegree() const;
+
+    /** Get the maximal order.
+     * @return maximal order
+     */
+    int getMaxOrder() const;
+
+    /** Get a fully normalized cosine coefficient.
+     * @param n degree
+     * @param m order
+     * @return C̄nm, 0 out of the field degree and order
+     */
+    double getNormalizedC(int n, int m) const;
+
+    /** Get a fully normalized sine coefficient.
+     * @param n degree
+     * @param m order
+     * @return S̄nm, 0 out of the field degree and order
+     */
+    double getNormalizedS(int n, int m) const;
+
+    /** Compute the acceleration at one position.
+     * @param position position in the body-fixed frame (m)
+     * @return perturbing acceleration (m/s²)
+     */
+    Vector3D getAcceleration(const Vector3D& position) const;
+
+    /** Compute the accelerations at several positions.
+     * @param x abscissas (m)
+     * @param y ordinates (m)
+     * @param z heights (m)
+     * @param count number of positions
+     * @param ax placeholder for the accelerations abscissas (m/s²)
+     * @param ay placeholder for the accelerations ordinates (m/s²)
+     * @param az placeholder for the accelerations heights (m/s²)
+     */
+    void getAccelerations(const double* x, const double* y, const double* z, size_t count,
+                          double* ax, double* ay, double* az) const;
+
+    /** Number of positions evaluated together by the batch method. */
+    static const int LANES = 32;
+
+private:
+    /** Evaluate the acceleration for a block of positions.
+     * @param B number of positions in the block
+     * @param x abscissas (m)
+     * @param y ordinates (m)
+     * @param z heights (m)
+     * @param ax placeholder for the accelerations abscissas (m/s²)
+     * @param ay placeholder for the accelerations ordinates (m/s²)
+     * @param az placeholder for the accelerations heights (m/s²)
+     */
+    template<int B>
+    void evaluate(const double* x, const double* y, const double* z, double* ax, double* ay, double* az) const;
+
+    /** Get the index of a coefficient in the column arrays.
+     * @param n degree
+     * @param m order
+     * @return index of the coefficient
+     */
+    size_t index(int n, int m) const;
+
+    /** Equatorial radius. */
+    double ae;
+
+    /** Gravitational constant. */
+    double mu;
+
+    /** Maximal degree. */
+    int degree;
+
+    /** Maximal order. */
+    int order;
+
+    /** Number of columns evaluated (the derivatives of the last order need the next column). */
+    int columns;
+
+    /** Fully normalized cosine coefficients, in triangular row major layout. */
+    std::vector<double> normalizedC;
+
+    /** Fully normalized sine coefficients, in triangular row major layout. */
+    std::vector<double> normalizedS;
+
+    /** Index of the first element (n = m) of each column. */
+    std::vector<size_t> columnStart;
+
+    /** Factors of the sectorial recursion, indexed by order. */
+    std::vector<double> sectorial;
+
+    /** Factors of the previous degree term in the column recursion. */
+    std::vector<double> g;
+
+    /** Factors of the second previous degree term in the column recursion. */
+    std::vector<double> h;
+
+    /** Fully normalized cosine coefficients (0 below degree 2). */
+    std::vector<double> c;
+
+    /** Fully normalized sine coefficients (0 below degree 2). */
+    std::vector<double> s;
+
+    /** Cosine coefficients of the previous column, times their latitude derivative factor. */
+    std::vector<double> ec;
+
+    /** Sine coefficients of the previous column, times their latitude derivative factor. */
+    std::vector<double> es;
+};
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef _THIRD_BODY_ATTRACTION_H_
+#define _THIRD_BODY_ATTRACTION_H_
+
+#include "forces/ForceModel.h"
+#include "geometry/Vector3D.h"
+
+/** Third body attraction perturbation.
+ * <p>This is the difference between the attraction of a point mass on the
+ * spacecraft and on the Earth: a = μ (d / |d|³ - s / |s|³), s being the
+ * geocentric position of the body and d = s - r.</p>
+ * <p>The body position is given by a plain function, {@link #sun()} and
+ * {@link #moon()} use {@link LowPrecisionEphemeris}.</p>
+ * <p>Instances of this class are guaranteed to be immutable.</p>
+ */
+class ThirdBodyAttraction : public ForceModel
+{
+public:
+    /** Function giving the geocentric position of the body (m) at a date. */
+    typedef Vector3D (*PositionFunction)(const LinearTime& date);
+
+    /** Simple constructor.
+     * @param mu attraction coefficient of the body (m³/s²)
+     * @param position function giving the geocentric position of the body
+     */
+    ThirdBodyAttraction(double mu, PositionFunction position);
+
+    /** Build the attraction of the Sun.
+     * @return attraction of the Sun, with low precision ephemeris
+     */
+    static ThirdBodyAttraction sun();
+
+    /** Build the attraction of the Moon.
+     * @return attraction of the Moon, with low precision ephemeris
+     */
+    static ThirdBodyAttraction moon();
+
+    /** {@inheritDoc} */
+    void addAcceleration(const LinearTime& date, const double* state, double* acceleration) const override;
+
+private:
+    /** Attraction coefficient of the body. */
+    double mu;
+
+    /** Position of the body. */
+    PositionFunction position;
+};
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef _ZONAL_ATTRACTION_H_
+#define _ZONAL_ATTRACTION_H_
+
+#include "forces/ForceModel.h"
+#include "forces/ZonalGravityField.h"
+
+/** Zonal harmonics perturbation of the Earth gravity field.
+ * <p>Zonal terms do not depend on longitude, so the acceleration computed
+ * by {@link ZonalGravityField} in the body-fixed frame is also the one in
+ * the inertial frame of {@link ForceModel}, without Earth rotation.</p>
+ * <p>Instances of this class are guaranteed to be immutable.</p>
+ */
+class ZonalAttraction : public ForceModel
+{
+public:
+    /** Simple constructor.
+     * @param field zonal gravity field
+     */
+    explicit ZonalAttraction(const ZonalGravityField& field);
+
+    /** Get the gravity field.
+     * @return zonal gravity field
+     */
+    const ZonalGravityField& getField() const;
+
+    /** {@inheritDoc} */
+    void addAcceleration(const LinearTime& date, const double* state, double* acceleration) const override;
+
+private:
+    /** Zonal gravity field. */
+    ZonalGravityField field;
+};
+
+#endif
@@ -0,0 +1,119 @@
+#ifndef _ZONAL_GRAVITY_FIELD_H_
+#define _ZONAL_GRAVITY_FIELD_H_
+
+#include <stddef.h>
+#include "geometry/Vector3D.h"
+#include "utils/EarthModels.h"
+
+/** Zonal harmonics (J2 to J6) perturbing acceleration of a gravity field.
+ * <p>The acceleration is the gradient of the zonal part of the potential,
+ * without the central attraction, in the body-fixed frame (see {@link
+ * ZonalKernels}). Its Jacobian with respect to position is available too,
+ * for variational equations. Batch methods use structure of arrays layouts,
+ * 9 row major elements per position for the Jacobians.</p>
+ * <p>When the field is known at compile time, {@link ReferenceZonalField}
+ * provides the same batch methods with the coefficients folded in.</p>
+ * <p>Instances of this class are guaranteed to be immutable.</p>
+ */
+class ZonalGravityField
+{
+public:
+    /** Simple constructor.
+     * <p>Coefficients above {@link #MAX_SUPPORTED_DEGREE} are ignored.</p>
+     * @param ae equatorial radius (m)
+     * @param mu gravitational constant (m³/s²)
+     * @param unnormalizedZonals un-normalized zonal coefficients Cn,0, indexed by degree
+     * @param maxDegree maximal degree, from 2 to {@link #MAX_SUPPORTED_DEGREE}
+     */
+    ZonalGravityField(double ae, double mu, const double* unnormalizedZonals, int maxDegree);
+
+    /** Build the zonal field of a model.
+     * @param Model model tag from {@link EarthModels.h}, for example {@link EGM96}
+     * @param maxDegree maximal degree, from 2 to the model degree (larger values are clamped)
+     * @return zonal field of the model
+     */
+    template<typename Model>
+    static ZonalGravityField create(int maxDegree = ZonalModel<Model>::MAX_DEGREE)
+    {
+        return ZonalGravityField(ZonalModel<Model>::EQUATORIAL_RADIUS, ZonalModel<Model>::MU,
+                                 Model::UNNORMALIZED_ZONALS,
+                                 (maxDegree < ZonalModel<Model>::MAX_DEGREE) ? maxDegree : ZonalModel<Model>::MAX_DEGREE);
+    }
+
+    /** Get the equatorial radius.
+     * @return equatorial radius (m)
+     */
+    double getEquatorialRadius() const;
+
+    /** Get the gravitational constant.
+     * @return gravitational constant (m³/s²)
+     */
+    double getMu() const;
+
+    /** Get the maximal degree.
+     * @return maximal degree
+     */
+    int getMaxDegree() const;
+
+    /** Get a zonal harmonic.
+     * @param n degree
+     * @return Jn = -Cn,0, 0 above the maximal degree
+     */
+    double getJ(int n) const;
+
+    /** Compute the acceleration at one position.
+     * @param position position in the body-fixed frame (m)
+     * @return perturbing acceleration (m/s²)
+     */
+    Vector3D getAcceleration(const Vector3D& position) const;
+
+    /** Compute the acceleration and its Jacobian at one position.
+     * @param position position in the body-fixed frame (m)
+     * @param jacobian placeholder for the Jacobian with respect to position (s⁻²)
+     * @return perturbing acceleration (m/s²)
+     */
+    Vector3D getAcceleration(const Vector3D& position, double jacobian[3][3]) const;
+
+    /** Compute the accelerations at several positions.
+     * @param x abscissas (m)
+     * @param y ordinates (m)
+     * @param z heights (m)
+     * @param count number of positions
+     * @param ax placeholder for the accelerations abscissas (m/s²)
+     * @param ay placeholder for the accelerations ordinates (m/s²)
+     * @param az placeholder for the accelerations heights (m/s²)
+     */
+    void getAccelerations(const double* x, const double* y, const double* z, size_t count,
+                          double* ax, double* ay, double* az) const;
+
+    /** Compute the accelerations and their Jacobians at several positions.
+     * @param x abscissas (m)
+     * @param y ordinates (m)
+     * @param z heights (m)
+     * @param count number of positions
+     * @param ax placeholder for the accelerations abscissas (m/s²)
+     * @param ay placeholder for the accelerations ordinates (m/s²)
+     * @param az placeholder for the accelerations heights (m/s²)
+     * @param jacobians placeholder for the Jacobians (s⁻²), 9 row major elements per position
+     */
+    void getAccelerations(const double* x, const double* y, const double* z, size_t count,
+                          double* ax, double* ay, double* az, double* jacobians) const;
+
+    /** Maximal supported degree. */
+    static constexpr int MAX_SUPPORTED_DEGREE = 6;
+
+private:
+    /** Equatorial radius. */
+    double ae;
+
+    /** Gravitational constant. */
+    double mu;
+
+    /** Maximal degree. */
+    int maxDegree;
+
+    /** Zonal harmonics Jn, indexed by degree. */
+    double j[MAX_SUPPORTED_DEGREE + 1];
+};
+
+#endif
@@ -0,0 +1,163 @@
+#ifndef _ZONAL_KERNELS_H_
+#define _ZONAL_KERNELS_H_
+
+#include <stddef.h>
+#include <algorithm>
+#include <cmath>
+#include "utils/Gradient.h"
+
+/** Acceleration kernels of the zonal part of a gravity field.
+ * <p>The perturbing potential of the zonal harmonics Jn up to degree N is
+ * U = -μ/r Σ Jn (ae/r)ⁿ Pn(z/r), the central attraction μ/r is not
+ * included. Its gradient has the closed form</p>
+ * <pre>
+ *   ax = μ/r² Σ Jn (ae/r)ⁿ P'n+1(z/r) x/r
+ *   ay = μ/r² Σ Jn (ae/r)ⁿ P'n+1(z/r) y/r
+ *   az = μ/r² Σ Jn (ae/r)ⁿ (n+1) Pn+1(z/r)
+ * </pre>
+ * <p>where the Legendre polynomials Pn and their derivatives are computed
+ * by their three terms recurrences. The degree is a template parameter, so
+ * the recurrence is fully unrolled and the batch loops only contain
+ * arithmetic and one square root per point, which the compiler vectorizes.
+ * The kernels are templates on their scalar type too: instantiated with
+ * {@link Gradient}, they provide the Jacobian of the acceleration with
+ * respect to position.</p>
+ * <p>Batch kernels use structure of arrays layouts, arrays may not overlap.</p>
+ */
+struct ZonalKernels
+{
+    /** Compute the acceleration at one position.
+     * @param DEGREE maximal degree, from 2 to 6
+     * @param T scalar type, <code>double</code> or {@link Gradient}
+     * @param ae equatorial radius (m)
+     * @param mu gravitational constant (m³/s²)
+     * @param j zonal harmonics Jn, indexed by degree
+     * @param x abscissa (m)
+     * @param y ordinate (m)
+     * @param z height (m)
+     * @param ax placeholder for the acceleration abscissa (m/s²)
+     * @param ay placeholder for the acceleration ordinate (m/s²)
+     * @param az placeholder for the acceleration height (m/s²)
+     */
+    template<int DEGREE, typename T>
+    static inline void acceleration(double ae, double mu, const double* j,
+                                    const T& x, const T& y, const T& z, T& ax, T& ay, T& az)
+    {
+        using std::sqrt;
+        const T invR = 1.0 / sqrt(x * x + y * y + z * z);
+        const T u    = z * invR;
+        const T t    = ae * invR;
+
+        // Legendre polynomials and derivatives, from degree 0 and 1
+        T pPrevious = T(1.0);
+        T p         = u;
+        T dPrevious = T(0.0);
+        T d         = T(1.0);
+        T tn        = t;
+        T horizontal(0.0);
+        T vertical(0.0);
+        for (int k = 1; k <= DEGREE; ++k) {
+            const T pNext = ((2.0 * k + 1.0) / (k + 1.0)) * (u * p) - (k / (k + 1.0)) * pPrevious;
+            const T dNext = dPrevious + (2.0 * k + 1.0) * p;
+            if (k >= 2) {
+                tn = tn * t;
+                const T jtn = j[k] * tn;
+                horizontal = horizontal + jtn * dNext;
+                vertical   = vertical + ((k + 1.0) * jtn) * pNext;
+            }
+            pPrevious = p;
+            p         = pNext;
+            dPrevious = d;
+            d         = dNext;
+        }
+
+        const T f = mu * (invR * invR);
+        const T h = f * horizontal * invR;
+        ax = h * x;
+        ay = h * y;
+        az = f * vertical;
+    }
+
+    /** Compute the accelerations at several positions.
+     * @param DEGREE maximal degree, from 2 to 6
+     * @param ae equatorial radius (m)
+     * @param mu gravitational constant (m³/s²)
+     * @param j zonal harmonics Jn, indexed by degree
+     * @param x abscissas (m)
+     * @param y ordinates (m)
+     * @param z heights (m)
+     * @param count number of positions
+     * @param ax placeholder for the accelerations abscissas (m/s²)
+     * @param ay placeholder for the accelerations ordinates (m/s²)
+     * @param az placeholder for the accelerations heights (m/s²)
+     */
+    template<int DEGREE>
+    static inline void accelerations(double ae, double mu, const double* j,
+                                     const double* x, const double* y, const double* z, size_t count,
+                                     double* ax, double* ay, double* az)
+    {
+        // coefficients and results are kept in local arrays, which cannot alias the
+        // caller arrays, so the compiler vectorizes the loop without run-time checks
+        double jn[DEGREE + 1];
+        for (int n = 0; n <= DEGREE; ++n) {
+            jn[n] = j[n];
+        }
+        double bx[BLOCK_SIZE];
+        double by[BLOCK_SIZE];
+        double bz[BLOCK_SIZE];
+        for (size_t start = 0; start < count; start += BLOCK_SIZE) {
+            const size_t size = (count - start < BLOCK_SIZE) ? count - start : BLOCK_SIZE;
+            const double* px = x + start;
+            const double* py = y + start;
+            const double* pz = z + start;
+            for (size_t i = 0; i < size; ++i) {
+                acceleration<DEGREE>(ae, mu, jn, px[i], py[i], pz[i], bx[i], by[i], bz[i]);
+            }
+            std::copy(bx, bx + size, ax + start);
+            std::copy(by, by + size, ay + start);
+            std::copy(bz, bz + size, az + start);
+        }
+    }
+
+    /** Compute the accelerations and their Jacobians at several positions.
+     * @param DEGREE maximal degree, from 2 to 6
+     * @param ae equatorial radius (m)
+     * @param mu gravitational constant (m³/s²)
+     * @param j zonal harmonics Jn, indexed by degree
+     * @param x abscissas (m)
+     * @param y ordinates (m)
+     * @param z heights (m)
+     * @param count number of positions
+     * @param ax placeholder for the accelerations abscissas (m/s²)
+     * @param ay placeholder for the accelerations ordinates (m/s²)
+     * @param az placeholder for the accelerations heights (m/s²)
+     * @param jacobians placeholder for the Jacobians with respect to
+     * position (s⁻²), 9 row major elements per position
+     */
+    template<int DEGREE>
+    static inline void accelerations(double ae, double mu, const double* j,
+                                     const double* x, const double* y, const double* z, size_t count,
+                                     double* ax, double* ay, double* az, double* jacobians)
+    {
+        typedef Gradient<3> G;
+        for (size_t i = 0; i < count; ++i) {
+            G gx, gy, gz;
+            acceleration<DEGREE>(ae, mu, j, G::variable(x[i], 0), G::variable(y[i], 1), G::variable(z[i], 2),
+                                 gx, gy, gz);
+            ax[i] = gx.getValue();
+            ay[i] = gy.getValue();
+            az[i] = gz.getValue();
+            double* jacobian = jacobians + 9 * i;
+            for (int c = 0; c < 3; ++c) {
+                jacobian[c]     = gx.getPartialDerivative(c);
+                jacobian[3 + c] = gy.getPartialDerivative(c);
+                jacobian[6 + c] = gz.getPartialDerivative(c);
+            }
+        }
+    }
+
+    /** Number of positions processed per block by the batch kernels. */
+    static constexpr size_t BLOCK_SIZE = 64;
+};
+
+#endif
@@ -0,0 +1,165 @@
+#ifndef _VECTOR3D_H_
+#define _VECTOR3D_H_
+
+/** This class implements vectors in a three-dimensional space.
+ * <p>Instances of this class are guaranteed to be immutable.</p>
+ */
+class Vector3D
+{
+public:
+    /** Build a null vector. */
+    Vector3D();
+
+    /** Simple constructor.
+     * @param x abscissa
+     * @param y ordinate
+     * @param z height
+     */
+    Vector3D(double x, double y, double z);
+
+    /** Multiplicative constructor: build a vector from another one and a scale factor.
+     * <p>The vector built will be a * u.</p>
+     * @param a scale factor
+     * @param u base (unscaled) vector
+     */
+    Vector3D(double a, const Vector3D& u);
+
+    /** Linear constructor: build a vector from two other ones and corresponding scale factors.
+     * <p>The vector built will be a1 * u1 + a2 * u2.</p>
+     * @param a1 first scale factor
+     * @param u1 first base (unscaled) vector
+     * @param a2 second scale factor
+     * @param u2 second base (unscaled) vector
+     */
+    Vector3D(double a1, const Vector3D& u1, double a2, const Vector3D& u2);
+
+    /** Linear constructor: build a vector from three other ones and corresponding scale factors.
+     * <p>The vector built will be a1 * u1 + a2 * u2 + a3 * u3.</p>
+     * @param a1 first scale factor
+     * @param u1 first base (unscaled) vector
+     * @param a2 second scale factor
+     * @param u2 second base (unscaled) vector
+     * @param a3 third scale factor
+     * @param u3 third base (unscaled) vector
+     */
+    Vector3D(double a1, const Vector3D& u1, double a2, const Vector3D& u2, double a3, const Vector3D& u3);
+
+    /** Get the abscissa of the vector.
+     * @return abscissa of the vector
+     */
+    double getX() const;
+
+    /** Get the ordinate of the vector.
+     * @return ordinate of the vector
+     */
+    double getY() const;
+
+    /** Get the height of the vector.
+     * @return height of the vector
+     */
+    double getZ() const;
+
+    /** Get the L2 norm for the vector.
+     * @return euclidean norm for the vector
+     */
+    double getNorm() const;
+
+    /** Get the square of the norm for the vector.
+     * @return square of the euclidean norm for the vector
+     */
+    double getNormSq() const;
+
+    /** Add a vector to the instance.
+     * @param v vector to add
+     * @return a new vector
+     */
+    Vector3D add(const Vector3D& v) const;
+
+    /** Add a scaled vector to the instance.
+     * @param factor scale factor to apply to v before adding it
+     * @param v vector to add
+     * @return a new vector
+     */
+    Vector3D add(double factor, const Vector3D& v) const;
+
+    /** Subtract a vector from the instance.
+     * @param v vector to subtract
+     * @return a new vector
+     */
+    Vector3D subtract(const Vector3D& v) const;
+
+    /** Subtract a scaled vector from the instance.
+     * @param factor scale factor to apply to v before subtracting it
+     * @param v vector to subtract
+     * @return a new vector
+     */
+    Vector3D subtract(double factor, const Vector3D& v) const;
+
+    /** Get the opposite of the instance.
+     * @return a new vector which is opposite to the instance
+     */
+    Vector3D negate() const;
+
+    /** Multiply the instance by a scalar.
+     * @param a scalar
+     * @return a new vector
+     */
+    Vector3D scalarMultiply(double a) const;
+
+    /** Get a normalized vector aligned with the instance.
+     * @return a new normalized vector, or the instance itself if its norm is zero
+     */
+    Vector3D normalize() const;
+
+    /** Compute the dot-product of the instance and another vector.
+     * @param v second vector
+     * @return the dot product this.v
+     */
+    double dotProduct(const Vector3D& v) const;
+
+    /** Compute the cross-product of the instance with another vector.
+     * @param v other vector
+     * @return the cross product this ^ v as a new Vector3D
+     */
+    Vector3D crossProduct(const Vector3D& v) const;
+
+    /** Compute the distance between the instance and another vector.
+     * @param v second vector
+     * @return the distance between the instance and p according to the L2 norm
+     */
+    double distance(const Vector3D& v) const;
+
+    /** Compute the angular separation between two vectors.
+     * @param v1 first vector
+     * @param v2 second vector
+     * @return angular separation between v1 and v2, 0 if one of them is null
+     */
+    static double angle(const Vector3D& v1, const Vector3D& v2);
+
+    /** {@inheritDoc} */
+    bool operator == (const Vector3D& other) const;
+
+    /** Null vector (coordinates: 0, 0, 0). */
+    static const Vector3D ZERO;
+
+    /** First canonical vector (coordinates: 1, 0, 0). */
+    static const Vector3D PLUS_I;
+
+    /** Second canonical vector (coordinates: 0, 1, 0). */
+    static const Vector3D PLUS_J;
+
+    /** Third canonical vector (coordinates: 0, 0, 1). */
+    static const Vector3D PLUS_K;
+
+private:
+    /** Abscissa. */
+    double x;
+
+    /** Ordinate. */
+    double y;
+
+    /** Height. */
+    double z;
+};
+
+#endif
@@ -0,0 +1,110 @@
+#ifndef _CARTESIAN_ORBIT_H_
+#define _CARTESIAN_ORBIT_H_
+
+#include "orbits/Orbit.h"
+
+/** This class holds Cartesian orbital parameters.
+ * <p>The parameters used internally are the Cartesian coordinates:</p>
+ * <pre>
+ *     x
+ *     y
+ *     z
+ *     xDot
+ *     yDot
+ *     zDot
+ * </pre>
+ * <p>contained in {@link PVCoordinates}.</p>
+ * <p>Note that the implementation of this class delegates all non-Cartesian
+ * related computations ({@link #getA()}, {@link #getEquinoctialEx()}, ...)
+ * to equinoctial parameters (or Keplerian ones for hyperbolic orbits),
+ * computed once at construction.</p>
+ * <p>Instances of this class are guaranteed to be immutable.</p>
+ */
+class CartesianOrbit : public Orbit
+{
+public:
+    /** Constructor from Cartesian parameters.
+     * @param pv position-velocity
+     * @param date date of the orbital parameters
+     * @param mu central attraction coefficient (m³/s²)
+     */
+    CartesianOrbit(const PVCoordinates& pv, const LinearTime& date, double mu);
+
+    /** Constructor from any kind of orbital parameters.
+     * @param orbit orbital parameters to copy
+     */
+    explicit CartesianOrbit(const Orbit& orbit);
+
+    /** {@inheritDoc} */
+    Type getType() const override;
+
+    /** {@inheritDoc} */
+    double getA() const override;
+
+    /** {@inheritDoc} */
+    double getEquinoctialEx() const override;
+
+    /** {@inheritDoc} */
+    double getEquinoctialEy() const override;
+
+    /** {@inheritDoc} */
+    double getHx() const override;
+
+    /** {@inheritDoc} */
+    double getHy() const override;
+
+    /** {@inheritDoc} */
+    double getLv() const override;
+
+    /** {@inheritDoc} */
+    double getLE() const override;
+
+    /** {@inheritDoc} */
+    double getLM() const override;
+
+    /** {@inheritDoc} */
+    double getE() const override;
+
+    /** {@inheritDoc} */
+    double getI() const override;
+
+    /** {@inheritDoc} */
+    PVCoordinates getPVCoordinates() const override;
+
+    /** Get a time-shifted orbit.
+     * <p>The orbit can be slightly shifted to close dates. This shift is
+     * based on a simple Keplerian model. It is <em>not</em> intended as a
+     * replacement for proper orbit propagation but should be sufficient for
+     * small time shifts or coarse accuracy.</p>
+     * @param dt time shift (s)
+     * @return a new orbit, shifted with respect to the instance (which is immutable)
+     */
+    CartesianOrbit shiftedBy(double dt) const;
+
+private:
+    /** Initialize the equinoctial parameters from the position-velocity. */
+    void initEquinoctial();
+
+    /** Position-velocity. */
+    PVCoordinates pv;
+
+    /** Semi-major axis (m). */
+    double a;
+
+    /** First component of the equinoctial eccentricity vector. */
+    double ex;
+
+    /** Second component of the equinoctial eccentricity vector. */
+    double ey;
+
+    /** First component of the inclination vector. */
+    double hx;
+
+    /** Second component of the inclination vector. */
+    double hy;
+
+    /** True longitude argument (rad). */
+    double lv;
+};
+
+#endif
@@ -0,0 +1,162 @@
+#ifndef _CIRCULAR_ORBIT_H_
+#define _CIRCULAR_ORBIT_H_
+
+#include "orbits/Orbit.h"
+
+/** This class handles circular orbital parameters.
+ * <p>The parameters used internally are the circular elements which can be
+ * related to Keplerian elements as follows:</p>
+ * <pre>
+ *     a
+ *     ex = e cos(ω)
+ *     ey = e sin(ω)
+ *     i
+ *     Ω
+ *     αv = v + ω
+ * </pre>
+ * <p>where Ω stands for the Right Ascension of the Ascending Node and αv
+ * stands for the true latitude argument.</p>
+ * <p>The conversion equations from and to Keplerian elements given above
+ * hold only when both sides are unambiguously defined, i.e. when orbit is
+ * neither equatorial nor circular. When orbit is circular (but not
+ * equatorial), the circular parameters are still unambiguously defined
+ * whereas some Keplerian elements (more precisely ω and Ω) become
+ * ambiguous. When orbit is equatorial, neither the Keplerian nor the
+ * circular parameters can be defined unambiguously. {@link
+ * EquinoctialOrbit equinoctial orbits} is the recommended way to represent
+ * orbits. Only elliptic orbits are supported, hyperbolic ones lead to NaN
+ * parameters.</p>
+ * <p>Instances of this class are guaranteed to be immutable.</p>
+ */
+class CircularOrbit : public Orbit
+{
+public:
+    /** Creates a new instance.
+     * @param a semi-major axis (m)
+     * @param ex e cos(ω), first component of circular eccentricity vector
+     * @param ey e sin(ω), second component of circular eccentricity vector
+     * @param i inclination (rad)
+     * @param raan right ascension of ascending node (Ω, rad)
+     * @param alpha (M or E or v) + ω, mean, eccentric or true latitude argument (rad)
+     * @param type type of latitude argument
+     * @param date date of the orbital parameters
+     * @param mu central attraction coefficient (m³/s²)
+     */
+    CircularOrbit(double a, double ex, double ey, double i, double raan, double alpha, PositionAngle type,
+                  const LinearTime& date, double mu);
+
+    /** Constructor from Cartesian parameters.
+     * @param pv position-velocity
+     * @param date date of the orbital parameters
+     * @param mu central attraction coefficient (m³/s²)
+     */
+    CircularOrbit(const PVCoordinates& pv, const LinearTime& date, double mu);
+
+    /** Constructor from any kind of orbital parameters.
+     * @param orbit orbital parameters to copy
+     */
+    explicit CircularOrbit(const Orbit& orbit);
+
+    /** {@inheritDoc} */
+    Type getType() const override;
+
+    /** {@inheritDoc} */
+    double getA() const override;
+
+    /** Get the first component of the circular eccentricity vector.
+     * @return ex = e cos(ω), first component of the circular eccentricity vector
+     */
+    double getCircularEx() const;
+
+    /** Get the second component of the circular eccentricity vector.
+     * @return ey = e sin(ω), second component of the circular eccentricity vector
+     */
+    double getCircularEy() const;
+
+    /** {@inheritDoc} */
+    double getI() const override;
+
+    /** Get the right ascension of the ascending node.
+     * @return right ascension of the ascending node (rad)
+     */
+    double getRightAscensionOfAscendingNode() const;
+
+    /** Get the latitude argument.
+     * @param type type of the angle
+     * @return latitude argument (rad)
+     */
+    double getAlpha(PositionAngle type) const;
+
+    /** Get the true latitude argument.
+     * @return v + ω true latitude argument (rad)
+     */
+    double getAlphaV() const;
+
+    /** Get the eccentric latitude argument.
+     * @return E + ω eccentric latitude argument (rad)
+     */
+    double getAlphaE() const;
+
+    /** Get the mean latitude argument.
+     * @return M + ω mean latitude argument (rad)
+     */
+    double getAlphaM() const;
+
+    /** {@inheritDoc} */
+    double getE() const override;
+
+    /** {@inheritDoc} */
+    double getEquinoctialEx() const override;
+
+    /** {@inheritDoc} */
+    double getEquinoctialEy() const override;
+
+    /** {@inheritDoc} */
+    double getHx() const override;
+
+    /** {@inheritDoc} */
+    double getHy() const override;
+
+    /** {@inheritDoc} */
+    double getLv() const override;
+
+    /** {@inheritDoc} */
+    double getLE() const override;
+
+    /** {@inheritDoc} */
+    double getLM() const override;
+
+    /** {@inheritDoc} */
+    PVCoordinates getPVCoordinates() const override;
+
+    /** Get a time-shifted orbit.
+     * <p>The orbit can be slightly shifted to close dates. This shift is
+     * based on a simple Keplerian model. It is <em>not</em> intended as a
+     * replacement for proper orbit propagation but should be sufficient for
+     * small time shifts or coarse accuracy.</p>
+     * @param dt time shift (s)
+     * @return a new orbit, shifted with respect to the instance (which is immutable)
+     */
+    CircularOrbit shiftedBy(double dt) const;
+
+private:
+    /** Semi-major axis (m). */
+    double a;
+
+    /** First component of the circular eccentricity vector. */
+    double ex;
+
+    /** Second component of the circular eccentricity vector. */
+    double ey;
+
+    /** Inclination (rad). */
+    double i;
+
+    /** Right Ascension of Ascending Node (rad). */
+    double raan;
+
+    /** True latitude argument (rad). */
+    double alphaV;
+};
+
+#endif
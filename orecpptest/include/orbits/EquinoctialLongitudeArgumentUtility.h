@@ -0,0 +1,65 @@
+#ifndef _EQUINOCTIAL_LONGITUDE_ARGUMENT_UTILITY_H_
+#define _EQUINOCTIAL_LONGITUDE_ARGUMENT_UTILITY_H_
+
+/** Utility methods for converting between different equinoctial longitude arguments.
+ * <p>The longitude arguments L = Ω + ω + anomaly are related through the
+ * equinoctial eccentricity vector components ex = e cos(ω + Ω) and
+ * ey = e sin(ω + Ω). The same relations hold between the latitude
+ * arguments α = ω + anomaly of circular parameters with their eccentricity
+ * vector components e cos(ω) and e sin(ω), so {@link CircularOrbit} uses
+ * these methods too. Only elliptic orbits are supported.</p>
+ * @see EquinoctialOrbit
+ */
+class EquinoctialLongitudeArgumentUtility
+{
+public:
+    /** Compute the eccentric longitude argument from the mean longitude argument.
+     * @param ex first component of the eccentricity vector
+     * @param ey second component of the eccentricity vector
+     * @param lM mean longitude argument (rad)
+     * @return eccentric longitude argument (rad)
+     */
+    static double meanToEccentric(double ex, double ey, double lM);
+
+    /** Compute the mean longitude argument from the eccentric longitude argument.
+     * @param ex first component of the eccentricity vector
+     * @param ey second component of the eccentricity vector
+     * @param lE eccentric longitude argument (rad)
+     * @return mean longitude argument (rad)
+     */
+    static double eccentricToMean(double ex, double ey, double lE);
+
+    /** Compute the true longitude argument from the eccentric longitude argument.
+     * @param ex first component of the eccentricity vector
+     * @param ey second component of the eccentricity vector
+     * @param lE eccentric longitude argument (rad)
+     * @return true longitude argument (rad)
+     */
+    static double eccentricToTrue(double ex, double ey, double lE);
+
+    /** Compute the eccentric longitude argument from the true longitude argument.
+     * @param ex first component of the eccentricity vector
+     * @param ey second component of the eccentricity vector
+     * @param lv true longitude argument (rad)
+     * @return eccentric longitude argument (rad)
+     */
+    static double trueToEccentric(double ex, double ey, double lv);
+
+    /** Compute the true longitude argument from the mean longitude argument.
+     * @param ex first component of the eccentricity vector
+     * @param ey second component of the eccentricity vector
+     * @param lM mean longitude argument (rad)
+     * @return true longitude argument (rad)
+     */
+    static double meanToTrue(double ex, double ey, double lM);
+
+    /** Compute the mean longitude argument from the true longitude argument.
+     * @param ex first component of the eccentricity vector
+     * @param ey second component of the eccentricity vector
+     * @param lv true longitude argument (rad)
+     * @return mean longitude argument (rad)
+     */
+    static double trueToMean(double ex, double ey, double lv);
+};
+
+#endif
@@ -0,0 +1,131 @@
+#ifndef _EQUINOCTIAL_ORBIT_H_
+#define _EQUINOCTIAL_ORBIT_H_
+
+#include "orbits/Orbit.h"
+
+/** This class handles equinoctial orbital parameters, which can support both
+ * circular and equatorial orbits.
+ * <p>The parameters used internally are the equinoctial elements which can
+ * be related to Keplerian elements as follows:</p>
+ * <pre>
+ *     a
+ *     ex = e cos(ω + Ω)
+ *     ey = e sin(ω + Ω)
+ *     hx = tan(i/2) cos(Ω)
+ *     hy = tan(i/2) sin(Ω)
+ *     lv = v + ω + Ω
+ * </pre>
+ * <p>where ω stands for the Perigee Argument and Ω stands for the Right
+ * Ascension of the Ascending Node.</p>
+ * <p>The conversion equations from and to Keplerian elements given above
+ * hold only when both sides are unambiguously defined, i.e. when orbit is
+ * neither equatorial nor circular. When orbit is either equatorial or
+ * circular, the equinoctial parameters are still unambiguously defined
+ * whereas some Keplerian elements (more precisely ω and Ω) become
+ * ambiguous. For this reason, equinoctial parameters are the recommended
+ * way to represent orbits. Only elliptic orbits are supported, hyperbolic
+ * ones lead to NaN parameters.</p>
+ * <p>Instances of this class are guaranteed to be immutable.</p>
+ */
+class EquinoctialOrbit : public Orbit
+{
+public:
+    /** Creates a new instance.
+     * @param a semi-major axis (m)
+     * @param ex e cos(ω + Ω), first component of eccentricity vector
+     * @param ey e sin(ω + Ω), second component of eccentricity vector
+     * @param hx tan(i/2) cos(Ω), first component of inclination vector
+     * @param hy tan(i/2) sin(Ω), second component of inclination vector
+     * @param l (M or E or v) + ω + Ω, mean, eccentric or true longitude argument (rad)
+     * @param type type of longitude argument
+     * @param date date of the orbital parameters
+     * @param mu central attraction coefficient (m³/s²)
+     */
+    EquinoctialOrbit(double a, double ex, double ey, double hx, double hy, double l, PositionAngle type,
+                     const LinearTime& date, double mu);
+
+    /** Constructor from Cartesian parameters.
+     * @param pv position-velocity
+     * @param date date of the orbital parameters
+     * @param mu central attraction coefficient (m³/s²)
+     */
+    EquinoctialOrbit(const PVCoordinates& pv, const LinearTime& date, double mu);
+
+    /** Constructor from any kind of orbital parameters.
+     * @param orbit orbital parameters to copy
+     */
+    explicit EquinoctialOrbit(const Orbit& orbit);
+
+    /** {@inheritDoc} */
+    Type getType() const override;
+
+    /** {@inheritDoc} */
+    double getA() const override;
+
+    /** {@inheritDoc} */
+    double getEquinoctialEx() const override;
+
+    /** {@inheritDoc} */
+    double getEquinoctialEy() const override;
+
+    /** {@inheritDoc} */
+    double getHx() const override;
+
+    /** {@inheritDoc} */
+    double getHy() const override;
+
+    /** Get the longitude argument.
+     * @param type type of the angle
+     * @return longitude argument (rad)
+     */
+    double getL(PositionAngle type) const;
+
+    /** {@inheritDoc} */
+    double getLv() const override;
+
+    /** {@inheritDoc} */
+    double getLE() const override;
+
+    /** {@inheritDoc} */
+    double getLM() const override;
+
+    /** {@inheritDoc} */
+    double getE() const override;
+
+    /** {@inheritDoc} */
+    double getI() const override;
+
+    /** {@inheritDoc} */
+    PVCoordinates getPVCoordinates() const override;
+
+    /** Get a time-shifted orbit.
+     * <p>The orbit can be slightly shifted to close dates. This shift is
+     * based on a simple Keplerian model. It is <em>not</em> intended as a
+     * replacement for proper orbit propagation but should be sufficient for
+     * small time shifts or coarse accuracy.</p>
+     * @param dt time shift (s)
+     * @return a new orbit, shifted with respect to the instance (which is immutable)
+     */
+    EquinoctialOrbit shiftedBy(double dt) const;
+
+private:
+    /** Semi-major axis (m). */
+    double a;
+
+    /** First component of the eccentricity vector. */
+    double ex;
+
+    /** Second component of the eccentricity vector. */
+    double ey;
+
+    /** First component of the inclination vector. */
+    double hx;
+
+    /** Second component of the inclination vector. */
+    double hy;
+
+    /** True longitude argument (rad). */
+    double lv;
+};
+
+#endif
@@ -0,0 +1,396 @@
+#ifndef _KEPLER_SOLVER_H_
+#define _KEPLER_SOLVER_H_
+
+#include <stddef.h>
+#include <cmath>
+#include "utils/MathUtils.h"
+
+/** Fixed cost solvers for Kepler's equation, elliptic and hyperbolic.
+ * <p>Both solvers start from an approximation accurate enough for a fixed
+ * number of Halley iterations to converge to the last bits over the whole
+ * eccentricity range, so there is no convergence test and every solution
+ * costs the same:</p>
+ * <ul>
+ *   <li>elliptic case, 0 &le; e &lt; 1: the cubic starter of F. L. Markley,
+ *       "Kepler equation solver", Celestial Mechanics and Dynamical
+ *       Astronomy 63, 1995, or the cheaper first order solution M + e sin(M)
+ *       up to {@link #FIRST_ORDER_LIMIT}, then {@link #ELLIPTIC_ITERATIONS}
+ *       iterations,</li>
+ *   <li>hyperbolic case, e &gt; 1: the smallest of the root of the cubic
+ *       expansion of e sinh(H) - H near 0 and of the asymptotic logarithm,
+ *       both being above the solution, then {@link #HYPERBOLIC_ITERATIONS}
+ *       iterations.</li>
+ * </ul>
+ * <p>The iterations work on the difference d between the solution and
+ * the starter (elliptic case: between eccentric and mean anomalies, which
+ * is bounded by e), whose sine and cosine (or hyperbolic sine and cosine)
+ * are computed by polynomials, combined with the ones of the reference
+ * angle computed once. Batch methods process blocks of {@link #BLOCK_SIZE}
+ * lanes step by step: only the starter calls library functions, the
+ * iterations have no call and no data dependent branch and are
+ * vectorized. The elliptic starter is selected once per block, from the
+ * largest eccentricity of the block.</p>
+ * @see KeplerianAnomalyUtility
+ */
+struct KeplerSolver
+{
+    /** Number of Halley iterations of the elliptic solver. */
+    static const int ELLIPTIC_ITERATIONS = 2;
+
+    /** Largest eccentricity for which the first order elliptic starter is used. */
+    static constexpr double FIRST_ORDER_LIMIT = 0.3;
+
+    /** Number of Halley iterations of the hyperbolic solver. */
+    static const int HYPERBOLIC_ITERATIONS = 3;
+
+    /** Number of lanes processed together by batch methods. */
+    static const size_t BLOCK_SIZE = 64;
+
+    /** Compute sine and cosine of a small angle.
+     * <p>The Taylor expansions are truncated after the x¹⁷ and x¹⁸ terms,
+     * which is accurate to the last bit for |x| &le; 1 and still to about
+     * 1.0e-14 for |x| &le; 1.5.</p>
+     * @param x angle (rad)
+     * @param sinX placeholder for sin(x)
+     * @param cosX placeholder for cos(x)
+     */
+    static inline void sinCosSmall(double x, double& sinX, double& cosX)
+    {
+        const double x2 = x * x;
+        double s = 1.0 / 355687428096000.0;
+        s = s * x2 - 1.0 / 1307674368000.0;
+        s = s * x2 + 1.0 / 6227020800.0;
+        s = s * x2 - 1.0 / 39916800.0;
+        s = s * x2 + 1.0 / 362880.0;
+        s = s * x2 - 1.0 / 5040.0;
+        s = s * x2 + 1.0 / 120.0;
+        s = s * x2 - 1.0 / 6.0;
+        sinX = x + x * x2 * s;
+        double c = -1.0 / 6402373705728000.0;
+        c = c * x2 + 1.0 / 20922789888000.0;
+        c = c * x2 - 1.0 / 87178291200.0;
+        c = c * x2 + 1.0 / 479001600.0;
+        c = c * x2 - 1.0 / 3628800.0;
+        c = c * x2 + 1.0 / 40320.0;
+        c = c * x2 - 1.0 / 720.0;
+        c = c * x2 + 1.0 / 24.0;
+        cosX = 1.0 - 0.5 * x2 + x2 * x2 * c;
+    }
+
+    /** Compute hyperbolic sine and cosine of a small argument.
+     * <p>Same expansions as {@link #sinCosSmall(double, double&, double&)},
+     * with the same accuracy.</p>
+     * @param x argument
+     * @param sinhX placeholder for sinh(x)
+     * @param coshX placeholder for cosh(x)
+     */
+    static inline void sinhCoshSmall(double x, double& sinhX, double& coshX)
+    {
+        const double x2 = x * x;
+        double s = 1.0 / 355687428096000.0;
+        s = s * x2 + 1.0 / 1307674368000.0;
+        s = s * x2 + 1.0 / 6227020800.0;
+        s = s * x2 + 1.0 / 39916800.0;
+        s = s * x2 + 1.0 / 362880.0;
+        s = s * x2 + 1.0 / 5040.0;
+        s = s * x2 + 1.0 / 120.0;
+        s = s * x2 + 1.0 / 6.0;
+        sinhX = x + x * x2 * s;
+        double c = 1.0 / 6402373705728000.0;
+        c = c * x2 + 1.0 / 20922789888000.0;
+        c = c * x2 + 1.0 / 87178291200.0;
+        c = c * x2 + 1.0 / 479001600.0;
+        c = c * x2 + 1.0 / 3628800.0;
+        c = c * x2 + 1.0 / 40320.0;
+        c = c * x2 + 1.0 / 720.0;
+        c = c * x2 + 1.0 / 24.0;
+        coshX = 1.0 + 0.5 * x2 + x2 * x2 * c;
+    }
+
+    /** Compute the starter of the elliptic solver.
+     * @param e eccentricity such that 0 &le; e &lt; 1
+     * @param M mean anomaly, in [-π, π] (rad)
+     * @return approximate eccentric anomaly (rad), within 5.0e-4 of the solution
+     */
+    static inline double ellipticStarter(double e, double M)
+    {
+        const double absM  = std::abs(M);
+        const double alpha = (3.0 * MathUtils::PI * MathUtils::PI +
+                              1.6 * MathUtils::PI * (MathUtils::PI - absM) / (1.0 + e)) /
+                             (MathUtils::PI * MathUtils::PI - 6.0);
+        const double d = 3.0 * (1.0 - e) + alpha * e;
+        const double q = 2.0 * alpha * d * (1.0 - e) - absM * absM;
+        const double r = 3.0 * alpha * d * (d - 1.0 + e) * absM + absM * absM * absM;
+        const double w = std::cbrt(std::abs(r) + std::sqrt(q * q * q + r * r));
+        const double w2 = w * w;
+        const double E = (2.0 * r * w2 / (w2 * w2 + w2 * q + q * q) + absM) / d;
+        return (M < 0) ? -E : E;
+    }
+
+    /** Compute the starter of the hyperbolic solver.
+     * @param e eccentricity &gt; 1
+     * @param M mean anomaly
+     * @return approximate hyperbolic eccentric anomaly, above the solution
+     * in absolute value and within 0.4 of it
+     */
+    static inline double hyperbolicStarter(double e, double M)
+    {
+        // root of (e - 1) H + e H³ / 6 = |M|, using Cardano's formula without cancellation
+        const double absM  = std::abs(M);
+        const double p     = 2.0 * (e - 1.0) / e;
+        const double halfQ = 3.0 * absM / e;
+        const double u     = std::cbrt(halfQ + std::sqrt(halfQ * halfQ + p * p * p));
+        const double cubic = u - p / u;
+
+        // asymptotic behavior of e sinh(H) - H
+        const double logarithm = std::log(2.0 * absM / e + 1.8);
+
+        const double H = (cubic < logarithm) ? cubic : logarithm;
+        return (M < 0) ? -H : H;
+    }
+
+    /** Solve the elliptic Kepler equation M = E - e sin(E).
+     * @param e eccentricity such that 0 &le; e &lt; 1
+     * @param M mean anomaly (rad)
+     * @param sinE placeholder for the sine of the eccentric anomaly
+     * @param cosE placeholder for the cosine of the eccentric anomaly
+     * @return eccentric anomaly (rad), in the same 2π turn as the mean anomaly
+     */
+    static inline double ellipticMeanToEccentric(double e, double M, double& sinE, double& cosE)
+    {
+        const double reducedM = MathUtils::normalizeAngle(M, 0.0);
+        const double sinM = std::sin(reducedM);
+        const double cosM = std::cos(reducedM);
+        double d = (e <= FIRST_ORDER_LIMIT) ? e * sinM : ellipticStarter(e, reducedM) - reducedM;
+        double sinD, cosD;
+        for (int i = 0; i < ELLIPTIC_ITERATIONS; ++i) {
+            sinCosSmall(d, sinD, cosD);
+            d = ellipticHalley(e, d, sinM * cosD + cosM * sinD, cosM * cosD - sinM * sinD);
+        }
+        sinCosSmall(d, sinD, cosD);
+        sinE = sinM * cosD + cosM * sinD;
+        cosE = cosM * cosD - sinM * sinD;
+        return M + d;
+    }
+
+    /** Solve the elliptic Kepler equation M = E - e sin(E).
+     * @param e eccentricity such that 0 &le; e &lt; 1
+     * @param M mean anomaly (rad)
+     * @return eccentric anomaly (rad), in the same 2π turn as the mean anomaly
+     */
+    static inline double ellipticMeanToEccentric(double e, double M)
+    {
+        double sinE, cosE;
+        return ellipticMeanToEccentric(e, M, sinE, cosE);
+    }
+
+    /** Solve the hyperbolic Kepler equation M = e sinh(H) - H.
+     * @param e eccentricity &gt; 1
+     * @param M mean anomaly
+     * @param sinhH placeholder for the hyperbolic sine of the hyperbolic eccentric anomaly
+     * @param coshH placeholder for the hyperbolic cosine of the hyperbolic eccentric anomaly
+     * @return hyperbolic eccentric anomaly
+     */
+    static inline double hyperbolicMeanToEccentric(double e, double M, double& sinhH, double& coshH)
+    {
+        const double H0     = hyperbolicStarter(e, M);
+        const double sinhH0 = std::sinh(H0);
+        const double coshH0 = std::cosh(H0);
+        double d = 0.0;
+        double sinhD, coshD;
+        for (int i = 0; i < HYPERBOLIC_ITERATIONS; ++i) {
+            sinhCoshSmall(d, sinhD, coshD);
+            d = hyperbolicHalley(e, M, H0, d, sinhH0 * coshD + coshH0 * sinhD, coshH0 * coshD + sinhH0 * sinhD);
+        }
+        sinhCoshSmall(d, sinhD, coshD);
+        sinhH = sinhH0 * coshD + coshH0 * sinhD;
+        coshH = coshH0 * coshD + sinhH0 * sinhD;
+        return H0 + d;
+    }
+
+    /** Solve the hyperbolic Kepler equation M = e sinh(H) - H.
+     * @param e eccentricity &gt; 1
+     * @param M mean anomaly
+     * @return hyperbolic eccentric anomaly
+     */
+    static inline double hyperbolicMeanToEccentric(double e, double M)
+    {
+        double sinhH, coshH;
+        return hyperbolicMeanToEccentric(e, M, sinhH, coshH);
+    }
+
+    /** Solve the elliptic Kepler equation for several mean anomalies on one orbit.
+     * @param e eccentricity such that 0 &le; e &lt; 1
+     * @param M mean anomalies (rad)
+     * @param count number of anomalies
+     * @param E placeholder for the eccentric anomalies (rad)
+     */
+    static inline void ellipticMeanToEccentric(double e, const double* M, size_t count, double* E)
+    {
+        for (size_t start = 0; start < count; start += BLOCK_SIZE) {
+            const size_t size = (count - start < BLOCK_SIZE) ? count - start : BLOCK_SIZE;
+            ellipticBlock<0>(&e, M + start, size, E + start);
+        }
+    }
+
+    /** Solve the elliptic Kepler equation for several orbits.
+     * @param e eccentricities such that 0 &le; e &lt; 1
+     * @param M mean anomalies (rad)
+     * @param count number of orbits
+     * @param E placeholder for the eccentric anomalies (rad)
+     */
+    static inline void ellipticMeanToEccentric(const double* e, const double* M, size_t count, double* E)
+    {
+        for (size_t start = 0; start < count; start += BLOCK_SIZE) {
+            const size_t size = (count - start < BLOCK_SIZE) ? count - start : BLOCK_SIZE;
+            ellipticBlock<1>(e + start, M + start, size, E + start);
+        }
+    }
+
+    /** Solve the hyperbolic Kepler equation for several mean anomalies on one orbit.
+     * @param e eccentricity &gt; 1
+     * @param M mean anomalies
+     * @param count number of anomalies
+     * @param H placeholder for the hyperbolic eccentric anomalies
+     */
+    static inline void hyperbolicMeanToEccentric(double e, const double* M, size_t count, double* H)
+    {
+        for (size_t start = 0; start < count; start += BLOCK_SIZE) {
+            const size_t size = (count - start < BLOCK_SIZE) ? count - start : BLOCK_SIZE;
+            hyperbolicBlock<0>(&e, M + start, size, H + start);
+        }
+    }
+
+    /** Solve the hyperbolic Kepler equation for several orbits.
+     * @param e eccentricities &gt; 1
+     * @param M mean anomalies
+     * @param count number of orbits
+     * @param H placeholder for the hyperbolic eccentric anomalies
+     */
+    static inline void hyperbolicMeanToEccentric(const double* e, const double* M, size_t count, double* H)
+    {
+        for (size_t start = 0; start < count; start += BLOCK_SIZE) {
+            const size_t size = (count - start < BLOCK_SIZE) ? count - start : BLOCK_SIZE;
+            hyperbolicBlock<1>(e + start, M + start, size, H + start);
+        }
+    }
+
+private:
+    /** Perform one Halley iteration on the elliptic equation.
+     * @param e eccentricity
+     * @param d current difference E - M (rad)
+     * @param sinE sine of the current eccentric anomaly
+     * @param cosE cosine of the current eccentric anomaly
+     * @return updated difference E - M (rad)
+     */
+    static inline double ellipticHalley(double e, double d, double sinE, double cosE)
+    {
+        const double f2 = e * sinE;
+        const double f1 = 1.0 - e * cosE;
+        const double f0 = d - f2;
+        return d - 2.0 * f0 * f1 / (2.0 * f1 * f1 - f0 * f2);
+    }
+
+    /** Perform one Halley iteration on the hyperbolic equation.
+     * @param e eccentricity
+     * @param M mean anomaly
+     * @param H0 starter
+     * @param d current difference H - H0
+     * @param sinhH hyperbolic sine of the current anomaly
+     * @param coshH hyperbolic cosine of the current anomaly
+     * @return updated difference H - H0
+     */
+    static inline double hyperbolicHalley(double e, double M, double H0, double d, double sinhH, double coshH)
+    {
+        const double f2 = e * sinhH;
+        const double f1 = e * coshH - 1.0;
+        const double f0 = f2 - (H0 + d) - M;
+        return d - 2.0 * f0 * f1 / (2.0 * f1 * f1 - f0 * f2);
+    }
+
+    /** Solve the elliptic equation for a block of lanes.
+     * @param STEP distance between the eccentricities of two consecutive
+     * lanes, 0 if all lanes share the same orbit, 1 for one orbit per lane
+     * @param e eccentricities
+     * @param M mean anomalies (rad)
+     * @param count number of lanes, at most {@link #BLOCK_SIZE}
+     * @param E placeholder for the eccentric anomalies (rad)
+     */
+    template<size_t STEP>
+    static inline void ellipticBlock(const double* e, const double* M, size_t count, double* E)
+    {
+        double sinM[BLOCK_SIZE];
+        double cosM[BLOCK_SIZE];
+        double d[BLOCK_SIZE];
+        double eMax = 0.0;
+        for (size_t k = 0; k < count; ++k) {
+            eMax = (e[STEP * k] > eMax) ? e[STEP * k] : eMax;
+        }
+        if (eMax <= FIRST_ORDER_LIMIT) {
+            for (size_t k = 0; k < count; ++k) {
+                const double reducedM = MathUtils::normalizeAngle(M[k], 0.0);
+                sinM[k] = std::sin(reducedM);
+                cosM[k] = std::cos(reducedM);
+            }
+            for (size_t k = 0; k < count; ++k) {
+                d[k] = e[STEP * k] * sinM[k];
+            }
+        }
+        else {
+            for (size_t k = 0; k < count; ++k) {
+                const double reducedM = MathUtils::normalizeAngle(M[k], 0.0);
+                sinM[k] = std::sin(reducedM);
+                cosM[k] = std::cos(reducedM);
+                d[k]    = ellipticStarter(e[STEP * k], reducedM) - reducedM;
+            }
+        }
+        for (int i = 0; i < ELLIPTIC_ITERATIONS; ++i) {
+            for (size_t k = 0; k < count; ++k) {
+                double sinD, cosD;
+                sinCosSmall(d[k], sinD, cosD);
+                d[k] = ellipticHalley(e[STEP * k], d[k],
+                                      sinM[k] * cosD + cosM[k] * sinD, cosM[k] * cosD - sinM[k] * sinD);
+            }
+        }
+        for (size_t k = 0; k < count; ++k) {
+            E[k] = M[k] + d[k];
+        }
+    }
+
+    /** Solve the hyperbolic equation for a block of lanes.
+     * @param STEP distance between the eccentricities of two consecutive
+     * lanes, 0 if all lanes share the same orbit, 1 for one orbit per lane
+     * @param e eccentricities
+     * @param M mean anomalies
+     * @param count number of lanes, at most {@link #BLOCK_SIZE}
+     * @param H placeholder for the hyperbolic eccentric anomalies
+     */
+    template<size_t STEP>
+    static inline void hyperbolicBlock(const double* e, const double* M, size_t count, double* H)
+    {
+        double H0[BLOCK_SIZE];
+        double sinhH0[BLOCK_SIZE];
+        double coshH0[BLOCK_SIZE];
+        double d[BLOCK_SIZE];
+        for (size_t k = 0; k < count; ++k) {
+            H0[k]     = hyperbolicStarter(e[STEP * k], M[k]);
+            sinhH0[k] = std::sinh(H0[k]);
+            coshH0[k] = std::cosh(H0[k]);
+            d[k]      = 0.0;
+        }
+        for (int i = 0; i < HYPERBOLIC_ITERATIONS; ++i) {
+            for (size_t k = 0; k < count; ++k) {
+                double sinhD, coshD;
+                sinhCoshSmall(d[k], sinhD, coshD);
+                d[k] = hyperbolicHalley(e[STEP * k], M[k], H0[k], d[k],
+                                        sinhH0[k] * coshD + coshH0[k] * sinhD,
+                                        coshH0[k] * coshD + sinhH0[k] * sinhD);
+            }
+        }
+        for (size_t k = 0; k < count; ++k) {
+            H[k] = H0[k] + d[k];
+        }
+    }
+};
+
+#endif
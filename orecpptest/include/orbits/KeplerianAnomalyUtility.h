@@ -0,0 +1,98 @@
+#ifndef _KEPLERIAN_ANOMALY_UTILITY_H_
+#define _KEPLERIAN_ANOMALY_UTILITY_H_
+
+/** Utility methods for converting between different Keplerian anomalies.
+ * <p>Elliptic methods are valid for eccentricities in [0, 1), hyperbolic
+ * methods for eccentricities above 1. Mean to eccentric conversions solve
+ * Kepler's equation with {@link KeplerSolver}.</p>
+ * @see KeplerianOrbit
+ */
+class KeplerianAnomalyUtility
+{
+public:
+    /** Compute the elliptic eccentric anomaly from the mean anomaly.
+     * @param e eccentricity such that 0 &le; e &lt; 1
+     * @param M mean anomaly (rad)
+     * @return eccentric anomaly (rad), in the same 2π turn as the mean anomaly
+     */
+    static double ellipticMeanToEccentric(double e, double M);
+
+    /** Compute the elliptic mean anomaly from the eccentric anomaly.
+     * @param e eccentricity such that 0 &le; e &lt; 1
+     * @param E eccentric anomaly (rad)
+     * @return mean anomaly (rad)
+     */
+    static double ellipticEccentricToMean(double e, double E);
+
+    /** Compute the elliptic true anomaly from the eccentric anomaly.
+     * @param e eccentricity such that 0 &le; e &lt; 1
+     * @param E eccentric anomaly (rad)
+     * @return true anomaly (rad)
+     */
+    static double ellipticEccentricToTrue(double e, double E);
+
+    /** Compute the elliptic eccentric anomaly from the true anomaly.
+     * @param e eccentricity such that 0 &le; e &lt; 1
+     * @param v true anomaly (rad)
+     * @return eccentric anomaly (rad)
+     */
+    static double ellipticTrueToEccentric(double e, double v);
+
+    /** Compute the elliptic true anomaly from the mean anomaly.
+     * @param e eccentricity such that 0 &le; e &lt; 1
+     * @param M mean anomaly (rad)
+     * @return true anomaly (rad)
+     */
+    static double ellipticMeanToTrue(double e, double M);
+
+    /** Compute the elliptic mean anomaly from the true anomaly.
+     * @param e eccentricity such that 0 &le; e &lt; 1
+     * @param v true anomaly (rad)
+     * @return mean anomaly (rad)
+     */
+    static double ellipticTrueToMean(double e, double v);
+
+    /** Compute the hyperbolic eccentric anomaly from the mean anomaly.
+     * @param e eccentricity &gt; 1
+     * @param M mean anomaly
+     * @return hyperbolic eccentric anomaly
+     */
+    static double hyperbolicMeanToEccentric(double e, double M);
+
+    /** Compute the hyperbolic mean anomaly from the hyperbolic eccentric anomaly.
+     * @param e eccentricity &gt; 1
+     * @param H hyperbolic eccentric anomaly
+     * @return mean anomaly
+     */
+    static double hyperbolicEccentricToMean(double e, double H);
+
+    /** Compute the true anomaly from the hyperbolic eccentric anomaly.
+     * @param e eccentricity &gt; 1
+     * @param H hyperbolic eccentric anomaly
+     * @return true anomaly (rad)
+     */
+    static double hyperbolicEccentricToTrue(double e, double H);
+
+    /** Compute the hyperbolic eccentric anomaly from the true anomaly.
+     * @param e eccentricity &gt; 1
+     * @param v true anomaly (rad)
+     * @return hyperbolic eccentric anomaly
+     */
+    static double hyperbolicTrueToEccentric(double e, double v);
+
+    /** Compute the true anomaly from the hyperbolic mean anomaly.
+     * @param e eccentricity &gt; 1
+     * @param M mean anomaly
+     * @return true anomaly (rad)
+     */
+    static double hyperbolicMeanToTrue(double e, double M);
+
+    /** Compute the hyperbolic mean anomaly from the true anomaly.
+     * @param e eccentricity &gt; 1
+     * @param v true anomaly (rad)
+     * @return mean anomaly
+     */
+    static double hyperbolicTrueToMean(double e, double v);
+};
+
+#endif
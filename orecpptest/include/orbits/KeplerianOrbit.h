@@ -0,0 +1,153 @@
+#ifndef _KEPLERIAN_ORBIT_H_
+#define _KEPLERIAN_ORBIT_H_
+
+#include "orbits/Orbit.h"
+
+/** This class handles traditional Keplerian orbital parameters.
+ * <p>The parameters used internally are the classical Keplerian elements:</p>
+ * <pre>
+ *     a
+ *     e
+ *     i
+ *     ω
+ *     Ω
+ *     v
+ * </pre>
+ * <p>where ω stands for the Perigee Argument, Ω stands for the Right
+ * Ascension of the Ascending Node and v stands for the true anomaly.</p>
+ * <p>This class supports hyperbolic orbits, using the convention that semi
+ * major axis is negative for such orbits (and of course eccentricity is
+ * greater than 1).</p>
+ * <p>When orbit is either equatorial or circular, some Keplerian elements
+ * (more precisely ω and Ω) become ambiguous so this class should not be used
+ * for such orbits. For this reason, {@link EquinoctialOrbit equinoctial
+ * orbits} is the recommended way to represent orbits.</p>
+ * <p>Instances of this class are guaranteed to be immutable.</p>
+ */
+class KeplerianOrbit : public Orbit
+{
+public:
+    /** Creates a new instance.
+     * @param a semi-major axis (m), negative for hyperbolic orbits
+     * @param e eccentricity
+     * @param i inclination (rad)
+     * @param pa perigee argument (ω, rad)
+     * @param raan right ascension of ascending node (Ω, rad)
+     * @param anomaly mean, eccentric or true anomaly (rad)
+     * @param type type of anomaly
+     * @param date date of the orbital parameters
+     * @param mu central attraction coefficient (m³/s²)
+     */
+    KeplerianOrbit(double a, double e, double i, double pa, double raan, double anomaly, PositionAngle type,
+                   const LinearTime& date, double mu);
+
+    /** Constructor from Cartesian parameters.
+     * @param pv position-velocity
+     * @param date date of the orbital parameters
+     * @param mu central attraction coefficient (m³/s²)
+     */
+    KeplerianOrbit(const PVCoordinates& pv, const LinearTime& date, double mu);
+
+    /** Constructor from any kind of orbital parameters.
+     * @param orbit orbital parameters to copy
+     */
+    explicit KeplerianOrbit(const Orbit& orbit);
+
+    /** {@inheritDoc} */
+    Type getType() const override;
+
+    /** {@inheritDoc} */
+    double getA() const override;
+
+    /** {@inheritDoc} */
+    double getE() const override;
+
+    /** {@inheritDoc} */
+    double getI() const override;
+
+    /** Get the perigee argument.
+     * @return perigee argument (rad)
+     */
+    double getPerigeeArgument() const;
+
+    /** Get the right ascension of the ascending node.
+     * @return right ascension of the ascending node (rad)
+     */
+    double getRightAscensionOfAscendingNode() const;
+
+    /** Get the anomaly.
+     * @param type type of the angle
+     * @return anomaly (rad)
+     */
+    double getAnomaly(PositionAngle type) const;
+
+    /** Get the true anomaly.
+     * @return true anomaly (rad)
+     */
+    double getTrueAnomaly() const;
+
+    /** Get the eccentric anomaly.
+     * @return eccentric anomaly (rad), hyperbolic eccentric anomaly for hyperbolic orbits
+     */
+    double getEccentricAnomaly() const;
+
+    /** Get the mean anomaly.
+     * @return mean anomaly (rad)
+     */
+    double getMeanAnomaly() const;
+
+    /** {@inheritDoc} */
+    double getEquinoctialEx() const override;
+
+    /** {@inheritDoc} */
+    double getEquinoctialEy() const override;
+
+    /** {@inheritDoc} */
+    double getHx() const override;
+
+    /** {@inheritDoc} */
+    double getHy() const override;
+
+    /** {@inheritDoc} */
+    double getLv() const override;
+
+    /** {@inheritDoc} */
+    double getLE() const override;
+
+    /** {@inheritDoc} */
+    double getLM() const override;
+
+    /** {@inheritDoc} */
+    PVCoordinates getPVCoordinates() const override;
+
+    /** Get a time-shifted orbit.
+     * <p>The orbit can be slightly shifted to close dates. This shift is
+     * based on a simple Keplerian model. It is <em>not</em> intended as a
+     * replacement for proper orbit propagation but should be sufficient for
+     * small time shifts or coarse accuracy.</p>
+     * @param dt time shift (s)
+     * @return a new orbit, shifted with respect to the instance (which is immutable)
+     */
+    KeplerianOrbit shiftedBy(double dt) const;
+
+private:
+    /** Semi-major axis (m). */
+    double a;
+
+    /** Eccentricity. */
+    double e;
+
+    /** Inclination (rad). */
+    double i;
+
+    /** Perigee Argument (rad). */
+    double pa;
+
+    /** Right Ascension of Ascending Node (rad). */
+    double raan;
+
+    /** True anomaly (rad). */
+    double v;
+};
+
+#endif
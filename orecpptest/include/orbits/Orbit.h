@@ -0,0 +1,168 @@
+#ifndef _ORBIT_H_
+#define _ORBIT_H_
+
+#include "time/LinearTime.h"
+#include "utils/PVCoordinates.h"
+
+/** Base class for orbital parameters.
+ * <p>An orbit is a set of six parameters defining the state of an object
+ * moving under a central attraction at some date, together with the
+ * gravitational constant of the central body. Concrete classes hold
+ * different parameter sets ({@link CartesianOrbit}, {@link KeplerianOrbit},
+ * {@link CircularOrbit} and {@link EquinoctialOrbit}) but all of them
+ * provide the equinoctial parameters and the position-velocity, which are
+ * used to convert from one set to another: each concrete class has a
+ * constructor from any orbit.</p>
+ * <p>Orbits are expressed in an inertial frame centered on the attracting
+ * body, the frame is implicit.</p>
+ * <p>Instances of this class are guaranteed to be immutable.</p>
+ * @see KeplerianPropagator
+ */
+class Orbit
+{
+public:
+    /** Orbital parameters sets. */
+    enum Type
+    {
+        /** Position and velocity. */
+        CARTESIAN,
+
+        /** Circular parameters (a, ex, ey, i, Ω, α). */
+        CIRCULAR,
+
+        /** Equinoctial parameters (a, ex, ey, hx, hy, L). */
+        EQUINOCTIAL,
+
+        /** Keplerian parameters (a, e, i, ω, Ω, anomaly). */
+        KEPLERIAN
+    };
+
+    /** Types of position angles (anomalies, latitude or longitude arguments). */
+    enum PositionAngle
+    {
+        /** Mean angle. */
+        MEAN_ANOMALY,
+
+        /** Eccentric angle. */
+        ECCENTRIC_ANOMALY,
+
+        /** True angle. */
+        TRUE_ANOMALY
+    };
+
+    /** Destructor. */
+    virtual ~Orbit();
+
+    /** Get the parameters set type.
+     * @return parameters set type
+     */
+    virtual Type getType() const = 0;
+
+    /** Get the semi-major axis.
+     * <p>Note that the semi-major axis is considered negative for hyperbolic orbits.</p>
+     * @return semi-major axis (m)
+     */
+    virtual double getA() const = 0;
+
+    /** Get the first component of the equinoctial eccentricity vector.
+     * @return e cos(ω + Ω), first component of the eccentricity vector
+     */
+    virtual double getEquinoctialEx() const = 0;
+
+    /** Get the second component of the equinoctial eccentricity vector.
+     * @return e sin(ω + Ω), second component of the eccentricity vector
+     */
+    virtual double getEquinoctialEy() const = 0;
+
+    /** Get the first component of the inclination vector.
+     * @return tan(i/2) cos(Ω), first component of the inclination vector
+     */
+    virtual double getHx() const = 0;
+
+    /** Get the second component of the inclination vector.
+     * @return tan(i/2) sin(Ω), second component of the inclination vector
+     */
+    virtual double getHy() const = 0;
+
+    /** Get the eccentric longitude argument.
+     * @return E + ω + Ω, eccentric longitude argument (rad)
+     */
+    virtual double getLE() const = 0;
+
+    /** Get the true longitude argument.
+     * @return v + ω + Ω, true longitude argument (rad)
+     */
+    virtual double getLv() const = 0;
+
+    /** Get the mean longitude argument.
+     * @return M + ω + Ω, mean longitude argument (rad)
+     */
+    virtual double getLM() const = 0;
+
+    /** Get the eccentricity.
+     * @return eccentricity
+     */
+    virtual double getE() const = 0;
+
+    /** Get the inclination.
+     * @return inclination (rad)
+     */
+    virtual double getI() const = 0;
+
+    /** Get the position-velocity.
+     * @return position-velocity in the inertial frame of the orbit
+     */
+    virtual PVCoordinates getPVCoordinates() const = 0;
+
+    /** Get the date of the orbital parameters.
+     * @return date of the orbital parameters
+     */
+    const LinearTime& getDate() const;
+
+    /** Get the central attraction coefficient used for position and velocity conversions.
+     * @return central attraction coefficient (m³/s²)
+     */
+    double getMu() const;
+
+    /** Get the Keplerian period.
+     * <p>The Keplerian period is computed directly from semi major axis
+     * and central acceleration constant, it is infinite for hyperbolic orbits.</p>
+     * @return Keplerian period (s)
+     */
+    double getKeplerianPeriod() const;
+
+    /** Get the Keplerian mean motion.
+     * <p>The Keplerian mean motion is computed directly from semi major axis
+     * and central acceleration constant.</p>
+     * @return Keplerian mean motion (rad/s)
+     */
+    double getKeplerianMeanMotion() const;
+
+    /** Check if the orbit is elliptic.
+     * @return true if the semi-major axis is positive
+     */
+    bool isElliptical() const;
+
+protected:
+    /** Simple constructor.
+     * @param date date of the orbital parameters
+     * @param mu central attraction coefficient (m³/s²)
+     */
+    Orbit(const LinearTime& date, double mu);
+
+    /** Compute the semi-major axis corresponding to a position-velocity.
+     * @param pv position-velocity
+     * @param mu central attraction coefficient (m³/s²)
+     * @return semi-major axis (m), negative for hyperbolic orbits
+     */
+    static double computeA(const PVCoordinates& pv, double mu);
+
+private:
+    /** Date of the orbital parameters. */
+    LinearTime date;
+
+    /** Central attraction coefficient (m³/s²). */
+    double mu;
+};
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef _CLASSICAL_RUNGE_KUTTA_INTEGRATOR_H_
+#define _CLASSICAL_RUNGE_KUTTA_INTEGRATOR_H_
+
+#include "propagation/ODEIntegrator.h"
+
+/** Classical fourth order Runge-Kutta integrator with fixed step.
+ * <p>The derivative at step end is reused as first stage of the next step,
+ * so a step costs four evaluations. The dense output is the cubic Hermite
+ * interpolation between the step ends, its error is of the same order as
+ * the one of the integrator.</p>
+ * <p>Instances of this class are <em>not</em> thread-safe.</p>
+ */
+class ClassicalRungeKuttaIntegrator : public ODEIntegrator
+{
+public:
+    /** Simple constructor.
+     * @param step integration step size (s), its sign is ignored, steps
+     * fail if it is zero or NaN
+     */
+    explicit ClassicalRungeKuttaIntegrator(double step);
+
+    /** Get the integration step size.
+     * @return integration step size (s)
+     */
+    double getStep() const;
+
+    /** {@inheritDoc}
+     * <p>The step size to try is ignored, steps are always the fixed one
+     * except the last one which is shortened to stop at tEnd. The step fails
+     * if the fixed step size is zero or NaN.</p>
+     */
+    bool step(Equations& equations, double& t, double* y, double* yDot, double& h, double tEnd,
+              StepInterpolator& interpolator) override;
+
+    /** {@inheritDoc}
+     * <p>The Hermite dense output needs no extra evaluation, this does nothing.</p>
+     */
+    void prepareInterpolation(Equations& equations, StepInterpolator& interpolator) override;
+
+private:
+    /** Dimension of the state. */
+    static const int N = StepInterpolator::DIMENSION;
+
+    /** Integration step size. */
+    double fixedStep;
+
+    /** State at step start. */
+    double y0[N];
+
+    /** Derivative at step start. */
+    double f0[N];
+
+    /** Intermediate state. */
+    double yTmp[N];
+
+    /** Stages. */
+    double k2[N];
+    double k3[N];
+    double k4[N];
+};
+
+#endif
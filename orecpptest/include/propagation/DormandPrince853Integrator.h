@@ -0,0 +1,101 @@
+#ifndef _DORMAND_PRINCE_853_INTEGRATOR_H_
+#define _DORMAND_PRINCE_853_INTEGRATOR_H_
+
+#include "propagation/ODEIntegrator.h"
+
+/** Dormand-Prince 8(5,3) adaptive step integrator.
+ * <p>This is the embedded Runge-Kutta method of Hairer's DOP853 code: twelve
+ * stages for an eighth order step, the local error being estimated by
+ * combining fifth and third order embedded solutions. The derivative at
+ * step end is the thirteenth stage and the first stage of the next step, so
+ * an accepted step costs twelve evaluations.</p>
+ * <p>The error of each component is scaled by absTol + relTol max(|y₀|, |y₁|)
+ * and the step is accepted when the root mean square of the scaled errors
+ * is at most one. Step sizes follow Hairer's control, with the step size
+ * ratio limited to [1/3, 6] and no increase right after a rejection.</p>
+ * <p>Dense output is of order seven. It needs three extra evaluations
+ * which are only performed by {@link #prepareInterpolation}, the plain
+ * step only sets up the cubic Hermite interpolation.</p>
+ * <p>Instances of this class are <em>not</em> thread-safe.</p>
+ */
+class DormandPrince853Integrator : public ODEIntegrator
+{
+public:
+    /** Build an integrator with the same tolerances for all components.
+     * @param minStep minimal step size (s), the last step before tEnd may be smaller
+     * @param maxStep maximal step size (s)
+     * @param absTol absolute tolerance
+     * @param relTol relative tolerance
+     */
+    DormandPrince853Integrator(double minStep, double maxStep, double absTol, double relTol);
+
+    /** Build an integrator with tolerances per component.
+     * @param minStep minimal step size (s), the last step before tEnd may be smaller
+     * @param maxStep maximal step size (s)
+     * @param absTol absolute tolerances, {@link StepInterpolator#DIMENSION} elements
+     * @param relTol relative tolerances, {@link StepInterpolator#DIMENSION} elements
+     */
+    DormandPrince853Integrator(double minStep, double maxStep, const double* absTol, const double* relTol);
+
+    /** {@inheritDoc}
+     * <p>A null or wrongly signed step size to try is replaced by an
+     * estimate from the derivatives, at the cost of one evaluation. The
+     * step fails if the maximal step size is zero or NaN.</p>
+     */
+    bool step(Equations& equations, double& t, double* y, double* yDot, double& h, double tEnd,
+              StepInterpolator& interpolator) override;
+
+    /** {@inheritDoc} */
+    void prepareInterpolation(Equations& equations, StepInterpolator& interpolator) override;
+
+    /** Number of stages, including the dense output ones. */
+    static const int STAGES = 16;
+
+private:
+    /** Dimension of the state. */
+    static const int N = StepInterpolator::DIMENSION;
+
+    /** Estimate the initial step size.
+     * @param equations differential equations
+     * @param t current time
+     * @param y current state
+     * @param yDot state derivative at t
+     * @param forward integration direction
+     * @return signed initial step size
+     */
+    double initializeStep(Equations& equations, double t, const double* y, const double* yDot, bool forward);
+
+    /** Compute an intermediate state from the previous stages.
+     * @param s stage index, from 1 to {@link #STAGES} - 1
+     */
+    void computeStageState(int s);
+
+    /** Minimal step size. */
+    double minStep;
+
+    /** Maximal step size. */
+    double maxStep;
+
+    /** Absolute tolerances. */
+    double absTol[N];
+
+    /** Relative tolerances. */
+    double relTol[N];
+
+    /** Time at last step start. */
+    double t0;
+
+    /** Last step size. */
+    double h0;
+
+    /** State at last step start. */
+    double y0[N];
+
+    /** Intermediate state. */
+    double yTmp[N];
+
+    /** Stages of the last step. */
+    double k[STAGES][N];
+};
+
+#endif
@@ -0,0 +1,121 @@
+#ifndef _ECKSTEIN_HECHLER_BATCH_PROPAGATOR_H_
+#define _ECKSTEIN_HECHLER_BATCH_PROPAGATOR_H_
+
+#include <stddef.h>
+#include <vector>
+#include "orbits/Orbit.h"
+#include "utils/EarthModels.h"
+
+/** Eckstein-Hechler propagator for many near circular orbits at once.
+ * <p>The propagator holds a table of orbits in structure of arrays layout:
+ * the mean parameters and model coefficients of each orbit (see {@link
+ * EcksteinHechlerKernels}) are computed when the orbit is added, one array
+ * per constant, so propagation streams through contiguous memory without
+ * any per-orbit object or virtual call. Results agree with the ones of
+ * {@link EcksteinHechlerPropagator} for each orbit, up to rounding in the
+ * dates offsets.</p>
+ * <p>All orbits share the same gravity field.</p>
+ * <p>This class is not thread-safe while orbits are added, propagation
+ * methods can be called concurrently.</p>
+ */
+class EcksteinHechlerBatchPropagator
+{
+public:
+    /** Build an empty propagator.
+     * @param referenceRadius reference radius of the gravity field (m)
+     * @param mu central attraction coefficient (m³/s²)
+     * @param c20 un-normalized zonal coefficient
+     * @param c30 un-normalized zonal coefficient
+     * @param c40 un-normalized zonal coefficient
+     * @param c50 un-normalized zonal coefficient
+     * @param c60 un-normalized zonal coefficient
+     */
+    EcksteinHechlerBatchPropagator(double referenceRadius, double mu,
+                                   double c20, double c30, double c40, double c50, double c60);
+
+    /** Build an empty propagator with a reference gravity field.
+     * @param Model model tag, for example {@link EIGEN5C}
+     * @return propagator
+     */
+    template<typename Model>
+    static EcksteinHechlerBatchPropagator create()
+    {
+        static_assert(ZonalModel<Model>::MAX_DEGREE >= 6, "the model needs zonal coefficients up to C60");
+        return EcksteinHechlerBatchPropagator(ZonalModel<Model>::EQUATORIAL_RADIUS, ZonalModel<Model>::MU,
+                                              ZonalModel<Model>::getUnnormalizedC(2), ZonalModel<Model>::getUnnormalizedC(3),
+                                              ZonalModel<Model>::getUnnormalizedC(4), ZonalModel<Model>::getUnnormalizedC(5),
+                                              ZonalModel<Model>::getUnnormalizedC(6));
+    }
+
+    /** Reserve room for orbits.
+     * @param capacity number of orbits to reserve room for
+     */
+    void reserve(size_t capacity);
+
+    /** Add an orbit.
+     * <p>The central attraction coefficient of the orbit is ignored, the
+     * one of the gravity field is used.</p>
+     * @param orbit initial osculating orbit to add
+     * @return true if the orbit was added, false if the model cannot handle it
+     * (see {@link EcksteinHechlerPropagator#Status})
+     */
+    bool addOrbit(const Orbit& orbit);
+
+    /** Get the number of orbits.
+     * @return number of orbits
+     */
+    size_t getSize() const;
+
+    /** Propagate all orbits to several dates.
+     * <p>Output arrays hold <code>getSize() * count</code> elements, the
+     * state of orbit s at date k being at index <code>s * count + k</code>.</p>
+     * @param dates target dates
+     * @param count number of dates
+     * @param x placeholder for the positions abscissas (m)
+     * @param y placeholder for the positions ordinates (m)
+     * @param z placeholder for the positions heights (m)
+     * @param vx placeholder for the velocities abscissas (m/s)
+     * @param vy placeholder for the velocities ordinates (m/s)
+     * @param vz placeholder for the velocities heights (m/s)
+     */
+    void propagate(const LinearTime* dates, size_t count,
+                   double* x, double* y, double* z, double* vx, double* vy, double* vz) const;
+
+    /** Propagate all orbits to one date.
+     * <p>Output arrays hold <code>getSize()</code> elements, in the order
+     * the orbits were added.</p>
+     * @param date target date
+     * @param x placeholder for the positions abscissas (m)
+     * @param y placeholder for the positions ordinates (m)
+     * @param z placeholder for the positions heights (m)
+     * @param vx placeholder for the velocities abscissas (m/s)
+     * @param vy placeholder for the velocities ordinates (m/s)
+     * @param vz placeholder for the velocities heights (m/s)
+     */
+    void propagate(const LinearTime& date,
+                   double* x, double* y, double* z, double* vx, double* vy, double* vz) const;
+
+private:
+    /** Reference radius of the gravity field. */
+    double referenceRadius;
+
+    /** Central attraction coefficient. */
+    double mu;
+
+    /** Un-normalized zonal coefficients, indexed by degree. */
+    double ck0[7];
+
+    /** Number of orbits. */
+    size_t size;
+
+    /** Capacity of the constants table, which is also the stride between constants of one orbit. */
+    size_t capacity;
+
+    /** Orbit constants, one array of {@link #capacity} elements per constant. */
+    std::vector<double> constants;
+
+    /** Orbit epochs. */
+    std::vector<LinearTime> epochs;
+};
+
+#endif
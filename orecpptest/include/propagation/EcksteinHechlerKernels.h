@@ -0,0 +1,578 @@
+#ifndef _ECKSTEIN_HECHLER_KERNELS_H_
+#define _ECKSTEIN_HECHLER_KERNELS_H_
+
+#include <stddef.h>
+#include <cmath>
+#include "orbits/KeplerSolver.h"
+
+/** Eckstein-Hechler analytical model kernels.
+ * <p>The model propagates mean circular parameters with secular drifts of
+ * the node, latitude argument and eccentricity vector due to the zonal
+ * harmonics C20 to C60, then adds the short periodic terms to get the
+ * osculating parameters. It is valid for near circular orbits (e &lt; 0.1,
+ * with poor accuracy above 0.005), neither equatorial nor critically
+ * inclined, see {@link EcksteinHechlerPropagator}.</p>
+ * <p>Every coefficient of the secular drifts and periodic terms depends
+ * only on the mean parameters, it is computed once per orbit by {@link
+ * #initialize}. The {@link #CONSTANTS} orbit constants are read as
+ * <code>constants[c * stride]</code>, with c one of the indices below: a
+ * single orbit uses a stride of 1, a table of orbits in structure of arrays
+ * layout uses its capacity as stride and points to the column of the
+ * orbit.</p>
+ * <p>Each evaluation needs the sine and cosine of three angles (the
+ * eccentricity vector rotation, the mean latitude argument and the mean
+ * node), the periodic corrections being applied to the angles through
+ * {@link KeplerSolver#sinCosSmall(double, double&, double&)}. Batch kernels
+ * use structure of arrays layouts, arrays may not overlap: they compute
+ * these sines and cosines for a block of {@link #BLOCK_SIZE} lanes first,
+ * the rest of the evaluation being straight arithmetic.</p>
+ */
+struct EcksteinHechlerKernels
+{
+    /** Indices of the orbit constants. */
+    enum Constant {
+        A, EX, EY, SIN_I, COS_I, I, RAAN, ALPHA_M, MU,
+        ECCENTRICITY_RATE, RAAN_RATE, ALPHA_RATE,
+        EX_SIN, EY_SIN, EY_COS, EPS2, KH, KL,
+        AX1, AY1, AS1, AC2, AXY3, AS3, AC4, AS5, AC6,
+        EX1, EXX2, EXY2, EX3, EX4,
+        EY1, EYX2, EYY2, EY3, EY4,
+        RX1, RY1, R2, R3, RL,
+        IY1, IX1, I2, I3, IH,
+        LX1, LY1, L2, L3, LL,
+        CONSTANTS
+    };
+
+    /** Number of lanes processed together by batch kernels. */
+    static const size_t BLOCK_SIZE = 64;
+
+    /** Number of Halley iterations for Kepler's equation, enough up to e = 0.3. */
+    static const int ITERATIONS = 2;
+
+    /** Compute the constants of an orbit.
+     * @param a mean semi-major axis (m)
+     * @param ex mean first component of the circular eccentricity vector
+     * @param ey mean second component of the circular eccentricity vector
+     * @param i mean inclination (rad)
+     * @param raan mean right ascension of ascending node (rad)
+     * @param alphaM mean latitude argument (rad)
+     * @param referenceRadius reference radius of the gravity field (m)
+     * @param mu central attraction coefficient (m³/s²)
+     * @param ck0 un-normalized zonal coefficients, indexed by degree (C20 to C60)
+     * @param constants placeholder for the {@link #CONSTANTS} orbit constants
+     * @param stride distance between two consecutive constants
+     */
+    static inline void initialize(double a, double ex, double ey, double i, double raan, double alphaM,
+                                  double referenceRadius, double mu, const double* ck0,
+                                  double* constants, size_t stride)
+    {
+        double q  = referenceRadius / a;
+        double ql = q * q;
+        const double g2 = ck0[2] * ql;
+        ql *= q;
+        const double g3 = ck0[3] * ql;
+        ql *= q;
+        const double g4 = ck0[4] * ql;
+        ql *= q;
+        const double g5 = ck0[5] * ql;
+        ql *= q;
+        const double g6 = ck0[6] * ql;
+
+        const double cosI1 = std::cos(i);
+        const double sinI1 = std::sin(i);
+        const double sinI2 = sinI1 * sinI1;
+        const double sinI4 = sinI2 * sinI2;
+        const double sinI6 = sinI2 * sinI4;
+
+        // secular effects
+        const double xnotDot = std::sqrt(mu / a) / a;
+        const double rdpom   = -0.75 * g2 * (4.0 - 5.0 * sinI2);
+        const double rdpomp  = 7.5 * g4 * (1.0 - 31.0 / 8.0 * sinI2 + 49.0 / 16.0 * sinI4) -
+                               13.125 * g6 * (1.0 - 8.0 * sinI2 + 129.0 / 8.0 * sinI4 - 297.0 / 32.0 * sinI6);
+
+        q = 3.0 / (32.0 * rdpom);
+        const double eps1 = q * g4 * sinI2 * (30.0 - 35.0 * sinI2) -
+                            175.0 * q * g6 * sinI2 * (1.0 - 3.0 * sinI2 + 2.0625 * sinI4);
+        q = 3.0 * sinI1 / (8.0 * rdpom);
+        const double eps2 = q * g3 * (4.0 - 5.0 * sinI2) - q * g5 * (10.0 - 35.0 * sinI2 + 26.25 * sinI4);
+
+        const double ommD = cosI1 * (1.50    * g2 - 2.25 * g2 * g2 * (2.5 - 19.0 / 6.0 * sinI2) +
+                                     0.9375  * g4 * (7.0 * sinI2 - 4.0) +
+                                     3.28125 * g6 * (2.0 - 9.0 * sinI2 + 8.25 * sinI4));
+
+        const double rdl = 1.0 - 1.50 * g2 * (3.0 - 4.0 * sinI2);
+        const double aMD = rdl +
+                           2.25 * g2 * g2 * (9.0 - 263.0 / 12.0 * sinI2 + 341.0 / 24.0 * sinI4) +
+                           15.0 / 16.0 * g4 * (8.0 - 31.0 * sinI2 + 24.5 * sinI4) +
+                           105.0 / 32.0 * g6 * (-10.0 / 3.0 + 25.0 * sinI2 - 48.75 * sinI4 + 27.5 * sinI6);
+
+        double* c = constants;
+        c[A       * stride] = a;
+        c[EX      * stride] = ex;
+        c[EY      * stride] = ey;
+        c[SIN_I   * stride] = sinI1;
+        c[COS_I   * stride] = cosI1;
+        c[I       * stride] = i;
+        c[RAAN    * stride] = raan;
+        c[ALPHA_M * stride] = alphaM;
+        c[MU      * stride] = mu;
+        c[ECCENTRICITY_RATE * stride] = xnotDot * (rdpom + rdpomp);
+        c[RAAN_RATE         * stride] = xnotDot * ommD;
+        c[ALPHA_RATE        * stride] = xnotDot * aMD;
+        c[EX_SIN  * stride] = eps2 - (1.0 - eps1) * ey;
+        c[EY_SIN  * stride] = (1.0 + eps1) * ex;
+        c[EY_COS  * stride] = ey - eps2;
+        c[EPS2    * stride] = eps2;
+
+        // periodic effects
+        const double qq = -1.5 * g2 / rdl;
+        const double qA = 0.75 * g2 * g2 * sinI2;
+        const double qB = 0.25 * g4 * sinI2;
+        const double qC = 105.0 / 16.0 * g6 * sinI2;
+        const double qD = -0.75 * g3 * sinI1;
+        const double qE = 3.75 * g5 * sinI1;
+        const double kh = 0.375 / rdpom;
+        c[KH * stride] = kh;
+        c[KL * stride] = kh / sinI1;
+
+        c[AX1  * stride] = qq * (2.0 - 3.5 * sinI2);
+        c[AY1  * stride] = qq * (2.0 - 2.5 * sinI2);
+        c[AS1  * stride] = qD * (4.0 - 5.0 * sinI2) +
+                           qE * (2.625 * sinI4 - 3.5 * sinI2 + 1.0);
+        c[AC2  * stride] = qq * sinI2 +
+                           qA * 7.0 * (2.0 - 3.0 * sinI2) +
+                           qB * (15.0 - 17.5 * sinI2) +
+                           qC * (3.0 * sinI2 - 1.0 - 33.0 / 16.0 * sinI4);
+        c[AXY3 * stride] = qq * 3.5 * sinI2;
+        c[AS3  * stride] = qD * 5.0 / 3.0 * sinI2 +
+                           qE * 7.0 / 6.0 * sinI2 * (1.0 - 1.125 * sinI2);
+        c[AC4  * stride] = qA * sinI2 +
+                           qB * 4.375 * sinI2 +
+                           qC * 0.75 * (1.1 * sinI4 - sinI2);
+        c[AS5  * stride] = qE * 21.0 / 80.0 * sinI4;
+        c[AC6  * stride] = qC * -11.0 / 80.0 * sinI4;
+
+        c[EX1  * stride] = qq * (1.0 - 1.25 * sinI2);
+        c[EXX2 * stride] = qq * 0.5 * (3.0 - 5.0 * sinI2);
+        c[EXY2 * stride] = qq * (2.0 - 1.5 * sinI2);
+        c[EX3  * stride] = qq * 7.0 / 12.0 * sinI2;
+        c[EX4  * stride] = qq * 17.0 / 8.0 * sinI2;
+
+        c[EY1  * stride] = qq * (1.0 - 1.75 * sinI2);
+        c[EYX2 * stride] = qq * (1.0 - 3.0 * sinI2);
+        c[EYY2 * stride] = qq * (2.0 * sinI2 - 1.5);
+        c[EY3  * stride] = qq * 7.0 / 12.0 * sinI2;
+        c[EY4  * stride] = qq * 17.0 / 8.0 * sinI2;
+
+        q = -qq * cosI1;
+        c[RX1  * stride] =  3.5 * q;
+        c[RY1  * stride] = -2.5 * q;
+        c[R2   * stride] = -0.5 * q;
+        c[R3   * stride] =  7.0 / 6.0 * q;
+        c[RL   * stride] = g3 * cosI1 * (4.0 - 15.0 * sinI2) -
+                           2.5 * g5 * cosI1 * (4.0 - 42.0 * sinI2 + 52.5 * sinI4);
+
+        q = 0.5 * qq * sinI1 * cosI1;
+        c[IY1  * stride] =  q;
+        c[IX1  * stride] = -q;
+        c[I2   * stride] =  q;
+        c[I3   * stride] =  q * 7.0 / 3.0;
+        c[IH   * stride] = -g3 * cosI1 * (4.0 - 5.0 * sinI2) +
+                           2.5 * g5 * cosI1 * (4.0 - 14.0 * sinI2 + 10.5 * sinI4);
+
+        c[LX1  * stride] = qq * (7.0 - 77.0 / 8.0 * sinI2);
+        c[LY1  * stride] = qq * (55.0 / 8.0 * sinI2 - 7.50);
+        c[L2   * stride] = qq * (1.25 * sinI2 - 0.5);
+        c[L3   * stride] = qq * (77.0 / 24.0 * sinI2 - 7.0 / 6.0);
+        c[LL   * stride] = g3 * (53.0 * sinI2 - 4.0 - 57.5 * sinI4) +
+                           2.5 * g5 * (4.0 - 96.0 * sinI2 + 269.5 * sinI4 - 183.75 * sinI6);
+    }
+
+    /** Compute the osculating circular parameters of one orbit at one date.
+     * @param constants orbit constants from {@link #initialize}
+     * @param stride distance between two consecutive constants
+     * @param dt offset of the date with respect to orbit epoch (s)
+     * @param a placeholder for the semi-major axis (m)
+     * @param ex placeholder for the first component of the circular eccentricity vector
+     * @param ey placeholder for the second component of the circular eccentricity vector
+     * @param i placeholder for the inclination (rad)
+     * @param raan placeholder for the right ascension of ascending node (rad)
+     * @param alphaM placeholder for the mean latitude argument (rad)
+     */
+    static inline void osculatingParameters(const double* constants, size_t stride, double dt,
+                                            double& a, double& ex, double& ey,
+                                            double& i, double& raan, double& alphaM)
+    {
+        const double x   = constants[ECCENTRICITY_RATE * stride] * dt;
+        const double xlm = constants[ALPHA_M * stride] + constants[ALPHA_RATE * stride] * dt;
+        double exm, eym, rda, rdex, rdey, rdxi, rdom, rdxl;
+        corrections(constants, stride, std::sin(x), std::cos(x), std::sin(xlm), std::cos(xlm),
+                    exm, eym, rda, rdex, rdey, rdxi, rdom, rdxl);
+        a      = constants[A * stride] * (1.0 + rda);
+        ex     = exm + rdex;
+        ey     = eym + rdey;
+        i      = constants[I * stride] + rdxi;
+        raan   = constants[RAAN * stride] + constants[RAAN_RATE * stride] * dt + rdom;
+        alphaM = xlm + rdxl;
+    }
+
+    /** Propagate one orbit to one date.
+     * @param constants orbit constants from {@link #initialize}
+     * @param stride distance between two consecutive constants
+     * @param dt offset of the date with respect to orbit epoch (s)
+     * @param x placeholder for the position abscissa (m)
+     * @param y placeholder for the position ordinate (m)
+     * @param z placeholder for the position height (m)
+     * @param vx placeholder for the velocity abscissa (m/s)
+     * @param vy placeholder for the velocity ordinate (m/s)
+     * @param vz placeholder for the velocity height (m/s)
+     */
+    static inline void propagate(const double* constants, size_t stride, double dt,
+                                 double& x, double& y, double& z, double& vx, double& vy, double& vz)
+    {
+        const double angle = constants[ECCENTRICITY_RATE * stride] * dt;
+        const double xlm   = constants[ALPHA_M * stride] + constants[ALPHA_RATE * stride] * dt;
+        const double omm   = constants[RAAN * stride] + constants[RAAN_RATE * stride] * dt;
+        double a, ex, ey, sinI, cosI, sinRaan, cosRaan, sinAlphaM, cosAlphaM;
+        osculating(constants, stride,
+                   std::sin(angle), std::cos(angle), std::sin(xlm), std::cos(xlm), std::sin(omm), std::cos(omm),
+                   a, ex, ey, sinI, cosI, sinRaan, cosRaan, sinAlphaM, cosAlphaM);
+        double d = ex * sinAlphaM - ey * cosAlphaM;
+        for (int k = 0; k < ITERATIONS; ++k) {
+            halley(ex, ey, sinAlphaM, cosAlphaM, d);
+        }
+        double u, v, uDot, vDot;
+        inPlane(constants[MU * stride], a, ex, ey, sinAlphaM, cosAlphaM, d, u, v, uDot, vDot);
+        project(sinI, cosI, sinRaan, cosRaan, u, v, uDot, vDot, x, y, z, vx, vy, vz);
+    }
+
+    /** Propagate one orbit to several dates.
+     * @param constants orbit constants from {@link #initialize}
+     * @param stride distance between two consecutive constants
+     * @param dt offsets of the dates with respect to orbit epoch (s)
+     * @param count number of dates
+     * @param x placeholder for the positions abscissas (m)
+     * @param y placeholder for the positions ordinates (m)
+     * @param z placeholder for the positions heights (m)
+     * @param vx placeholder for the velocities abscissas (m/s)
+     * @param vy placeholder for the velocities ordinates (m/s)
+     * @param vz placeholder for the velocities heights (m/s)
+     */
+    static inline void propagate(const double* constants, size_t stride, const double* dt, size_t count,
+                                 double* x, double* y, double* z, double* vx, double* vy, double* vz)
+    {
+        // copy the constants locally, so they are loop invariants
+        double local[CONSTANTS];
+        for (int c = 0; c < CONSTANTS; ++c) {
+            local[c] = constants[c * stride];
+        }
+        for (size_t start = 0; start < count; start += BLOCK_SIZE) {
+            const size_t size = (count - start < BLOCK_SIZE) ? count - start : BLOCK_SIZE;
+            propagateBlock<0>(local, 1, dt + start, size,
+                              x + start, y + start, z + start, vx + start, vy + start, vz + start);
+        }
+    }
+
+    /** Propagate several orbits to one date each.
+     * @param constants constants of the first orbit, the constants of all
+     * orbits being stored in structure of arrays layout
+     * @param stride distance between two consecutive constants of one orbit
+     * @param dt offsets of the dates with respect to the orbits epochs (s)
+     * @param count number of orbits
+     * @param x placeholder for the positions abscissas (m)
+     * @param y placeholder for the positions ordinates (m)
+     * @param z placeholder for the positions heights (m)
+     * @param vx placeholder for the velocities abscissas (m/s)
+     * @param vy placeholder for the velocities ordinates (m/s)
+     * @param vz placeholder for the velocities heights (m/s)
+     */
+    static inline void propagateOrbits(const double* constants, size_t stride, const double* dt, size_t count,
+                                       double* x, double* y, double* z, double* vx, double* vy, double* vz)
+    {
+        for (size_t start = 0; start < count; start += BLOCK_SIZE) {
+            const size_t size = (count - start < BLOCK_SIZE) ? count - start : BLOCK_SIZE;
+            propagateBlock<1>(constants + start, stride, dt + start, size,
+                              x + start, y + start, z + start, vx + start, vy + start, vz + start);
+        }
+    }
+
+private:
+    /** Rotate an angle by a small increment.
+     * @param sinA sine of the angle
+     * @param cosA cosine of the angle
+     * @param delta small increment (rad)
+     * @param sinB placeholder for the sine of the rotated angle
+     * @param cosB placeholder for the cosine of the rotated angle
+     */
+    static inline void rotate(double sinA, double cosA, double delta, double& sinB, double& cosB)
+    {
+        double sinD, cosD;
+        KeplerSolver::sinCosSmall(delta, sinD, cosD);
+        sinB = sinA * cosD + cosA * sinD;
+        cosB = cosA * cosD - sinA * sinD;
+    }
+
+    /** Compute the secular eccentricity vector and the periodic corrections.
+     * @param c orbit constants
+     * @param stride distance between two consecutive constants
+     * @param sx sine of the eccentricity vector rotation angle
+     * @param cx cosine of the eccentricity vector rotation angle
+     * @param sl1 sine of the mean latitude argument
+     * @param cl1 cosine of the mean latitude argument
+     * @param exm placeholder for the mean first component of the eccentricity vector
+     * @param eym placeholder for the mean second component of the eccentricity vector
+     * @param rda placeholder for the relative correction of the semi-major axis
+     * @param rdex placeholder for the correction of the first component of the eccentricity vector
+     * @param rdey placeholder for the correction of the second component of the eccentricity vector
+     * @param rdxi placeholder for the correction of the inclination (rad)
+     * @param rdom placeholder for the correction of the ascending node (rad)
+     * @param rdxl placeholder for the correction of the latitude argument (rad)
+     */
+    static inline void corrections(const double* c, size_t stride,
+                                   double sx, double cx, double sl1, double cl1,
+                                   double& exm, double& eym,
+                                   double& rda, double& rdex, double& rdey,
+                                   double& rdxi, double& rdom, double& rdxl)
+    {
+        // secular effects on the eccentricity vector
+        exm = cx * c[EX * stride] + sx * c[EX_SIN * stride];
+        eym = sx * c[EY_SIN * stride] + cx * c[EY_COS * stride] + c[EPS2 * stride];
+
+        // harmonics of the latitude argument
+        const double cl2 = cl1 * cl1 - sl1 * sl1;
+        const double sl2 = 2.0 * cl1 * sl1;
+        const double cl3 = cl2 * cl1 - sl2 * sl1;
+        const double sl3 = cl2 * sl1 + sl2 * cl1;
+        const double cl4 = cl3 * cl1 - sl3 * sl1;
+        const double sl4 = cl3 * sl1 + sl3 * cl1;
+        const double cl5 = cl4 * cl1 - sl4 * sl1;
+        const double sl5 = cl4 * sl1 + sl4 * cl1;
+        const double cl6 = cl5 * cl1 - sl5 * sl1;
+
+        const double qh = (eym - c[EPS2 * stride]) * c[KH * stride];
+        const double ql = exm * c[KL * stride];
+
+        const double exmCl1 = exm * cl1;
+        const double exmSl1 = exm * sl1;
+        const double eymCl1 = eym * cl1;
+        const double eymSl1 = eym * sl1;
+        const double exmCl2 = exm * cl2;
+        const double exmSl2 = exm * sl2;
+        const double eymCl2 = eym * cl2;
+        const double eymSl2 = eym * sl2;
+        const double exmCl3 = exm * cl3;
+        const double exmSl3 = exm * sl3;
+        const double eymCl3 = eym * cl3;
+        const double eymSl3 = eym * sl3;
+        const double exmCl4 = exm * cl4;
+        const double exmSl4 = exm * sl4;
+        const double eymCl4 = eym * cl4;
+        const double eymSl4 = eym * sl4;
+
+        rda  = c[AX1 * stride] * exmCl1 + c[AY1 * stride] * eymSl1 + c[AS1 * stride] * sl1 +
+               c[AC2 * stride] * cl2 + c[AXY3 * stride] * (exmCl3 + eymSl3) + c[AS3 * stride] * sl3 +
+               c[AC4 * stride] * cl4 + c[AS5 * stride] * sl5 + c[AC6 * stride] * cl6;
+        rdex = c[EX1 * stride] * cl1 + c[EXX2 * stride] * exmCl2 + c[EXY2 * stride] * eymSl2 +
+               c[EX3 * stride] * cl3 + c[EX4 * stride] * (exmCl4 + eymSl4);
+        rdey = c[EY1 * stride] * sl1 + c[EYX2 * stride] * exmSl2 + c[EYY2 * stride] * eymCl2 +
+               c[EY3 * stride] * sl3 + c[EY4 * stride] * (exmSl4 - eymCl4);
+        rdom = c[RX1 * stride] * exmSl1 + c[RY1 * stride] * eymCl1 + c[R2 * stride] * sl2 +
+               c[R3 * stride] * (eymCl3 - exmSl3) + c[RL * stride] * ql;
+        rdxi = c[IY1 * stride] * eymSl1 + c[IX1 * stride] * exmCl1 + c[I2 * stride] * cl2 +
+               c[I3 * stride] * (exmCl3 + eymSl3) + c[IH * stride] * qh;
+        rdxl = c[LX1 * stride] * exmSl1 + c[LY1 * stride] * eymCl1 + c[L2 * stride] * sl2 +
+               c[L3 * stride] * (exmSl3 - eymCl3) + c[LL * stride] * ql;
+    }
+
+    /** Apply the periodic corrections to the mean parameters of one orbit.
+     * @param c orbit constants
+     * @param stride distance between two consecutive constants
+     * @param sx sine of the eccentricity vector rotation angle
+     * @param cx cosine of the eccentricity vector rotation angle
+     * @param sl1 sine of the mean latitude argument
+     * @param cl1 cosine of the mean latitude argument
+     * @param so sine of the mean ascending node
+     * @param co cosine of the mean ascending node
+     * @param a placeholder for the osculating semi-major axis (m)
+     * @param ex placeholder for the osculating first component of the eccentricity vector
+     * @param ey placeholder for the osculating second component of the eccentricity vector
+     * @param sinI placeholder for the sine of the osculating inclination
+     * @param cosI placeholder for the cosine of the osculating inclination
+     * @param sinRaan placeholder for the sine of the osculating ascending node
+     * @param cosRaan placeholder for the cosine of the osculating ascending node
+     * @param sinAlphaM placeholder for the sine of the osculating mean latitude argument
+     * @param cosAlphaM placeholder for the cosine of the osculating mean latitude argument
+     */
+    static inline void osculating(const double* c, size_t stride,
+                                  double sx, double cx, double sl1, double cl1, double so, double co,
+                                  double& a, double& ex, double& ey, double& sinI, double& cosI,
+                                  double& sinRaan, double& cosRaan, double& sinAlphaM, double& cosAlphaM)
+    {
+        double exm, eym, rda, rdex, rdey, rdxi, rdom, rdxl;
+        corrections(c, stride, sx, cx, sl1, cl1, exm, eym, rda, rdex, rdey, rdxi, rdom, rdxl);
+        a  = c[A * stride] * (1.0 + rda);
+        ex = exm + rdex;
+        ey = eym + rdey;
+        rotate(c[SIN_I * stride], c[COS_I * stride], rdxi, sinI, cosI);
+        rotate(so, co, rdom, sinRaan, cosRaan);
+        rotate(sl1, cl1, rdxl, sinAlphaM, cosAlphaM);
+    }
+
+    /** Perform one Halley iteration on the eccentric latitude argument.
+     * @param ex first component of the eccentricity vector
+     * @param ey second component of the eccentricity vector
+     * @param sinAlphaM sine of the mean latitude argument
+     * @param cosAlphaM cosine of the mean latitude argument
+     * @param d difference between eccentric and mean latitude arguments (rad), updated in place
+     */
+    static inline void halley(double ex, double ey, double sinAlphaM, double cosAlphaM, double& d)
+    {
+        double sinAlphaE, cosAlphaE;
+        rotate(sinAlphaM, cosAlphaM, d, sinAlphaE, cosAlphaE);
+        const double f2 = ex * sinAlphaE - ey * cosAlphaE;
+        const double f1 = 1.0 - ex * cosAlphaE - ey * sinAlphaE;
+        const double f0 = d - f2;
+        d -= 2.0 * f0 * f1 / (2.0 * f1 * f1 - f0 * f2);
+    }
+
+    /** Compute the position-velocity in the orbital plane from osculating parameters.
+     * <p>The coordinates are given along the ascending node direction and
+     * its orthogonal in the orbital plane.</p>
+     * @param mu central attraction coefficient (m³/s²)
+     * @param a semi-major axis (m)
+     * @param ex first component of the eccentricity vector
+     * @param ey second component of the eccentricity vector
+     * @param sinAlphaM sine of the mean latitude argument
+     * @param cosAlphaM cosine of the mean latitude argument
+     * @param d difference between eccentric and mean latitude arguments (rad)
+     * @param u placeholder for the position along the ascending node (m)
+     * @param v placeholder for the position orthogonal to the ascending node (m)
+     * @param uDot placeholder for the velocity along the ascending node (m/s)
+     * @param vDot placeholder for the velocity orthogonal to the ascending node (m/s)
+     */
+    static inline void inPlane(double mu, double a, double ex, double ey,
+                               double sinAlphaM, double cosAlphaM, double d,
+                               double& u, double& v, double& uDot, double& vDot)
+    {
+        double sinAlphaE, cosAlphaE;
+        rotate(sinAlphaM, cosAlphaM, d, sinAlphaE, cosAlphaE);
+        const double beta   = 1.0 / (1.0 + std::sqrt(1.0 - ex * ex - ey * ey));
+        const double exCeyS = ex * cosAlphaE + ey * sinAlphaE;
+        const double exey   = ex * ey;
+        const double factor = std::sqrt(mu / a) / (1.0 - exCeyS);
+        u    = a * ((1.0 - beta * ey * ey) * cosAlphaE + beta * exey * sinAlphaE - ex);
+        v    = a * ((1.0 - beta * ex * ex) * sinAlphaE + beta * exey * cosAlphaE - ey);
+        uDot = factor * (-sinAlphaE + beta * ey * exCeyS);
+        vDot = factor * ( cosAlphaE - beta * ex * exCeyS);
+    }
+
+    /** Project in-plane coordinates to the inertial frame.
+     * @param sinI sine of the inclination
+     * @param cosI cosine of the inclination
+     * @param sinRaan sine of the ascending node
+     * @param cosRaan cosine of the ascending node
+     * @param u position along the ascending node (m)
+     * @param v position orthogonal to the ascending node (m)
+     * @param uDot velocity along the ascending node (m/s)
+     * @param vDot velocity orthogonal to the ascending node (m/s)
+     * @param x placeholder for the position abscissa (m)
+     * @param y placeholder for the position ordinate (m)
+     * @param z placeholder for the position height (m)
+     * @param vx placeholder for the velocity abscissa (m/s)
+     * @param vy placeholder for the velocity ordinate (m/s)
+     * @param vz placeholder for the velocity height (m/s)
+     */
+    static inline void project(double sinI, double cosI, double sinRaan, double cosRaan,
+                               double u, double v, double uDot, double vDot,
+                               double& x, double& y, double& z, double& vx, double& vy, double& vz)
+    {
+        const double gx = -cosI * sinRaan;
+        const double gy =  cosI * cosRaan;
+        x  = u    * cosRaan + v    * gx;
+        y  = u    * sinRaan + v    * gy;
+        z  =                  v    * sinI;
+        vx = uDot * cosRaan + vDot * gx;
+        vy = uDot * sinRaan + vDot * gy;
+        vz =                  vDot * sinI;
+    }
+
+    /** Propagate a block of lanes.
+     * <p>The evaluation is split in phases, each one a loop over the lanes
+     * (libm sines and cosines, periodic corrections, Halley iterations,
+     * Cartesian coordinates), so the arithmetic loops can be vectorized.</p>
+     * @param STEP distance between the constants of two consecutive lanes,
+     * 0 if all lanes share the same orbit, 1 for one orbit per lane
+     * @param constants constants of the first lane
+     * @param stride distance between two consecutive constants of one lane
+     * @param dt offsets of the dates with respect to the orbits epochs (s)
+     * @param count number of lanes, at most {@link #BLOCK_SIZE}
+     * @param x placeholder for the positions abscissas (m)
+     * @param y placeholder for the positions ordinates (m)
+     * @param z placeholder for the positions heights (m)
+     * @param vx placeholder for the velocities abscissas (m/s)
+     * @param vy placeholder for the velocities ordinates (m/s)
+     * @param vz placeholder for the velocities heights (m/s)
+     */
+    template<size_t STEP>
+    static inline void propagateBlock(const double* constants, size_t stride, const double* dt, size_t count,
+                                      double* x, double* y, double* z, double* vx, double* vy, double* vz)
+    {
+        const double* eccentricityRate = constants + ECCENTRICITY_RATE * stride;
+        const double* alphaM0          = constants + ALPHA_M * stride;
+        const double* alphaRate        = constants + ALPHA_RATE * stride;
+        const double* raan0            = constants + RAAN * stride;
+        const double* raanRate         = constants + RAAN_RATE * stride;
+        const double* mu               = constants + MU * stride;
+
+        // the sines and cosines of the mean angles are replaced in place by the osculating ones
+        double sx[BLOCK_SIZE];
+        double cx[BLOCK_SIZE];
+        double sl[BLOCK_SIZE];
+        double cl[BLOCK_SIZE];
+        double so[BLOCK_SIZE];
+        double co[BLOCK_SIZE];
+        for (size_t k = 0; k < count; ++k) {
+            const double angle = eccentricityRate[STEP * k] * dt[k];
+            const double xlm   = alphaM0[STEP * k] + alphaRate[STEP * k] * dt[k];
+            const double omm   = raan0[STEP * k] + raanRate[STEP * k] * dt[k];
+            sx[k] = std::sin(angle);
+            cx[k] = std::cos(angle);
+            sl[k] = std::sin(xlm);
+            cl[k] = std::cos(xlm);
+            so[k] = std::sin(omm);
+            co[k] = std::cos(omm);
+        }
+
+        double a[BLOCK_SIZE];
+        double ex[BLOCK_SIZE];
+        double ey[BLOCK_SIZE];
+        double d[BLOCK_SIZE];
+        for (size_t k = 0; k < count; ++k) {
+            osculating(constants + STEP * k, stride, sx[k], cx[k], sl[k], cl[k], so[k], co[k],
+                       a[k], ex[k], ey[k], sx[k], cx[k], so[k], co[k], sl[k], cl[k]);
+            d[k] = ex[k] * sl[k] - ey[k] * cl[k];
+        }
+
+        for (int i = 0; i < ITERATIONS; ++i) {
+            for (size_t k = 0; k < count; ++k) {
+                halley(ex[k], ey[k], sl[k], cl[k], d[k]);
+            }
+        }
+
+        // coordinates of position and velocity in the orbital plane
+        double u[BLOCK_SIZE];
+        double v[BLOCK_SIZE];
+        double uDot[BLOCK_SIZE];
+        double vDot[BLOCK_SIZE];
+        for (size_t k = 0; k < count; ++k) {
+            inPlane(mu[STEP * k], a[k], ex[k], ey[k], sl[k], cl[k], d[k], u[k], v[k], uDot[k], vDot[k]);
+        }
+
+        for (size_t k = 0; k < count; ++k) {
+            project(sx[k], cx[k], so[k], co[k], u[k], v[k], uDot[k], vDot[k],
+                    x[k], y[k], z[k], vx[k], vy[k], vz[k]);
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,159 @@
+#ifndef _ECKSTEIN_HECHLER_PROPAGATOR_H_
+#define _ECKSTEIN_HECHLER_PROPAGATOR_H_
+
+#include <stddef.h>
+#include "orbits/CartesianOrbit.h"
+#include "orbits/CircularOrbit.h"
+#include "propagation/EcksteinHechlerKernels.h"
+#include "utils/EarthModels.h"
+
+/** Eckstein-Hechler analytical propagator.
+ * <p>This propagator models the effects of the zonal harmonics C20 to C60
+ * on near circular orbits, with secular drifts and short periodic terms
+ * (see {@link EcksteinHechlerKernels}). It is orders of magnitude faster
+ * than numerical integration, at the price of accuracy: the model is valid
+ * for eccentricities below 0.1, and is accurate below 0.005.</p>
+ * <p>The initial orbit is considered osculating: the mean parameters are
+ * computed at construction by fixed point iterations, together with all
+ * the coefficients of the model, so evaluating at a new date only costs
+ * three sines and cosines and a few hundred arithmetic operations.</p>
+ * <p>The model is singular for equatorial and critically inclined orbits
+ * (sin²(i) = 4/5), such orbits are rejected: the propagator is then
+ * invalid (see {@link #getStatus()}) and only produces NaN.</p>
+ * <p>Instances of this class are guaranteed to be immutable.</p>
+ * @see EcksteinHechlerBatchPropagator
+ */
+class EcksteinHechlerPropagator
+{
+public:
+    /** Validity of a propagator. */
+    enum Status {
+        /** The propagator can be used. */
+        VALID,
+        /** The initial semi-major axis is below the reference radius. */
+        TRAJECTORY_INSIDE_BRILLOUIN_SPHERE,
+        /** The inclination is too close to 0 or π. */
+        ALMOST_EQUATORIAL_ORBIT,
+        /** The inclination is too close to the critical inclination. */
+        ALMOST_CRITICALLY_INCLINED_ORBIT,
+        /** The mean eccentricity is above 0.1. */
+        TOO_LARGE_ECCENTRICITY,
+        /** The mean parameters computation did not converge. */
+        MEAN_PARAMETERS_NOT_CONVERGED
+    };
+
+    /** Build a propagator from an orbit and a gravity field.
+     * @param initialOrbit initial osculating orbit
+     * @param referenceRadius reference radius of the gravity field (m)
+     * @param mu central attraction coefficient (m³/s²)
+     * @param c20 un-normalized zonal coefficient (about -1.08e-3 for Earth)
+     * @param c30 un-normalized zonal coefficient (about +2.53e-6 for Earth)
+     * @param c40 un-normalized zonal coefficient (about +1.62e-6 for Earth)
+     * @param c50 un-normalized zonal coefficient (about +2.28e-7 for Earth)
+     * @param c60 un-normalized zonal coefficient (about -5.41e-7 for Earth)
+     */
+    EcksteinHechlerPropagator(const Orbit& initialOrbit, double referenceRadius, double mu,
+                              double c20, double c30, double c40, double c50, double c60);
+
+    /** Build a propagator from an orbit and a reference gravity field.
+     * @param Model model tag, for example {@link EIGEN5C}
+     * @param initialOrbit initial osculating orbit
+     * @return propagator
+     */
+    template<typename Model>
+    static EcksteinHechlerPropagator create(const Orbit& initialOrbit)
+    {
+        static_assert(ZonalModel<Model>::MAX_DEGREE >= 6, "the model needs zonal coefficients up to C60");
+        return EcksteinHechlerPropagator(initialOrbit,
+                                         ZonalModel<Model>::EQUATORIAL_RADIUS, ZonalModel<Model>::MU,
+                                         ZonalModel<Model>::getUnnormalizedC(2), ZonalModel<Model>::getUnnormalizedC(3),
+                                         ZonalModel<Model>::getUnnormalizedC(4), ZonalModel<Model>::getUnnormalizedC(5),
+                                         ZonalModel<Model>::getUnnormalizedC(6));
+    }
+
+    /** Compute the mean parameters of an orbit and the model constants.
+     * <p>The constants are set to NaN if the orbit cannot be handled.</p>
+     * @param osculating osculating orbit
+     * @param referenceRadius reference radius of the gravity field (m)
+     * @param mu central attraction coefficient (m³/s²)
+     * @param ck0 un-normalized zonal coefficients, indexed by degree (C20 to C60)
+     * @param constants placeholder for the {@link EcksteinHechlerKernels#CONSTANTS} orbit constants
+     * @param stride distance between two consecutive constants
+     * @return status of the computation
+     */
+    static Status initialize(const Orbit& osculating, double referenceRadius, double mu, const double* ck0,
+                             double* constants, size_t stride);
+
+    /** Get the status of the propagator.
+     * @return status of the propagator
+     */
+    Status getStatus() const;
+
+    /** Check if the propagator can be used.
+     * @return true if the status is {@link #VALID}
+     */
+    bool isValid() const;
+
+    /** Get the initial orbit.
+     * @return initial osculating orbit
+     */
+    const CartesianOrbit& getInitialOrbit() const;
+
+    /** Get the mean orbit at initial date.
+     * @return mean circular parameters at initial date
+     */
+    CircularOrbit getMeanOrbit() const;
+
+    /** Get the reference radius of the gravity field.
+     * @return reference radius (m)
+     */
+    double getReferenceRadius() const;
+
+    /** Get the central attraction coefficient μ.
+     * @return central attraction coefficient (m³/s²)
+     */
+    double getMu() const;
+
+    /** Propagate the orbit to a date.
+     * @param date target date
+     * @return osculating orbit at date
+     */
+    CircularOrbit propagate(const LinearTime& date) const;
+
+    /** Get the position-velocity at a date.
+     * @param date target date
+     * @return position-velocity at date
+     */
+    PVCoordinates getPVCoordinates(const LinearTime& date) const;
+
+    /** Get the position-velocity at several dates.
+     * @param dates target dates
+     * @param count number of dates
+     * @param x placeholder for the positions abscissas (m)
+     * @param y placeholder for the positions ordinates (m)
+     * @param z placeholder for the positions heights (m)
+     * @param vx placeholder for the velocities abscissas (m/s)
+     * @param vy placeholder for the velocities ordinates (m/s)
+     * @param vz placeholder for the velocities heights (m/s)
+     */
+    void getPVCoordinates(const LinearTime* dates, size_t count,
+                          double* x, double* y, double* z, double* vx, double* vy, double* vz) const;
+
+private:
+    /** Initial osculating orbit. */
+    CartesianOrbit initialOrbit;
+
+    /** Reference radius of the gravity field. */
+    double referenceRadius;
+
+    /** Central attraction coefficient. */
+    double mu;
+
+    /** Status of the propagator. */
+    Status status;
+
+    /** Orbit constants. */
+    double constants[EcksteinHechlerKernels::CONSTANTS];
+};
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef _KEPLERIAN_BATCH_PROPAGATOR_H_
+#define _KEPLERIAN_BATCH_PROPAGATOR_H_
+
+#include <stddef.h>
+#include <vector>
+#include "orbits/Orbit.h"
+
+/** Keplerian propagator for many elliptic orbits at once.
+ * <p>The propagator holds a table of orbits in structure of arrays layout:
+ * the time independent constants of each orbit (see {@link
+ * KeplerianKernels}) are computed when the orbit is added, one array per
+ * constant, so propagation streams through contiguous memory without any
+ * per-orbit object, virtual call or orbit parameters conversion. Results
+ * agree with the ones of {@link KeplerianPropagator} for each orbit, up to
+ * rounding in the dates offsets.</p>
+ * <p>Only elliptic orbits can be added, whatever their parameters type.</p>
+ * <p>This class is not thread-safe while orbits are added, propagation
+ * methods can be called concurrently.</p>
+ */
+class KeplerianBatchPropagator
+{
+public:
+    /** Build an empty propagator. */
+    KeplerianBatchPropagator();
+
+    /** Reserve room for orbits.
+     * @param capacity number of orbits to reserve room for
+     */
+    void reserve(size_t capacity);
+
+    /** Add an orbit.
+     * @param orbit orbit to add, with its own central attraction coefficient
+     * @return true if the orbit was added, false if it is not elliptic
+     */
+    bool addOrbit(const Orbit& orbit);
+
+    /** Get the number of orbits.
+     * @return number of orbits
+     */
+    size_t getSize() const;
+
+    /** Propagate all orbits to several dates.
+     * <p>Output arrays hold <code>getSize() * count</code> elements, the
+     * state of orbit s at date k being at index <code>s * count + k</code>.</p>
+     * @param dates target dates
+     * @param count number of dates
+     * @param x placeholder for the positions abscissas (m)
+     * @param y placeholder for the positions ordinates (m)
+     * @param z placeholder for the positions heights (m)
+     * @param vx placeholder for the velocities abscissas (m/s)
+     * @param vy placeholder for the velocities ordinates (m/s)
+     * @param vz placeholder for the velocities heights (m/s)
+     */
+    void propagate(const LinearTime* dates, size_t count,
+                   double* x, double* y, double* z, double* vx, double* vy, double* vz) const;
+
+    /** Propagate all orbits to one date.
+     * <p>Output arrays hold <code>getSize()</code> elements, in the order
+     * the orbits were added. All orbits use the number of Halley iterations
+     * of the most eccentric one.</p>
+     * @param date target date
+     * @param x placeholder for the positions abscissas (m)
+     * @param y placeholder for the positions ordinates (m)
+     * @param z placeholder for the positions heights (m)
+     * @param vx placeholder for the velocities abscissas (m/s)
+     * @param vy placeholder for the velocities ordinates (m/s)
+     * @param vz placeholder for the velocities heights (m/s)
+     */
+    void propagate(const LinearTime& date,
+                   double* x, double* y, double* z, double* vx, double* vy, double* vz) const;
+
+private:
+    /** Number of orbits. */
+    size_t size;
+
+    /** Capacity of the constants table, which is also the stride between constants of one orbit. */
+    size_t capacity;
+
+    /** Orbit constants, one array of {@link #capacity} elements per constant. */
+    std::vector<double> constants;
+
+    /** Orbit epochs. */
+    std::vector<LinearTime> epochs;
+
+    /** Number of Halley iterations for each orbit. */
+    std::vector<int> iterations;
+
+    /** Largest number of Halley iterations. */
+    int maxIterations;
+};
+
+#endif
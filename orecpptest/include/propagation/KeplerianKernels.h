@@ -0,0 +1,314 @@
+#ifndef _KEPLERIAN_KERNELS_H_
+#define _KEPLERIAN_KERNELS_H_
+
+#include <stddef.h>
+#include <cmath>
+#include "orbits/KeplerSolver.h"
+
+/** Two-body motion kernels on elliptic orbits, in equinoctial parameters.
+ * <p>The motion is the one of {@link EquinoctialOrbit#shiftedBy(double)}:
+ * the mean longitude argument drifts linearly, the eccentric longitude
+ * argument is recovered by solving Kepler's equation and the state is
+ * computed in the orbital plane then projected on two reference axes. Every
+ * term that does not depend on time is computed once per orbit, see {@link
+ * #initialize}, so the per-date work is one Kepler equation and a few
+ * products.</p>
+ * <p>The {@link #CONSTANTS} orbit constants are read as
+ * <code>constants[c * stride]</code>: a single orbit uses a stride of 1,
+ * a table of orbits in structure of arrays layout uses its capacity as
+ * stride and points to the column of the orbit.</p>
+ * <p>Kepler's equation is solved with a fixed number of Halley iterations
+ * starting from the first order solution, the number depending only on
+ * eccentricity (see {@link #getIterations(double)}), and with only one
+ * sine and cosine evaluation per date, the iterations working on the small
+ * difference between eccentric and mean longitude arguments.</p>
+ * <p>Batch kernels use structure of arrays layouts, arrays may not overlap.
+ * They process blocks of {@link #BLOCK_SIZE} lanes step by step, so all
+ * steps but the sine and cosine evaluations have no call and no data
+ * dependent branch and are vectorized.</p>
+ */
+struct KeplerianKernels
+{
+    /** Number of orbit constants computed by {@link #initialize}. */
+    static const int CONSTANTS = 13;
+
+    /** Number of elements processed together by batch callers working on blocks. */
+    static const size_t BLOCK_SIZE = 64;
+
+    /** Get the number of Halley iterations needed to solve Kepler's equation.
+     * <p>The number of iterations ensures the eccentric longitude argument
+     * converges to a few ulps for any mean longitude argument, for
+     * eccentricities up to 0.999999 (the first order starting point is
+     * cheaper than the one of {@link KeplerSolver} for small eccentricities,
+     * but converges slowly for large ones).</p>
+     * @param e eccentricity
+     * @return number of Halley iterations
+     */
+    static inline int getIterations(double e)
+    {
+        return (e <= 0.01) ? 1 : (e <= 0.3) ? 2 : (e <= 0.8) ? 3 : (e <= 0.95) ? 4 : (e <= 0.99) ? 5 :
+               (e <= 0.9999) ? 8 : 10;
+    }
+
+    /** Compute the time independent constants of an orbit.
+     * <p>The constants are, in this order: mean longitude argument at epoch,
+     * Keplerian mean motion, a, ex, ey, β = 1 / (1 + √(1 - e²)), √(μ/a), and
+     * the two reference axes f and g of the orbital plane.</p>
+     * @param a semi-major axis (m)
+     * @param ex first component of the equinoctial eccentricity vector
+     * @param ey second component of the equinoctial eccentricity vector
+     * @param hx first component of the inclination vector
+     * @param hy second component of the inclination vector
+     * @param lM mean longitude argument at orbit epoch (rad)
+     * @param mu central attraction coefficient (m³/s²)
+     * @param constants placeholder for the {@link #CONSTANTS} orbit constants
+     * @param stride distance between two consecutive constants
+     */
+    static inline void initialize(double a, double ex, double ey, double hx, double hy, double lM, double mu,
+                                  double* constants, size_t stride)
+    {
+        const double hx2   = hx * hx;
+        const double hy2   = hy * hy;
+        const double factH = 1.0 / (1.0 + hx2 + hy2);
+        constants[0]           = lM;
+        constants[stride]      = std::sqrt(mu / a) / a;
+        constants[2 * stride]  = a;
+        constants[3 * stride]  = ex;
+        constants[4 * stride]  = ey;
+        constants[5 * stride]  = 1.0 / (1.0 + std::sqrt(1.0 - ex * ex - ey * ey));
+        constants[6 * stride]  = std::sqrt(mu / a);
+        constants[7 * stride]  = (1.0 + hx2 - hy2) * factH;
+        constants[8 * stride]  = 2.0 * hx * hy * factH;
+        constants[9 * stride]  = -2.0 * hy * factH;
+        constants[10 * stride] = 2.0 * hx * hy * factH;
+        constants[11 * stride] = (1.0 - hx2 + hy2) * factH;
+        constants[12 * stride] = 2.0 * hx * factH;
+    }
+
+    /** Solve Kepler's equation in equinoctial form.
+     * <p>The iterations are made on the difference lE - lM, which is
+     * bounded by the eccentricity: its sine and cosine are computed by
+     * {@link KeplerSolver#sinCosSmall(double, double&, double&)} and
+     * combined with the ones of lM, so only one sine and one cosine are
+     * evaluated per call.</p>
+     * @param ex first component of the equinoctial eccentricity vector
+     * @param ey second component of the equinoctial eccentricity vector
+     * @param lM mean longitude argument (rad)
+     * @param iterations number of Halley iterations
+     * @param sinLE placeholder for the sine of the eccentric longitude argument
+     * @param cosLE placeholder for the cosine of the eccentric longitude argument
+     * @return eccentric longitude argument (rad)
+     */
+    static inline double meanToEccentric(double ex, double ey, double lM, int iterations,
+                                         double& sinLE, double& cosLE)
+    {
+        const double sinLM = std::sin(lM);
+        const double cosLM = std::cos(lM);
+        double lEmlM = ex * sinLM - ey * cosLM;
+        double sinD, cosD;
+        for (int k = 0; k < iterations; ++k) {
+            KeplerSolver::sinCosSmall(lEmlM, sinD, cosD);
+            sinLE = sinLM * cosD + cosLM * sinD;
+            cosLE = cosLM * cosD - sinLM * sinD;
+            const double f2 = ex * sinLE - ey * cosLE;
+            const double f1 = 1.0 - ex * cosLE - ey * sinLE;
+            const double f0 = lEmlM - f2;
+            lEmlM -= 2.0 * f0 * f1 / (2.0 * f1 * f1 - f0 * f2);
+        }
+        KeplerSolver::sinCosSmall(lEmlM, sinD, cosD);
+        sinLE = sinLM * cosD + cosLM * sinD;
+        cosLE = cosLM * cosD - sinLM * sinD;
+        return lM + lEmlM;
+    }
+
+    /** Propagate one orbit to one date.
+     * @param constants orbit constants from {@link #initialize}
+     * @param stride distance between two consecutive constants
+     * @param iterations number of Halley iterations
+     * @param dt offset of the date with respect to orbit epoch (s)
+     * @param x placeholder for the position abscissa (m)
+     * @param y placeholder for the position ordinate (m)
+     * @param z placeholder for the position height (m)
+     * @param vx placeholder for the velocity abscissa (m/s)
+     * @param vy placeholder for the velocity ordinate (m/s)
+     * @param vz placeholder for the velocity height (m/s)
+     */
+    static inline void propagate(const double* constants, size_t stride, int iterations, double dt,
+                                 double& x, double& y, double& z, double& vx, double& vy, double& vz)
+    {
+        const double a    = constants[2 * stride];
+        const double ex   = constants[3 * stride];
+        const double ey   = constants[4 * stride];
+        const double beta = constants[5 * stride];
+        double sLe, cLe;
+        meanToEccentric(ex, ey, constants[0] + constants[stride] * dt, iterations, sLe, cLe);
+
+        // coordinates of position and velocity in the orbital plane
+        const double exCeyS = ex * cLe + ey * sLe;
+        const double exey   = ex * ey;
+        const double u      = a * ((1.0 - beta * ey * ey) * cLe + beta * exey * sLe - ex);
+        const double v      = a * ((1.0 - beta * ex * ex) * sLe + beta * exey * cLe - ey);
+        const double factor = constants[6 * stride] / (1.0 - exCeyS);
+        const double uDot   = factor * (-sLe + beta * ey * exCeyS);
+        const double vDot   = factor * ( cLe - beta * ex * exCeyS);
+
+        x  = u    * constants[7 * stride] + v    * constants[10 * stride];
+        y  = u    * constants[8 * stride] + v    * constants[11 * stride];
+        z  = u    * constants[9 * stride] + v    * constants[12 * stride];
+        vx = uDot * constants[7 * stride] + vDot * constants[10 * stride];
+        vy = uDot * constants[8 * stride] + vDot * constants[11 * stride];
+        vz = uDot * constants[9 * stride] + vDot * constants[12 * stride];
+    }
+
+    /** Propagate one orbit to several dates.
+     * @param constants orbit constants from {@link #initialize}
+     * @param stride distance between two consecutive constants
+     * @param iterations number of Halley iterations
+     * @param dt offsets of the dates with respect to orbit epoch (s)
+     * @param count number of dates
+     * @param x placeholder for the positions abscissas (m)
+     * @param y placeholder for the positions ordinates (m)
+     * @param z placeholder for the positions heights (m)
+     * @param vx placeholder for the velocities abscissas (m/s)
+     * @param vy placeholder for the velocities ordinates (m/s)
+     * @param vz placeholder for the velocities heights (m/s)
+     */
+    static inline void propagate(const double* constants, size_t stride, int iterations,
+                                 const double* dt, size_t count,
+                                 double* x, double* y, double* z, double* vx, double* vy, double* vz)
+    {
+        // copy the constants locally, so they are loop invariants
+        double local[CONSTANTS];
+        for (int c = 0; c < CONSTANTS; ++c) {
+            local[c] = constants[c * stride];
+        }
+        for (size_t start = 0; start < count; start += BLOCK_SIZE) {
+            const size_t size = (count - start < BLOCK_SIZE) ? count - start : BLOCK_SIZE;
+            propagateBlock<0>(local, 1, iterations, dt + start, size,
+                              x + start, y + start, z + start, vx + start, vy + start, vz + start);
+        }
+    }
+
+    /** Propagate several orbits to one date each.
+     * @param constants constants of the first orbit, the constants of all
+     * orbits being stored in structure of arrays layout
+     * @param stride distance between two consecutive constants of one orbit
+     * @param iterations number of Halley iterations, suitable for all orbits
+     * @param dt offsets of the dates with respect to the orbits epochs (s)
+     * @param count number of orbits
+     * @param x placeholder for the positions abscissas (m)
+     * @param y placeholder for the positions ordinates (m)
+     * @param z placeholder for the positions heights (m)
+     * @param vx placeholder for the velocities abscissas (m/s)
+     * @param vy placeholder for the velocities ordinates (m/s)
+     * @param vz placeholder for the velocities heights (m/s)
+     */
+    static inline void propagateOrbits(const double* constants, size_t stride, int iterations,
+                                       const double* dt, size_t count,
+                                       double* x, double* y, double* z, double* vx, double* vy, double* vz)
+    {
+        for (size_t start = 0; start < count; start += BLOCK_SIZE) {
+            const size_t size = (count - start < BLOCK_SIZE) ? count - start : BLOCK_SIZE;
+            propagateBlock<1>(constants + start, stride, iterations, dt + start, size,
+                              x + start, y + start, z + start, vx + start, vy + start, vz + start);
+        }
+    }
+
+    /** Propagate a block of lanes.
+     * <p>Each step is a loop over the lanes: only the first one calls the
+     * sine and cosine functions, the Halley iterations and the conversion
+     * to cartesian coordinates are straight arithmetic, which the compiler
+     * vectorizes, and independent lanes hide the latency of the dependency
+     * chain of each iteration.</p>
+     * @param STEP distance between the constants of two consecutive lanes,
+     * 0 if all lanes share the same orbit, 1 for one orbit per lane
+     * @param constants constants of the first lane
+     * @param stride distance between two consecutive constants of one lane
+     * @param iterations number of Halley iterations, suitable for all lanes
+     * @param dt offsets of the dates with respect to the orbits epochs (s)
+     * @param count number of lanes, at most {@link #BLOCK_SIZE}
+     * @param x placeholder for the positions abscissas (m)
+     * @param y placeholder for the positions ordinates (m)
+     * @param z placeholder for the positions heights (m)
+     * @param vx placeholder for the velocities abscissas (m/s)
+     * @param vy placeholder for the velocities ordinates (m/s)
+     * @param vz placeholder for the velocities heights (m/s)
+     */
+    template<size_t STEP>
+    static inline void propagateBlock(const double* constants, size_t stride, int iterations,
+                                      const double* dt, size_t count,
+                                      double* x, double* y, double* z, double* vx, double* vy, double* vz)
+    {
+        const double* lM0  = constants;
+        const double* n    = constants + stride;
+        const double* a    = constants + 2 * stride;
+        const double* ex   = constants + 3 * stride;
+        const double* ey   = constants + 4 * stride;
+        const double* beta = constants + 5 * stride;
+        const double* vf   = constants + 6 * stride;
+        double sinLM[BLOCK_SIZE];
+        double cosLM[BLOCK_SIZE];
+        double lEmlM[BLOCK_SIZE];
+
+        for (size_t k = 0; k < count; ++k) {
+            const double lM = lM0[STEP * k] + n[STEP * k] * dt[k];
+            sinLM[k] = std::sin(lM);
+            cosLM[k] = std::cos(lM);
+        }
+
+        for (size_t k = 0; k < count; ++k) {
+            lEmlM[k] = ex[STEP * k] * sinLM[k] - ey[STEP * k] * cosLM[k];
+        }
+        for (int i = 0; i < iterations; ++i) {
+            for (size_t k = 0; k < count; ++k) {
+                double sinD, cosD;
+                KeplerSolver::sinCosSmall(lEmlM[k], sinD, cosD);
+                const double sinLE = sinLM[k] * cosD + cosLM[k] * sinD;
+                const double cosLE = cosLM[k] * cosD - sinLM[k] * sinD;
+                const double f2 = ex[STEP * k] * sinLE - ey[STEP * k] * cosLE;
+                const double f1 = 1.0 - ex[STEP * k] * cosLE - ey[STEP * k] * sinLE;
+                const double f0 = lEmlM[k] - f2;
+                lEmlM[k] -= 2.0 * f0 * f1 / (2.0 * f1 * f1 - f0 * f2);
+            }
+        }
+
+        // coordinates of position and velocity in the orbital plane
+        double u[BLOCK_SIZE];
+        double v[BLOCK_SIZE];
+        double uDot[BLOCK_SIZE];
+        double vDot[BLOCK_SIZE];
+        for (size_t k = 0; k < count; ++k) {
+            double sinD, cosD;
+            KeplerSolver::sinCosSmall(lEmlM[k], sinD, cosD);
+            const double sLe    = sinLM[k] * cosD + cosLM[k] * sinD;
+            const double cLe    = cosLM[k] * cosD - sinLM[k] * sinD;
+            const double exk    = ex[STEP * k];
+            const double eyk    = ey[STEP * k];
+            const double betak  = beta[STEP * k];
+            const double exCeyS = exk * cLe + eyk * sLe;
+            const double exey   = exk * eyk;
+            const double factor = vf[STEP * k] / (1.0 - exCeyS);
+            u[k]    = a[STEP * k] * ((1.0 - betak * eyk * eyk) * cLe + betak * exey * sLe - exk);
+            v[k]    = a[STEP * k] * ((1.0 - betak * exk * exk) * sLe + betak * exey * cLe - eyk);
+            uDot[k] = factor * (-sLe + betak * eyk * exCeyS);
+            vDot[k] = factor * ( cLe - betak * exk * exCeyS);
+        }
+
+        const double* fx = constants +  7 * stride;
+        const double* fy = constants +  8 * stride;
+        const double* fz = constants +  9 * stride;
+        const double* gx = constants + 10 * stride;
+        const double* gy = constants + 11 * stride;
+        const double* gz = constants + 12 * stride;
+        for (size_t k = 0; k < count; ++k) {
+            x[k]  = u[k]    * fx[STEP * k] + v[k]    * gx[STEP * k];
+            y[k]  = u[k]    * fy[STEP * k] + v[k]    * gy[STEP * k];
+            z[k]  = u[k]    * fz[STEP * k] + v[k]    * gz[STEP * k];
+            vx[k] = uDot[k] * fx[STEP * k] + vDot[k] * gx[STEP * k];
+            vy[k] = uDot[k] * fy[STEP * k] + vDot[k] * gy[STEP * k];
+            vz[k] = uDot[k] * fz[STEP * k] + vDot[k] * gz[STEP * k];
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef _KEPLERIAN_PROPAGATOR_H_
+#define _KEPLERIAN_PROPAGATOR_H_
+
+#include <stddef.h>
+#include "orbits/CartesianOrbit.h"
+#include "propagation/KeplerianKernels.h"
+
+/** Simple Keplerian orbit propagator.
+ * <p>The propagator shifts the initial orbit according to two-body motion,
+ * the mean anomaly drifting linearly at the Keplerian mean motion. Elliptic
+ * orbits, whatever their parameters type, are propagated in equinoctial
+ * parameters with the time independent terms computed once at construction
+ * (see {@link KeplerianKernels}), hyperbolic orbits are propagated in
+ * Keplerian parameters.</p>
+ * <p>Instances of this class are guaranteed to be immutable.</p>
+ * @see KeplerianBatchPropagator
+ */
+class KeplerianPropagator
+{
+public:
+    /** Build a propagator from an orbit only.
+     * <p>The central attraction coefficient μ is set to the same value used
+     * for the initial orbit definition.</p>
+     * @param initialOrbit initial orbit
+     */
+    explicit KeplerianPropagator(const Orbit& initialOrbit);
+
+    /** Build a propagator from an orbit and a central attraction coefficient μ.
+     * <p>The orbital parameters of the initial orbit are kept, the position
+     * and velocity are recomputed with the new μ.</p>
+     * @param initialOrbit initial orbit
+     * @param mu central attraction coefficient (m³/s²)
+     */
+    KeplerianPropagator(const Orbit& initialOrbit, double mu);
+
+    /** Get the initial orbit.
+     * @return initial orbit, with the central attraction coefficient of the propagator
+     */
+    const CartesianOrbit& getInitialOrbit() const;
+
+    /** Get the central attraction coefficient μ.
+     * @return central attraction coefficient (m³/s²)
+     */
+    double getMu() const;
+
+    /** Propagate the orbit to a date.
+     * @param date target date
+     * @return propagated orbit
+     */
+    CartesianOrbit propagate(const LinearTime& date) const;
+
+    /** Get the position-velocity at a date.
+     * @param date target date
+     * @return position-velocity at date
+     */
+    PVCoordinates getPVCoordinates(const LinearTime& date) const;
+
+    /** Get the position-velocity at several dates.
+     * @param dates target dates
+     * @param count number of dates
+     * @param x placeholder for the positions abscissas (m)
+     * @param y placeholder for the positions ordinates (m)
+     * @param z placeholder for the positions heights (m)
+     * @param vx placeholder for the velocities abscissas (m/s)
+     * @param vy placeholder for the velocities ordinates (m/s)
+     * @param vz placeholder for the velocities heights (m/s)
+     */
+    void getPVCoordinates(const LinearTime* dates, size_t count,
+                          double* x, double* y, double* z, double* vx, double* vy, double* vz) const;
+
+private:
+    /** Initialize the propagation constants. */
+    void initialize();
+
+    /** Initial orbit. */
+    CartesianOrbit initialOrbit;
+
+    /** Number of Halley iterations for Kepler's equation. */
+    int iterations;
+
+    /** Orbit constants of elliptic orbits. */
+    double constants[KeplerianKernels::CONSTANTS];
+};
+
+#endif
@@ -0,0 +1,155 @@
+#ifndef _NUMERICAL_PROPAGATOR_H_
+#define _NUMERICAL_PROPAGATOR_H_
+
+#include <stddef.h>
+#include <vector>
+#include "forces/ForceModel.h"
+#include "orbits/CartesianOrbit.h"
+#include "propagation/ODEIntegrator.h"
+
+/** Orbit propagator integrating the equations of motion in Cartesian coordinates.
+ * <p>The acceleration is the central attraction, with the central attraction
+ * coefficient of the initial orbit, plus the contributions of the {@link
+ * ForceModel force models}, which all add to the same buffer. The state,
+ * its derivative and the integrator stages are fixed size arrays, so
+ * propagation performs no allocation.</p>
+ * <p>Each step stops before tEnd if a force model requires it (see {@link
+ * ForceModel#getMaxStep}), the step size control of the integrator is not
+ * affected by these shortened steps.</p>
+ * <p>The propagator keeps the state where the last propagation stopped and
+ * the next propagation continues from there, in either direction. Dates
+ * between integration steps are computed with the dense output of the
+ * integrator.</p>
+ * <p>Instances of this class are <em>not</em> thread-safe: the propagator
+ * and its integrator are modified by propagation. Force models may be
+ * shared.</p>
+ */
+class NumericalPropagator : public ODEIntegrator::Equations
+{
+public:
+    /** Propagation status. */
+    enum Status {
+        /** Propagation reached its target. */
+        VALID,
+        /** Integrator could not meet its tolerances with its minimal step size, or has a null step size. */
+        STEP_SIZE_UNDERFLOW
+    };
+
+    /** Simple constructor.
+     * @param initialOrbit initial orbit, giving the central attraction coefficient
+     * @param integrator integrator, used by this propagator only
+     */
+    NumericalPropagator(const Orbit& initialOrbit, ODEIntegrator& integrator);
+
+    /** Add a force model.
+     * <p>The model is not copied, it must outlive the propagator.</p>
+     * @param model force model to add
+     */
+    void addForceModel(const ForceModel& model);
+
+    /** Propagate the orbit to a date.
+     * @param target target date
+     * @return propagation status, the state is left at the last accepted
+     * step when it is not {@link #VALID}
+     */
+    Status propagate(const LinearTime& target);
+
+    /** Propagate the orbit through several dates.
+     * <p>Integration goes to the last date and the other dates are
+     * interpolated inside the steps, so they cost no extra step. Dates must
+     * be sorted in the propagation direction, starting from the current
+     * date. Outputs of dates not reached after a failure are set to NaN.</p>
+     * @param dates target dates
+     * @param count number of dates
+     * @param x placeholder for the positions abscissas (m)
+     * @param y placeholder for the positions ordinates (m)
+     * @param z placeholder for the positions heights (m)
+     * @param vx placeholder for the velocities abscissas (m/s)
+     * @param vy placeholder for the velocities ordinates (m/s)
+     * @param vz placeholder for the velocities heights (m/s)
+     * @return propagation status
+     */
+    Status propagate(const LinearTime* dates, size_t count,
+                     double* x, double* y, double* z, double* vx, double* vy, double* vz);
+
+    /** Get the current date.
+     * @return date where the last propagation stopped
+     */
+    LinearTime getDate() const;
+
+    /** Get the current position-velocity.
+     * @return position-velocity at the current date
+     */
+    PVCoordinates getPVCoordinates() const;
+
+    /** Get the current orbit.
+     * @return orbit at the current date
+     */
+    CartesianOrbit getOrbit() const;
+
+    /** Get the central attraction coefficient μ.
+     * @return central attraction coefficient (m³/s²)
+     */
+    double getMu() const;
+
+    /** Get the number of equations of motion evaluations since construction.
+     * @return number of evaluations
+     */
+    long long getEvaluations() const;
+
+    /** Get the status of the last propagation.
+     * @return status of the last propagation
+     */
+    Status getStatus() const;
+
+    /** {@inheritDoc} */
+    void computeDerivatives(double t, const double* y, double* yDot) override;
+
+private:
+    /** Dimension of the state. */
+    static const int N = StepInterpolator::DIMENSION;
+
+    /** Perform one integration step, within the step limits of the force models.
+     * @param tEnd integration limit, in seconds from the initial date
+     * @return true if the step succeeded
+     */
+    bool advance(double tEnd);
+
+    /** Integrator. */
+    ODEIntegrator& integrator;
+
+    /** Central attraction coefficient. */
+    double mu;
+
+    /** Initial date, reference of the integration time. */
+    LinearTime epoch;
+
+    /** Current time, in seconds from the initial date. */
+    double t;
+
+    /** Current state. */
+    double state[N];
+
+    /** Derivative at the current state. */
+    double stateDot[N];
+
+    /** Step size to try next, 0 if unknown. */
+    double h;
+
+    /** Indicator of an up to date {@link #stateDot}. */
+    bool derivativesValid;
+
+    /** Force models. */
+    std::vector<const ForceModel*> forceModels;
+
+    /** Number of evaluations. */
+    long long evaluations;
+
+    /** Status of the last propagation. */
+    Status status;
+
+    /** Dense output of the last step. */
+    StepInterpolator interpolator;
+};
+
+#endif
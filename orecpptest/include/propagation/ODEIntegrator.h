@@ -0,0 +1,144 @@
+#ifndef _ODE_INTEGRATOR_H_
+#define _ODE_INTEGRATOR_H_
+
+/** Dense output of one integration step.
+ * <p>The state inside the step is the nested polynomial of Hairer's
+ * DOP853 dense output, with θ = (t - t₀) / h and η = 1 - θ:</p>
+ * <pre>
+ *   y(θ) = r₁ + θ (r₂ + η (r₃ + θ (r₄ + η (r₅ + θ (r₆ + η (r₇ + θ r₈))))))
+ * </pre>
+ * <p>With the four first terms only, r₁ = y₀, r₂ = y₁ - y₀, r₃ = h y'₀ - r₂
+ * and r₄ = r₂ - h y'₁ - r₃, this is the cubic Hermite interpolation between
+ * the step ends, which is what low order integrators provide.</p>
+ */
+struct StepInterpolator
+{
+    /** Dimension of the interpolated state. */
+    static const int DIMENSION = 6;
+
+    /** Maximum number of polynomial terms. */
+    static const int MAX_TERMS = 8;
+
+    /** Time at step start. */
+    double previousTime;
+
+    /** Time at step end. */
+    double currentTime;
+
+    /** Signed step size. */
+    double step;
+
+    /** Number of polynomial terms in use (4 or 8). */
+    int terms;
+
+    /** Polynomial terms, r₁ to r₈. */
+    double coefficients[MAX_TERMS][DIMENSION];
+
+    /** Set up the cubic Hermite interpolation of a step.
+     * @param t0 time at step start
+     * @param h signed step size
+     * @param y0 state at step start
+     * @param y1 state at step end
+     * @param f0 state derivative at step start
+     * @param f1 state derivative at step end
+     */
+    inline void initialize(double t0, double h, const double* y0, const double* y1,
+                           const double* f0, const double* f1)
+    {
+        previousTime = t0;
+        currentTime  = t0 + h;
+        step         = h;
+        terms        = 4;
+        for (int i = 0; i < DIMENSION; ++i) {
+            const double dy = y1[i] - y0[i];
+            const double r3 = h * f0[i] - dy;
+            coefficients[0][i] = y0[i];
+            coefficients[1][i] = dy;
+            coefficients[2][i] = r3;
+            coefficients[3][i] = dy - h * f1[i] - r3;
+        }
+    }
+
+    /** Interpolate the state inside the step.
+     * @param t time, between {@link #previousTime} and {@link #currentTime}
+     * @param y placeholder for the interpolated state
+     */
+    inline void interpolate(double t, double* y) const
+    {
+        const double theta = (t - previousTime) / step;
+        const double eta   = 1.0 - theta;
+        if (terms == MAX_TERMS) {
+            for (int i = 0; i < DIMENSION; ++i) {
+                y[i] = coefficients[0][i] + theta * (coefficients[1][i] +
+                       eta * (coefficients[2][i] + theta * (coefficients[3][i] +
+                       eta * (coefficients[4][i] + theta * (coefficients[5][i] +
+                       eta * (coefficients[6][i] + theta * coefficients[7][i]))))));
+            }
+        }
+        else {
+            for (int i = 0; i < DIMENSION; ++i) {
+                y[i] = coefficients[0][i] + theta * (coefficients[1][i] +
+                       eta * (coefficients[2][i] + theta * coefficients[3][i]));
+            }
+        }
+    }
+};
+
+/** Single step integrator for first order differential equations of dimension
+ * {@link StepInterpolator#DIMENSION}.
+ * <p>Integrators work on caller provided fixed size arrays and keep their
+ * stages in members, so a step allocates nothing. The caller keeps the state
+ * derivative at the current point between steps: integrators evaluate the
+ * derivative at the end of each step (first same as last), it is both the
+ * last stage of the step and the first of the next one.</p>
+ * <p>Instances of this class are <em>not</em> thread-safe, a propagator
+ * needs its own integrator.</p>
+ */
+class ODEIntegrator
+{
+public:
+    /** Differential equations y' = f(t, y). */
+    class Equations
+    {
+    public:
+        virtual ~Equations() = default;
+
+        /** Compute the state derivative.
+         * @param t current time
+         * @param y current state
+         * @param yDot placeholder for the state derivative
+         */
+        virtual void computeDerivatives(double t, const double* y, double* yDot) = 0;
+    };
+
+    virtual ~ODEIntegrator() = default;
+
+    /** Perform one step.
+     * <p>The step goes from t towards tEnd and stops exactly at tEnd if it
+     * would go beyond. Adaptive integrators reject and retry steps until the
+     * error is acceptable, so the returned step is always accepted.</p>
+     * @param equations differential equations
+     * @param t current time, replaced by the time at step end
+     * @param y current state, replaced by the state at step end
+     * @param yDot state derivative at t, replaced by the derivative at step end
+     * @param h step size to try, 0 to let the integrator choose one,
+     * replaced by the step size to try next
+     * @param tEnd integration limit
+     * @param interpolator placeholder for the dense output of the step
+     * @return false if no step size between the integrator limits meets the
+     * tolerances (the state is then unchanged)
+     */
+    virtual bool step(Equations& equations, double& t, double* y, double* yDot, double& h, double tEnd,
+                      StepInterpolator& interpolator) = 0;
+
+    /** Complete the dense output of the last step.
+     * <p>Integrators whose full order dense output needs extra evaluations
+     * only perform them here, so steps without output dates do not pay for
+     * them. This must be called before the next step.</p>
+     * @param equations differential equations of the last step
+     * @param interpolator dense output of the last step
+     */
+    virtual void prepareInterpolation(Equations& equations, StepInterpolator& interpolator) = 0;
+};
+
+#endif
@@ -0,0 +1,131 @@
+#ifndef _SGP4_CATALOG_PROPAGATOR_H_
+#define _SGP4_CATALOG_PROPAGATOR_H_
+
+#include <stddef.h>
+#include <vector>
+#include "propagation/SGP4Record.h"
+#include "propagation/TLE.h"
+#include "utils/ThreadPool.h"
+
+/** SGP4/SDP4 propagator for a whole catalog of satellites.
+ * <p>Each satellite is initialized once when it is added (see {@link
+ * SGP4Propagator#initialize}). Near Earth satellites, which are most of a
+ * public catalog, are stored in a structure of arrays table of {@link
+ * SGP4Kernels} constants and propagated one satellite per lane, deep space
+ * satellites keep their full initialization record and are propagated one
+ * at a time.</p>
+ * <p>Propagation is split in blocks of {@link SGP4Kernels#BLOCK_SIZE}
+ * satellites run on the threads of a {@link ThreadPool}. Each block only
+ * writes the states of its own satellites, so the output does not depend on
+ * the number of threads. States are given in the TEME frame, in meters and
+ * meters per second, and are NaN where the model reports an error (decay,
+ * eccentricity out of range...). Results agree with the ones of {@link
+ * SGP4Propagator} for each satellite, up to rounding errors.</p>
+ * <p>This class is not thread-safe while satellites are added, propagation
+ * methods can be called concurrently.</p>
+ */
+class SGP4CatalogPropagator
+{
+public:
+    /** Build an empty propagator. */
+    SGP4CatalogPropagator();
+
+    /** Reserve room for satellites.
+     * @param capacity number of satellites to reserve room for
+     */
+    void reserve(size_t capacity);
+
+    /** Add a satellite.
+     * @param tle elements of the satellite
+     * @return true if the satellite was added, false if its elements are invalid
+     */
+    bool addTLE(const TLE& tle);
+
+    /** Get the number of satellites.
+     * @return number of satellites
+     */
+    size_t getSize() const;
+
+    /** Get the number of deep space satellites.
+     * @return number of satellites propagated with the deep space model
+     */
+    size_t getDeepSpaceSize() const;
+
+    /** Get the satellite catalog number of a satellite.
+     * @param index index of the satellite, in the order they were added
+     * @return satellite catalog number
+     */
+    int getSatelliteNumber(size_t index) const;
+
+    /** Propagate all satellites to several dates.
+     * <p>Output arrays hold <code>getSize() * count</code> elements, the
+     * state of satellite s at date k being at index <code>s * count + k</code>.</p>
+     * @param pool thread pool
+     * @param dates target dates
+     * @param count number of dates
+     * @param x placeholder for the positions abscissas (m)
+     * @param y placeholder for the positions ordinates (m)
+     * @param z placeholder for the positions heights (m)
+     * @param vx placeholder for the velocities abscissas (m/s)
+     * @param vy placeholder for the velocities ordinates (m/s)
+     * @param vz placeholder for the velocities heights (m/s)
+     */
+    void propagate(ThreadPool& pool, const LinearTime* dates, size_t count,
+                   double* x, double* y, double* z, double* vx, double* vy, double* vz) const;
+
+    /** Propagate all satellites to one date.
+     * <p>Output arrays hold <code>getSize()</code> elements, in the order
+     * the satellites were added.</p>
+     * @param pool thread pool
+     * @param date target date
+     * @param x placeholder for the positions abscissas (m)
+     * @param y placeholder for the positions ordinates (m)
+     * @param z placeholder for the positions heights (m)
+     * @param vx placeholder for the velocities abscissas (m/s)
+     * @param vy placeholder for the velocities ordinates (m/s)
+     * @param vz placeholder for the velocities heights (m/s)
+     */
+    void propagate(ThreadPool& pool, const LinearTime& date,
+                   double* x, double* y, double* z, double* vx, double* vy, double* vz) const;
+
+private:
+    /** Propagate a block of satellites to several dates.
+     * @param block index of the block
+     * @param dates target dates
+     * @param count number of dates
+     * @param x placeholder for the positions abscissas (m)
+     * @param y placeholder for the positions ordinates (m)
+     * @param z placeholder for the positions heights (m)
+     * @param vx placeholder for the velocities abscissas (m/s)
+     * @param vy placeholder for the velocities ordinates (m/s)
+     * @param vz placeholder for the velocities heights (m/s)
+     */
+    void propagateBlock(size_t block, const LinearTime* dates, size_t count,
+                        double* x, double* y, double* z, double* vx, double* vy, double* vz) const;
+
+    /** Number of near Earth satellites. */
+    size_t nearSize;
+
+    /** Capacity of the near Earth constants table, which is also the stride between constants of one satellite. */
+    size_t capacity;
+
+    /** Near Earth satellites constants, one array of {@link #capacity} elements per constant. */
+    std::vector<double> constants;
+
+    /** Near Earth satellites epochs. */
+    std::vector<LinearTime> nearEpochs;
+
+    /** Indices of the near Earth satellites in the output arrays. */
+    std::vector<size_t> nearIndices;
+
+    /** Deep space satellites initialization records. */
+    std::vector<SGP4Record> deepRecords;
+
+    /** Indices of the deep space satellites in the output arrays. */
+    std::vector<size_t> deepIndices;
+
+    /** Satellite catalog numbers, in the order the satellites were added. */
+    std::vector<int> satelliteNumbers;
+};
+
+#endif
@@ -0,0 +1,339 @@
+#ifndef _SGP4_KERNELS_H_
+#define _SGP4_KERNELS_H_
+
+#include <stddef.h>
+#include <cmath>
+#include <limits>
+#include "orbits/KeplerSolver.h"
+#include "propagation/SGP4Record.h"
+
+/** SGP4 model constants and near Earth batch kernels.
+ * <p>The constants are the WGS72 ones, which were used to fit the published
+ * element sets and must be used with them.</p>
+ * <p>The batch kernels evaluate the near Earth model (period below 225
+ * minutes, see {@link SGP4Propagator}) for many satellites at once, one
+ * satellite per lane. The {@link #CONSTANTS} satellite constants are read
+ * as <code>constants[c * stride]</code>, with c one of the indices below, a
+ * table of satellites in structure of arrays layout using its capacity as
+ * stride. The terms of the full drag model of the low perigee satellites
+ * are zero for the simplified ones, so all lanes run the same arithmetic.</p>
+ * <p>Each lane needs the sine and cosine of four angles (mean anomaly,
+ * perigee argument, node and mean argument of latitude) computed in a first
+ * phase, the Kepler equation being solved on the difference between
+ * eccentric and mean argument of latitude, and the short periodic
+ * corrections being applied to the angles through {@link
+ * KeplerSolver#sinCosSmall(double, double&, double&)}. Results agree with
+ * {@link SGP4Propagator#propagate} up to rounding errors. States of
+ * satellites that decayed or whose elements became invalid are NaN.</p>
+ */
+struct SGP4Kernels
+{
+    /** Earth equatorial radius of the WGS72 model (km). */
+    static constexpr double EARTH_RADIUS = 6378.135;
+
+    /** Square root of the WGS72 gravitational constant, in earth radii<sup>1.5</sup> per minute. */
+    static constexpr double XKE = 0.07436691613317342;
+
+    /** Earth radii per minute to kilometers per second. */
+    static constexpr double VKMPERSEC = EARTH_RADIUS * XKE / 60.0;
+
+    /** Un-normalized second zonal coefficient, opposite of C20, of the WGS72 model. */
+    static constexpr double J2 = 0.001082616;
+
+    /** Un-normalized third zonal coefficient, opposite of C30, of the WGS72 model. */
+    static constexpr double J3 = -0.00000253881;
+
+    /** Un-normalized fourth zonal coefficient, opposite of C40, of the WGS72 model. */
+    static constexpr double J4 = -0.00000165597;
+
+    /** J3 / J2. */
+    static constexpr double J3OJ2 = J3 / J2;
+
+    /** Indices of the satellite constants. */
+    enum Constant {
+        MO, MDOT, ARGPO, ARGPDOT, NODEO, NODEDOT, NODECF,
+        CC1, BCC4, BCC5, T2COF, T3COF, T4COF, T5COF,
+        OMGCOF, ETA, XMCOF, DELMO, SINMAO, D2, D3, D4,
+        NO, AO, ECCO, SINIO, COSIO,
+        AYCOF, XLCOF, CON41, X1MTH2, X7THM1,
+        CONSTANTS
+    };
+
+    /** Number of lanes processed together by batch kernels. */
+    static constexpr size_t BLOCK_SIZE = 64;
+
+    /** Maximum number of Newton iterations for Kepler's equation. */
+    static constexpr int MAX_ITERATIONS = 10;
+
+    /** Convergence threshold of Kepler's equation (rad). */
+    static constexpr double KEPLER_THRESHOLD = 1.0e-12;
+
+    /** Copy the constants of a near Earth satellite.
+     * @param record initialization record of a near Earth satellite
+     * @param constants placeholder for the {@link #CONSTANTS} satellite constants
+     * @param stride distance between two consecutive constants
+     */
+    static inline void initialize(const SGP4Record& record, double* constants, size_t stride)
+    {
+        double* c = constants;
+        c[MO      * stride] = record.mo;
+        c[MDOT    * stride] = record.mdot;
+        c[ARGPO   * stride] = record.argpo;
+        c[ARGPDOT * stride] = record.argpdot;
+        c[NODEO   * stride] = record.nodeo;
+        c[NODEDOT * stride] = record.nodedot;
+        c[NODECF  * stride] = record.nodecf;
+        c[CC1     * stride] = record.cc1;
+        c[BCC4    * stride] = record.bstar * record.cc4;
+        c[BCC5    * stride] = record.bstar * record.cc5;
+        c[T2COF   * stride] = record.t2cof;
+        c[T3COF   * stride] = record.t3cof;
+        c[T4COF   * stride] = record.t4cof;
+        c[T5COF   * stride] = record.t5cof;
+        c[OMGCOF  * stride] = record.omgcof;
+        c[ETA     * stride] = record.eta;
+        c[XMCOF   * stride] = record.xmcof;
+        c[DELMO   * stride] = record.delmo;
+        c[SINMAO  * stride] = record.sinmao;
+        c[D2      * stride] = record.d2;
+        c[D3      * stride] = record.d3;
+        c[D4      * stride] = record.d4;
+        c[NO      * stride] = record.no;
+        c[AO      * stride] = record.ao;
+        c[ECCO    * stride] = record.ecco;
+        c[SINIO   * stride] = record.sinio;
+        c[COSIO   * stride] = record.cosio;
+        c[AYCOF   * stride] = record.aycof;
+        c[XLCOF   * stride] = record.xlcof;
+        c[CON41   * stride] = record.con41;
+        c[X1MTH2  * stride] = record.x1mth2;
+        c[X7THM1  * stride] = record.x7thm1;
+    }
+
+    /** Propagate several near Earth satellites to one date each.
+     * @param constants constants of the first satellite, the constants of all
+     * satellites being stored in structure of arrays layout
+     * @param stride distance between two consecutive constants of one satellite
+     * @param tsince offsets of the dates with respect to the satellites epochs (min)
+     * @param count number of satellites
+     * @param x placeholder for the positions abscissas in TEME frame (m)
+     * @param y placeholder for the positions ordinates in TEME frame (m)
+     * @param z placeholder for the positions heights in TEME frame (m)
+     * @param vx placeholder for the velocities abscissas in TEME frame (m/s)
+     * @param vy placeholder for the velocities ordinates in TEME frame (m/s)
+     * @param vz placeholder for the velocities heights in TEME frame (m/s)
+     */
+    static inline void propagateSatellites(const double* constants, size_t stride,
+                                           const double* tsince, size_t count,
+                                           double* x, double* y, double* z, double* vx, double* vy, double* vz)
+    {
+        for (size_t start = 0; start < count; start += BLOCK_SIZE) {
+            const size_t size = (count - start < BLOCK_SIZE) ? count - start : BLOCK_SIZE;
+            propagateBlock(constants + start, stride, tsince + start, size,
+                           x + start, y + start, z + start, vx + start, vy + start, vz + start);
+        }
+    }
+
+    /** Propagate a block of near Earth satellites.
+     * <p>The evaluation is split in phases, each one a loop over the lanes
+     * (libm sines and cosines, secular and drag terms, Newton iterations,
+     * short periodic terms), so the arithmetic loops can be vectorized. The
+     * Newton iterations stop when all lanes converged.</p>
+     * @param constants constants of the first lane
+     * @param stride distance between two consecutive constants of one lane
+     * @param tsince offsets of the dates with respect to the satellites epochs (min)
+     * @param count number of lanes, at most {@link #BLOCK_SIZE}
+     * @param x placeholder for the positions abscissas in TEME frame (m)
+     * @param y placeholder for the positions ordinates in TEME frame (m)
+     * @param z placeholder for the positions heights in TEME frame (m)
+     * @param vx placeholder for the velocities abscissas in TEME frame (m/s)
+     * @param vy placeholder for the velocities ordinates in TEME frame (m/s)
+     * @param vz placeholder for the velocities heights in TEME frame (m/s)
+     */
+    static inline void propagateBlock(const double* constants, size_t stride, const double* tsince, size_t count,
+                                      double* x, double* y, double* z, double* vx, double* vy, double* vz)
+    {
+        const double* c = constants;
+
+        // mean anomaly without drag, for the drag terms
+        double xmdf[BLOCK_SIZE];
+        double cosXmdf[BLOCK_SIZE];
+        for (size_t k = 0; k < count; ++k) {
+            xmdf[k]    = c[MO * stride + k] + c[MDOT * stride + k] * tsince[k];
+            cosXmdf[k] = std::cos(xmdf[k]);
+        }
+
+        // secular gravity and atmospheric drag
+        double mm[BLOCK_SIZE];
+        double argpm[BLOCK_SIZE];
+        double nodem[BLOCK_SIZE];
+        double tempa[BLOCK_SIZE];
+        double templ[BLOCK_SIZE];
+        for (size_t k = 0; k < count; ++k) {
+            const double t        = tsince[k];
+            const double t2       = t * t;
+            const double t3       = t2 * t;
+            const double t4       = t3 * t;
+            const double delmtemp = 1.0 + c[ETA * stride + k] * cosXmdf[k];
+            const double delm     = c[XMCOF * stride + k] * (delmtemp * delmtemp * delmtemp - c[DELMO * stride + k]);
+            const double temp     = c[OMGCOF * stride + k] * t + delm;
+            mm[k]    = xmdf[k] + temp;
+            argpm[k] = c[ARGPO * stride + k] + c[ARGPDOT * stride + k] * t - temp;
+            nodem[k] = c[NODEO * stride + k] + c[NODEDOT * stride + k] * t + c[NODECF * stride + k] * t2;
+            tempa[k] = 1.0 - c[CC1 * stride + k] * t - c[D2 * stride + k] * t2 -
+                       c[D3 * stride + k] * t3 - c[D4 * stride + k] * t4;
+            templ[k] = c[T2COF * stride + k] * t2 + c[T3COF * stride + k] * t3 +
+                       t4 * (c[T4COF * stride + k] + t * c[T5COF * stride + k]);
+        }
+
+        double sinMm[BLOCK_SIZE];
+        for (size_t k = 0; k < count; ++k) {
+            sinMm[k] = std::sin(mm[k]);
+        }
+
+        double am[BLOCK_SIZE];
+        double nm[BLOCK_SIZE];
+        double em[BLOCK_SIZE];
+        bool   valid[BLOCK_SIZE];
+        for (size_t k = 0; k < count; ++k) {
+            const double t     = tsince[k];
+            const double tempe = c[BCC4 * stride + k] * t + c[BCC5 * stride + k] * (sinMm[k] - c[SINMAO * stride + k]);
+            am[k] = c[AO * stride + k] * tempa[k] * tempa[k];
+            nm[k] = XKE / (am[k] * std::sqrt(am[k]));
+            const double e = c[ECCO * stride + k] - tempe;
+            valid[k] = (e < 1.0) && (e >= -0.001);
+            em[k]    = (e < 1.0e-6) ? 1.0e-6 : e;
+            mm[k]   += c[NO * stride + k] * templ[k];
+        }
+
+        // sines and cosines of the secular angles
+        double sinArgp[BLOCK_SIZE];
+        double cosArgp[BLOCK_SIZE];
+        double sinNode[BLOCK_SIZE];
+        double cosNode[BLOCK_SIZE];
+        for (size_t k = 0; k < count; ++k) {
+            sinArgp[k] = std::sin(argpm[k]);
+            cosArgp[k] = std::cos(argpm[k]);
+            sinNode[k] = std::sin(nodem[k]);
+            cosNode[k] = std::cos(nodem[k]);
+        }
+
+        // long period periodics, u being the mean argument of latitude
+        double axnl[BLOCK_SIZE];
+        double aynl[BLOCK_SIZE];
+        double u[BLOCK_SIZE];
+        for (size_t k = 0; k < count; ++k) {
+            const double temp = 1.0 / (am[k] * (1.0 - em[k] * em[k]));
+            axnl[k] = em[k] * cosArgp[k];
+            aynl[k] = em[k] * sinArgp[k] + temp * c[AYCOF * stride + k];
+            u[k]    = mm[k] + argpm[k] + temp * c[XLCOF * stride + k] * axnl[k];
+        }
+
+        double sinU[BLOCK_SIZE];
+        double cosU[BLOCK_SIZE];
+        for (size_t k = 0; k < count; ++k) {
+            sinU[k] = std::sin(u[k]);
+            cosU[k] = std::cos(u[k]);
+        }
+
+        // Kepler's equation, solved for d = E - u
+        double d[BLOCK_SIZE];
+        for (size_t k = 0; k < count; ++k) {
+            d[k] = 0.0;
+        }
+        for (int i = 0; i < MAX_ITERATIONS; ++i) {
+            double largest = 0.0;
+            for (size_t k = 0; k < count; ++k) {
+                double sinE, cosE;
+                rotate(sinU[k], cosU[k], d[k], sinE, cosE);
+                const double f1 = 1.0 - cosE * axnl[k] - sinE * aynl[k];
+                double step = (axnl[k] * sinE - aynl[k] * cosE - d[k]) / f1;
+                step  = (step > 0.95) ? 0.95 : (step < -0.95) ? -0.95 : step;
+                d[k] += step;
+                const double absStep = std::fabs(step);
+                largest = (absStep > largest) ? absStep : largest;
+            }
+            if (!(largest >= KEPLER_THRESHOLD)) {
+                break;
+            }
+        }
+
+        // short period periodics
+        for (size_t k = 0; k < count; ++k) {
+            double sinE, cosE;
+            rotate(sinU[k], cosU[k], d[k], sinE, cosE);
+            const double ecose = axnl[k] * cosE + aynl[k] * sinE;
+            const double esine = axnl[k] * sinE - aynl[k] * cosE;
+            const double el2   = axnl[k] * axnl[k] + aynl[k] * aynl[k];
+            const double pl    = am[k] * (1.0 - el2);
+            const double rl    = am[k] * (1.0 - ecose);
+            const double rdotl = std::sqrt(am[k]) * esine / rl;
+            const double rvdotl = std::sqrt(pl) / rl;
+            const double betal = std::sqrt(1.0 - el2);
+            const double temp  = esine / (1.0 + betal);
+
+            // the argument of latitude is only used through its normalized sine and cosine
+            // so the common am / rl factor is dropped
+            const double sinu0 = sinE - aynl[k] - axnl[k] * temp;
+            const double cosu0 = cosE - axnl[k] + aynl[k] * temp;
+            const double norm  = 1.0 / std::sqrt(sinu0 * sinu0 + cosu0 * cosu0);
+            const double sinu  = sinu0 * norm;
+            const double cosu  = cosu0 * norm;
+            const double sin2u = (cosu + cosu) * sinu;
+            const double cos2u = 1.0 - 2.0 * sinu * sinu;
+            const double temp1 = 0.5 * J2 / pl;
+            const double temp2 = temp1 / pl;
+
+            const double cosio  = c[COSIO  * stride + k];
+            const double sinio  = c[SINIO  * stride + k];
+            const double con41  = c[CON41  * stride + k];
+            const double x1mth2 = c[X1MTH2 * stride + k];
+            const double mrt    = rl * (1.0 - 1.5 * temp2 * betal * con41) + 0.5 * temp1 * x1mth2 * cos2u;
+            const double mvt    = rdotl - nm[k] * temp1 * x1mth2 * sin2u / XKE;
+            const double rvdot  = rvdotl + nm[k] * temp1 * (x1mth2 * cos2u + 1.5 * con41) / XKE;
+
+            // orientation vectors
+            double sinsu, cossu, snod, cnod, sini, cosi;
+            rotate(sinu, cosu, -0.25 * temp2 * c[X7THM1 * stride + k] * sin2u, sinsu, cossu);
+            rotate(sinNode[k], cosNode[k], 1.5 * temp2 * cosio * sin2u, snod, cnod);
+            rotate(sinio, cosio, 1.5 * temp2 * cosio * sinio * cos2u, sini, cosi);
+            const double xmx = -snod * cosi;
+            const double xmy =  cnod * cosi;
+            const double ux  = xmx * sinsu + cnod * cossu;
+            const double uy  = xmy * sinsu + snod * cossu;
+            const double uz  = sini * sinsu;
+            const double wx  = xmx * cossu - cnod * sinsu;
+            const double wy  = xmy * cossu - snod * sinsu;
+            const double wz  = sini * cossu;
+
+            const double scale = (valid[k] && pl >= 0.0 && mrt >= 1.0) ?
+                                 1000.0 : std::numeric_limits<double>::quiet_NaN();
+            const double r = scale * EARTH_RADIUS * mrt;
+            const double v = scale * VKMPERSEC;
+            x[k]  = r * ux;
+            y[k]  = r * uy;
+            z[k]  = r * uz;
+            vx[k] = v * (mvt * ux + rvdot * wx);
+            vy[k] = v * (mvt * uy + rvdot * wy);
+            vz[k] = v * (mvt * uz + rvdot * wz);
+        }
+    }
+
+private:
+    /** Rotate an angle by a small increment.
+     * @param sinA sine of the angle
+     * @param cosA cosine of the angle
+     * @param delta small increment (rad)
+     * @param sinB placeholder for the sine of the rotated angle
+     * @param cosB placeholder for the cosine of the rotated angle
+     */
+    static inline void rotate(double sinA, double cosA, double delta, double& sinB, double& cosB)
+    {
+        double sinD, cosD;
+        KeplerSolver::sinCosSmall(delta, sinD, cosD);
+        sinB = sinA * cosD + cosA * sinD;
+        cosB = cosA * cosD - sinA * sinD;
+    }
+};
+
+#endif
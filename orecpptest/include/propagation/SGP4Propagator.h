@@ -0,0 +1,129 @@
+#ifndef _SGP4_PROPAGATOR_H_
+#define _SGP4_PROPAGATOR_H_
+
+#include <stddef.h>
+#include "propagation/SGP4Record.h"
+#include "propagation/TLE.h"
+#include "utils/PVCoordinates.h"
+
+/** SGP4/SDP4 propagator for {@link TLE Two-Line Elements}.
+ * <p>This is the model of "Revisiting Spacetrack Report #3" (Vallado et
+ * al., AIAA 2006-6753), in its improved operation mode: SGP4 for near
+ * Earth satellites, with a simplified drag model when the perigee is below
+ * 220 km, and SDP4 for deep space satellites (period of 225 minutes or
+ * more), which adds lunisolar periodics and secular rates and the one day
+ * and half day resonances of the geopotential.</p>
+ * <p>All time independent coefficients are computed once per satellite
+ * into a {@link SGP4Record}, see {@link #initialize}. States are given in
+ * the TEME frame, in meters and meters per second.</p>
+ * <p>Errors are reported through {@link Status} values: the propagator is
+ * invalid if the elements cannot be initialized, and propagation returns
+ * NaN states for dates where the satellite decayed or its elements became
+ * meaningless.</p>
+ * <p>Instances of this class are guaranteed to be immutable.</p>
+ * @see SGP4CatalogPropagator
+ */
+class SGP4Propagator
+{
+public:
+    /** Validity of a propagator or of a propagated state. */
+    enum Status {
+        /** The state is valid. */
+        VALID,
+        /** The mean eccentricity is outside of [0, 1) or the mean motion is not positive. */
+        INVALID_ELEMENTS,
+        /** The perturbed mean eccentricity is outside of [-0.001, 1). */
+        ECCENTRICITY_OUT_OF_RANGE,
+        /** The perturbed mean motion is not positive. */
+        NEGATIVE_MEAN_MOTION,
+        /** The eccentricity with lunisolar periodics is outside of [0, 1]. */
+        PERTURBED_ECCENTRICITY_OUT_OF_RANGE,
+        /** The semi-latus rectum is negative. */
+        NEGATIVE_SEMI_LATUS_RECTUM,
+        /** The satellite is below the Earth surface. */
+        DECAYED
+    };
+
+    /** Build a propagator.
+     * @param tle elements of the satellite
+     */
+    explicit SGP4Propagator(const TLE& tle);
+
+    /** Compute the initialization record of a satellite.
+     * @param tle elements of the satellite
+     * @param record placeholder for the initialization record
+     * @return {@link #VALID} or {@link #INVALID_ELEMENTS}
+     */
+    static Status initialize(const TLE& tle, SGP4Record& record);
+
+    /** Propagate a satellite.
+     * <p>The state is set to NaN if the status is not {@link #VALID}.</p>
+     * @param record initialization record of the satellite
+     * @param tsince offset of the date with respect to the epoch of the elements (min)
+     * @param x placeholder for the position abscissa in TEME frame (m)
+     * @param y placeholder for the position ordinate in TEME frame (m)
+     * @param z placeholder for the position height in TEME frame (m)
+     * @param vx placeholder for the velocity abscissa in TEME frame (m/s)
+     * @param vy placeholder for the velocity ordinate in TEME frame (m/s)
+     * @param vz placeholder for the velocity height in TEME frame (m/s)
+     * @return status of the state
+     */
+    static Status propagate(const SGP4Record& record, double tsince,
+                            double& x, double& y, double& z, double& vx, double& vy, double& vz);
+
+    /** Get the status of the propagator.
+     * @return status of the initialization
+     */
+    Status getStatus() const;
+
+    /** Check if the propagator can be used.
+     * @return true if the status is {@link #VALID}
+     */
+    bool isValid() const;
+
+    /** Check if the deep space model is used.
+     * @return true if the satellite period is 225 minutes or more
+     */
+    bool isDeepSpace() const;
+
+    /** Get the elements.
+     * @return elements of the satellite
+     */
+    const TLE& getTLE() const;
+
+    /** Get the initialization record.
+     * @return initialization record
+     */
+    const SGP4Record& getRecord() const;
+
+    /** Get the position-velocity at a date.
+     * @param date target date
+     * @return position-velocity in TEME frame, NaN if the state is not valid
+     */
+    PVCoordinates getPVCoordinates(const LinearTime& date) const;
+
+    /** Get the position-velocity at several dates.
+     * @param dates target dates
+     * @param count number of dates
+     * @param x placeholder for the positions abscissas in TEME frame (m)
+     * @param y placeholder for the positions ordinates in TEME frame (m)
+     * @param z placeholder for the positions heights in TEME frame (m)
+     * @param vx placeholder for the velocities abscissas in TEME frame (m/s)
+     * @param vy placeholder for the velocities ordinates in TEME frame (m/s)
+     * @param vz placeholder for the velocities heights in TEME frame (m/s)
+     */
+    void getPVCoordinates(const LinearTime* dates, size_t count,
+                          double* x, double* y, double* z, double* vx, double* vy, double* vz) const;
+
+private:
+    /** Elements of the satellite. */
+    TLE tle;
+
+    /** Status of the initialization. */
+    Status status;
+
+    /** Initialization record. */
+    SGP4Record record;
+};
+
+#endif
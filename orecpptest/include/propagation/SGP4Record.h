@@ -0,0 +1,84 @@
+#ifndef _SGP4_RECORD_H_
+#define _SGP4_RECORD_H_
+
+#include "time/LinearTime.h"
+
+/** Initialization record of the SGP4/SDP4 models for one satellite.
+ * <p>The record holds the elements of a {@link TLE} converted to the units
+ * of the models (earth radii, minutes) and every coefficient that does not
+ * depend on time, as computed by {@link SGP4Propagator#initialize}. Names
+ * follow the ones of the reference implementation of Vallado et al.,
+ * "Revisiting Spacetrack Report #3", AIAA 2006-6753, so the formulas can be
+ * checked against it.</p>
+ * <p>The deep space coefficients are only set for satellites whose period
+ * is 225 minutes or more. The resonance integrator always restarts from the
+ * epoch, so the record is never modified after initialization and can be
+ * shared between threads.</p>
+ */
+struct SGP4Record
+{
+    /** Epoch of the elements. */
+    LinearTime epoch;
+
+    /** Satellite catalog number. */
+    int satelliteNumber;
+
+    /** Indicator for the deep space (SDP4) model. */
+    bool deepSpace;
+
+    /** Indicator for the simplified drag model of low perigee and deep space satellites. */
+    bool simplified;
+
+    /** Resonance: 0 for none, 1 for one day (synchronous), 2 for half day (Molniya). */
+    int irez;
+
+    /** Ballistic coefficient (1/earth radii). */
+    double bstar;
+
+    /** Mean elements at epoch: eccentricity, inclination, node, perigee argument, mean anomaly (rad). */
+    double ecco, inclo, nodeo, argpo, mo;
+
+    /** Un-Kozai mean motion (rad/min). */
+    double no;
+
+    /** Mean semi-major axis (earth radii), sine and cosine of the inclination. */
+    double ao, sinio, cosio;
+
+    /** Secular rates of mean anomaly, perigee argument and node (rad/min). */
+    double mdot, argpdot, nodedot;
+
+    /** Drag coefficients. */
+    double cc1, cc4, cc5, d2, d3, d4, delmo, eta, omgcof, xmcof, nodecf, sinmao;
+
+    /** Drag polynomials coefficients of mean longitude. */
+    double t2cof, t3cof, t4cof, t5cof;
+
+    /** Long period and short period coefficients. */
+    double aycof, xlcof, con41, x1mth2, x7thm1;
+
+    /** Greenwich sidereal angle at epoch (rad). */
+    double gsto;
+
+    /** Solar periodics coefficients. */
+    double se2, se3, si2, si3, sl2, sl3, sl4, sgh2, sgh3, sgh4, sh2, sh3;
+
+    /** Lunar periodics coefficients. */
+    double ee2, e3, xi2, xi3, xl2, xl3, xl4, xgh2, xgh3, xgh4, xh2, xh3;
+
+    /** Solar and lunar mean anomalies at epoch (rad). */
+    double zmos, zmol;
+
+    /** Lunisolar secular rates of eccentricity, inclination, mean anomaly, perigee argument and node (per min). */
+    double dedt, didt, dmdt, domdt, dnodt;
+
+    /** Synchronous resonance coefficients. */
+    double del1, del2, del3;
+
+    /** Half day resonance coefficients. */
+    double d2201, d2211, d3210, d3222, d4410, d4422, d5220, d5232, d5421, d5433;
+
+    /** Resonance mean longitude at epoch (rad) and its rate offset (rad/min). */
+    double xlamo, xfact;
+};
+
+#endif
@@ -0,0 +1,153 @@
+#ifndef _TLE_H_
+#define _TLE_H_
+
+#include "time/LinearTime.h"
+
+/** Two-Line Elements of a satellite.
+ * <p>These are the mean elements published by NORAD for use with the SGP4
+ * and SDP4 models (see {@link SGP4Propagator}), they are not osculating
+ * elements and must not be used with any other propagation model.</p>
+ * <p>The epoch is given the way the lines give it: a year and a fractional
+ * day number in this year, day 1.0 being January 1st at 00:00 UTC. It is
+ * converted with {@link DateComponents#DateComponents(int, int)} for the
+ * integer part of the day.</p>
+ * <p>Angles are in radians and the mean motion in radians per second, as
+ * everywhere else in the library, and not in degrees and revolutions per
+ * day as in the lines.</p>
+ * <p>Instances of this class are guaranteed to be immutable.</p>
+ */
+class TLE
+{
+public:
+    /** Build an instance from its elements.
+     * @param satelliteNumber satellite catalog number
+     * @param epochYear year of the epoch, with all its digits
+     * @param epochDay day number of the epoch in the year, with fraction (1.0 is January 1st at 00:00)
+     * @param meanMotion mean motion (rad/s)
+     * @param meanMotionFirstDerivative first time derivative of the mean motion (rad/s²)
+     * @param meanMotionSecondDerivative second time derivative of the mean motion (rad/s³)
+     * @param e eccentricity
+     * @param i inclination (rad)
+     * @param pa perigee argument (rad)
+     * @param raan right ascension of ascending node (rad)
+     * @param meanAnomaly mean anomaly (rad)
+     * @param bStar ballistic coefficient (1/earth radii)
+     */
+    TLE(int satelliteNumber, int epochYear, double epochDay,
+        double meanMotion, double meanMotionFirstDerivative, double meanMotionSecondDerivative,
+        double e, double i, double pa, double raan, double meanAnomaly, double bStar);
+
+    /** Get the satellite catalog number.
+     * @return satellite catalog number
+     */
+    int getSatelliteNumber() const;
+
+    /** Get the year of the epoch.
+     * @return year of the epoch
+     */
+    int getEpochYear() const;
+
+    /** Get the day number of the epoch in its year.
+     * @return day number with fraction (1.0 is January 1st at 00:00)
+     */
+    double getEpochDay() const;
+
+    /** Get the epoch.
+     * @return epoch, in UTC
+     */
+    const LinearTime& getDate() const;
+
+    /** Get the mean motion.
+     * @return mean motion (rad/s)
+     */
+    double getMeanMotion() const;
+
+    /** Get the first time derivative of the mean motion.
+     * @return first time derivative of the mean motion (rad/s²)
+     */
+    double getMeanMotionFirstDerivative() const;
+
+    /** Get the second time derivative of the mean motion.
+     * @return second time derivative of the mean motion (rad/s³)
+     */
+    double getMeanMotionSecondDerivative() const;
+
+    /** Get the eccentricity.
+     * @return eccentricity
+     */
+    double getE() const;
+
+    /** Get the inclination.
+     * @return inclination (rad)
+     */
+    double getI() const;
+
+    /** Get the perigee argument.
+     * @return perigee argument (rad)
+     */
+    double getPerigeeArgument() const;
+
+    /** Get the right ascension of the ascending node.
+     * @return right ascension of the ascending node (rad)
+     */
+    double getRaan() const;
+
+    /** Get the mean anomaly.
+     * @return mean anomaly (rad)
+     */
+    double getMeanAnomaly() const;
+
+    /** Get the ballistic coefficient.
+     * @return bStar (1/earth radii)
+     */
+    double getBStar() const;
+
+    /** Compute the epoch of a set of elements.
+     * @param epochYear year of the epoch, with all its digits
+     * @param epochDay day number of the epoch in the year, with fraction
+     * @return epoch, in UTC
+     */
+    static LinearTime computeDate(int epochYear, double epochDay);
+
+private:
+    /** Satellite catalog number. */
+    int satelliteNumber;
+
+    /** Year of the epoch. */
+    int epochYear;
+
+    /** Day number of the epoch, with fraction. */
+    double epochDay;
+
+    /** Epoch. */
+    LinearTime epoch;
+
+    /** Mean motion (rad/s). */
+    double meanMotion;
+
+    /** First time derivative of the mean motion (rad/s²). */
+    double meanMotionFirstDerivative;
+
+    /** Second time derivative of the mean motion (rad/s³). */
+    double meanMotionSecondDerivative;
+
+    /** Eccentricity. */
+    double e;
+
+    /** Inclination (rad). */
+    double i;
+
+    /** Perigee argument (rad). */
+    double pa;
+
+    /** Right ascension of the ascending node (rad). */
+    double raan;
+
+    /** Mean anomaly (rad). */
+    double meanAnomaly;
+
+    /** Ballistic coefficient (1/earth radii). */
+    double bStar;
+};
+
+#endif
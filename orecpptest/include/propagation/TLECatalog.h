@@ -0,0 +1,220 @@
+#ifndef _TLE_CATALOG_H_
+#define _TLE_CATALOG_H_
+
+#include <stddef.h>
+#include <vector>
+#include "propagation/TLE.h"
+#include "utils/ThreadPool.h"
+
+/** Catalog of Two-Line Elements read from a text file.
+ * <p>Files are memory mapped and parsed in place: the fixed columns of
+ * each line are decoded directly from the mapped bytes, without copying
+ * lines nor allocating per record. Elements are stored as a structure of
+ * arrays, one column per element, in the units of {@link TLE}; the epoch
+ * is converted once with {@link TLE#computeDate(int, double)}, which uses
+ * {@link DateComponents#DateComponents(int, int)} for the day number and
+ * adds the fraction of day.</p>
+ * <p>A record is a line starting with <code>1 </code> immediately followed
+ * by a line starting with <code>2 </code>, both at least 69 characters
+ * long, with valid checksums (column 69, sum of the digits of columns 1 to
+ * 68 with minus signs counting as 1, modulo 10) and the same satellite
+ * number. Satellite numbers may use the Alpha-5 extension (a letter
+ * followed by four digits, I and O being skipped). Two digits years from
+ * 57 to 99 are in the twentieth century, others in the twenty-first. Other
+ * lines (the name lines of the three lines format, blank lines...) are
+ * skipped, and pairs of lines that fail any check are counted as {@link
+ * #getRejected() rejected}.</p>
+ * <p>The parallel parse cuts the data in segments at record boundaries and
+ * parses each segment into its own slice of the columns, which are sized
+ * once for the largest possible number of records; slices are then packed.
+ * Records keep their file order, so the table does not depend on the number
+ * of threads.</p>
+ */
+class TLECatalog
+{
+public:
+    /** Build an empty catalog. */
+    TLECatalog();
+
+    /** Read a catalog file, replacing the current content.
+     * @param path path of the file
+     * @return true if the file could be mapped
+     */
+    bool read(const char* path);
+
+    /** Read a catalog file in parallel, replacing the current content.
+     * @param pool thread pool
+     * @param path path of the file
+     * @return true if the file could be mapped
+     */
+    bool read(ThreadPool& pool, const char* path);
+
+    /** Parse catalog data in memory, replacing the current content.
+     * @param begin first character
+     * @param end character after the last one
+     */
+    void parse(const char* begin, const char* end);
+
+    /** Parse catalog data in memory in parallel, replacing the current content.
+     * @param pool thread pool
+     * @param begin first character
+     * @param end character after the last one
+     */
+    void parse(ThreadPool& pool, const char* begin, const char* end);
+
+    /** Get the number of records.
+     * @return number of valid records
+     */
+    size_t getSize() const;
+
+    /** Get the number of rejected records.
+     * @return number of pairs of lines that failed format, checksum or satellite number checks
+     */
+    size_t getRejected() const;
+
+    /** Get one record.
+     * @param index index of the record, in file order
+     * @return elements of the record
+     */
+    TLE getTLE(size_t index) const;
+
+    /** Get the satellite catalog numbers.
+     * @return satellite catalog numbers, {@link #getSize()} elements
+     */
+    const int* getSatelliteNumbers() const;
+
+    /** Get the years of the epochs.
+     * @return years of the epochs, with all their digits
+     */
+    const int* getEpochYears() const;
+
+    /** Get the day numbers of the epochs in their years.
+     * @return day numbers with fraction (1.0 is January 1st at 00:00)
+     */
+    const double* getEpochDays() const;
+
+    /** Get the epochs.
+     * @return epochs, in UTC
+     */
+    const LinearTime* getEpochs() const;
+
+    /** Get the mean motions.
+     * @return mean motions (rad/s)
+     */
+    const double* getMeanMotions() const;
+
+    /** Get the first time derivatives of the mean motions.
+     * @return first time derivatives of the mean motions (rad/s²)
+     */
+    const double* getMeanMotionFirstDerivatives() const;
+
+    /** Get the second time derivatives of the mean motions.
+     * @return second time derivatives of the mean motions (rad/s³)
+     */
+    const double* getMeanMotionSecondDerivatives() const;
+
+    /** Get the eccentricities.
+     * @return eccentricities
+     */
+    const double* getE() const;
+
+    /** Get the inclinations.
+     * @return inclinations (rad)
+     */
+    const double* getI() const;
+
+    /** Get the perigee arguments.
+     * @return perigee arguments (rad)
+     */
+    const double* getPerigeeArguments() const;
+
+    /** Get the right ascensions of ascending nodes.
+     * @return right ascensions of ascending nodes (rad)
+     */
+    const double* getRaans() const;
+
+    /** Get the mean anomalies.
+     * @return mean anomalies (rad)
+     */
+    const double* getMeanAnomalies() const;
+
+    /** Get the ballistic coefficients.
+     * @return ballistic coefficients (1/earth radii)
+     */
+    const double* getBStars() const;
+
+    /** Minimal number of bytes of a record: two 69 characters lines and a newline between them. */
+    static constexpr size_t MIN_RECORD_BYTES = 139;
+
+    /** Target number of bytes of the segments of the parallel parse. */
+    static constexpr size_t SEGMENT_BYTES = 1 << 20;
+
+private:
+    /** Resize all columns.
+     * @param size new number of rows
+     */
+    void resize(size_t size);
+
+    /** Move rows within all columns.
+     * @param from index of the first row to move
+     * @param count number of rows to move
+     * @param to new index of the first row, not after from
+     */
+    void move(size_t from, size_t count, size_t to);
+
+    /** Parse a segment of data into the columns.
+     * @param begin first character, at a line start
+     * @param end character after the last one, at a line start or at the end of data
+     * @param first index of the row receiving the first record
+     * @param rejects placeholder for the number of rejected records, incremented
+     * @return number of records parsed
+     */
+    size_t parseSegment(const char* begin, const char* end, size_t first, size_t& rejects);
+
+    /** Number of records. */
+    size_t size;
+
+    /** Number of rejected records. */
+    size_t rejected;
+
+    /** Satellite catalog numbers. */
+    std::vector<int> satelliteNumbers;
+
+    /** Years of the epochs. */
+    std::vector<int> epochYears;
+
+    /** Day numbers of the epochs. */
+    std::vector<double> epochDays;
+
+    /** Epochs. */
+    std::vector<LinearTime> epochs;
+
+    /** Mean motions (rad/s). */
+    std::vector<double> meanMotions;
+
+    /** First time derivatives of the mean motions (rad/s²). */
+    std::vector<double> meanMotionFirstDerivatives;
+
+    /** Second time derivatives of the mean motions (rad/s³). */
+    std::vector<double> meanMotionSecondDerivatives;
+
+    /** Eccentricities. */
+    std::vector<double> e;
+
+    /** Inclinations (rad). */
+    std::vector<double> i;
+
+    /** Perigee arguments (rad). */
+    std::vector<double> pa;
+
+    /** Right ascensions of ascending nodes (rad). */
+    std::vector<double> raan;
+
+    /** Mean anomalies (rad). */
+    std::vector<double> meanAnomalies;
+
+    /** Ballistic coefficients (1/earth radii). */
+    std::vector<double> bStars;
+};
+
+#endif
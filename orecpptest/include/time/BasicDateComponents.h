@@ -0,0 +1,392 @@
+#ifndef _BASIC_DATE_COMPONENTS_H_
+#define _BASIC_DATE_COMPONENTS_H_
+
+#include <stdint.h>
+#include "time/DateComponents.h"
+
+/** Calendar policy following the astronomical convention of {@link DateComponents}.
+ * <p>Up to 0000-12-31 the proleptic julian calendar is used, from 0001-01-01
+ * to 1582-10-04 the julian calendar and from 1582-10-15 the gregorian
+ * calendar. Conversions are delegated to {@link DateComponents}, so dates
+ * built with this policy have exactly the same fields.</p>
+ * @see BasicDateComponents
+ */
+struct AstronomicalCalendar
+{
+    /** Convert a day offset to calendar fields.
+     * @param j2000Day day offset with respect to J2000 epoch
+     * @param year placeholder for the year number
+     * @param month placeholder for the month number
+     * @param day placeholder for the day number
+     */
+    static void toCalendar(int j2000Day, int& year, int& month, int& day)
+    {
+        const DateComponents date(j2000Day);
+        year  = date.getYear();
+        month = date.getMonth();
+        day   = date.getDay();
+    }
+
+    /** Convert calendar fields to a day offset.
+     * @param year year number
+     * @param month month number from 1 to 12
+     * @param day day number from 1 to 31
+     * @return day offset with respect to J2000 epoch
+     */
+    static int toJ2000Day(int year, int month, int day)
+    {
+        return DateComponents(year, month, day).getJ2000Day();
+    }
+
+    /** Get the ISO calendar week of a date.
+     * @param j2000Day day offset with respect to J2000 epoch
+     * @param year year number of the date
+     * @param month month number of the date
+     * @param day day number of the date
+     * @return calendar week number
+     */
+    static int getCalendarWeek(int j2000Day, int year, int month, int day)
+    {
+        (void) j2000Day;
+        return DateComponents(year, month, day).getCalendarWeek();
+    }
+};
+
+/** Calendar policy using the proleptic gregorian calendar for all dates.
+ * <p>This is the calendar of ISO-8601 and <code>std::chrono::year_month_day</code>,
+ * with a year 0 between years -1 and +1 and no missing days in 1582. Dates
+ * before 1582-10-15 therefore have different fields than with
+ * {@link AstronomicalCalendar}, for the same day offset.</p>
+ * <p>Conversions use the Neri-Schneider euclidean affine functions: the day
+ * offset is first shifted by a whole number of 400 years cycles so that all
+ * computations are done on unsigned 64 bits integers, with only
+ * multiplications, shifts and divisions by constants. There are no branches
+ * and no table lookups, and the full range of <code>int</code> offsets is
+ * supported.</p>
+ * @see BasicDateComponents
+ */
+struct GregorianOnly
+{
+    /** Convert a day offset to calendar fields.
+     * @param j2000Day day offset with respect to J2000 epoch
+     * @param year placeholder for the year number
+     * @param month placeholder for the month number
+     * @param day placeholder for the day number
+     */
+    static void toCalendar(int j2000Day, int& year, int& month, int& day)
+    {
+        int64_t y;
+        toCalendar(j2000Day, y, month, day);
+        year = static_cast<int>(y);
+    }
+
+    /** Convert calendar fields to a day offset.
+     * @param year year number
+     * @param month month number from 1 to 12
+     * @param day day number from 1 to 31
+     * @return day offset with respect to J2000 epoch
+     */
+    static int toJ2000Day(int year, int month, int day)
+    {
+        return static_cast<int>(toJ2000Day(static_cast<int64_t>(year), month, day));
+    }
+
+    /** Get the ISO calendar week of a date.
+     * @param j2000Day day offset with respect to J2000 epoch
+     * @param year year number of the date
+     * @param month month number of the date
+     * @param day day number of the date
+     * @return calendar week number
+     */
+    static int getCalendarWeek(int j2000Day, int year, int month, int day)
+    {
+        (void) year;
+        (void) month;
+        (void) day;
+
+        // the week belongs to the year containing its Thursday,
+        // which may be out of the int range near the range bounds
+        const int64_t thursday = static_cast<int64_t>(j2000Day) - getDayOfWeek(j2000Day) + 4;
+        int64_t weekYear;
+        int m;
+        int d;
+        toCalendar(thursday, weekYear, m, d);
+        return static_cast<int>((thursday - toJ2000Day(weekYear, 1, 1)) / 7) + 1;
+    }
+
+    /** Get the day of week of a day offset.
+     * @param j2000Day day offset with respect to J2000 epoch
+     * @return day of week, from 1 (Monday) to 7 (Sunday)
+     */
+    static int getDayOfWeek(int64_t j2000Day)
+    {
+        // J2000 epoch is a Saturday, the bias is a multiple of 7 keeping the dividend positive
+        return static_cast<int>(static_cast<uint64_t>(j2000Day + 5 + WEEK_BIAS) % 7) + 1;
+    }
+
+private:
+    /** Convert a day offset to calendar fields.
+     * @param j2000Day day offset with respect to J2000 epoch
+     * @param year placeholder for the year number
+     * @param month placeholder for the month number
+     * @param day placeholder for the day number
+     */
+    static void toCalendar(int64_t j2000Day, int64_t& year, int& month, int& day)
+    {
+        // days since March 1st of the biased year 0
+        const uint64_t n  = static_cast<uint64_t>(j2000Day + DAY_BIAS);
+
+        // century and day in century
+        const uint64_t n1 = 4 * n + 3;
+        const uint64_t c  = n1 / 146097;
+        const uint64_t nc = (n1 % 146097) / 4;
+
+        // year in century and day in year
+        const uint64_t p2 = UINT64_C(2939745) * (4 * nc + 3);
+        const uint64_t z  = p2 >> 32;
+        const uint64_t ny = (p2 & 0xFFFFFFFFu) / 2939745 / 4;
+
+        // March-based month and day in month
+        const uint64_t n3 = 2141 * ny + 197913;
+        const uint64_t m  = n3 >> 16;
+        const uint64_t d  = (n3 & 0xFFFFu) / 2141;
+
+        // January and February belong to the next year
+        const uint64_t j  = (ny >= 306) ? 1 : 0;
+        year  = static_cast<int64_t>(100 * c + z + j) - YEAR_BIAS;
+        month = static_cast<int>(m - 12 * j);
+        day   = static_cast<int>(d + 1);
+    }
+
+    /** Convert calendar fields to a day offset.
+     * @param year year number
+     * @param month month number from 1 to 12
+     * @param day day number from 1 to 31
+     * @return day offset with respect to J2000 epoch
+     */
+    static int64_t toJ2000Day(int64_t year, int month, int day)
+    {
+        // January and February belong to the previous March-based year
+        const uint64_t j  = (month <= 2) ? 1 : 0;
+        const uint64_t y  = static_cast<uint64_t>(year + YEAR_BIAS) - j;
+        const uint64_t m  = static_cast<uint64_t>(month) + 12 * j;
+        const uint64_t c  = y / 100;
+        const uint64_t ys = 1461 * y / 4 - c + c / 4;
+        const uint64_t ms = (979 * m - 2919) / 32;
+        return static_cast<int64_t>(ys + ms + static_cast<uint64_t>(day - 1)) - DAY_BIAS;
+    }
+
+    /** Number of 400 years cycles added to keep all computations positive. */
+    static const int64_t CYCLES_BIAS = 14700;
+
+    /** Year bias. */
+    static const int64_t YEAR_BIAS = 400 * CYCLES_BIAS;
+
+    /** Day bias: offset of J2000 epoch with respect to March 1st of the biased year 0. */
+    static const int64_t DAY_BIAS = 146097 * CYCLES_BIAS + 730425;
+
+    /** Multiple of 7 larger than any int offset magnitude. */
+    static const int64_t WEEK_BIAS = INT64_C(7) << 29;
+};
+
+/** Class representing a date broken up as year, month and day components,
+ * with a compile-time selectable calendar.
+ * <p>The calendar policy defines how day offsets are mapped to calendar
+ * fields. {@link AstronomicalCalendar} keeps the astronomical convention of
+ * {@link DateComponents} (julian calendar before 1582-10-15) whereas
+ * {@link GregorianOnly} uses the proleptic gregorian calendar for all dates,
+ * with a fully branch-free conversion. Both share the {@link DateComponents}
+ * API, so code written against one can be switched to the other by changing
+ * the type only.</p>
+ * <p>A policy is a class with the static functions
+ * <code>toCalendar(int, int&amp;, int&amp;, int&amp;)</code>,
+ * <code>toJ2000Day(int, int, int)</code> and
+ * <code>getCalendarWeek(int, int, int, int)</code>.</p>
+ * <p>Instances of this class are guaranteed to be immutable.</p>
+ * @param Policy calendar policy
+ * @see DateComponents
+ */
+template <typename Policy>
+class BasicDateComponents
+{
+public:
+    BasicDateComponents() = default;
+
+    /** Build a date from its components.
+     * @param year year number (may be 0 or negative for BC years)
+     * @param month month number from 1 to 12
+     * @param day day number from 1 to 31
+     */
+    BasicDateComponents(int year, int month, int day)
+        : year(year), month(month), day(day)
+    {
+
+    }
+
+    /** Build a date from a year and day number.
+     * @param year year number (may be 0 or negative for BC years)
+     * @param dayNumber day number in the year from 1 to 366
+     */
+    BasicDateComponents(int year, int dayNumber)
+        : BasicDateComponents(Policy::toJ2000Day(year - 1, 12, 31) + dayNumber)
+    {
+
+    }
+
+    /** Build a date from its offset with respect to J2000 epoch.
+     * @param offset offset with respect to J2000 epoch
+     * @see #getJ2000Day()
+     */
+    BasicDateComponents(int offset)
+    {
+        Policy::toCalendar(offset, year, month, day);
+    }
+
+    /** Build a date from its offset with respect to a reference epoch.
+     * @param epoch reference epoch
+     * @param offset offset with respect to a reference epoch
+     * @see #BasicDateComponents(int)
+     */
+    BasicDateComponents(const BasicDateComponents& epoch, int offset)
+        : BasicDateComponents(epoch.getJ2000Day() + offset)
+    {
+
+    }
+
+    /** Build a date representing the same day as a {@link DateComponents}.
+     * @param date date to convert (its fields may differ before 1582-10-15)
+     */
+    explicit BasicDateComponents(const DateComponents& date)
+        : BasicDateComponents(date.getJ2000Day())
+    {
+
+    }
+
+    /** Convert the date to a {@link DateComponents} representing the same day.
+     * @return date for the same day (its fields may differ before 1582-10-15)
+     */
+    DateComponents toDateComponents() const
+    {
+        return DateComponents(getJ2000Day());
+    }
+
+    /** Get the year number.
+     * @return year number (may be 0 or negative for BC years)
+     */
+    int getYear() const
+    {
+        return year;
+    }
+
+    /** Get the month.
+     * @return month number from 1 to 12
+     */
+    int getMonth() const
+    {
+        return month;
+    }
+
+    /** Get the day.
+     * @return day number from 1 to 31
+     */
+    int getDay() const
+    {
+        return day;
+    }
+
+    /** Get the day number with respect to J2000 epoch.
+     * @return day number with respect to J2000 epoch
+     */
+    int getJ2000Day() const
+    {
+        return Policy::toJ2000Day(year, month, day);
+    }
+
+    /** Get the modified julian day.
+     * @return modified julian day
+     */
+    int getMJD() const
+    {
+        return MJD_TO_J2000 + getJ2000Day();
+    }
+
+    /** Get the calendar week number.
+     * @return calendar week number, from 1 to 52 or 53
+     * @see DateComponents#getCalendarWeek()
+     */
+    int getCalendarWeek() const
+    {
+        return Policy::getCalendarWeek(getJ2000Day(), year, month, day);
+    }
+
+    /** Get the day of week.
+     * <p>Day of week is a number between 1 (Monday) and 7 (Sunday).</p>
+     * @return day of week
+     */
+    int getDayOfWeek() const
+    {
+        return GregorianOnly::getDayOfWeek(getJ2000Day());
+    }
+
+    /** Get the day number in year.
+     * @return day number in year, from 1 to 365 or 366
+     */
+    int getDayOfYear() const
+    {
+        return getJ2000Day() - Policy::toJ2000Day(year - 1, 12, 31);
+    }
+
+    /** {@inheritDoc} */
+    bool operator < (const BasicDateComponents& other) const
+    {
+        return getJ2000Day() < other.getJ2000Day();
+    }
+
+    /** {@inheritDoc} */
+    bool operator == (const BasicDateComponents& other) const
+    {
+        return year == other.year && month == other.month && day == other.day;
+    }
+
+    /** {@inheritDoc} */
+    int hashCode() const
+    {
+        return (year << 16) ^ (month << 8) ^ day;
+    }
+
+    /** Build a date from week components.
+     * @param wYear year associated to week numbering
+     * @param week week number in year, from 1 to 52 or 53
+     * @param dayOfWeek day of week, from 1 (Monday) to 7 (Sunday)
+     * @return a builded date
+     * @see DateComponents#createFromWeekComponents(int, int, int)
+     */
+    static BasicDateComponents createFromWeekComponents(int wYear, int week, int dayOfWeek)
+    {
+        // the first week is the one containing January 4th
+        const int january4 = Policy::toJ2000Day(wYear, 1, 4);
+        const int firstWeekMonday = january4 - GregorianOnly::getDayOfWeek(january4) + 1;
+        return BasicDateComponents(firstWeekMonday + 7 * week + dayOfWeek - 8);
+    }
+
+private:
+    /** Year number. */
+    int year;
+
+    /** Month number. */
+    int month;
+
+    /** Day number. */
+    int day;
+
+    /** Offset between J2000 epoch and modified julian day epoch. */
+    static const int MJD_TO_J2000 = 51544;
+};
+
+/** Date using the astronomical convention, with the same fields as {@link DateComponents}. */
+typedef BasicDateComponents<AstronomicalCalendar> AstronomicalDateComponents;
+
+/** Date using the proleptic gregorian calendar. */
+typedef BasicDateComponents<GregorianOnly> GregorianDateComponents;
+
+#endif
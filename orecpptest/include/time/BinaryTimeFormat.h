@@ -0,0 +1,127 @@
+#ifndef _BINARY_TIME_FORMAT_H_
+#define _BINARY_TIME_FORMAT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/** Layout of the binary format for arrays of dates and date/times.
+ * <p>A file (or memory block) starts with a fixed size {@link BinaryTimeHeader}
+ * followed by packed integer columns, one column per component. All values are
+ * little-endian and every column starts on an 8 bytes boundary, so a mapped file
+ * can be read by pointer casts without any parsing on little-endian hosts.</p>
+ * <ul>
+ *   <li>day column: <code>int32_t</code> day offsets with respect to the header epoch,</li>
+ *   <li>minute column: <code>int16_t</code> minute in day from 0 to 1439
+ *       (date/times only),</li>
+ *   <li>offset column: <code>int16_t</code> offset from UTC in minutes
+ *       (date/times only),</li>
+ *   <li>nanoseconds column: <code>int64_t</code> nanoseconds in minute from 0
+ *       to 61e9 excluded, leap seconds included (date/times only).</li>
+ * </ul>
+ * @see BinaryTimeView
+ * @see BinaryTimeWriter
+ */
+class BinaryTimeFormat
+{
+public:
+    /** Kind of elements stored. */
+    enum Kind : uint16_t {
+        /** Arrays of {@link DateComponents}. */
+        DATES      = 1,
+        /** Arrays of {@link DateTimeComponents}. */
+        DATE_TIMES = 2
+    };
+
+    /** Identifier of the time scale the stored components refer to. */
+    enum Scale : uint16_t {
+        UNSPECIFIED = 0,
+        UTC         = 1,
+        TAI         = 2,
+        TT          = 3,
+        GPS         = 4,
+        GST         = 5,
+        BDT         = 6,
+        GLONASS     = 7,
+        QZSS        = 8,
+        IRNSS       = 9,
+        TCB         = 10,
+        TCG         = 11,
+        TDB         = 12,
+        UT1         = 13
+    };
+
+    /** Magic number at the start of the header ("ORETIME" followed by a null byte). */
+    static const char MAGIC[8];
+
+    /** Current format version. */
+    static const uint16_t VERSION = 1;
+
+    /** Alignment of columns in bytes. */
+    static const size_t ALIGNMENT = 8;
+
+    /** Round a byte count up to the column alignment.
+     * @param bytes byte count
+     * @return aligned byte count
+     */
+    static size_t align(size_t bytes)
+    {
+        return (bytes + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+    }
+
+    /** Check if the host stores integers in little-endian order.
+     * <p>Zero-copy reading relies on this.</p>
+     * @return true if the host is little-endian
+     */
+    static bool isHostLittleEndian()
+    {
+        const uint16_t probe = 1;
+        return *reinterpret_cast<const unsigned char*>(&probe) == 1;
+    }
+};
+
+/** Fixed size header of the binary time format.
+ * <p>Column offsets are counted in bytes from the start of the header, an
+ * offset of zero meaning the column is absent.</p>
+ */
+struct BinaryTimeHeader
+{
+    /** Magic number, {@link BinaryTimeFormat#MAGIC}. */
+    char     magic[8];
+
+    /** Format version. */
+    uint16_t version;
+
+    /** Kind of elements, a {@link BinaryTimeFormat::Kind}. */
+    uint16_t kind;
+
+    /** Time scale, a {@link BinaryTimeFormat::Scale}. */
+    uint16_t scale;
+
+    /** Size of this header in bytes. */
+    uint16_t headerSize;
+
+    /** Epoch of the day column, as a day number with respect to J2000 epoch. */
+    int32_t  epochJ2000Day;
+
+    /** Reserved for future use, always 0. */
+    uint32_t reserved;
+
+    /** Number of elements. */
+    uint64_t count;
+
+    /** Offset of the day column. */
+    uint64_t dayOffset;
+
+    /** Offset of the minute in day column. */
+    uint64_t minuteOffset;
+
+    /** Offset of the offset from UTC column. */
+    uint64_t utcOffsetOffset;
+
+    /** Offset of the nanoseconds in minute column. */
+    uint64_t nanosOffset;
+};
+
+static_assert(sizeof(BinaryTimeHeader) == 64, "binary time header must be packed on 64 bytes");
+
+#endif
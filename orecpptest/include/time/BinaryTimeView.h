@@ -0,0 +1,117 @@
+#ifndef _BINARY_TIME_VIEW_H_
+#define _BINARY_TIME_VIEW_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "time/BinaryTimeFormat.h"
+#include "time/DateComponents.h"
+#include "time/DateTimeComponents.h"
+
+/** Zero-copy reader for the {@link BinaryTimeFormat binary time format}.
+ * <p>The view does not own the bytes it reads, they typically come from a
+ * {@link MappedFile}. Construction only validates the header and the column
+ * bounds, the columns are then accessed in place.</p>
+ * @see BinaryTimeWriter
+ */
+class BinaryTimeView
+{
+public:
+    /** Build an invalid view. */
+    BinaryTimeView();
+
+    /** Build a view over a memory block.
+     * <p>The block must start on an 8 bytes boundary (memory mappings and
+     * heap allocations always do).</p>
+     * @param data first byte of the block
+     * @param size number of bytes in the block
+     * @see #isValid()
+     */
+    BinaryTimeView(const void* data, size_t size);
+
+    /** Check if the block holds a supported, consistent layout.
+     * <p>Blocks are also rejected on big-endian hosts, where
+     * the columns cannot be read in place.</p>
+     * @return true if the view can be used
+     */
+    bool isValid() const;
+
+    /** Get the kind of elements stored.
+     * @return kind of elements stored
+     */
+    BinaryTimeFormat::Kind getKind() const;
+
+    /** Get the time scale the components refer to.
+     * @return time scale identifier
+     */
+    BinaryTimeFormat::Scale getScale() const;
+
+    /** Get the epoch of the day column.
+     * @return epoch of the day column
+     */
+    DateComponents getEpoch() const;
+
+    /** Get the number of elements.
+     * @return number of elements (0 for invalid views)
+     */
+    size_t size() const;
+
+    /** Get the day column.
+     * @return day offsets with respect to {@link #getEpoch()}
+     */
+    const int32_t* getDays() const;
+
+    /** Get the minute in day column.
+     * @return minutes in day, or null for dates
+     */
+    const int16_t* getMinutesInDay() const;
+
+    /** Get the offset from UTC column.
+     * @return offsets from UTC in minutes, or null for dates
+     */
+    const int16_t* getMinutesFromUTC() const;
+
+    /** Get the nanoseconds in minute column.
+     * @return nanoseconds in minute, or null for dates
+     */
+    const int64_t* getNanosInMinute() const;
+
+    /** Get the day number with respect to J2000 epoch of one element.
+     * @param i index of the element
+     * @return day number with respect to J2000 epoch
+     */
+    int getJ2000Day(size_t i) const;
+
+    /** Get the date of one element.
+     * @param i index of the element
+     * @return date of the element
+     */
+    DateComponents getDate(size_t i) const;
+
+    /** Get the date/time of one element.
+     * <p>Time is set to 00:00:00 for views holding dates.</p>
+     * @param i index of the element
+     * @return date/time of the element
+     */
+    DateTimeComponents getDateTime(size_t i) const;
+
+private:
+    /** Header at the start of the block. */
+    const BinaryTimeHeader* header;
+
+    /** Day column. */
+    const int32_t* days;
+
+    /** Minute in day column. */
+    const int16_t* minutes;
+
+    /** Offset from UTC column. */
+    const int16_t* utcOffsets;
+
+    /** Nanoseconds in minute column. */
+    const int64_t* nanos;
+
+    /** Number of elements. */
+    size_t count;
+};
+
+#endif
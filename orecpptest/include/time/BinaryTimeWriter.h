@@ -0,0 +1,109 @@
+#ifndef _BINARY_TIME_WRITER_H_
+#define _BINARY_TIME_WRITER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include "time/BinaryTimeFormat.h"
+#include "time/DateComponents.h"
+#include "time/DateTimeComponents.h"
+
+/** Writer for the {@link BinaryTimeFormat binary time format}.
+ * <p>The writer streams to a file descriptor (a file, a pipe or a socket)
+ * using a fixed size staging buffer, so arrays of any size are written
+ * without additional allocation. The descriptor is neither opened nor
+ * closed by the writer.</p>
+ * @see BinaryTimeView
+ */
+class BinaryTimeWriter
+{
+public:
+    /** Build a writer.
+     * @param fd file descriptor to write to
+     * @param scale time scale the written components refer to
+     */
+    explicit BinaryTimeWriter(int fd, BinaryTimeFormat::Scale scale = BinaryTimeFormat::UNSPECIFIED);
+
+    /** Set the epoch of the day column.
+     * <p>The default epoch is {@link DateComponents#J2000_EPOCH}.</p>
+     * @param epoch epoch of the day column
+     */
+    void setEpoch(const DateComponents& epoch);
+
+    /** Write an array of dates as one complete block.
+     * @param dates dates to write
+     * @param count number of dates
+     * @return true if all bytes were written
+     */
+    bool writeDates(const DateComponents* dates, size_t count);
+
+    /** Write an array of date/times as one complete block.
+     * <p>Seconds are rounded to the nearest nanosecond, without
+     * ever rounding up to the next whole second.</p>
+     * @param dateTimes date/times to write
+     * @param count number of date/times
+     * @return true if all bytes were written
+     */
+    bool writeDateTimes(const DateTimeComponents* dateTimes, size_t count);
+
+    /** Get the number of bytes written so far.
+     * @return number of bytes written so far
+     */
+    uint64_t getBytesWritten() const;
+
+    /** Get the size of an encoded block.
+     * @param kind kind of elements
+     * @param count number of elements
+     * @return size of the block in bytes
+     */
+    static size_t getEncodedSize(BinaryTimeFormat::Kind kind, size_t count);
+
+    /** Compute the nanoseconds in minute encoding of a time.
+     * @param time time to encode
+     * @return nanoseconds in minute
+     */
+    static int64_t getNanosInMinute(const TimeComponents& time);
+
+private:
+    /** Write a block header.
+     * @param kind kind of elements
+     * @param count number of elements
+     * @return true if all bytes were written
+     */
+    bool writeHeader(BinaryTimeFormat::Kind kind, size_t count);
+
+    /** Write one column, padded to the format alignment.
+     * @param count number of elements
+     * @param extract function returning element i of the column
+     * @return true if all bytes were written
+     */
+    template<typename T, typename Extract>
+    bool writeColumn(size_t count, Extract extract);
+
+    /** Write raw bytes.
+     * @param bytes bytes to write
+     * @param length number of bytes
+     * @return true if all bytes were written
+     */
+    bool writeBytes(const void* bytes, size_t length);
+
+    /** Size of the staging buffer in bytes. */
+    static const size_t BUFFER_SIZE = 1 << 16;
+
+    /** Destination descriptor. */
+    int fd;
+
+    /** Time scale identifier. */
+    BinaryTimeFormat::Scale scale;
+
+    /** Epoch of the day column, as a day number with respect to J2000 epoch. */
+    int epochJ2000Day;
+
+    /** Number of bytes written so far. */
+    uint64_t written;
+
+    /** Staging buffer. */
+    std::vector<char> buffer;
+};
+
+#endif
@@ -0,0 +1,129 @@
+#ifndef _CHRONO_CONVERSIONS_H_
+#define _CHRONO_CONVERSIONS_H_
+
+#include <stddef.h>
+#include <chrono>
+#include "time/DateComponents.h"
+#include "time/DateTimeComponents.h"
+#include "time/TimeComponents.h"
+
+#if defined(__cpp_lib_chrono) && __cpp_lib_chrono >= 201907L
+/** Defined when the standard library provides <code>std::chrono::utc_clock</code>. */
+#define ORECPP_HAS_UTC_CLOCK 1
+#endif
+
+/** Direct conversions between <code>std::chrono</code> calendar types and
+ * the library date and time components.
+ * <p>Conversions are done arithmetically through day counts, without any
+ * formatting or parsing. <code>std::chrono::sys_days</code> counts days from
+ * {@link DateComponents#JAVA_EPOCH} and <code>std::chrono::year_month_day</code>
+ * uses the proleptic gregorian calendar, whereas {@link DateComponents} uses
+ * the julian calendar before 1582-10-15: the same day therefore has different
+ * year/month/day fields in both representations before this date.</p>
+ * <p><code>std::chrono::sys_time</code> ignores leap seconds: a time of day
+ * in a leap second (23:59:60.x) is converted to 00:00:00.x of the next day.
+ * When the standard library provides it, <code>std::chrono::utc_clock</code>
+ * time points are converted with leap seconds preserved.</p>
+ * <p>Conversions from components use their offset from UTC, conversions to
+ * components produce UTC components.</p>
+ */
+class ChronoConversions
+{
+public:
+    /** Nanoseconds time point of the system clock. */
+    typedef std::chrono::sys_time<std::chrono::nanoseconds> SysNanos;
+
+    /** Convert a date to a count of days since 1970-01-01.
+     * @param date date to convert
+     * @return days since 1970-01-01
+     */
+    static std::chrono::sys_days toSysDays(const DateComponents& date);
+
+    /** Convert a count of days since 1970-01-01 to a date.
+     * @param days days since 1970-01-01 (must fit in the {@link DateComponents} range)
+     * @return date
+     */
+    static DateComponents toDateComponents(const std::chrono::sys_days& days);
+
+    /** Convert a date to a proleptic gregorian calendar date.
+     * @param date date to convert
+     * @return proleptic gregorian calendar date for the same day
+     */
+    static std::chrono::year_month_day toYearMonthDay(const DateComponents& date);
+
+    /** Convert a proleptic gregorian calendar date to a date.
+     * @param date valid proleptic gregorian calendar date
+     * @return date for the same day
+     */
+    static DateComponents toDateComponents(const std::chrono::year_month_day& date);
+
+    /** Convert a time of day to a duration since midnight.
+     * <p>The time is the local time of day, its offset from UTC is ignored.</p>
+     * @param time time to convert
+     * @return duration since midnight, rounded to the nearest nanosecond
+     */
+    static std::chrono::hh_mm_ss<std::chrono::nanoseconds> toHhMmSs(const TimeComponents& time);
+
+    /** Convert a duration since midnight to a time of day.
+     * @param time non-negative duration since midnight
+     * @return time of day, in UTC
+     */
+    static TimeComponents toTimeComponents(const std::chrono::hh_mm_ss<std::chrono::nanoseconds>& time);
+
+    /** Convert date/time components to a system clock time point.
+     * <p>Time points outside of the nanoseconds range (years 1677 to 2262) saturate.</p>
+     * @param dateTime date/time to convert
+     * @return time point, rounded to the nearest nanosecond
+     */
+    static SysNanos toSysTime(const DateTimeComponents& dateTime);
+
+    /** Convert a system clock time point to date/time components.
+     * @param time time point to convert
+     * @return date/time components, in UTC
+     */
+    static DateTimeComponents toDateTimeComponents(const SysNanos& time);
+
+    /** Convert an array of date/time components to system clock time points.
+     * <p>Consecutive elements sharing the same date reuse the day count of
+     * the previous element.</p>
+     * @param dateTimes date/times to convert
+     * @param count number of elements
+     * @param times array where to store the time points
+     */
+    static void toSysTimes(const DateTimeComponents* dateTimes, size_t count, SysNanos* times);
+
+    /** Convert an array of system clock time points to date/time components.
+     * <p>Consecutive elements in the same day reuse the calendar decomposition
+     * of the previous element, so only the time of day is computed for them.</p>
+     * @param times time points to convert
+     * @param count number of elements
+     * @param dateTimes array where to store the date/time components
+     */
+    static void toDateTimeComponents(const SysNanos* times, size_t count, DateTimeComponents* dateTimes);
+
+#ifdef ORECPP_HAS_UTC_CLOCK
+    /** Convert date/time components to a UTC clock time point.
+     * @param dateTime date/time to convert, possibly in a leap second
+     * @return time point, rounded to the nearest nanosecond
+     */
+    static std::chrono::utc_time<std::chrono::nanoseconds> toUtcTime(const DateTimeComponents& dateTime);
+
+    /** Convert a UTC clock time point to date/time components.
+     * @param time time point to convert
+     * @return date/time components, in UTC, with seconds in [60, 61) during leap seconds
+     */
+    static DateTimeComponents toDateTimeComponents(const std::chrono::utc_time<std::chrono::nanoseconds>& time);
+#endif
+
+    /** Offset of {@link DateComponents#JAVA_EPOCH} with respect to {@link DateComponents#J2000_EPOCH}. */
+    static const int JAVA_EPOCH_J2000_DAY = -10957;
+
+private:
+    /** Build UTC components from nanoseconds since 1970-01-01.
+     * @param nanos nanoseconds since 1970-01-01
+     * @return date/time components
+     */
+    static DateTimeComponents fromNanos(long long nanos);
+};
+
+#endif
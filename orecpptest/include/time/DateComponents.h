@@ -1,6 +1,7 @@
 #ifndef _DATE_COMPONENTS_H_
 #define _DATE_COMPONENTS_H_
 
+#include <stddef.h>
 #include <stdint.h>
 
 /** Class representing a date broken up as year, month and day components.
@@ -37,10 +38,14 @@ public:
     DateComponents(int year, int month, int day);
 
      /** Build a date from a year and day number.
+      * <p>The ordinal date is converted directly using the months sequence
+      * of the year. Day numbers out of range with respect to year spill over
+      * the neighbouring years.</p>
       * @param year year number (may be 0 or negative for BC years)
       * @param dayNumber day number in the year from 1 to 366
       * @exception IllegalArgumentException if dayNumber is out of range
       * with respect to year
+      * @see #createFromOrdinalDates(const int*, const int*, size_t, DateComponents*)
       */
     DateComponents(int year, int dayNumber);
 
@@ -107,8 +112,9 @@ public:
 
     /** Get the day number in year.
      * <p>Day number in year is between 1 (January 1st) and either 365 or
-     * 366 inclusive depending on year.</p>
+     * 366 inclusive depending on year (355 in 1582).</p>
      * @return day number in year
+     * @see #getDaysOfYear(const DateComponents*, size_t, int*)
      */
     int getDayOfYear() const;
 
@@ -161,6 +167,25 @@ public:
     */
     static DateComponents createFromWeekComponents(int wYear, int week, int dayOfWeek);
 
+    /** Build dates from ordinal dates.
+     * <p>This is the batch version of {@link #DateComponents(int, int)},
+     * consecutive dates in the same year share the year lookup.</p>
+     * @param years year numbers
+     * @param dayNumbers day numbers in the years
+     * @param count number of dates
+     * @param dates placeholder for the dates
+     */
+    static void createFromOrdinalDates(const int* years, const int* dayNumbers, size_t count,
+                                       DateComponents* dates);
+
+    /** Get the day numbers in year of dates.
+     * <p>This is the batch version of {@link #getDayOfYear()}.</p>
+     * @param dates dates
+     * @param count number of dates
+     * @param dayNumbers placeholder for the day numbers in year
+     */
+    static void getDaysOfYear(const DateComponents* dates, size_t count, int* dayNumbers);
+
     /** Reference epoch for julian dates: -4712-01-01.
      * <p>Both <code>java.util.Date</code> and {@link DateComponents} classes
      * follow the astronomical conventions and consider a year 0 between
@@ -231,6 +256,12 @@ private:
      */
     static int getFirstWeekMonday(const int year);
 
+    /** Get the number of days in a year.
+     * @param year year number
+     * @return number of days in the year (355 in 1582)
+     */
+    static int getYearLength(int year);
+
     /** Factory for proleptic julian calendar (up to 0000-12-31). */
     static const YearFactory* PROLEPTIC_JULIAN_FACTORY;
 
@@ -0,0 +1,116 @@
+#ifndef _DATE_TIME_KEYS_H_
+#define _DATE_TIME_KEYS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "time/DateTimeComponents.h"
+
+/** Order preserving 96 bits key for a {@link DateTimeComponents}.
+ * <p>The {@link #high} part holds the biased UTC minute index in its upper
+ * 43 bits and the whole second in minute (0 to 60) in its lower 6 bits, the
+ * {@link #low} part holds the nanosecond within the second. Keys compare
+ * lexicographically, they cover the whole range of {@link DateComponents}
+ * at nanosecond resolution and leap seconds sort between second 59 and the
+ * next minute.</p>
+ * @see DateTimeKeys
+ */
+struct DateTimeKey96
+{
+    /** Minute and second part. */
+    uint64_t high;
+
+    /** Nanosecond part. */
+    uint32_t low;
+
+    /** Compare keys.
+     * @param other other key
+     * @return true if this key is strictly before the other one
+     */
+    bool operator<(const DateTimeKey96& other) const
+    {
+        return (high < other.high) || ((high == other.high) && (low < other.low));
+    }
+
+    /** Check keys equality.
+     * @param other other key
+     * @return true if keys are equal
+     */
+    bool operator==(const DateTimeKey96& other) const
+    {
+        return (high == other.high) && (low == other.low);
+    }
+};
+
+/** Extraction of integer sort keys from {@link DateTimeComponents}.
+ * <p>Keys are computed once per element (a single {@link
+ * DateComponents#getJ2000Day() J2000 day} computation) and then compared
+ * as plain integers, which is much cheaper than {@link
+ * DateTimeComponents#operator<}. Keys order instants along the UTC time
+ * line, taking {@link TimeComponents#getMinutesFromUTC() offsets from UTC}
+ * into account; this is the same order as {@link DateTimeComponents#operator<}
+ * when all elements share the same offset.</p>
+ * <p>The 64 bits keys hold the biased UTC minute index in 38 bits, the whole
+ * second in minute in 6 bits and the microsecond in 20 bits. They cover about
+ * 261000 years on each side of J2000 and saturate outside of this range;
+ * {@link #isInKey64Range(const DateTimeComponents&)} can be used to check it.
+ * Instants closer than one microsecond may share the same 64 bits key.</p>
+ * @see DateTimeKey96
+ * @see DateTimeSorter
+ */
+class DateTimeKeys
+{
+public:
+    /** Compute the 64 bits key of a date/time.
+     * @param dateTime date/time
+     * @return order preserving key at microsecond resolution
+     */
+    static uint64_t toKey64(const DateTimeComponents& dateTime);
+
+    /** Compute the 96 bits key of a date/time.
+     * @param dateTime date/time
+     * @return order preserving key at nanosecond resolution
+     */
+    static DateTimeKey96 toKey96(const DateTimeComponents& dateTime);
+
+    /** Compute the 64 bits keys of an array of date/times.
+     * @param dateTimes date/times
+     * @param count number of date/times
+     * @param keys output keys (may hold count elements)
+     * @return true if no key was saturated
+     */
+    static bool toKeys64(const DateTimeComponents* dateTimes, size_t count, uint64_t* keys);
+
+    /** Compute the 96 bits keys of an array of date/times.
+     * @param dateTimes date/times
+     * @param count number of date/times
+     * @param keys output keys (may hold count elements)
+     */
+    static void toKeys96(const DateTimeComponents* dateTimes, size_t count, DateTimeKey96* keys);
+
+    /** Check if a date/time can be represented by a 64 bits key without saturation.
+     * @param dateTime date/time
+     * @return true if the 64 bits key of the date/time is not saturated
+     */
+    static bool isInKey64Range(const DateTimeComponents& dateTime);
+
+    /** Smallest 64 bits key, used for instants before the covered range. */
+    static const uint64_t KEY64_MIN = 0;
+
+    /** Largest 64 bits key, used for instants after the covered range. */
+    static const uint64_t KEY64_MAX = UINT64_MAX;
+
+private:
+    /** Get the UTC minute index with respect to J2000 epoch.
+     * @param dateTime date/time
+     * @return minute index
+     */
+    static int64_t getUTCMinute(const DateTimeComponents& dateTime);
+
+    /** Bias applied to minute index in 64 bits keys. */
+    static const int64_t KEY64_MINUTE_BIAS = INT64_C(1) << 37;
+
+    /** Bias applied to minute index in 96 bits keys. */
+    static const int64_t KEY96_MINUTE_BIAS = INT64_C(1) << 42;
+};
+
+#endif
@@ -0,0 +1,82 @@
+#ifndef _DATE_TIME_SORTER_H_
+#define _DATE_TIME_SORTER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include "time/DateTimeComponents.h"
+#include "time/DateTimeKeys.h"
+
+/** Sorted run of date/times, typically the log of one station. */
+struct DateTimeRun
+{
+    /** First element of the run. */
+    const DateTimeComponents* data;
+
+    /** Number of elements in the run. */
+    size_t size;
+};
+
+/** Sorting and merging utilities for large arrays of {@link DateTimeComponents}.
+ * <p>All methods order elements using {@link DateTimeKeys integer keys}, i.e.
+ * along the UTC time line, and are stable: elements with equal keys keep their
+ * relative order (and for merges, elements from lower index runs come first).</p>
+ * @see DateTimeKeys
+ */
+class DateTimeSorter
+{
+public:
+    /** Sort an array of date/times in place.
+     * <p>Elements are ordered by their 96 bits keys, i.e. at nanosecond
+     * resolution, which is the order checked by {@link #isSorted}.</p>
+     * <p>This is a least significant digit radix sort on 64 bits keys,
+     * falling back to 96 bits keys if some element is out of the 64 bits
+     * key range. As 64 bits keys only have microsecond resolution, runs of
+     * elements sharing the same 64 bits key are then sorted by their 96 bits
+     * keys. Digits that are identical for all elements are skipped, so arrays
+     * spanning a few years only need about three passes.</p>
+     * @param dateTimes date/times to sort
+     * @param count number of date/times
+     */
+    static void sort(DateTimeComponents* dateTimes, size_t count);
+
+    /** Stable radix sort of 64 bits keys carrying a payload.
+     * @param keys keys to sort
+     * @param payload payload to reorder along with keys (may be null)
+     * @param count number of keys
+     */
+    static void sortKeys(uint64_t* keys, uint32_t* payload, size_t count);
+
+    /** Stable radix sort of 96 bits keys carrying a payload.
+     * @param keys keys to sort
+     * @param payload payload to reorder along with keys (may be null)
+     * @param count number of keys
+     */
+    static void sortKeys(DateTimeKey96* keys, uint32_t* payload, size_t count);
+
+    /** Merge already sorted runs.
+     * <p>This is a k-way merge using a tournament (loser) tree, each element
+     * is visited once and costs about log2(k) integer key comparisons.</p>
+     * @param runs sorted runs to merge
+     * @param nbRuns number of runs
+     * @param output merged elements (must have room for the sum of run sizes)
+     * @param origin if not null, index of the run each merged element comes from
+     */
+    static void merge(const DateTimeRun* runs, size_t nbRuns,
+                      DateTimeComponents* output, uint32_t* origin = nullptr);
+
+    /** Merge already sorted runs into a vector.
+     * @param runs sorted runs to merge
+     * @return merged elements
+     */
+    static std::vector<DateTimeComponents> merge(const std::vector<DateTimeRun>& runs);
+
+    /** Check if an array is sorted with respect to the integer keys order.
+     * @param dateTimes date/times to check
+     * @param count number of date/times
+     * @return true if the array is sorted
+     */
+    static bool isSorted(const DateTimeComponents* dateTimes, size_t count);
+};
+
+#endif
@@ -0,0 +1,183 @@
+#ifndef _INTERVAL_SET_H_
+#define _INTERVAL_SET_H_
+
+#include <stddef.h>
+#include <vector>
+#include "time/DateTimeComponents.h"
+#include "time/LinearTime.h"
+
+/** Half-open time interval [start, end). */
+struct TimeInterval
+{
+    /** Build an empty interval at J2000 epoch. */
+    TimeInterval() = default;
+
+    /** Build an interval from its bounds.
+     * @param start start of the interval (included)
+     * @param end end of the interval (excluded)
+     */
+    TimeInterval(const LinearTime& start, const LinearTime& end) : start(start), end(end) {}
+
+    /** Build an interval from date/time bounds.
+     * @param start start of the interval (included)
+     * @param end end of the interval (excluded)
+     */
+    TimeInterval(const DateTimeComponents& start, const DateTimeComponents& end)
+        : start(start), end(end) {}
+
+    /** Get the interval duration.
+     * @return interval duration in seconds
+     */
+    double getDuration() const { return end.durationFrom(start); }
+
+    /** Start of the interval (included). */
+    LinearTime start;
+
+    /** End of the interval (excluded). */
+    LinearTime end;
+};
+
+/** Set of disjoint time intervals.
+ * <p>The set is stored as a single sorted flat array of strictly increasing
+ * boundaries: interval i spans [boundary 2i, boundary 2i+1). Overlapping or
+ * touching intervals are coalesced and empty ones are dropped, so the
+ * representation of a given set is unique.</p>
+ * <p>Set operations are linear merges of boundary arrays, point containment
+ * is a binary search. The static operations writing into an existing result
+ * reuse its buffer, so scheduling loops run without allocation once buffers
+ * have grown to their working size.</p>
+ * @see TimeInterval
+ */
+class IntervalSet
+{
+public:
+    /** Build an empty set. */
+    IntervalSet() = default;
+
+    /** Build a set from intervals in any order.
+     * @param intervals intervals (possibly overlapping, empty or reversed
+     * intervals are ignored)
+     */
+    explicit IntervalSet(std::vector<TimeInterval> intervals);
+
+    /** Replace the content of the set with intervals in any order.
+     * <p>The intervals array is sorted in place, and the set buffer is reused.</p>
+     * @param intervals intervals (possibly overlapping, empty or reversed
+     * intervals are ignored)
+     * @param count number of intervals
+     */
+    void assign(TimeInterval* intervals, size_t count);
+
+    /** Add one interval to the set.
+     * <p>This costs a linear move of the boundaries after the interval,
+     * use {@link #assign(TimeInterval*, size_t)} for bulk construction.</p>
+     * @param interval interval to add
+     */
+    void add(const TimeInterval& interval);
+
+    /** Remove all intervals, keeping the buffer. */
+    void clear();
+
+    /** Reserve room for intervals.
+     * @param nbIntervals number of intervals to reserve room for
+     */
+    void reserve(size_t nbIntervals);
+
+    /** Check if the set is empty.
+     * @return true if the set contains no interval
+     */
+    bool isEmpty() const;
+
+    /** Get the number of disjoint intervals.
+     * @return number of disjoint intervals
+     */
+    size_t size() const;
+
+    /** Get one interval.
+     * @param i index of the interval, intervals are sorted chronologically
+     * @return interval
+     */
+    TimeInterval get(size_t i) const;
+
+    /** Get the sorted boundaries.
+     * @return pointer to the 2 * {@link #size()} boundaries
+     */
+    const LinearTime* getBoundaries() const;
+
+    /** Get the sum of the intervals durations.
+     * @return total duration in seconds
+     */
+    double getTotalDuration() const;
+
+    /** Check if a time belongs to the set.
+     * @param t time to check
+     * @return true if t belongs to one interval
+     */
+    bool contains(const LinearTime& t) const;
+
+    /** Find the interval containing a time.
+     * @param t time to locate
+     * @return index of the interval containing t, or -1
+     */
+    long find(const LinearTime& t) const;
+
+    /** Compute the union with another set.
+     * @param other other set
+     * @return union of the sets
+     */
+    IntervalSet unionWith(const IntervalSet& other) const;
+
+    /** Compute the intersection with another set.
+     * @param other other set
+     * @return intersection of the sets
+     */
+    IntervalSet intersectionWith(const IntervalSet& other) const;
+
+    /** Compute the difference with another set.
+     * @param other set to remove from this one
+     * @return difference of the sets
+     */
+    IntervalSet differenceWith(const IntervalSet& other) const;
+
+    /** Compute the union of two sets.
+     * @param a first set
+     * @param b second set
+     * @param result set where to store the union (must be distinct from a and b)
+     */
+    static void unionOf(const IntervalSet& a, const IntervalSet& b, IntervalSet& result);
+
+    /** Compute the intersection of two sets.
+     * @param a first set
+     * @param b second set
+     * @param result set where to store the intersection (must be distinct from a and b)
+     */
+    static void intersectionOf(const IntervalSet& a, const IntervalSet& b, IntervalSet& result);
+
+    /** Compute the difference of two sets.
+     * @param a set to remove from
+     * @param b set to remove
+     * @param result set where to store the difference (must be distinct from a and b)
+     */
+    static void differenceOf(const IntervalSet& a, const IntervalSet& b, IntervalSet& result);
+
+    /** {@inheritDoc} */
+    bool operator==(const IntervalSet& other) const;
+
+private:
+    /** Boolean operation applied to membership flags. */
+    enum Operation { UNION, INTERSECTION, DIFFERENCE };
+
+    /** Merge two boundary arrays.
+     * @param a first set
+     * @param b second set
+     * @param operation operation to apply
+     * @param result set where to store the result
+     */
+    static void combine(const IntervalSet& a, const IntervalSet& b,
+                        Operation operation, IntervalSet& result);
+
+    /** Strictly increasing boundaries. */
+    std::vector<LinearTime> boundaries;
+};
+
+#endif
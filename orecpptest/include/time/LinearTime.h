@@ -0,0 +1,116 @@
+#ifndef _LINEAR_TIME_H_
+#define _LINEAR_TIME_H_
+
+#include <stdint.h>
+#include "time/DateComponents.h"
+#include "time/DateTimeComponents.h"
+#include "time/TimeComponents.h"
+
+/** Point on a linear time line, counted in nanoseconds from J2000 epoch.
+ * <p>This is the flat representation of {@link DateTimeComponents} used by
+ * containers and bulk algorithms: a single 64 bits integer, cheap to compare,
+ * subtract and store contiguously. The count is made with respect to
+ * 2000-01-01T00:00:00 in the time scale the components refer to, with
+ * {@link TimeComponents#getMinutesFromUTC() offsets from UTC} applied, so
+ * two components denoting the same instant in different offsets map to the
+ * same linear time.</p>
+ * <p>Like {@link DateTimeComponents#offsetFrom(const DateTimeComponents&)},
+ * the conversion counts 86400 seconds per day: in the UTC time scale a leap
+ * second (second 60) maps to the same linear time as the first second of the
+ * next day. Scales with leap seconds should convert through a uniform scale
+ * when this matters.</p>
+ * <p>The representable range is about 292 years around J2000 (years 1708 to
+ * 2292); components outside of this range saturate to {@link #PAST_INFINITY}
+ * or {@link #FUTURE_INFINITY}.</p>
+ * <p>Instances of this class are guaranteed to be immutable.</p>
+ * @see DateTimeComponents
+ */
+class LinearTime
+{
+public:
+    /** Build an instance at {@link #J2000_EPOCH}. */
+    LinearTime() : nanos(0) {}
+
+    /** Build an instance from a number of nanoseconds since J2000 epoch.
+     * @param nanosSinceJ2000 nanoseconds since J2000 epoch
+     */
+    explicit LinearTime(int64_t nanosSinceJ2000) : nanos(nanosSinceJ2000) {}
+
+    /** Build an instance from date/time components.
+     * @param dateTime date/time components
+     */
+    LinearTime(const DateTimeComponents& dateTime);
+
+    /** Build an instance from date and time components.
+     * @param date date components
+     * @param time time components
+     */
+    LinearTime(const DateComponents& date, const TimeComponents& time);
+
+    /** Build an instance from a seconds offset with respect to another one.
+     * @param reference reference linear time
+     * @param offset offset from the reference in seconds
+     * @see #durationFrom(const LinearTime&)
+     */
+    LinearTime(const LinearTime& reference, double offset);
+
+    /** Get the number of nanoseconds since J2000 epoch.
+     * @return number of nanoseconds since J2000 epoch
+     */
+    int64_t getNanos() const { return nanos; }
+
+    /** Get a time shifted by a number of seconds.
+     * @param dt shift in seconds
+     * @return shifted time
+     */
+    LinearTime shiftedBy(double dt) const;
+
+    /** Compute the seconds offset between two instances.
+     * @param other instance to subtract from this one
+     * @return offset in seconds (positive if this instance is posterior to the argument)
+     */
+    double durationFrom(const LinearTime& other) const;
+
+    /** Break the instance up into date/time components.
+     * @param minutesFromUTC offset from UTC of the components
+     * @return date/time components
+     */
+    DateTimeComponents getComponents(int minutesFromUTC = 0) const;
+
+    /** Get the day number with respect to J2000 epoch.
+     * @param minutesFromUTC offset from UTC of the day
+     * @return day number with respect to J2000 epoch
+     */
+    int getJ2000Day(int minutesFromUTC = 0) const;
+
+    bool operator<(const LinearTime& other) const  { return nanos <  other.nanos; }
+    bool operator<=(const LinearTime& other) const { return nanos <= other.nanos; }
+    bool operator>(const LinearTime& other) const  { return nanos >  other.nanos; }
+    bool operator>=(const LinearTime& other) const { return nanos >= other.nanos; }
+    bool operator==(const LinearTime& other) const { return nanos == other.nanos; }
+    bool operator!=(const LinearTime& other) const { return nanos != other.nanos; }
+
+    /** J2000.0 Reference epoch: 2000-01-01T00:00:00. */
+    static const LinearTime J2000_EPOCH;
+
+    /** Earliest representable time. */
+    static const LinearTime PAST_INFINITY;
+
+    /** Latest representable time. */
+    static const LinearTime FUTURE_INFINITY;
+
+    /** Number of nanoseconds in one second. */
+    static const int64_t NANOS_PER_SECOND = 1000000000LL;
+
+    /** Number of nanoseconds in one minute. */
+    static const int64_t NANOS_PER_MINUTE = 60LL * NANOS_PER_SECOND;
+
+    /** Number of nanoseconds in one day. */
+    static const int64_t NANOS_PER_DAY = 86400LL * NANOS_PER_SECOND;
+
+private:
+    /** Nanoseconds since J2000 epoch. */
+    int64_t nanos;
+};
+
+#endif
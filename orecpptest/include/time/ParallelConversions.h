@@ -0,0 +1,133 @@
+#ifndef _PARALLEL_CONVERSIONS_H_
+#define _PARALLEL_CONVERSIONS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "time/BinaryTimeView.h"
+#include "time/ChronoConversions.h"
+#include "time/DateComponents.h"
+#include "time/DateTimeComponents.h"
+#include "time/DateTimeKeys.h"
+#include "time/LinearTime.h"
+#include "time/UTCScale.h"
+#include "utils/ThreadPool.h"
+
+/** Parallel front-ends of the bulk time conversions.
+ * <p>Each function splits its arrays into chunks sized for the first level
+ * data cache (see {@link ThreadPool#getChunkSize(size_t)}) and converts the
+ * chunks on the threads of a {@link ThreadPool}, the number of threads being
+ * chosen when the pool is built. Element i of the output is always computed
+ * from element i of the input, so the output is the same as the one of the
+ * sequential conversion, whatever the number of threads.</p>
+ * <p>Batch conversions that reuse the calendar decomposition of consecutive
+ * elements ({@link ChronoConversions}, {@link UTCScale}) do so within each
+ * chunk.</p>
+ */
+class ParallelConversions
+{
+public:
+    /** Convert day offsets to dates.
+     * @param pool thread pool
+     * @param offsets offsets with respect to J2000 epoch
+     * @param count number of elements
+     * @param dates array where to store the dates
+     */
+    static void toDateComponents(ThreadPool& pool, const int* offsets, size_t count, DateComponents* dates);
+
+    /** Convert dates to day offsets.
+     * @param pool thread pool
+     * @param dates dates to convert
+     * @param count number of elements
+     * @param offsets array where to store the offsets with respect to J2000 epoch
+     */
+    static void toJ2000Days(ThreadPool& pool, const DateComponents* dates, size_t count, int* offsets);
+
+    /** Compute offsets of date/times with respect to a reference.
+     * @param pool thread pool
+     * @param dateTimes date/times
+     * @param count number of elements
+     * @param reference reference date/time
+     * @param offsets array where to store the offsets in seconds,
+     * see {@link DateTimeComponents#offsetFrom(const DateTimeComponents&)}
+     */
+    static void offsetFrom(ThreadPool& pool, const DateTimeComponents* dateTimes, size_t count,
+                           const DateTimeComponents& reference, double* offsets);
+
+    /** Convert date/times to linear times.
+     * @param pool thread pool
+     * @param dateTimes date/times to convert
+     * @param count number of elements
+     * @param times array where to store the linear times
+     */
+    static void toLinearTimes(ThreadPool& pool, const DateTimeComponents* dateTimes, size_t count,
+                              LinearTime* times);
+
+    /** Convert linear times to UTC date/time components.
+     * @param pool thread pool
+     * @param times linear times to convert
+     * @param count number of elements
+     * @param dateTimes array where to store the date/time components
+     */
+    static void toDateTimeComponents(ThreadPool& pool, const LinearTime* times, size_t count,
+                                     DateTimeComponents* dateTimes);
+
+    /** Convert system clock time points to date/time components.
+     * @param pool thread pool
+     * @param times time points to convert
+     * @param count number of elements
+     * @param dateTimes array where to store the date/time components
+     * @see ChronoConversions#toDateTimeComponents(const ChronoConversions::SysNanos*, size_t, DateTimeComponents*)
+     */
+    static void toDateTimeComponents(ThreadPool& pool, const ChronoConversions::SysNanos* times, size_t count,
+                                     DateTimeComponents* dateTimes);
+
+    /** Convert date/time components to system clock time points.
+     * @param pool thread pool
+     * @param dateTimes date/times to convert
+     * @param count number of elements
+     * @param times array where to store the time points
+     * @see ChronoConversions#toSysTimes(const DateTimeComponents*, size_t, ChronoConversions::SysNanos*)
+     */
+    static void toSysTimes(ThreadPool& pool, const DateTimeComponents* dateTimes, size_t count,
+                           ChronoConversions::SysNanos* times);
+
+    /** Convert TAI linear times to UTC components, with leap seconds.
+     * @param pool thread pool
+     * @param utc UTC scale
+     * @param tai times in the TAI scale, preferably sorted in increasing order
+     * @param count number of elements
+     * @param dateTimes array where to store the date/time components
+     * @see UTCScale#getComponents(const LinearTime*, size_t, DateTimeComponents*)
+     */
+    static void getComponents(ThreadPool& pool, const UTCScale& utc, const LinearTime* tai, size_t count,
+                              DateTimeComponents* dateTimes);
+
+    /** Encode date/times as 64 bits sort keys.
+     * @param pool thread pool
+     * @param dateTimes date/times to encode
+     * @param count number of elements
+     * @param keys array where to store the keys
+     * @return true if all date/times are in the 64 bits keys range
+     * @see DateTimeKeys#toKeys64(const DateTimeComponents*, size_t, uint64_t*)
+     */
+    static bool toKeys64(ThreadPool& pool, const DateTimeComponents* dateTimes, size_t count, uint64_t* keys);
+
+    /** Encode date/times as 96 bits sort keys.
+     * @param pool thread pool
+     * @param dateTimes date/times to encode
+     * @param count number of elements
+     * @param keys array where to store the keys
+     * @see DateTimeKeys#toKeys96(const DateTimeComponents*, size_t, DateTimeKey96*)
+     */
+    static void toKeys96(ThreadPool& pool, const DateTimeComponents* dateTimes, size_t count, DateTimeKey96* keys);
+
+    /** Decode the date/times of a binary time file.
+     * @param pool thread pool
+     * @param view view on a valid file
+     * @param dateTimes array of {@link BinaryTimeView#size()} elements where to store the date/times
+     * @see BinaryTimeView#getDateTime(size_t)
+     */
+    static void getDateTimes(ThreadPool& pool, const BinaryTimeView& view, DateTimeComponents* dateTimes);
+};
+
+#endif
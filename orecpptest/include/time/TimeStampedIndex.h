@@ -0,0 +1,281 @@
+#ifndef _TIME_STAMPED_INDEX_H_
+#define _TIME_STAMPED_INDEX_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <algorithm>
+#include <atomic>
+#include <utility>
+#include <vector>
+#include "time/LinearTime.h"
+
+/** Index of time-stamped records answering "which record is valid at epoch t".
+ * <p>A record is valid from its time stamp until the time stamp of the next
+ * record, the last record remaining valid forever. Lookups pick the fastest
+ * strategy available for the data:</p>
+ * <ul>
+ *   <li>uniformly spaced records (EOP tables, ephemeris segments) are located
+ *       in O(1) by a single division,</li>
+ *   <li>irregular records (leap seconds, maneuvers) are located by a branch-free
+ *       binary search over a copy of the time stamps in Eytzinger (breadth-first)
+ *       layout, which keeps the first levels of the search in a few cache lines,</li>
+ *   <li>monotone query streams first check the record found by the previous query
+ *       of the same thread and its successor, which succeeds most of the time.</li>
+ * </ul>
+ * <p>Instances are immutable once built, and can be shared between threads.</p>
+ * @param T type of the records
+ * @see LinearTime
+ */
+template<typename T>
+class TimeStampedIndex
+{
+public:
+    /** Last hit hint for monotone query streams.
+     * <p>A cursor must be used by one thread at a time.</p>
+     */
+    struct Cursor
+    {
+        /** Index found by the last query. */
+        size_t last = 0;
+    };
+
+    /** Build an empty index. */
+    TimeStampedIndex()
+        : instance(nextInstance()), uniform(false), step(0)
+    {
+
+    }
+
+    /** Build an index from records in any order.
+     * <p>Records sharing the same time stamp keep their relative order,
+     * the last one of them being the one found by lookups.</p>
+     * @param records time-stamped records
+     */
+    explicit TimeStampedIndex(std::vector<std::pair<LinearTime, T>> records)
+        : TimeStampedIndex()
+    {
+        std::stable_sort(records.begin(), records.end(),
+                         [](const std::pair<LinearTime, T>& a, const std::pair<LinearTime, T>& b) {
+                             return a.first < b.first;
+                         });
+        times.reserve(records.size());
+        values.reserve(records.size());
+        for (auto& record : records) {
+            times.push_back(record.first);
+            values.push_back(std::move(record.second));
+        }
+        setUp();
+    }
+
+    /** Build an index from parallel arrays already sorted by time stamp.
+     * @param sortedTimes time stamps, in non-decreasing order
+     * @param sortedValues records, one per time stamp
+     */
+    TimeStampedIndex(std::vector<LinearTime> sortedTimes, std::vector<T> sortedValues)
+        : TimeStampedIndex()
+    {
+        times  = std::move(sortedTimes);
+        values = std::move(sortedValues);
+        setUp();
+    }
+
+    /** Get the number of records.
+     * @return number of records
+     */
+    size_t size() const
+    {
+        return times.size();
+    }
+
+    /** Check if the records are uniformly spaced.
+     * @return true if lookups are done in O(1)
+     */
+    bool isUniform() const
+    {
+        return uniform;
+    }
+
+    /** Get the time stamp of a record.
+     * @param i index of the record
+     * @return time stamp of the record
+     */
+    const LinearTime& getTime(size_t i) const
+    {
+        return times[i];
+    }
+
+    /** Get a record.
+     * @param i index of the record
+     * @return record
+     */
+    const T& getValue(size_t i) const
+    {
+        return values[i];
+    }
+
+    /** Get the index of the record valid at some epoch.
+     * @param t epoch
+     * @return index of the last record with a time stamp before or at t,
+     * or -1 if t is before the first record
+     */
+    long floorIndex(const LinearTime& t) const
+    {
+        if (times.empty() || t < times.front()) {
+            return -1;
+        }
+        if (uniform) {
+            // unsigned difference is exact as t is not before the first record
+            const uint64_t k = (static_cast<uint64_t>(t.getNanos()) -
+                                static_cast<uint64_t>(times.front().getNanos())) / step;
+            return static_cast<long>(std::min<uint64_t>(k, times.size() - 1));
+        }
+        return searchEytzinger(t);
+    }
+
+    /** Get the index of the record valid at some epoch, using a last hit hint.
+     * @param t epoch
+     * @param cursor hint updated by the call
+     * @return index of the last record with a time stamp before or at t,
+     * or -1 if t is before the first record
+     */
+    long floorIndex(const LinearTime& t, Cursor& cursor) const
+    {
+        const size_t n = times.size();
+        size_t k = cursor.last;
+        if (k < n && !(t < times[k])) {
+            // the hint is before t, check it and its successor
+            if (k + 1 == n || t < times[k + 1]) {
+                return static_cast<long>(k);
+            }
+            if (k + 2 == n || t < times[k + 2]) {
+                cursor.last = k + 1;
+                return static_cast<long>(k + 1);
+            }
+        }
+        const long found = floorIndex(t);
+        cursor.last = (found < 0) ? 0 : static_cast<size_t>(found);
+        return found;
+    }
+
+    /** Find the record valid at some epoch.
+     * <p>This method uses a per-thread last hit hint, so monotone query
+     * streams issued by one thread are served in constant time.</p>
+     * @param t epoch
+     * @return record valid at t, or null if t is before the first record
+     */
+    const T* findValid(const LinearTime& t) const
+    {
+        thread_local struct {
+            uint64_t owner = 0;
+            Cursor   cursor;
+        } hint;
+        if (hint.owner != instance) {
+            hint.owner  = instance;
+            hint.cursor = Cursor();
+        }
+        const long i = floorIndex(t, hint.cursor);
+        return (i < 0) ? nullptr : &values[i];
+    }
+
+private:
+    /** Get a process-wide unique identifier for a new instance.
+     * <p>Identifiers (rather than addresses, which may be reused) tag
+     * the per-thread hints.</p>
+     * @return unique identifier
+     */
+    static uint64_t nextInstance()
+    {
+        static std::atomic<uint64_t> counter(0);
+        return ++counter;
+    }
+
+    /** Detect uniform spacing and prepare the Eytzinger layout. */
+    void setUp()
+    {
+        const size_t n = times.size();
+
+        // uniform spacing requires strictly increasing, exactly evenly spaced time stamps
+        uniform = false;
+        if (n > 1) {
+            const int64_t delta = times[1].getNanos() - times[0].getNanos();
+            uniform = delta > 0;
+            for (size_t i = 2; uniform && i < n; ++i) {
+                uniform = times[i].getNanos() - times[i - 1].getNanos() == delta;
+            }
+            step = uniform ? static_cast<uint64_t>(delta) : 0;
+        }
+
+        if (!uniform) {
+            // Eytzinger layout, 1-based, slot 0 being unused
+            eytzinger.assign(n + 1, LinearTime::FUTURE_INFINITY);
+            eytzingerRank.assign(n + 1, 0);
+            size_t next = 0;
+            fill(1, next);
+        }
+    }
+
+    /** Fill the Eytzinger layout by an in-order traversal.
+     * @param k current node
+     * @param next index of the next sorted element to place
+     */
+    void fill(size_t k, size_t& next)
+    {
+        if (k < eytzinger.size()) {
+            fill(2 * k, next);
+            eytzinger[k]     = times[next];
+            eytzingerRank[k] = next++;
+            fill(2 * k + 1, next);
+        }
+    }
+
+    /** Search the Eytzinger layout.
+     * @param t epoch, not before the first record
+     * @return index of the last record with a time stamp before or at t
+     */
+    long searchEytzinger(const LinearTime& t) const
+    {
+        const size_t n = eytzinger.size() - 1;
+        const LinearTime* base = eytzinger.data();
+        size_t k = 1;
+        while (k <= n) {
+#if defined(__GNUC__)
+            // prefetch four levels down, only while the address is inside the array
+            if (16 * k <= n) {
+                __builtin_prefetch(base + 16 * k);
+            }
+#endif
+            k = 2 * k + (base[k] <= t ? 1 : 0);
+        }
+
+        // strip the trailing right turns, leaving the first element strictly after t
+        while (k & 1) {
+            k >>= 1;
+        }
+        k >>= 1;
+
+        return (k == 0) ? static_cast<long>(n - 1) : static_cast<long>(eytzingerRank[k]) - 1;
+    }
+
+    /** Unique identifier of the instance. */
+    uint64_t instance;
+
+    /** Sorted time stamps. */
+    std::vector<LinearTime> times;
+
+    /** Records, in the same order as time stamps. */
+    std::vector<T> values;
+
+    /** Uniform spacing flag. */
+    bool uniform;
+
+    /** Spacing between records in nanoseconds, for uniform spacing only. */
+    uint64_t step;
+
+    /** Time stamps in Eytzinger layout, for irregular spacing only. */
+    std::vector<LinearTime> eytzinger;
+
+    /** Sorted index of each Eytzinger slot. */
+    std::vector<size_t> eytzingerRank;
+};
+
+#endif
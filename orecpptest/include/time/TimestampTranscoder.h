@@ -0,0 +1,233 @@
+#ifndef _TIMESTAMP_TRANSCODER_H_
+#define _TIMESTAMP_TRANSCODER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "time/BinaryTimeFormat.h"
+#include "time/BinaryTimeWriter.h"
+#include "time/DateTimeComponents.h"
+#include "utils/ThreadPool.h"
+
+/** Streaming transcoder of a timestamp column of text files.
+ * <p>The transcoder reads delimited text lines (CSV, TSV, logs...), parses
+ * the timestamp found in one column into {@link DateTimeComponents} and
+ * emits either a normalized text column, one ISO-8601 timestamp per input
+ * line, or the {@link BinaryTimeFormat binary time format}. Supported input
+ * formats, detected for each line unless a format is forced, are:</p>
+ * <ul>
+ *   <li>{@link #ISO_8601}: <code>2024-03-01T12:34:56.789Z</code>, with a
+ *       'T' or a space between date and time, optional seconds, fraction
+ *       and offset from UTC (<code>Z</code>, <code>+hh:mm</code>,
+ *       <code>+hhmm</code>), or a date only; the ordinal form
+ *       <code>2024-061T12:34:56</code> is also accepted,</li>
+ *   <li>{@link #YEAR_DAY}: <code>2024 061 12:34:56.789</code>,</li>
+ *   <li>{@link #MJD}: modified julian day as a decimal number,
+ *       <code>60370.524268</code>.</li>
+ * </ul>
+ * <p>Files are memory mapped, other inputs (pipes, sockets) are read by
+ * chunks. The input is cut into batches of whole lines, and a window of one
+ * batch per thread of the {@link ThreadPool} is parsed in parallel before
+ * being written in input order, so the memory used does not depend on the
+ * input size. Each binary batch is written as one complete block.</p>
+ * <p>Years must be between -5877489 and 5881609. These are the years whose
+ * days all have an <code>int32</code> day number with respect to J2000,
+ * as {@link DateComponents} and the day column of the binary format
+ * require. MJD timestamps have at most 9 integer digits, which always
+ * stays in this range.</p>
+ * <p>Lines whose timestamp cannot be parsed are counted as rejected. They
+ * are emitted as empty lines in text output, to keep the output lines
+ * aligned with the input lines, and skipped in binary output.</p>
+ */
+class TimestampTranscoder
+{
+public:
+    /** Timestamp formats. */
+    enum Format
+    {
+        /** Detect the format of each timestamp. */
+        AUTO,
+
+        /** ISO-8601 calendar or ordinal date, with optional time and offset from UTC. */
+        ISO_8601,
+
+        /** Year, day in year and time separated by spaces. */
+        YEAR_DAY,
+
+        /** Modified julian day as a decimal number. */
+        MJD
+    };
+
+    /** Output kinds. */
+    enum Output
+    {
+        /** One normalized ISO-8601 timestamp per line. */
+        TEXT,
+
+        /** {@link BinaryTimeFormat binary time format} blocks. */
+        BINARY
+    };
+
+    /** Transcoding statistics. */
+    struct Statistics
+    {
+        /** Number of input lines. */
+        uint64_t lines;
+
+        /** Number of timestamps converted. */
+        uint64_t converted;
+
+        /** Number of lines whose timestamp could not be parsed. */
+        uint64_t rejected;
+
+        /** Number of input bytes. */
+        uint64_t bytesRead;
+
+        /** Number of output bytes. */
+        uint64_t bytesWritten;
+    };
+
+    /** Build a transcoder reading the first comma separated column with format detection.
+     * @param pool thread pool parsing the batches
+     */
+    explicit TimestampTranscoder(ThreadPool& pool);
+
+    /** Set the timestamp column.
+     * @param column index of the column, starting at 0
+     * @param delimiter columns delimiter (must not appear in timestamps)
+     */
+    void setColumn(size_t column, char delimiter);
+
+    /** Set the timestamp format.
+     * @param format timestamp format, {@link #AUTO} for detection
+     */
+    void setFormat(Format format);
+
+    /** Set the output kind.
+     * @param output output kind
+     * @param scale time scale recorded in binary output
+     */
+    void setOutput(Output output, BinaryTimeFormat::Scale scale = BinaryTimeFormat::UNSPECIFIED);
+
+    /** Set the batch size.
+     * @param bytes approximate number of input bytes per batch
+     */
+    void setBatchSize(size_t bytes);
+
+    /** Transcode a file.
+     * @param path path of the file to read (memory mapped)
+     * @param fd file descriptor to write to
+     * @return true if the file could be read and all output bytes were written
+     */
+    bool transcodeFile(const char* path, int fd);
+
+    /** Transcode a stream.
+     * @param inputFd file descriptor to read from, until end of file
+     * @param outputFd file descriptor to write to
+     * @return true if the input could be read and all output bytes were written
+     */
+    bool transcode(int inputFd, int outputFd);
+
+    /** Get the statistics of the last transcoding.
+     * @return statistics of the last transcoding
+     */
+    const Statistics& getStatistics() const;
+
+    /** Detect the format of a timestamp.
+     * @param begin first character of the timestamp
+     * @param end character after the last one
+     * @return detected format, {@link #AUTO} if none matches
+     */
+    static Format detect(const char* begin, const char* end);
+
+    /** Parse a timestamp.
+     * @param begin first character of the timestamp
+     * @param end character after the last one
+     * @param format timestamp format, {@link #AUTO} for detection
+     * @param dateTime placeholder for the parsed date/time
+     * @return true if the timestamp was parsed
+     */
+    static bool parse(const char* begin, const char* end, Format format, DateTimeComponents& dateTime);
+
+    /** Format a date/time as a normalized ISO-8601 timestamp.
+     * <p>The timestamp has nanoseconds and an offset from UTC, for example
+     * <code>2024-03-01T12:34:56.789000000Z</code>.</p>
+     * @param dateTime date/time to format
+     * @param buffer buffer of at least {@link #MAX_FORMATTED_SIZE} characters
+     * @return number of characters written (not null terminated)
+     */
+    static size_t format(const DateTimeComponents& dateTime, char* buffer);
+
+    /** Maximum number of characters written by {@link #format(const DateTimeComponents&, char*)}. */
+    static const size_t MAX_FORMATTED_SIZE = 48;
+
+    /** Default batch size in bytes. */
+    static const size_t DEFAULT_BATCH_SIZE = 1 << 22;
+
+private:
+    /** Batch of whole input lines. */
+    struct Batch
+    {
+        /** First character. */
+        const char* begin;
+
+        /** Character after the last one. */
+        const char* end;
+
+        /** Storage of the characters when they are not memory mapped. */
+        std::vector<char> storage;
+
+        /** Parsed date/times (binary output). */
+        std::vector<DateTimeComponents> dateTimes;
+
+        /** Formatted text (text output). */
+        std::string text;
+
+        /** Number of lines. */
+        uint64_t lines;
+
+        /** Number of rejected lines. */
+        uint64_t rejected;
+    };
+
+    /** Parse the lines of a batch and prepare its output.
+     * @param batch batch to process
+     */
+    void process(Batch& batch) const;
+
+    /** Process a window of batches in parallel and write them in order.
+     * @param batches batches to process
+     * @param count number of batches
+     * @param writer binary writer (for binary output)
+     * @param fd file descriptor to write to (for text output)
+     * @return true if all bytes were written
+     */
+    bool flush(std::vector<Batch>& batches, size_t count, BinaryTimeWriter& writer, int fd);
+
+    /** Thread pool parsing the batches. */
+    ThreadPool& pool;
+
+    /** Index of the timestamp column. */
+    size_t column;
+
+    /** Columns delimiter. */
+    char delimiter;
+
+    /** Timestamp format. */
+    Format inputFormat;
+
+    /** Output kind. */
+    Output output;
+
+    /** Time scale of binary output. */
+    BinaryTimeFormat::Scale scale;
+
+    /** Approximate number of bytes per batch. */
+    size_t batchSize;
+
+    /** Statistics of the last transcoding. */
+    Statistics statistics;
+};
+
+#endif
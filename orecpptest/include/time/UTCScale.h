@@ -0,0 +1,139 @@
+#ifndef _UTC_SCALE_H_
+#define _UTC_SCALE_H_
+
+#include <stddef.h>
+#include <vector>
+#include "time/DateComponents.h"
+#include "time/DateTimeComponents.h"
+#include "time/LinearTime.h"
+#include "time/TimeComponents.h"
+
+/** Coordinated Universal Time scale.
+ * <p>The scale converts {@link LinearTime} instances counted in the TAI
+ * scale (nanoseconds since 2000-01-01T00:00:00 TAI) into UTC components,
+ * with leap seconds: during a leap second the components have a second of
+ * minute in [60, 61) and the whole minute before the leap is 61 seconds long,
+ * as produced by {@link TimeComponents#fromSeconds(int, double, double, int)}.</p>
+ * <p>The default table contains the leap seconds from 1972-01-01 (TAI - UTC
+ * = 10 s) to 2017-01-01 (TAI - UTC = 37 s). The offset of the first entry is
+ * used for all earlier dates, the 1961 to 1971 drifting offsets are not
+ * modelled.</p>
+ * <p>Converting an array sorted in increasing time order is done in one
+ * pass merged with the leap seconds table: the table position is only moved
+ * forward as the times increase, and the calendar decomposition is reused
+ * for consecutive times in the same day. Unsorted arrays are still converted
+ * correctly, with one table lookup each time the order is broken.</p>
+ * <p>Instances of this class are guaranteed to be immutable.</p>
+ * @see TimeComponents
+ * @see LinearTime
+ */
+class UTCScale
+{
+public:
+    /** Offset between TAI and UTC in effect from a date. */
+    struct Offset
+    {
+        /** First UTC day of the offset. */
+        DateComponents date;
+
+        /** TAI - UTC in seconds. */
+        int taiMinusUTC;
+    };
+
+    /** Build a scale with the built-in leap seconds table. */
+    UTCScale();
+
+    /** Build a scale with a custom leap seconds table.
+     * @param offsets offsets between TAI and UTC, sorted by increasing date,
+     * with at least one element
+     */
+    explicit UTCScale(const std::vector<Offset>& offsets);
+
+    /** Get the offset between TAI and UTC.
+     * <p>During a leap second, the offset after the leap second is returned.</p>
+     * @param tai time in the TAI scale
+     * @return TAI - UTC in seconds
+     */
+    int getTAIMinusUTC(const LinearTime& tai) const;
+
+    /** Convert a time to UTC components.
+     * @param tai time in the TAI scale
+     * @return date/time components in UTC
+     */
+    DateTimeComponents getComponents(const LinearTime& tai) const;
+
+    /** Convert an array of times to UTC components.
+     * @param tai times in the TAI scale, preferably sorted in increasing order
+     * @param count number of elements
+     * @param dateTimes array where to store the date/time components in UTC
+     */
+    void getComponents(const LinearTime* tai, size_t count, DateTimeComponents* dateTimes) const;
+
+    /** Convert an array of times to UTC times of day.
+     * @param tai times in the TAI scale, preferably sorted in increasing order
+     * @param count number of elements
+     * @param times array where to store the times of day in UTC
+     */
+    void getTimeComponents(const LinearTime* tai, size_t count, TimeComponents* times) const;
+
+private:
+    /** Change of offset between TAI and UTC, with limits expressed in the TAI scale. */
+    struct Transition
+    {
+        /** Start of the last UTC minute before the change (ns since J2000 TAI). */
+        int64_t minuteStart;
+
+        /** Start of the leap second(s), where the new offset applies (ns since J2000 TAI). */
+        int64_t leapStart;
+
+        /** Start of the first UTC day with the new offset (ns since J2000 TAI). */
+        int64_t dayStart;
+
+        /** TAI - UTC before the change, in seconds. */
+        int previous;
+
+        /** TAI - UTC after the change, in seconds. */
+        int offset;
+    };
+
+    /** UTC decoding of one time. */
+    struct Decoded
+    {
+        /** Nanoseconds since 2000-01-01T00:00:00 UTC, counting 86400 seconds per day. */
+        int64_t utcNanos;
+
+        /** Leap to add to the second of minute, in seconds. */
+        int leap;
+
+        /** Number of seconds in the current minute. */
+        int minuteDuration;
+    };
+
+    /** Find the first transition that is not complete at a time.
+     * @param nanos time in the TAI scale
+     * @return index of the first transition with {@link Transition#dayStart} after the time
+     */
+    size_t locate(int64_t nanos) const;
+
+    /** Decode a time.
+     * @param nanos time in the TAI scale
+     * @param index index of the first transition not complete at the time
+     * @return decoded time
+     */
+    Decoded decode(int64_t nanos, size_t index) const;
+
+    /** Build the time of day of a decoded time.
+     * @param decoded decoded time
+     * @param day day of the time, in UTC, with respect to J2000
+     * @return time of day
+     */
+    static TimeComponents getTime(const Decoded& decoded, int64_t day);
+
+    /** TAI - UTC before the first transition, in seconds. */
+    int initial;
+
+    /** Changes of offset, sorted by increasing time. */
+    std::vector<Transition> transitions;
+};
+
+#endif
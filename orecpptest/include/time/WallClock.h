@@ -0,0 +1,132 @@
+#ifndef _WALL_CLOCK_H_
+#define _WALL_CLOCK_H_
+
+#include <stdint.h>
+#include "time/DateTimeComponents.h"
+#include "time/LinearTime.h"
+
+/** Low latency source of the current time.
+ * <p>The clock reads the operating system real time clock, the TAI clock
+ * (<code>CLOCK_TAI</code>, Linux only) or the processor time stamp counter
+ * calibrated against the real time clock, and returns {@link LinearTime}
+ * instances or {@link DateTimeComponents} in the clock scale.</p>
+ * <p>The date part of the components is cached per thread for the current
+ * day, so that only the time of day is computed on each call. With the time
+ * stamp counter source, each thread also keeps an anchor pairing a counter
+ * value with a real time clock reading, refreshed every few tens of
+ * milliseconds to bound the drift, so that most calls only read the counter
+ * and do one multiplication.</p>
+ * <p>The real time clock ignores leap seconds. The TAI clock is only correct
+ * if the system time daemon (ntpd, chrony...) has set the kernel TAI offset,
+ * see {@link #getTAIOffset()}.</p>
+ * <p>Instances are immutable once built and can be shared between threads.</p>
+ */
+class WallClock
+{
+public:
+    /** Time sources. */
+    enum Source
+    {
+        /** Operating system real time clock (UTC, without leap seconds). */
+        REALTIME,
+
+        /** Linux TAI clock. */
+        TAI,
+
+        /** Time stamp counter calibrated against the real time clock. */
+        TSC
+    };
+
+    /** Build a clock.
+     * <p>If the requested source is not available, the clock falls back to
+     * {@link #REALTIME}, see {@link #getSource()}.</p>
+     * @param source time source
+     */
+    explicit WallClock(Source source = REALTIME);
+
+    /** Get the time source actually used.
+     * @return time source actually used
+     */
+    Source getSource() const;
+
+    /** Check if a time source is available on this system.
+     * @param source time source
+     * @return true if the source is available
+     */
+    static bool isAvailable(Source source);
+
+    /** Get the offset between TAI and UTC set in the kernel.
+     * @return TAI - UTC in seconds (0 if not set or not available)
+     */
+    static int getTAIOffset();
+
+    /** Get the current time.
+     * @return nanoseconds since J2000 epoch, in the clock scale
+     */
+    int64_t nowNanos() const;
+
+    /** Get the current time.
+     * @return current time, in the clock scale
+     */
+    LinearTime now() const;
+
+    /** Get the current date and time.
+     * @return current date and time components, in the clock scale
+     */
+    DateTimeComponents nowComponents() const;
+
+    /** Get the time stamp counter frequency.
+     * @return ticks per second (0 if the clock does not use the time stamp counter)
+     */
+    double getTicksPerSecond() const;
+
+private:
+    /** Per-thread state of the clock last used by the thread. */
+    struct ThreadCache;
+
+    /** Get the state of the current thread for a clock.
+     * @param instance identifier of the clock
+     * @return state of the current thread, reset if it belonged to another clock
+     */
+    static ThreadCache& getCache(uint64_t instance);
+
+    /** Get the current time from the time stamp counter.
+     * @param cache state of the current thread
+     * @return nanoseconds since J2000 epoch
+     */
+    int64_t readCounterNanos(ThreadCache& cache) const;
+
+    /** Read the operating system clock.
+     * @param source clock to read ({@link #REALTIME} or {@link #TAI})
+     * @return nanoseconds since J2000 epoch
+     */
+    static int64_t readSystemClock(Source source);
+
+    /** Read the time stamp counter.
+     * @return counter value
+     */
+    static uint64_t readCounter();
+
+    /** Calibrate the time stamp counter. */
+    void calibrate();
+
+    /** Unique identifier of the instance, for the per-thread caches. */
+    uint64_t instance;
+
+    /** Time source. */
+    Source source;
+
+    /** Nanoseconds per tick, as a fixed point number with {@link #SCALE_SHIFT} fractional bits. */
+    uint64_t scale;
+
+    /** Ticks per second. */
+    double ticksPerSecond;
+
+    /** Number of fractional bits of {@link #scale}. */
+    static const int SCALE_SHIFT = 24;
+
+    /** Number of ticks after which the per-thread anchor is refreshed. */
+    static const uint64_t ANCHOR_LIFETIME = UINT64_C(1) << 26;
+};
+
+#endif
@@ -0,0 +1,316 @@
+#ifndef _EARTH_MODELS_H_
+#define _EARTH_MODELS_H_
+
+#include "utils/Constants.h"
+
+/** Compile-time helpers for the model descriptors. */
+struct EarthModelMath
+{
+    /** Compute a square root at compile time.
+     * <p>Newton iterations starting above the root, intended for the small
+     * positive arguments of the model descriptors.</p>
+     * @param x argument, must be between 0 and about 1.0e6
+     * @return square root of x, 0 for non-positive arguments
+     */
+    static constexpr double sqrt(double x)
+    {
+        if (!(x > 0.0)) {
+            return 0.0;
+        }
+        double root = (x > 1.0) ? x : 1.0;
+        for (int i = 0; i < 64; ++i) {
+            const double next = 0.5 * (root + x / root);
+            if (next >= root) {
+                break;
+            }
+            root = next;
+        }
+        return root;
+    }
+};
+
+/** World Geodetic System 1984. */
+struct WGS84
+{
+    /** Equatorial radius (m). */
+    static constexpr double EQUATORIAL_RADIUS = Constants::WGS84_EARTH_EQUATORIAL_RADIUS;
+
+    /** Flattening. */
+    static constexpr double FLATTENING = Constants::WGS84_EARTH_FLATTENING;
+
+    /** Angular velocity (rad/s). */
+    static constexpr double ANGULAR_VELOCITY = Constants::WGS84_EARTH_ANGULAR_VELOCITY;
+
+    /** Gravitational constant (m³/s²). */
+    static constexpr double MU = Constants::WGS84_EARTH_MU;
+
+    /** Un-normalized zonal coefficients, indexed by degree. */
+    static constexpr double UNNORMALIZED_ZONALS[] = { 0.0, 0.0, Constants::WGS84_EARTH_C20 };
+};
+
+/** Geodetic Reference System 1980. */
+struct GRS80
+{
+    /** Equatorial radius (m). */
+    static constexpr double EQUATORIAL_RADIUS = Constants::GRS80_EARTH_EQUATORIAL_RADIUS;
+
+    /** Flattening. */
+    static constexpr double FLATTENING = Constants::GRS80_EARTH_FLATTENING;
+
+    /** Angular velocity (rad/s). */
+    static constexpr double ANGULAR_VELOCITY = Constants::GRS80_EARTH_ANGULAR_VELOCITY;
+
+    /** Gravitational constant (m³/s²). */
+    static constexpr double MU = Constants::GRS80_EARTH_MU;
+
+    /** Un-normalized zonal coefficients, indexed by degree. */
+    static constexpr double UNNORMALIZED_ZONALS[] = { 0.0, 0.0, Constants::GRS80_EARTH_C20 };
+};
+
+/** GRIM5-C1 combined gravity field and ellipsoid. */
+struct GRIM5C1
+{
+    /** Equatorial radius (m). */
+    static constexpr double EQUATORIAL_RADIUS = Constants::GRIM5C1_EARTH_EQUATORIAL_RADIUS;
+
+    /** Flattening. */
+    static constexpr double FLATTENING = Constants::GRIM5C1_EARTH_FLATTENING;
+
+    /** Angular velocity (rad/s). */
+    static constexpr double ANGULAR_VELOCITY = Constants::GRIM5C1_EARTH_ANGULAR_VELOCITY;
+
+    /** Gravitational constant (m³/s²). */
+    static constexpr double MU = Constants::GRIM5C1_EARTH_MU;
+
+    /** Un-normalized zonal coefficients, indexed by degree. */
+    static constexpr double UNNORMALIZED_ZONALS[] = {
+        0.0, 0.0,
+        Constants::GRIM5C1_EARTH_C20, Constants::GRIM5C1_EARTH_C30, Constants::GRIM5C1_EARTH_C40,
+        Constants::GRIM5C1_EARTH_C50, Constants::GRIM5C1_EARTH_C60
+    };
+};
+
+/** IERS conventions 1996. */
+struct IERS96
+{
+    /** Equatorial radius (m). */
+    static constexpr double EQUATORIAL_RADIUS = Constants::IERS96_EARTH_EQUATORIAL_RADIUS;
+
+    /** Flattening. */
+    static constexpr double FLATTENING = Constants::IERS96_EARTH_FLATTENING;
+
+    /** Angular velocity (rad/s). */
+    static constexpr double ANGULAR_VELOCITY = Constants::IERS96_EARTH_ANGULAR_VELOCITY;
+
+    /** Gravitational constant (m³/s²). */
+    static constexpr double MU = Constants::IERS96_EARTH_MU;
+
+    /** Un-normalized zonal coefficients, indexed by degree. */
+    static constexpr double UNNORMALIZED_ZONALS[] = { 0.0, 0.0, Constants::IERS96_EARTH_C20 };
+};
+
+/** IERS conventions 2003. */
+struct IERS2003
+{
+    /** Equatorial radius (m). */
+    static constexpr double EQUATORIAL_RADIUS = Constants::IERS2003_EARTH_EQUATORIAL_RADIUS;
+
+    /** Flattening. */
+    static constexpr double FLATTENING = Constants::IERS2003_EARTH_FLATTENING;
+
+    /** Angular velocity (rad/s). */
+    static constexpr double ANGULAR_VELOCITY = Constants::IERS2003_EARTH_ANGULAR_VELOCITY;
+
+    /** Gravitational constant (m³/s²). */
+    static constexpr double MU = Constants::IERS2003_EARTH_MU;
+
+    /** Un-normalized zonal coefficients, indexed by degree. */
+    static constexpr double UNNORMALIZED_ZONALS[] = { 0.0, 0.0, Constants::IERS2003_EARTH_C20 };
+};
+
+/** IERS conventions 2010. */
+struct IERS2010
+{
+    /** Equatorial radius (m). */
+    static constexpr double EQUATORIAL_RADIUS = Constants::IERS2010_EARTH_EQUATORIAL_RADIUS;
+
+    /** Flattening. */
+    static constexpr double FLATTENING = Constants::IERS2010_EARTH_FLATTENING;
+
+    /** Angular velocity (rad/s). */
+    static constexpr double ANGULAR_VELOCITY = Constants::IERS2010_EARTH_ANGULAR_VELOCITY;
+
+    /** Gravitational constant (m³/s²). */
+    static constexpr double MU = Constants::IERS2010_EARTH_MU;
+
+    /** Un-normalized zonal coefficients, indexed by degree. */
+    static constexpr double UNNORMALIZED_ZONALS[] = { 0.0, 0.0, Constants::IERS2010_EARTH_C20 };
+};
+
+/** Earth Gravitational Model 1996 (gravity field only). */
+struct EGM96
+{
+    /** Equatorial radius (m). */
+    static constexpr double EQUATORIAL_RADIUS = Constants::EGM96_EARTH_EQUATORIAL_RADIUS;
+
+    /** Gravitational constant (m³/s²). */
+    static constexpr double MU = Constants::EGM96_EARTH_MU;
+
+    /** Un-normalized zonal coefficients, indexed by degree. */
+    static constexpr double UNNORMALIZED_ZONALS[] = {
+        0.0, 0.0,
+        Constants::EGM96_EARTH_C20, Constants::EGM96_EARTH_C30, Constants::EGM96_EARTH_C40,
+        Constants::EGM96_EARTH_C50, Constants::EGM96_EARTH_C60
+    };
+};
+
+/** EIGEN-5C combined gravity field (gravity field only). */
+struct EIGEN5C
+{
+    /** Equatorial radius (m). */
+    static constexpr double EQUATORIAL_RADIUS = Constants::EIGEN5C_EARTH_EQUATORIAL_RADIUS;
+
+    /** Gravitational constant (m³/s²). */
+    static constexpr double MU = Constants::EIGEN5C_EARTH_MU;
+
+    /** Un-normalized zonal coefficients, indexed by degree. */
+    static constexpr double UNNORMALIZED_ZONALS[] = {
+        0.0, 0.0,
+        Constants::EIGEN5C_EARTH_C20, Constants::EIGEN5C_EARTH_C30, Constants::EIGEN5C_EARTH_C40,
+        Constants::EIGEN5C_EARTH_C50, Constants::EIGEN5C_EARTH_C60
+    };
+};
+
+/** Reference ellipsoid of a model.
+ * <p>Model tags ({@link WGS84}, {@link GRS80}...) group the values of
+ * {@link Constants} by model. This descriptor adds the derived quantities
+ * (polar radius, eccentricities...), all members are compile-time
+ * constants. Models without flattening (pure gravity fields such as
+ * {@link EGM96}) cannot be used as ellipsoids, this is checked at compile
+ * time.</p>
+ * @param Model model tag, providing equatorial radius, flattening,
+ * angular velocity and gravitational constant
+ */
+template<typename Model>
+class Ellipsoid
+{
+public:
+    /** Equatorial radius (m). */
+    static constexpr double EQUATORIAL_RADIUS = Model::EQUATORIAL_RADIUS;
+
+    /** Flattening. */
+    static constexpr double FLATTENING = Model::FLATTENING;
+
+    /** Angular velocity (rad/s). */
+    static constexpr double ANGULAR_VELOCITY = Model::ANGULAR_VELOCITY;
+
+    /** Gravitational constant (m³/s²). */
+    static constexpr double MU = Model::MU;
+
+    /** Polar radius (m): a (1 - f). */
+    static constexpr double POLAR_RADIUS = EQUATORIAL_RADIUS * (1.0 - FLATTENING);
+
+    /** Square of the first eccentricity: f (2 - f). */
+    static constexpr double E2 = FLATTENING * (2.0 - FLATTENING);
+
+    /** Fourth power of the first eccentricity. */
+    static constexpr double E4 = E2 * E2;
+
+    /** First eccentricity. */
+    static constexpr double ECCENTRICITY = EarthModelMath::sqrt(E2);
+
+    /** One minus the square of the first eccentricity: (1 - f)². */
+    static constexpr double ONE_MINUS_E2 = (1.0 - FLATTENING) * (1.0 - FLATTENING);
+
+    /** Square of the second eccentricity: e² / (1 - e²). */
+    static constexpr double E_PRIME2 = E2 / ONE_MINUS_E2;
+
+    /** Square of the equatorial radius (m²). */
+    static constexpr double EQUATORIAL_RADIUS2 = EQUATORIAL_RADIUS * EQUATORIAL_RADIUS;
+
+    /** Inverse of the square of the equatorial radius (m⁻²). */
+    static constexpr double INVERSE_EQUATORIAL_RADIUS2 = 1.0 / EQUATORIAL_RADIUS2;
+
+    static_assert(FLATTENING > 0.0 && FLATTENING < 1.0, "ellipsoid flattening must be between 0 and 1");
+};
+
+/** Zonal part of the gravity field of a model.
+ * <p>All members are compile-time constants. Coefficients are indexed by
+ * degree, from 0 to {@link #MAX_DEGREE}; degrees 0 and 1 are 0.</p>
+ * <p>A kernel specialized for one model gets its constants folded in at
+ * compile time:</p>
+ * <pre>
+ *   template&lt;typename Model&gt;
+ *   double j2Acceleration(...)
+ *   {
+ *       constexpr double k = 1.5 * ZonalModel&lt;Model&gt;::MU *
+ *                            ZonalModel&lt;Model&gt;::template J&lt;2&gt; * ...;
+ *   }
+ * </pre>
+ * @param Model model tag, providing equatorial radius, gravitational
+ * constant and un-normalized zonal coefficients
+ */
+template<typename Model>
+class ZonalModel
+{
+public:
+    /** Equatorial radius (m). */
+    static constexpr double EQUATORIAL_RADIUS = Model::EQUATORIAL_RADIUS;
+
+    /** Gravitational constant (m³/s²). */
+    static constexpr double MU = Model::MU;
+
+    /** Maximal degree of the zonal coefficients. */
+    static constexpr int MAX_DEGREE =
+        static_cast<int>(sizeof(Model::UNNORMALIZED_ZONALS) / sizeof(Model::UNNORMALIZED_ZONALS[0])) - 1;
+
+    /** Get an un-normalized zonal coefficient Cn,0.
+     * @param n degree
+     * @return un-normalized coefficient, 0 above {@link #MAX_DEGREE}
+     */
+    static constexpr double getUnnormalizedC(int n)
+    {
+        return (n >= 0 && n <= MAX_DEGREE) ? Model::UNNORMALIZED_ZONALS[n] : 0.0;
+    }
+
+    /** Get a fully normalized zonal coefficient C̄n,0 = Cn,0 / √(2n + 1).
+     * @param n degree
+     * @return normalized coefficient, 0 above {@link #MAX_DEGREE}
+     */
+    static constexpr double getNormalizedC(int n)
+    {
+        return getUnnormalizedC(n) / EarthModelMath::sqrt(2.0 * n + 1.0);
+    }
+
+    /** Get a zonal harmonic Jn = -Cn,0.
+     * @param n degree
+     * @return zonal harmonic, 0 above {@link #MAX_DEGREE}
+     */
+    static constexpr double getJ(int n)
+    {
+        return -getUnnormalizedC(n);
+    }
+
+    /** Get the product μ aⁿ Jn used by the zonal accelerations.
+     * @param n degree
+     * @return μ aⁿ Jn (m^(n+3)/s²)
+     */
+    static constexpr double getMuAnJ(int n)
+    {
+        double an = 1.0;
+        for (int i = 0; i < n; ++i) {
+            an *= EQUATORIAL_RADIUS;
+        }
+        return MU * an * getJ(n);
+    }
+
+    /** Zonal harmonic Jn as a compile-time constant. */
+    template<int N>
+    static constexpr double J = getJ(N);
+
+    /** Fully normalized zonal coefficient C̄n,0 as a compile-time constant. */
+    template<int N>
+    static constexpr double NORMALIZED_C = getNormalizedC(N);
+};
+
+#endif
@@ -0,0 +1,451 @@
+#ifndef _GENERIC_TIME_STAMPED_CACHE_H_
+#define _GENERIC_TIME_STAMPED_CACHE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "time/LinearTime.h"
+#include "utils/TimeStampedGenerator.h"
+
+/** Generic thread-safe cache for time stamped data.
+ * <p>The cache holds a bounded number of slots, each slot being an immutable
+ * chronologically sorted window of entries created on demand by a {@link
+ * TimeStampedGenerator generator}. Queries return the entries surrounding an
+ * epoch, for example interpolation nodes or frame transforms.</p>
+ * <p>Reads are lock-free: the set of slots is an immutable snapshot published
+ * through an atomic pointer, and readers only announce the epoch they entered
+ * in, so that writers reclaim retired snapshots once no reader can still hold
+ * them (epoch-based reclamation, a user-space flavor of RCU). Only misses take
+ * the writer lock, to generate a new slot and publish a new snapshot in which
+ * the least recently used slot may have been evicted. Readers beyond the
+ * {@link #MAX_READERS} announcement slots take the writer lock too, rather
+ * than spinning until a slot is released.</p>
+ * <p>Memory is bounded by the maximum number of slots times the number of
+ * entries the generator returns for one slot span.</p>
+ * @param T type of the cached data, which must be copyable and provide a
+ * <code>LinearTime getDate() const</code> method
+ * @see TimeStampedGenerator
+ */
+template<typename T>
+class GenericTimeStampedCache
+{
+public:
+    /** Cache statistics. */
+    struct Statistics
+    {
+        /** Number of queries served from an existing slot. */
+        uint64_t hits;
+
+        /** Number of queries that required generating a slot. */
+        uint64_t misses;
+
+        /** Number of slots evicted. */
+        uint64_t evictions;
+
+        /** Number of slots currently held. */
+        size_t slots;
+
+        /** Number of entries currently held. */
+        size_t entries;
+    };
+
+    /** Simple constructor.
+     * @param neighborsSize fixed size of the arrays to be returned by
+     * {@link #getNeighbors(const LinearTime&, T*)}, must be at least 1
+     * @param maxSlots maximum number of independent cached time slots
+     * @param slotSpan time span of the range requested to the generator for one slot (s)
+     * @param generator generator to use for yet non-cached data
+     */
+    GenericTimeStampedCache(size_t neighborsSize, size_t maxSlots, double slotSpan,
+                            std::shared_ptr<const TimeStampedGenerator<T>> generator)
+        : neighborsSize(std::max<size_t>(neighborsSize, 1)),
+          maxSlots(std::max<size_t>(maxSlots, 1)),
+          slotSpan(slotSpan),
+          generator(std::move(generator)),
+          current(new Snapshot()),
+          globalEpoch(1),
+          accessClock(0),
+          hits(0),
+          misses(0),
+          evictions(0)
+    {
+        for (Reader& reader : readers) {
+            reader.epoch.store(IDLE, std::memory_order_relaxed);
+        }
+    }
+
+    GenericTimeStampedCache(const GenericTimeStampedCache&) = delete;
+    GenericTimeStampedCache& operator=(const GenericTimeStampedCache&) = delete;
+
+    /** Destructor.
+     * <p>No query may be running when the cache is destroyed.</p>
+     */
+    ~GenericTimeStampedCache()
+    {
+        delete current.load();
+        for (const Retired& retired : retiredSnapshots) {
+            delete retired.snapshot;
+        }
+    }
+
+    /** Get the entries surrounding a central date.
+     * <p>If the central date is between entries k and k+1, the returned entries
+     * are centered on this interval, i.e. from k + 1 - neighborsSize/2 on, shifted
+     * if the available data does not extend far enough on one side.</p>
+     * @param central central date
+     * @param neighbors array where to copy the {@link #getNeighborsSize()} entries
+     * @return true if the entries could be found or generated
+     */
+    bool getNeighbors(const LinearTime& central, T* neighbors) const
+    {
+        {
+            // lock-free fast path
+            ReadGuard guard(*this);
+            const Snapshot* snapshot = current.load(std::memory_order_seq_cst);
+            if (copyNeighbors(*snapshot, central, neighbors)) {
+                hits.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return generateAndCopy(central, neighbors);
+    }
+
+    /** Get the entries surrounding a central date.
+     * @param central central date
+     * @return the {@link #getNeighborsSize()} entries surrounding the central date,
+     * or an empty vector if they could not be generated
+     */
+    std::vector<T> getNeighbors(const LinearTime& central) const
+    {
+        std::vector<T> neighbors;
+        neighbors.reserve(neighborsSize);
+        {
+            ReadGuard guard(*this);
+            const Snapshot* snapshot = current.load(std::memory_order_seq_cst);
+            if (copyNeighbors(*snapshot, central, std::back_inserter(neighbors))) {
+                hits.fetch_add(1, std::memory_order_relaxed);
+                return neighbors;
+            }
+        }
+        generateAndCopy(central, std::back_inserter(neighbors));
+        return neighbors;
+    }
+
+    /** Get the fixed size of the arrays returned by neighbors queries.
+     * @return size of the neighbors arrays
+     */
+    size_t getNeighborsSize() const
+    {
+        return neighborsSize;
+    }
+
+    /** Get the maximum number of independent cached time slots.
+     * @return maximum number of independent cached time slots
+     */
+    size_t getMaxSlots() const
+    {
+        return maxSlots;
+    }
+
+    /** Get the cache statistics.
+     * @return statistics
+     */
+    Statistics getStatistics() const
+    {
+        Statistics statistics;
+        statistics.hits      = hits.load(std::memory_order_relaxed);
+        statistics.misses    = misses.load(std::memory_order_relaxed);
+        statistics.evictions = evictions.load(std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(writerMutex);
+        const Snapshot* snapshot = current.load();
+        statistics.slots   = snapshot->slots.size();
+        statistics.entries = 0;
+        for (const auto& slot : snapshot->slots) {
+            statistics.entries += slot->entries.size();
+        }
+        return statistics;
+    }
+
+private:
+    /** Immutable window of cached entries. */
+    struct Slot
+    {
+        /** Chronologically sorted entries. */
+        std::vector<T> entries;
+
+        /** Indicator for data not extending before the first entry. */
+        bool dataStart;
+
+        /** Indicator for data not extending after the last entry. */
+        bool dataEnd;
+
+        /** Logical time of last access, for least recently used eviction. */
+        mutable std::atomic<uint64_t> lastAccess;
+    };
+
+    /** Immutable set of slots, sorted by first entry date. */
+    struct Snapshot
+    {
+        std::vector<std::shared_ptr<const Slot>> slots;
+    };
+
+    /** Snapshot waiting for reclamation. */
+    struct Retired
+    {
+        /** Retired snapshot. */
+        const Snapshot* snapshot;
+
+        /** Global epoch after the snapshot was unpublished. */
+        uint64_t epoch;
+    };
+
+    /** Announcement slot for one active reader, on its own cache line. */
+    struct alignas(64) Reader
+    {
+        /** Epoch the reader entered in, or {@link #IDLE}. */
+        std::atomic<uint64_t> epoch;
+    };
+
+    /** Scoped reader announcement.
+     * <p>When all announcement slots are busy, the guard holds the writer
+     * lock instead: snapshots are only published and reclaimed under this
+     * lock, so the current one stays valid until the guard is destroyed.</p>
+     */
+    class ReadGuard
+    {
+    public:
+        /** Announce a reader.
+         * @param cache protected cache
+         */
+        explicit ReadGuard(const GenericTimeStampedCache& cache)
+            : reader(nullptr), lock(cache.writerMutex, std::defer_lock)
+        {
+            // start probing from a per-thread position to avoid contention
+            thread_local const size_t preferred =
+                std::hash<std::thread::id>()(std::this_thread::get_id());
+            for (size_t i = 0; i < MAX_READERS; ++i) {
+                Reader& candidate = cache.readers[(preferred + i) % MAX_READERS];
+                uint64_t expected = IDLE;
+                const uint64_t epoch = cache.globalEpoch.load(std::memory_order_seq_cst);
+                if (candidate.epoch.load(std::memory_order_relaxed) == IDLE &&
+                    candidate.epoch.compare_exchange_strong(expected, epoch, std::memory_order_seq_cst)) {
+                    reader = &candidate;
+                    return;
+                }
+            }
+
+            // too many simultaneous readers, wait for writers instead of spinning
+            lock.lock();
+        }
+
+        /** Retire the reader announcement, or release the writer lock. */
+        ~ReadGuard()
+        {
+            if (reader != nullptr) {
+                reader->epoch.store(IDLE, std::memory_order_release);
+            }
+        }
+
+    private:
+        /** Announcement slot used, null if the writer lock is held instead. */
+        Reader* reader;
+
+        /** Writer lock, only held when no announcement slot was available. */
+        std::unique_lock<std::mutex> lock;
+    };
+
+    /** Copy neighbors from a snapshot.
+     * @param snapshot snapshot to search
+     * @param central central date
+     * @param neighbors output iterator where to copy the entries
+     * @return true if one slot could provide all neighbors
+     */
+    template<typename OutputIterator>
+    bool copyNeighbors(const Snapshot& snapshot, const LinearTime& central, OutputIterator neighbors) const
+    {
+        for (const auto& slot : snapshot.slots) {
+            const std::vector<T>& entries = slot->entries;
+            if (central < entries.front().getDate() && !slot->dataStart) {
+                continue;
+            }
+            if (entries.back().getDate() < central && !slot->dataEnd) {
+                continue;
+            }
+
+            // index of the first entry strictly after central
+            const size_t after =
+                std::upper_bound(entries.begin(), entries.end(), central,
+                                 [](const LinearTime& t, const T& entry) {
+                                     return t < entry.getDate();
+                                 }) - entries.begin();
+            long first = static_cast<long>(after) - static_cast<long>(neighborsSize / 2);
+            const long last = first + static_cast<long>(neighborsSize);
+
+            // shifting is only allowed at the boundaries of the underlying data
+            if (first < 0) {
+                if (!slot->dataStart) {
+                    continue;
+                }
+                first = 0;
+            }
+            else if (last > static_cast<long>(entries.size())) {
+                if (!slot->dataEnd) {
+                    continue;
+                }
+                first = static_cast<long>(entries.size()) - static_cast<long>(neighborsSize);
+            }
+            if (first < 0 || first + neighborsSize > entries.size()) {
+                // not enough data at all
+                continue;
+            }
+
+            std::copy(entries.begin() + first, entries.begin() + first + neighborsSize, neighbors);
+            slot->lastAccess.store(accessClock.fetch_add(1, std::memory_order_relaxed) + 1,
+                                   std::memory_order_relaxed);
+            return true;
+        }
+        return false;
+    }
+
+    /** Generate a slot around a central date and copy neighbors from it.
+     * @param central central date
+     * @param neighbors output iterator where to copy the entries
+     * @return true if the entries could be generated
+     */
+    template<typename OutputIterator>
+    bool generateAndCopy(const LinearTime& central, OutputIterator neighbors) const
+    {
+        std::lock_guard<std::mutex> lock(writerMutex);
+
+        // another writer may have generated the slot while we were waiting
+        const Snapshot* snapshot = current.load();
+        if (copyNeighbors(*snapshot, central, neighbors)) {
+            hits.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+        misses.fetch_add(1, std::memory_order_relaxed);
+
+        const LinearTime start = central.shiftedBy(-0.5 * slotSpan);
+        const LinearTime end   = central.shiftedBy(0.5 * slotSpan);
+        std::shared_ptr<Slot> slot(new Slot());
+        slot->entries = generator->generate(start, end);
+        if (slot->entries.size() < neighborsSize) {
+            return false;
+        }
+        slot->dataStart = start < slot->entries.front().getDate();
+        slot->dataEnd   = slot->entries.back().getDate() < end;
+        slot->lastAccess.store(accessClock.fetch_add(1, std::memory_order_relaxed) + 1);
+
+        // new snapshot: drop slots overlapping the new one, then evict least recently used ones
+        Snapshot* replacement = new Snapshot();
+        const LinearTime first = slot->entries.front().getDate();
+        const LinearTime last  = slot->entries.back().getDate();
+        for (const auto& existing : snapshot->slots) {
+            if (existing->entries.back().getDate() < first || last < existing->entries.front().getDate()) {
+                replacement->slots.push_back(existing);
+            }
+            else {
+                evictions.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        while (replacement->slots.size() >= maxSlots) {
+            auto lru = std::min_element(replacement->slots.begin(), replacement->slots.end(),
+                                        [](const std::shared_ptr<const Slot>& a,
+                                           const std::shared_ptr<const Slot>& b) {
+                                            return a->lastAccess.load(std::memory_order_relaxed) <
+                                                   b->lastAccess.load(std::memory_order_relaxed);
+                                        });
+            replacement->slots.erase(lru);
+            evictions.fetch_add(1, std::memory_order_relaxed);
+        }
+        replacement->slots.push_back(slot);
+        std::sort(replacement->slots.begin(), replacement->slots.end(),
+                  [](const std::shared_ptr<const Slot>& a, const std::shared_ptr<const Slot>& b) {
+                      return a->entries.front().getDate() < b->entries.front().getDate();
+                  });
+
+        // publish, then retire the previous snapshot
+        const Snapshot* previous = current.exchange(replacement, std::memory_order_seq_cst);
+        const uint64_t epoch = globalEpoch.fetch_add(1, std::memory_order_seq_cst) + 1;
+        retiredSnapshots.push_back(Retired{ previous, epoch });
+        reclaim();
+
+        return copyNeighbors(*replacement, central, neighbors);
+    }
+
+    /** Delete retired snapshots no reader can still hold.
+     * <p>Must be called with the writer lock held.</p>
+     */
+    void reclaim() const
+    {
+        uint64_t oldest = IDLE;
+        for (const Reader& reader : readers) {
+            oldest = std::min(oldest, reader.epoch.load(std::memory_order_seq_cst));
+        }
+        auto kept = retiredSnapshots.begin();
+        for (auto it = retiredSnapshots.begin(); it != retiredSnapshots.end(); ++it) {
+            // a reader which entered before the snapshot was retired may still hold it
+            if (it->epoch <= oldest) {
+                delete it->snapshot;
+            }
+            else {
+                *kept++ = *it;
+            }
+        }
+        retiredSnapshots.erase(kept, retiredSnapshots.end());
+    }
+
+    /** Epoch value of idle reader announcements. */
+    static constexpr uint64_t IDLE = UINT64_MAX;
+
+    /** Maximum number of simultaneous readers announcements. */
+    static constexpr size_t MAX_READERS = 64;
+
+    /** Size of the neighbors arrays. */
+    const size_t neighborsSize;
+
+    /** Maximum number of slots. */
+    const size_t maxSlots;
+
+    /** Time span requested to the generator for one slot. */
+    const double slotSpan;
+
+    /** Generator for yet non-cached data. */
+    const std::shared_ptr<const TimeStampedGenerator<T>> generator;
+
+    /** Currently published snapshot. */
+    mutable std::atomic<const Snapshot*> current;
+
+    /** Global epoch, incremented each time a snapshot is retired. */
+    mutable std::atomic<uint64_t> globalEpoch;
+
+    /** Logical clock for least recently used eviction. */
+    mutable std::atomic<uint64_t> accessClock;
+
+    /** Readers announcements. */
+    mutable Reader readers[MAX_READERS];
+
+    /** Lock serializing writers. */
+    mutable std::mutex writerMutex;
+
+    /** Snapshots waiting for reclamation (guarded by the writer lock). */
+    mutable std::vector<Retired> retiredSnapshots;
+
+    /** Number of hits. */
+    mutable std::atomic<uint64_t> hits;
+
+    /** Number of misses. */
+    mutable std::atomic<uint64_t> misses;
+
+    /** Number of evictions. */
+    mutable std::atomic<uint64_t> evictions;
+};
+
+#endif
@@ -0,0 +1,154 @@
+#ifndef _GRADIENT_H_
+#define _GRADIENT_H_
+
+#include <cmath>
+
+/** First order derivatives of a function of N free parameters.
+ * <p>This is a forward mode automatic differentiation number: a value and
+ * its partial derivatives with respect to N free parameters, propagated
+ * through arithmetic operations. Kernels written as templates on their
+ * scalar type compute their Jacobians by being instantiated with this
+ * type instead of <code>double</code>.</p>
+ * @param N number of free parameters
+ */
+template<int N>
+class Gradient
+{
+public:
+    /** Build a constant, with all partial derivatives set to 0.
+     * @param value value of the constant
+     */
+    Gradient(double value = 0.0)
+        : value(value)
+    {
+        for (int i = 0; i < N; ++i) {
+            grad[i] = 0.0;
+        }
+    }
+
+    /** Build a free parameter.
+     * @param value value of the parameter
+     * @param index index of the parameter, from 0 to N-1
+     * @return free parameter, with derivative 1 with respect to itself
+     */
+    static Gradient variable(double value, int index)
+    {
+        Gradient g(value);
+        g.grad[index] = 1.0;
+        return g;
+    }
+
+    /** Get the value part.
+     * @return value part
+     */
+    double getValue() const
+    {
+        return value;
+    }
+
+    /** Get a partial derivative.
+     * @param index index of the free parameter, from 0 to N-1
+     * @return partial derivative with respect to the free parameter
+     */
+    double getPartialDerivative(int index) const
+    {
+        return grad[index];
+    }
+
+    /** {@inheritDoc} */
+    friend Gradient operator + (const Gradient& a, const Gradient& b)
+    {
+        Gradient r(a.value + b.value);
+        for (int i = 0; i < N; ++i) {
+            r.grad[i] = a.grad[i] + b.grad[i];
+        }
+        return r;
+    }
+
+    /** {@inheritDoc} */
+    friend Gradient operator - (const Gradient& a, const Gradient& b)
+    {
+        Gradient r(a.value - b.value);
+        for (int i = 0; i < N; ++i) {
+            r.grad[i] = a.grad[i] - b.grad[i];
+        }
+        return r;
+    }
+
+    /** {@inheritDoc} */
+    friend Gradient operator - (const Gradient& a)
+    {
+        Gradient r(-a.value);
+        for (int i = 0; i < N; ++i) {
+            r.grad[i] = -a.grad[i];
+        }
+        return r;
+    }
+
+    /** {@inheritDoc} */
+    friend Gradient operator * (const Gradient& a, const Gradient& b)
+    {
+        Gradient r(a.value * b.value);
+        for (int i = 0; i < N; ++i) {
+            r.grad[i] = a.grad[i] * b.value + a.value * b.grad[i];
+        }
+        return r;
+    }
+
+    /** {@inheritDoc} */
+    friend Gradient operator * (const Gradient& a, double b)
+    {
+        Gradient r(a.value * b);
+        for (int i = 0; i < N; ++i) {
+            r.grad[i] = a.grad[i] * b;
+        }
+        return r;
+    }
+
+    /** {@inheritDoc} */
+    friend Gradient operator * (double a, const Gradient& b)
+    {
+        return b * a;
+    }
+
+    /** {@inheritDoc} */
+    friend Gradient operator / (const Gradient& a, const Gradient& b)
+    {
+        const double inv = 1.0 / b.value;
+        Gradient r(a.value * inv);
+        for (int i = 0; i < N; ++i) {
+            r.grad[i] = (a.grad[i] - r.value * b.grad[i]) * inv;
+        }
+        return r;
+    }
+
+    /** {@inheritDoc} */
+    friend Gradient operator / (double a, const Gradient& b)
+    {
+        return Gradient(a) / b;
+    }
+
+    /** Square root.
+     * @param a argument
+     * @return square root of a
+     */
+    friend Gradient sqrt(const Gradient& a)
+    {
+        const double s = std::sqrt(a.value);
+        const double d = 0.5 / s;
+        Gradient r(s);
+        for (int i = 0; i < N; ++i) {
+            r.grad[i] = a.grad[i] * d;
+        }
+        return r;
+    }
+
+private:
+    /** Value part. */
+    double value;
+
+    /** Partial derivatives. */
+    double grad[N];
+};
+
+#endif
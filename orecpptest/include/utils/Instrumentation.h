@@ -0,0 +1,204 @@
+#ifndef _INSTRUMENTATION_H_
+#define _INSTRUMENTATION_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <atomic>
+#include <chrono>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define ORECPP_HAS_TSC 1
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define ORECPP_HAS_TSC 1
+#endif
+
+/** Opt-in instrumentation of hot paths.
+ * <p>Hot paths are annotated with the {@code ORECPP_COUNT} and
+ * {@code ORECPP_TIMED_SCOPE} macros. Unless the library is compiled with the
+ * {@code ORECPP_INSTRUMENTATION} macro defined (CMake option of the same name),
+ * these macros expand to nothing and the instrumentation has no cost at all.</p>
+ * <p>When enabled, each thread accumulates call counts and elapsed ticks
+ * (time stamp counter cycles when available, nanoseconds otherwise) in its own
+ * counters, without any synchronization. Totals are gathered from all live
+ * threads and from the threads that already exited. Timed scopes can also
+ * record trace events in a global ring buffer, exported in the Chrome trace
+ * event format (loadable in chrome://tracing or Perfetto), when tracing is
+ * switched on at run time.</p>
+ */
+class Instrumentation
+{
+public:
+    /** Instrumented operations. */
+    enum Counter
+    {
+        /** Calendar date from day offset. */
+        DATE_FROM_OFFSET,
+
+        /** Day offset from calendar date. */
+        DATE_TO_J2000_DAY,
+
+        /** ISO calendar week. */
+        DATE_CALENDAR_WEEK,
+
+        /** Time of day from seconds in day. */
+        TIME_FROM_SECONDS,
+
+        /** Date/time shifted by an offset. */
+        DATE_TIME_SHIFT,
+
+        /** Offset between date/times. */
+        DATE_TIME_OFFSET_FROM,
+
+        /** Leap second lookup. */
+        LEAP_SECOND_LOOKUP,
+
+        /** Number of counters. */
+        NB_COUNTERS
+    };
+
+    /** Scope measuring elapsed ticks of an operation. */
+    class TimedScope
+    {
+    public:
+        /** Start measuring.
+         * @param counter counter to update at scope exit
+         */
+        explicit TimedScope(Counter counter)
+            : counter(counter), start(readTicks()),
+              traceStart(isTracing() ? readNanos() : -1)
+        {
+
+        }
+
+        /** Stop measuring and update the counter. */
+        ~TimedScope()
+        {
+            record(counter, readTicks() - start, traceStart);
+        }
+
+        TimedScope(const TimedScope&) = delete;
+        TimedScope& operator=(const TimedScope&) = delete;
+
+    private:
+        /** Counter to update. */
+        Counter counter;
+
+        /** Ticks at scope entry. */
+        uint64_t start;
+
+        /** Trace clock at scope entry, negative if tracing was off. */
+        int64_t traceStart;
+    };
+
+    /** Get the display name of a counter.
+     * @param counter counter
+     * @return display name
+     */
+    static const char* getName(Counter counter);
+
+    /** Increment the counter of the current thread.
+     * @param counter counter to increment
+     */
+    static void count(Counter counter);
+
+    /** Record one timed operation of the current thread.
+     * @param counter counter to update
+     * @param ticks elapsed ticks
+     * @param traceStart trace clock at operation start, negative if no trace event must be recorded
+     */
+    static void record(Counter counter, uint64_t ticks, int64_t traceStart);
+
+    /** Get the total number of calls, over all threads.
+     * @param counter counter
+     * @return number of calls
+     */
+    static uint64_t getCount(Counter counter);
+
+    /** Get the total elapsed ticks of timed calls, over all threads.
+     * @param counter counter
+     * @return elapsed ticks
+     */
+    static uint64_t getTicks(Counter counter);
+
+    /** Get the tick frequency.
+     * <p>The frequency is calibrated against the steady clock on first call.</p>
+     * @return number of ticks per second
+     */
+    static double getTicksPerSecond();
+
+    /** Reset all counters of all threads.
+     * <p>Updates made concurrently by other threads may be lost.</p>
+     */
+    static void reset();
+
+    /** Write counters, one JSON object per line.
+     * @param out output stream
+     */
+    static void writeReport(FILE* out);
+
+    /** Switch trace events recording on or off.
+     * @param enabled if true, timed scopes record trace events
+     */
+    static void setTracing(bool enabled);
+
+    /** Check if trace events are recorded.
+     * @return true if timed scopes record trace events
+     */
+    static bool isTracing()
+    {
+        return tracing.load(std::memory_order_relaxed);
+    }
+
+    /** Export the trace events in Chrome trace event format.
+     * <p>Only the most recent {@link #TRACE_CAPACITY} events are kept. Events
+     * recorded while exporting may be missing or partially written.</p>
+     * @param path path of the JSON file to write
+     * @return true if the file could be written
+     */
+    static bool exportChromeTrace(const char* path);
+
+    /** Read the ticks counter.
+     * @return current ticks
+     */
+    static uint64_t readTicks()
+    {
+#ifdef ORECPP_HAS_TSC
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(readNanos());
+#endif
+    }
+
+    /** Read the trace clock.
+     * @return nanoseconds from an arbitrary origin
+     */
+    static int64_t readNanos()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    /** Number of trace events kept in the ring buffer. */
+    static const size_t TRACE_CAPACITY = 1 << 16;
+
+private:
+    /** Trace events recording flag. */
+    static std::atomic<bool> tracing;
+};
+
+#ifdef ORECPP_INSTRUMENTATION
+#define ORECPP_INSTRUMENTATION_CONCAT2(a, b) a##b
+#define ORECPP_INSTRUMENTATION_CONCAT(a, b) ORECPP_INSTRUMENTATION_CONCAT2(a, b)
+/** Count one call of an operation. */
+#define ORECPP_COUNT(counter) Instrumentation::count(Instrumentation::counter)
+/** Count and time the enclosing scope. */
+#define ORECPP_TIMED_SCOPE(counter) \
+    Instrumentation::TimedScope ORECPP_INSTRUMENTATION_CONCAT(orecppTimedScope, __LINE__)(Instrumentation::counter)
+#else
+#define ORECPP_COUNT(counter)
+#define ORECPP_TIMED_SCOPE(counter)
+#endif
+
+#endif
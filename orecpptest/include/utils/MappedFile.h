@@ -0,0 +1,85 @@
+#ifndef _MAPPED_FILE_H_
+#define _MAPPED_FILE_H_
+
+#include <stddef.h>
+
+/** Read-only memory mapping of a whole file.
+ * <p>The mapping is released when the instance is closed or destroyed,
+ * so pointers returned by {@link #getData()} must not outlive it.
+ * An empty file is mapped successfully with a null data pointer and
+ * a zero size.</p>
+ * <p>Instances of this class are movable but not copyable.</p>
+ */
+class MappedFile
+{
+public:
+    /** Build an instance not attached to any file. */
+    MappedFile();
+
+    /** Build an instance mapping a file.
+     * @param path path of the file to map
+     * @see #isOpen()
+     */
+    explicit MappedFile(const char* path);
+
+    /** Move constructor.
+     * @param other instance to take the mapping from
+     */
+    MappedFile(MappedFile&& other) noexcept;
+
+    /** Move assignment.
+     * @param other instance to take the mapping from
+     * @return this instance
+     */
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /** Release the mapping. */
+    ~MappedFile();
+
+    /** Map a file, releasing any previous mapping.
+     * @param path path of the file to map
+     * @return true if the file could be opened and mapped
+     */
+    bool open(const char* path);
+
+    /** Release the mapping. */
+    void close();
+
+    /** Check if a file is currently mapped.
+     * @return true if a file is currently mapped
+     */
+    bool isOpen() const;
+
+    /** Get the mapped bytes.
+     * @return pointer to the first mapped byte (null for empty files)
+     */
+    const char* getData() const;
+
+    /** Get the number of mapped bytes.
+     * @return number of mapped bytes
+     */
+    size_t getSize() const;
+
+    /** Hint the system that the mapping will be read sequentially. */
+    void adviseSequential() const;
+
+private:
+    /** First mapped byte. */
+    const char* data;
+
+    /** Number of mapped bytes. */
+    size_t size;
+
+    /** Open flag. */
+    bool opened;
+
+#ifdef _WIN32
+    /** File mapping handle. */
+    void* mapping;
+#endif
+};
+
+#endif
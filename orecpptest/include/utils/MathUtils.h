@@ -0,0 +1,36 @@
+#ifndef _MATH_UTILS_H_
+#define _MATH_UTILS_H_
+
+#include <cmath>
+
+namespace MathUtils {
+    /** Archimede's constant PI, ratio of circle circumference to diameter. */
+    constexpr double PI = 3.141592653589793238462643383279502884;
+
+    /** 2 &pi;. */
+    constexpr double TWO_PI = 2 * PI;
+
+    /** &pi;/2. */
+    constexpr double SEMI_PI = 0.5 * PI;
+
+    /** Normalize an angle in a 2&pi; wide interval around a center value.
+     * <p>This method has three main uses:</p>
+     * <ul>
+     *   <li>normalize an angle between 0 and 2&pi;:<br>
+     *       <code>a = MathUtils::normalizeAngle(a, MathUtils::PI);</code></li>
+     *   <li>normalize an angle between -&pi; and +&pi;<br>
+     *       <code>a = MathUtils::normalizeAngle(a, 0.0);</code></li>
+     *   <li>compute the angle between two defining angular positions:<br>
+     *       <code>angle = MathUtils::normalizeAngle(end, start) - start;</code></li>
+     * </ul>
+     * @param a angle to normalize
+     * @param center center of the desired 2&pi; interval for the result
+     * @return a-2k&pi; with integer k and center-&pi; &lt;= a-2k&pi; &lt;= center+&pi;
+     */
+    inline double normalizeAngle(double a, double center)
+    {
+        return a - TWO_PI * std::floor((a + PI - center) / TWO_PI);
+    }
+};
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef _PV_COORDINATES_H_
+#define _PV_COORDINATES_H_
+
+#include "geometry/Vector3D.h"
+
+/** Simple container for Position/Velocity pairs.
+ * <p>Instances of this class are guaranteed to be immutable.</p>
+ */
+class PVCoordinates
+{
+public:
+    /** Build a null instance, at origin with null velocity. */
+    PVCoordinates();
+
+    /** Build a position/velocity pair.
+     * @param position position (m)
+     * @param velocity velocity (m/s)
+     */
+    PVCoordinates(const Vector3D& position, const Vector3D& velocity);
+
+    /** Get the position.
+     * @return position (m)
+     */
+    const Vector3D& getPosition() const;
+
+    /** Get the velocity.
+     * @return velocity (m/s)
+     */
+    const Vector3D& getVelocity() const;
+
+    /** Get the angular momentum.
+     * <p>This vector is the p &otimes; v where p is position, v is velocity
+     * and &otimes; is cross product. To get the real physical angular momentum
+     * you need to multiply this vector by the mass.</p>
+     * @return angular momentum (m²/s)
+     */
+    Vector3D getMomentum() const;
+
+    /** Get a time-shifted state, assuming constant velocity.
+     * @param dt time shift (s)
+     * @return shifted state
+     */
+    PVCoordinates shiftedBy(double dt) const;
+
+    /** Fixed position at origin (both position and velocity are zero vectors). */
+    static const PVCoordinates ZERO;
+
+private:
+    /** Position (m). */
+    Vector3D position;
+
+    /** Velocity (m/s). */
+    Vector3D velocity;
+};
+
+#endif
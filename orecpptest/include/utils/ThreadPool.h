@@ -0,0 +1,170 @@
+#ifndef _THREAD_POOL_H_
+#define _THREAD_POOL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/** Small work-stealing thread pool for data-parallel loops.
+ * <p>The pool runs one {@link #parallelFor(size_t, size_t, const Body&) loop}
+ * at a time. The index range of a loop is cut into chunks, and the chunks
+ * are initially dealt as contiguous ranges, one per participant (the pool
+ * threads and the calling thread). Each participant consumes its range from
+ * the front; once it is empty, it steals the back half of the range of
+ * another participant. Ranges are packed in single atomic words, so taking
+ * and stealing are lock-free.</p>
+ * <p>The body is called with disjoint index ranges, each element is
+ * processed exactly once, and the call returns when all elements have been
+ * processed. As long as the body writes the result of element i at
+ * position i, the output does not depend on the number of threads nor on
+ * the scheduling.</p>
+ * <p>A loop started from inside the body of a loop of the same pool is run
+ * sequentially by the calling thread. Loops started concurrently from
+ * several threads are serialized.</p>
+ */
+class ThreadPool
+{
+public:
+    /** Build a pool.
+     * @param nbThreads total number of threads running the loops, including
+     * the calling thread (0 for one per hardware thread)
+     */
+    explicit ThreadPool(unsigned nbThreads = 0);
+
+    /** Stop the pool threads. */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /** Get the number of threads running the loops.
+     * @return number of threads, including the calling thread
+     */
+    unsigned getNbThreads() const;
+
+    /** Run a loop in parallel.
+     * @param count number of elements
+     * @param chunkSize number of elements per chunk (at least 1), see {@link #getChunkSize(size_t)}
+     * @param body function called as <code>body(begin, end)</code> for each chunk of elements
+     * @param Body type of the body
+     */
+    template <typename Body>
+    void parallelFor(size_t count, size_t chunkSize, const Body& body)
+    {
+        run(count, chunkSize, &invoke<Body>, &body);
+    }
+
+    /** Get a chunk size fitting in the first level data cache.
+     * @param bytesPerElement number of bytes read and written per element
+     * @return number of elements per chunk
+     */
+    static size_t getChunkSize(size_t bytesPerElement);
+
+    /** Target number of bytes touched per chunk. */
+    static const size_t CHUNK_BYTES = 32768;
+
+private:
+    /** Type-erased call of a loop body.
+     * @param body loop body
+     * @param begin index of the first element of the chunk
+     * @param end index after the last element of the chunk
+     */
+    typedef void (*Invoker)(const void* body, size_t begin, size_t end);
+
+    /** Call a loop body.
+     * {@inheritDoc}
+     * @param Body type of the body
+     */
+    template <typename Body>
+    static void invoke(const void* body, size_t begin, size_t end)
+    {
+        (*static_cast<const Body*>(body))(begin, end);
+    }
+
+    /** Run a loop in parallel.
+     * @param count number of elements
+     * @param chunkSize number of elements per chunk
+     * @param invoker type-erased call of the body
+     * @param body loop body
+     */
+    void run(size_t count, size_t chunkSize, Invoker invoker, const void* body);
+
+    /** Main loop of a pool thread.
+     * @param index index of the thread participant
+     */
+    void work(unsigned index);
+
+    /** Process chunks of the current loop until none is left.
+     * @param index index of the participant
+     */
+    void participate(unsigned index);
+
+    /** Take the next chunk of a participant own range.
+     * @param index index of the participant
+     * @param chunk placeholder for the chunk index
+     * @return true if a chunk was taken
+     */
+    bool take(unsigned index, uint32_t& chunk);
+
+    /** Steal chunks from the range of another participant.
+     * <p>The first stolen chunk is returned, the other ones become the
+     * range of the thief.</p>
+     * @param index index of the thief participant
+     * @param chunk placeholder for the chunk index
+     * @return true if a chunk was stolen
+     */
+    bool steal(unsigned index, uint32_t& chunk);
+
+    /** Chunks range of one participant, packed as first | (end << 32). */
+    struct alignas(64) Range
+    {
+        /** Packed range. */
+        std::atomic<uint64_t> bounds;
+    };
+
+    /** Pool threads. */
+    std::vector<std::thread> threads;
+
+    /** Chunks ranges, one per participant (the calling thread is the last one). */
+    std::unique_ptr<Range[]> ranges;
+
+    /** Lock serializing the loops. */
+    std::mutex submitLock;
+
+    /** Lock protecting the loop hand-off. */
+    std::mutex lock;
+
+    /** Condition signaled when a loop starts or the pool stops. */
+    std::condition_variable started;
+
+    /** Condition signaled when all pool threads left the loop. */
+    std::condition_variable finished;
+
+    /** Loop counter. */
+    uint64_t generation;
+
+    /** Number of pool threads still in the current loop. */
+    unsigned pending;
+
+    /** Indicator for pool destruction. */
+    bool stopping;
+
+    /** Body of the current loop. */
+    Invoker invoker;
+
+    /** Body of the current loop. */
+    const void* body;
+
+    /** Number of elements of the current loop. */
+    size_t count;
+
+    /** Chunk size of the current loop. */
+    size_t chunkSize;
+};
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef _TIME_STAMPED_GENERATOR_H_
+#define _TIME_STAMPED_GENERATOR_H_
+
+#include <vector>
+#include "time/LinearTime.h"
+
+/** Generator to use for creating entries in {@link GenericTimeStampedCache time stamped caches}.
+ * <p>Generators may be called concurrently by several caches, they must
+ * therefore be thread-safe if they are shared.</p>
+ * @param T type of the cached data, which must provide a
+ * <code>LinearTime getDate() const</code> method
+ * @see GenericTimeStampedCache
+ */
+template<typename T>
+class TimeStampedGenerator
+{
+public:
+    virtual ~TimeStampedGenerator() = default;
+
+    /** Generate entries to be cached.
+     * <p>The generated entries must be sorted chronologically and should cover
+     * the whole [start, end] range, typically with one entry at or before start
+     * and one entry at or after end. Returning fewer entries tells the cache the
+     * underlying data does not extend that far.</p>
+     * @param start start of the range to cover
+     * @param end end of the range to cover
+     * @return chronologically sorted entries
+     */
+    virtual std::vector<T> generate(const LinearTime& start, const LinearTime& end) const = 0;
+};
+
+#endif
@@ -0,0 +1,27 @@
+#include "bodies/GeodeticPoint.h"
+
+GeodeticPoint::GeodeticPoint(double latitude, double longitude, double altitude)
+    : latitude(latitude), longitude(longitude), altitude(altitude)
+{
+
+}
+
+double GeodeticPoint::getLatitude() const
+{
+    return latitude;
+}
+
+double GeodeticPoint::getLongitude() const
+{
+    return longitude;
+}
+
+double GeodeticPoint::getAltitude() const
+{
+    return altitude;
+}
+
+bool GeodeticPoint::operator==(const GeodeticPoint& other) const
+{
+    return latitude == other.latitude && longitude == other.longitude && altitude == other.altitude;
+}
@@ -0,0 +1,82 @@
+#include "bodies/LowPrecisionEphemeris.h"
+#include "utils/MathUtils.h"
+#include <cmath>
+
+namespace {
+
+    /** Conversion from degrees to radians. */
+    const double DEG = MathUtils::PI / 180.0;
+
+    /** Conversion from arc seconds to radians. */
+    const double ARC_SECOND = DEG / 3600.0;
+
+    /** Obliquity of the ecliptic at J2000. */
+    const double OBLIQUITY = 23.43929111 * DEG;
+
+    /** Compute the Julian centuries since J2000.0.
+     * @param date date
+     * @return Julian centuries since 2000-01-01T12:00
+     */
+    double centuries(const LinearTime& date)
+    {
+        return (static_cast<double>(date.getNanos()) / LinearTime::NANOS_PER_DAY - 0.5) / 36525.0;
+    }
+
+    /** Convert ecliptic coordinates to equatorial ones.
+     * @param r distance (m)
+     * @param lambda ecliptic longitude (rad)
+     * @param beta ecliptic latitude (rad)
+     * @return position in EME2000 (m)
+     */
+    Vector3D toEquatorial(double r, double lambda, double beta)
+    {
+        const double x = r * std::cos(lambda) * std::cos(beta);
+        const double y = r * std::sin(lambda) * std::cos(beta);
+        const double z = r * std::sin(beta);
+        const double cosE = std::cos(OBLIQUITY);
+        const double sinE = std::sin(OBLIQUITY);
+        return Vector3D(x, cosE * y - sinE * z, sinE * y + cosE * z);
+    }
+
+}
+
+Vector3D LowPrecisionEphemeris::getSunPosition(const LinearTime& date)
+{
+    const double t = centuries(date);
+    const double m = (357.5256 + 35999.049 * t) * DEG;
+    const double lambda = 282.94 * DEG + m + (6892.0 * std::sin(m) + 72.0 * std::sin(2 * m)) * ARC_SECOND;
+    const double r = (149.619 - 2.499 * std::cos(m) - 0.021 * std::cos(2 * m)) * 1.0e9;
+    return toEquatorial(r, lambda, 0.0);
+}
+
+Vector3D LowPrecisionEphemeris::getMoonPosition(const LinearTime& date)
+{
+    const double t = centuries(date);
+
+    // mean longitude (referred to the J2000 equinox), mean anomalies of Moon and Sun,
+    // mean argument of latitude and mean elongation
+    const double l0 = (218.31617 + 481267.88088 * t - 1.3972 * t) * DEG;
+    const double l  = (134.96292 + 477198.86753 * t) * DEG;
+    const double lp = (357.52543 + 35999.04944 * t) * DEG;
+    const double f  = (93.27283 + 483202.01873 * t) * DEG;
+    const double d  = (297.85027 + 445267.11135 * t) * DEG;
+
+    const double dLambda = (22640.0 * std::sin(l) + 769.0 * std::sin(2 * l) -
+                            4586.0 * std::sin(l - 2 * d) + 2370.0 * std::sin(2 * d) -
+                            668.0 * std::sin(lp) - 412.0 * std::sin(2 * f) -
+                            212.0 * std::sin(2 * l - 2 * d) - 206.0 * std::sin(l + lp - 2 * d) +
+                            192.0 * std::sin(l + 2 * d) - 165.0 * std::sin(lp - 2 * d) +
+                            148.0 * std::sin(l - lp) - 125.0 * std::sin(d) -
+                            110.0 * std::sin(l + lp) - 55.0 * std::sin(2 * f - 2 * d)) * ARC_SECOND;
+    const double lambda = l0 + dLambda;
+    const double beta = (18520.0 * std::sin(f + dLambda + (412.0 * std::sin(2 * f) + 541.0 * std::sin(lp)) * ARC_SECOND) -
+                         526.0 * std::sin(f - 2 * d) + 44.0 * std::sin(l + f - 2 * d) -
+                         31.0 * std::sin(-l + f - 2 * d) - 25.0 * std::sin(-2 * l + f) -
+                         23.0 * std::sin(lp + f - 2 * d) + 21.0 * std::sin(-l + f) +
+                         11.0 * std::sin(-lp + f - 2 * d)) * ARC_SECOND;
+    const double r = (385000.0 - 20905.0 * std::cos(l) - 3699.0 * std::cos(2 * d - l) -
+                      2956.0 * std::cos(2 * d) - 570.0 * std::cos(2 * l) + 246.0 * std::cos(2 * l - 2 * d) -
+                      205.0 * std::cos(lp - 2 * d) - 171.0 * std::cos(l + 2 * d) -
+                      152.0 * std::cos(l + lp - 2 * d)) * 1.0e3;
+    return toEquatorial(r, lambda, beta);
+}
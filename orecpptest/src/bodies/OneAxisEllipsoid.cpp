@@ -0,0 +1,49 @@
+#include "bodies/OneAxisEllipsoid.h"
+#include "bodies/GeodeticKernels.h"
+
+OneAxisEllipsoid::OneAxisEllipsoid(double ae, double f)
+    : ae(ae), f(f), e2(f * (2.0 - f))
+{
+
+}
+
+double OneAxisEllipsoid::getEquatorialRadius() const
+{
+    return ae;
+}
+
+double OneAxisEllipsoid::getFlattening() const
+{
+    return f;
+}
+
+double OneAxisEllipsoid::getPolarRadius() const
+{
+    return ae * (1.0 - f);
+}
+
+Vector3D OneAxisEllipsoid::transform(const GeodeticPoint& point) const
+{
+    double x, y, z;
+    GeodeticKernels::toCartesian(ae, e2, point.getLatitude(), point.getLongitude(), point.getAltitude(), x, y, z);
+    return Vector3D(x, y, z);
+}
+
+GeodeticPoint OneAxisEllipsoid::transform(const Vector3D& point) const
+{
+    double latitude, longitude, altitude;
+    GeodeticKernels::toGeodetic(ae, e2, point.getX(), point.getY(), point.getZ(), latitude, longitude, altitude);
+    return GeodeticPoint(latitude, longitude, altitude);
+}
+
+void OneAxisEllipsoid::toCartesian(const double* latitudes, const double* longitudes, const double* altitudes,
+                                   size_t count, double* x, double* y, double* z) const
+{
+    GeodeticKernels::toCartesian(ae, e2, latitudes, longitudes, altitudes, count, x, y, z);
+}
+
+void OneAxisEllipsoid::toGeodetic(const double* x, const double* y, const double* z, size_t count,
+                                  double* latitudes, double* longitudes, double* altitudes) const
+{
+    GeodeticKernels::toGeodetic(ae, e2, x, y, z, count, latitudes, longitudes, altitudes);
+}
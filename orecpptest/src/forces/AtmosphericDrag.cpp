@@ -0,0 +1,32 @@
+#include "forces/AtmosphericDrag.h"
+#include <cmath>
+
+AtmosphericDrag::AtmosphericDrag(double bodyRadius, double rotationRate,
+                                 double referenceDensity, double referenceAltitude, double scaleHeight,
+                                 double dragCoefficient, double crossSection, double mass)
+    : bodyRadius(bodyRadius), rotationRate(rotationRate),
+      referenceDensity(referenceDensity), referenceAltitude(referenceAltitude), scaleHeight(scaleHeight),
+      ballisticFactor(0.5 * dragCoefficient * crossSection / mass)
+{
+
+}
+
+double AtmosphericDrag::getDensity(double altitude) const
+{
+    return referenceDensity * std::exp((referenceAltitude - altitude) / scaleHeight);
+}
+
+void AtmosphericDrag::addAcceleration(const LinearTime&, const double* state, double* acceleration) const
+{
+    const double r   = std::sqrt(state[0] * state[0] + state[1] * state[1] + state[2] * state[2]);
+    const double rho = getDensity(r - bodyRadius);
+
+    // velocity relative to the atmosphere, v - ω × r with ω along Z
+    const double vx = state[3] + rotationRate * state[1];
+    const double vy = state[4] - rotationRate * state[0];
+    const double vz = state[5];
+    const double k  = -ballisticFactor * rho * std::sqrt(vx * vx + vy * vy + vz * vz);
+    acceleration[0] += k * vx;
+    acceleration[1] += k * vy;
+    acceleration[2] += k * vz;
+}
@@ -0,0 +1,412 @@
+#include "forces/GravityFieldReader.h"
+#include "utils/MappedFile.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+    /** Maximal number of fields used from one line. */
+    const int MAX_FIELDS = 6;
+
+    /** Maximal length of a numeric field. */
+    const size_t MAX_NUMBER_LENGTH = 63;
+
+    /** Line split in whitespace separated fields. */
+    struct Fields
+    {
+        /** First character of each field. */
+        const char* begin[MAX_FIELDS];
+
+        /** Character after the last one of each field. */
+        const char* end[MAX_FIELDS];
+
+        /** Number of fields found (at most MAX_FIELDS). */
+        int count;
+
+        /** Check if a field is equal to a keyword.
+         * @param i field index
+         * @param keyword keyword to check
+         * @return true if the field is the keyword
+         */
+        bool is(int i, const char* keyword) const
+        {
+            const size_t length = std::strlen(keyword);
+            return i < count && static_cast<size_t>(end[i] - begin[i]) == length &&
+                   std::memcmp(begin[i], keyword, length) == 0;
+        }
+    };
+
+    /** Split a line into fields.
+     * @param begin first character of the line
+     * @param end character after the last one
+     * @param fields placeholder for the fields
+     */
+    void split(const char* begin, const char* end, Fields& fields)
+    {
+        fields.count = 0;
+        const char* p = begin;
+        while (fields.count < MAX_FIELDS) {
+            while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) {
+                ++p;
+            }
+            if (p == end) {
+                return;
+            }
+            fields.begin[fields.count] = p;
+            while (p < end && *p != ' ' && *p != '\t' && *p != '\r') {
+                ++p;
+            }
+            fields.end[fields.count++] = p;
+        }
+    }
+
+    /** Parse a floating point field, accepting Fortran exponents.
+     * @param fields line fields
+     * @param i field index
+     * @param value placeholder for the value
+     * @return true if the field is a number
+     */
+    bool parseDouble(const Fields& fields, int i, double& value)
+    {
+        if (i >= fields.count) {
+            return false;
+        }
+        const size_t length = fields.end[i] - fields.begin[i];
+        if (length > MAX_NUMBER_LENGTH) {
+            return false;
+        }
+        char buffer[MAX_NUMBER_LENGTH + 1];
+        for (size_t k = 0; k < length; ++k) {
+            const char ch = fields.begin[i][k];
+            buffer[k] = (ch == 'D' || ch == 'd') ? 'E' : ch;
+        }
+        buffer[length] = '\0';
+        char* last;
+        value = std::strtod(buffer, &last);
+        return last == buffer + length;
+    }
+
+    /** Parse a non-negative integer field.
+     * @param fields line fields
+     * @param i field index
+     * @param value placeholder for the value
+     * @return true if the field is a non-negative integer
+     */
+    bool parseInt(const Fields& fields, int i, int& value)
+    {
+        if (i >= fields.count || fields.begin[i] == fields.end[i]) {
+            return false;
+        }
+        value = 0;
+        for (const char* p = fields.begin[i]; p < fields.end[i]; ++p) {
+            if (*p < '0' || *p > '9' || value > 100000) {
+                return false;
+            }
+            value = 10 * value + (*p - '0');
+        }
+        return true;
+    }
+
+    /** Coefficients gathered while parsing. */
+    class Coefficients
+    {
+    public:
+        /** Simple constructor.
+         * @param maxDegree maximal degree to keep
+         * @param maxOrder maximal order to keep
+         */
+        Coefficients(int maxDegree, int maxOrder)
+            : maxDegree(maxDegree), maxOrder(maxOrder), degree(-1), order(0)
+        {
+
+        }
+
+        /** Reserve room for the coefficients announced by a header.
+         * @param fileDegree degree of the file
+         */
+        void reserve(int fileDegree)
+        {
+            grow(std::min(fileDegree, maxDegree));
+        }
+
+        /** Add one coefficient, if within the kept degree and order.
+         * @param n degree
+         * @param m order
+         * @param cnm cosine coefficient
+         * @param snm sine coefficient
+         * @return false if the order is larger than the degree
+         */
+        bool add(int n, int m, double cnm, double snm)
+        {
+            if (m > n) {
+                return false;
+            }
+            if (n > maxDegree || m > maxOrder) {
+                return true;
+            }
+            grow(n);
+            const size_t k = static_cast<size_t>(n) * (n + 1) / 2 + m;
+            c[k] = cnm;
+            s[k] = snm;
+            degree = std::max(degree, n);
+            order  = std::max(order, m);
+            return true;
+        }
+
+        /** Convert un-normalized coefficients to fully normalized ones. */
+        void normalize()
+        {
+            for (int n = 0; n <= degree; ++n) {
+                for (int m = 0; m <= n; ++m) {
+                    // N = √((2 - δm0) (2n + 1) (n - m)! / (n + m)!), evaluated in logarithms
+                    const double logFactor = 0.5 * (std::log((m == 0 ? 1.0 : 2.0) * (2.0 * n + 1.0)) +
+                                                    std::lgamma(n - m + 1.0) - std::lgamma(n + m + 1.0));
+                    const double inverse = std::exp(-logFactor);
+                    const size_t k = static_cast<size_t>(n) * (n + 1) / 2 + m;
+                    c[k] *= inverse;
+                    s[k] *= inverse;
+                }
+            }
+        }
+
+        /** Build the field.
+         * @param ae equatorial radius (m)
+         * @param mu gravitational constant (m³/s²)
+         * @return field
+         */
+        SphericalHarmonicsField build(double ae, double mu) const
+        {
+            if (degree < 0) {
+                return SphericalHarmonicsField();
+            }
+            return SphericalHarmonicsField(ae, mu, degree, std::min(order, degree), c.data(), s.data());
+        }
+
+    private:
+        /** Grow the triangular arrays.
+         * @param n degree to hold
+         */
+        void grow(int n)
+        {
+            const size_t size = static_cast<size_t>(n + 1) * (n + 2) / 2;
+            if (c.size() < size) {
+                c.resize(size, 0.0);
+                s.resize(size, 0.0);
+            }
+        }
+
+        /** Maximal degree to keep. */
+        int maxDegree;
+
+        /** Maximal order to keep. */
+        int maxOrder;
+
+        /** Largest degree found. */
+        int degree;
+
+        /** Largest order found. */
+        int order;
+
+        /** Cosine coefficients, triangular row major. */
+        std::vector<double> c;
+
+        /** Sine coefficients, triangular row major. */
+        std::vector<double> s;
+    };
+
+    /** Get the end of the line starting at some point.
+     * @param p first character of the line
+     * @param end end of data
+     * @return end of line (newline character or end of data)
+     */
+    inline const char* endOfLine(const char* p, const char* end)
+    {
+        const char* newline = static_cast<const char*>(std::memchr(p, '\n', end - p));
+        return (newline == nullptr) ? end : newline;
+    }
+
+    /** Parse ICGEM data.
+     * @param begin first character
+     * @param end character after the last one
+     * @param coefficients coefficients to fill
+     * @param ae placeholder for the equatorial radius
+     * @param mu placeholder for the gravitational constant
+     * @return true if the data could be parsed
+     */
+    bool parseICGEM(const char* begin, const char* end, Coefficients& coefficients, double& ae, double& mu)
+    {
+        bool inHeader = true;
+        bool hasAe = false;
+        bool hasMu = false;
+        bool normalized = true;
+        Fields fields;
+        for (const char* line = begin; line < end; ) {
+            const char* eol = endOfLine(line, end);
+            split(line, eol, fields);
+            line = eol + 1;
+            if (fields.count == 0) {
+                continue;
+            }
+            if (inHeader) {
+                if (fields.is(0, "end_of_head")) {
+                    if (!(hasAe && hasMu)) {
+                        return false;
+                    }
+                    inHeader = false;
+                }
+                else if (fields.is(0, "earth_gravity_constant") || fields.is(0, "gravity_constant")) {
+                    hasMu = parseDouble(fields, 1, mu);
+                }
+                else if (fields.is(0, "radius")) {
+                    hasAe = parseDouble(fields, 1, ae);
+                }
+                else if (fields.is(0, "max_degree")) {
+                    int fileDegree;
+                    if (parseInt(fields, 1, fileDegree)) {
+                        coefficients.reserve(fileDegree);
+                    }
+                }
+                else if (fields.is(0, "norm")) {
+                    normalized = !fields.is(1, "unnormalized");
+                }
+                continue;
+            }
+            if (fields.is(0, "gfc") || fields.is(0, "gfct")) {
+                int n, m;
+                double cnm, snm;
+                if (!parseInt(fields, 1, n) || !parseInt(fields, 2, m) ||
+                    !parseDouble(fields, 3, cnm) || !parseDouble(fields, 4, snm) ||
+                    !coefficients.add(n, m, cnm, snm)) {
+                    return false;
+                }
+            }
+        }
+        if (inHeader) {
+            return false;
+        }
+        if (!normalized) {
+            coefficients.normalize();
+        }
+        return true;
+    }
+
+    /** Parse SHM data.
+     * @param begin first character
+     * @param end character after the last one
+     * @param coefficients coefficients to fill
+     * @param ae placeholder for the equatorial radius
+     * @param mu placeholder for the gravitational constant
+     * @return true if the data could be parsed
+     */
+    bool parseSHM(const char* begin, const char* end, Coefficients& coefficients, double& ae, double& mu)
+    {
+        bool first = true;
+        bool hasEarth = false;
+        Fields fields;
+        for (const char* line = begin; line < end; ) {
+            const char* eol = endOfLine(line, end);
+            split(line, eol, fields);
+            line = eol + 1;
+            if (fields.count == 0) {
+                continue;
+            }
+            if (first) {
+                if (!fields.is(0, "FIRST") || !fields.is(1, "SHM")) {
+                    return false;
+                }
+                int fileDegree;
+                if (parseInt(fields, 2, fileDegree)) {
+                    coefficients.reserve(fileDegree);
+                }
+                first = false;
+            }
+            else if (fields.is(0, "EARTH")) {
+                hasEarth = parseDouble(fields, 1, mu) && parseDouble(fields, 2, ae);
+                if (!hasEarth) {
+                    return false;
+                }
+            }
+            else if (fields.is(0, "RECOEF")) {
+                int n, m;
+                double cnm, snm;
+                if (!parseInt(fields, 1, n) || !parseInt(fields, 2, m) ||
+                    !parseDouble(fields, 3, cnm) || !parseDouble(fields, 4, snm) ||
+                    !coefficients.add(n, m, cnm, snm)) {
+                    return false;
+                }
+            }
+        }
+        return hasEarth;
+    }
+
+}
+
+bool GravityFieldReader::read(const char* path, Format format, int maxDegree, int maxOrder,
+                              SphericalHarmonicsField& field)
+{
+    MappedFile file(path);
+    if (!file.isOpen()) {
+        return false;
+    }
+    file.adviseSequential();
+    return parse(file.getData(), file.getData() + file.getSize(), format, maxDegree, maxOrder, field);
+}
+
+bool GravityFieldReader::parse(const char* begin, const char* end, Format format, int maxDegree, int maxOrder,
+                               SphericalHarmonicsField& field)
+{
+    if (begin == nullptr || maxDegree < 0 || maxOrder < 0) {
+        return false;
+    }
+    if (format == AUTO) {
+        format = detect(begin, end);
+    }
+    Coefficients coefficients(maxDegree, maxOrder);
+    double ae = 0;
+    double mu = 0;
+    bool parsed;
+    switch (format) {
+        case ICGEM:
+            parsed = parseICGEM(begin, end, coefficients, ae, mu);
+            break;
+        case SHM:
+            parsed = parseSHM(begin, end, coefficients, ae, mu);
+            break;
+        default:
+            parsed = false;
+            break;
+    }
+    if (!parsed) {
+        return false;
+    }
+    field = coefficients.build(ae, mu);
+    return true;
+}
+
+GravityFieldReader::Format GravityFieldReader::detect(const char* begin, const char* end)
+{
+    // the first non empty line tells SHM apart, ICGEM headers have free text before their keywords
+    Fields fields;
+    for (const char* line = begin; line != nullptr && line < end; ) {
+        const char* eol = endOfLine(line, end);
+        split(line, eol, fields);
+        line = eol + 1;
+        if (fields.count == 0) {
+            continue;
+        }
+        if (fields.is(0, "FIRST") && fields.is(1, "SHM")) {
+            return SHM;
+        }
+        if (fields.is(0, "end_of_head") || fields.is(0, "product_type") ||
+            fields.is(0, "earth_gravity_constant") || fields.is(0, "begin_of_head")) {
+            return ICGEM;
+        }
+        if (fields.is(0, "gfc") || fields.is(0, "RECOEF")) {
+            break;
+        }
+    }
+    return AUTO;
+}
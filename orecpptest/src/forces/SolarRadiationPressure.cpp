@@ -0,0 +1,111 @@
+#include "forces/SolarRadiationPressure.h"
+#include "bodies/LowPrecisionEphemeris.h"
+#include "utils/Constants.h"
+#include "utils/MathUtils.h"
+#include <cmath>
+
+namespace {
+
+    /** Compute an arc cosine, clamping rounding errors on the argument.
+     * @param x cosine, possibly slightly out of [-1, 1]
+     * @return arc cosine
+     */
+    double safeAcos(double x)
+    {
+        return std::acos((x < -1) ? -1 : (x > 1) ? 1 : x);
+    }
+
+}
+
+SolarRadiationPressure::SolarRadiationPressure(double reflectivityCoefficient, double crossSection, double mass,
+                                               double occultingRadius)
+    : factor(reflectivityCoefficient * crossSection / mass * REFERENCE_PRESSURE *
+             Constants::IAU_2012_ASTRONOMICAL_UNIT * Constants::IAU_2012_ASTRONOMICAL_UNIT),
+      occultingRadius(occultingRadius)
+{
+
+}
+
+void SolarRadiationPressure::computeAngles(const Vector3D& position, const Vector3D& sun,
+                                           double& a, double& b, double& c) const
+{
+    const Vector3D toSun = sun.subtract(position);
+    const double r = position.getNorm();
+    const double d = toSun.getNorm();
+    a = std::asin(Constants::IAU_2015_NOMINAL_SOLAR_RADIUS / d);
+    b = std::asin(occultingRadius / r);
+    c = safeAcos(-position.dotProduct(toSun) / (r * d));
+}
+
+double SolarRadiationPressure::getLightingRatio(const Vector3D& position, const Vector3D& sun) const
+{
+    double a, b, c;
+    computeAngles(position, sun, a, b, c);
+
+    if (c >= a + b) {
+        // full light
+        return 1.0;
+    }
+    if (c <= b - a) {
+        // umbra
+        return 0.0;
+    }
+    if (c <= a - b) {
+        // annular eclipse
+        return 1.0 - (b * b) / (a * a);
+    }
+
+    // penumbra, area of the overlap of the two disks
+    const double x = (c * c + a * a - b * b) / (2 * c);
+    const double y = std::sqrt(std::fmax(0.0, a * a - x * x));
+    const double area = a * a * safeAcos(x / a) + b * b * safeAcos((c - x) / b) - c * y;
+    return 1.0 - area / (MathUtils::PI * a * a);
+}
+
+void SolarRadiationPressure::addAcceleration(const LinearTime& date, const double* state, double* acceleration) const
+{
+    const Vector3D sun = LowPrecisionEphemeris::getSunPosition(date);
+    const Vector3D position(state[0], state[1], state[2]);
+    const double ratio = getLightingRatio(position, sun);
+    if (ratio == 0) {
+        return;
+    }
+
+    const double dx = state[0] - sun.getX();
+    const double dy = state[1] - sun.getY();
+    const double dz = state[2] - sun.getZ();
+    const double d2 = dx * dx + dy * dy + dz * dz;
+    const double k  = ratio * factor / (d2 * std::sqrt(d2));
+    acceleration[0] += k * dx;
+    acceleration[1] += k * dy;
+    acceleration[2] += k * dz;
+}
+
+double SolarRadiationPressure::getMaxStep(const LinearTime& date, const double* state) const
+{
+    double a, b, c;
+    const Vector3D position(state[0], state[1], state[2]);
+    const Vector3D sun = LowPrecisionEphemeris::getSunPosition(date);
+    computeAngles(position, sun, a, b, c);
+
+    // the Sun direction is almost fixed over a step, the separation c changes with the
+    // direction of the position, which turns at most at the rate ω = |v| / r
+    const double r2 = position.getNormSq();
+    const double v2 = state[3] * state[3] + state[4] * state[4] + state[5] * state[5];
+    const double omega2 = v2 / r2;
+    const double omega  = std::sqrt(omega2);
+
+    // current rate of c, from cos c = -û.ŝ where û is the position direction
+    const double r = std::sqrt(r2);
+    const double rv = (state[0] * state[3] + state[1] * state[4] + state[2] * state[5]) / r2;
+    const Vector3D uDot((state[3] - rv * state[0]) / r, (state[4] - rv * state[1]) / r,
+                        (state[5] - rv * state[2]) / r);
+    const double sinC = std::sin(c);
+    const double slope = uDot.dotProduct(sun) / sun.getNorm();
+    const double cDot = (std::fabs(slope) < omega * sinC) ? std::fabs(slope) / sinC : omega;
+
+    // time to travel to the nearest boundary of the penumbra with c̈ bounded by ω²,
+    // the penumbra being crossed in a few steps
+    const double distance = std::fmax(std::fmin(std::fabs(c - (a + b)), std::fabs(c - std::fabs(b - a))), 0.5 * a);
+    return 2 * distance / (cDot + std::sqrt(cDot * cDot + 2 * omega2 * distance));
+}
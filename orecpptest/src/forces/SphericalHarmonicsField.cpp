@@ -0,0 +1,284 @@
+#include "forces/SphericalHarmonicsField.h"
+#include <algorithm>
+#include <cmath>
+
+SphericalHarmonicsField::SphericalHarmonicsField()
+    : ae(1.0), mu(0.0), degree(0), order(0), columns(0)
+{
+
+}
+
+SphericalHarmonicsField::SphericalHarmonicsField(double ae, double mu, int degree, int order,
+                                                 const double* normalizedC, const double* normalizedS)
+    : ae(ae), mu(mu), degree(std::max(0, degree)), order(std::max(0, std::min(order, degree)))
+{
+    const size_t size = static_cast<size_t>(this->degree + 1) * (this->degree + 2) / 2;
+    this->normalizedC.assign(normalizedC, normalizedC + size);
+    this->normalizedS.assign(normalizedS, normalizedS + size);
+    for (int n = 0; n <= this->degree; ++n) {
+        for (int m = this->order + 1; m <= n; ++m) {
+            this->normalizedC[n * (n + 1) / 2 + m] = 0.0;
+            this->normalizedS[n * (n + 1) / 2 + m] = 0.0;
+        }
+    }
+
+    // the latitude derivatives of order m terms involve the order m + 1 Legendre functions
+    columns = std::min(this->order + 1, this->degree) + 1;
+    columnStart.resize(columns + 1);
+    columnStart[0] = 0;
+    for (int m = 0; m < columns; ++m) {
+        columnStart[m + 1] = columnStart[m] + (this->degree - m + 1);
+    }
+
+    sectorial.assign(columns, 1.0);
+    for (int m = 1; m < columns; ++m) {
+        sectorial[m] = (m == 1) ? std::sqrt(3.0) : std::sqrt((2.0 * m + 1.0) / (2.0 * m));
+    }
+
+    const size_t total = columnStart[columns];
+    g.assign(total, 0.0);
+    h.assign(total, 0.0);
+    c.assign(total, 0.0);
+    s.assign(total, 0.0);
+    ec.assign(total, 0.0);
+    es.assign(total, 0.0);
+    for (int m = 0; m < columns; ++m) {
+        for (int n = m; n <= this->degree; ++n) {
+            const size_t k = index(n, m);
+            const double dn = n;
+            const double dm = m;
+            if (n > m) {
+                g[k] = std::sqrt((2 * dn + 1) * (2 * dn - 1) / ((dn - dm) * (dn + dm)));
+            }
+            if (n > m + 1) {
+                h[k] = std::sqrt((2 * dn + 1) * (dn + dm - 1) * (dn - dm - 1) /
+                                 ((dn - dm) * (dn + dm) * (2 * dn - 3)));
+            }
+            if (n < 2) {
+                // central and degree 1 terms are not part of the perturbing acceleration
+                continue;
+            }
+            c[k] = getNormalizedC(n, m);
+            s[k] = getNormalizedS(n, m);
+            if (m > 0) {
+                // dP̄n,m-1/dφ involves P̄n,m with factor √((n - m + 1)(n + m)), halved for m - 1 = 0
+                const double e = (m == 1) ? std::sqrt(0.5 * dn * (dn + 1)) : std::sqrt((dn - dm + 1) * (dn + dm));
+                ec[k] = e * getNormalizedC(n, m - 1);
+                es[k] = e * getNormalizedS(n, m - 1);
+            }
+        }
+    }
+}
+
+SphericalHarmonicsField SphericalHarmonicsField::truncate(int degree, int order) const
+{
+    const int newDegree = std::max(0, std::min(degree, this->degree));
+    const int newOrder  = std::max(0, std::min(std::min(order, this->order), newDegree));
+    return SphericalHarmonicsField(ae, mu, newDegree, newOrder, normalizedC.data(), normalizedS.data());
+}
+
+double SphericalHarmonicsField::getEquatorialRadius() const
+{
+    return ae;
+}
+
+double SphericalHarmonicsField::getMu() const
+{
+    return mu;
+}
+
+int SphericalHarmonicsField::getMaxDegree() const
+{
+    return degree;
+}
+
+int SphericalHarmonicsField::getMaxOrder() const
+{
+    return order;
+}
+
+double SphericalHarmonicsField::getNormalizedC(int n, int m) const
+{
+    if (n < 0 || n > degree || m < 0 || m > std::min(n, order) || normalizedC.empty()) {
+        return 0.0;
+    }
+    return normalizedC[n * (n + 1) / 2 + m];
+}
+
+double SphericalHarmonicsField::getNormalizedS(int n, int m) const
+{
+    if (n < 0 || n > degree || m < 0 || m > std::min(n, order) || normalizedS.empty()) {
+        return 0.0;
+    }
+    return normalizedS[n * (n + 1) / 2 + m];
+}
+
+size_t SphericalHarmonicsField::index(int n, int m) const
+{
+    return columnStart[m] + (n - m);
+}
+
+template<int B>
+void SphericalHarmonicsField::evaluate(const double* x, const double* y, const double* z,
+                                       double* ax, double* ay, double* az) const
+{
+    // geometry of each lane
+    double t[B], u[B], q[B], tq[B], q2[B], cosL[B], sinL[B], f[B];
+    for (int l = 0; l < B; ++l) {
+        const double rho2 = x[l] * x[l] + y[l] * y[l];
+        const double invR = 1.0 / std::sqrt(rho2 + z[l] * z[l]);
+        const double rho  = std::sqrt(rho2);
+        t[l]    = z[l] * invR;
+        u[l]    = rho * invR;
+        q[l]    = ae * invR;
+        tq[l]   = t[l] * q[l];
+        q2[l]   = q[l] * q[l];
+        // on the polar axis, any longitude can be used
+        cosL[l] = (rho > 0) ? x[l] / rho : 1.0;
+        sinL[l] = (rho > 0) ? y[l] / rho : 0.0;
+        f[l]    = mu * invR * invR;
+    }
+
+    // state carried from one column to the next
+    double pmm[B], cosM[B], sinM[B], cosPrevious[B], sinPrevious[B], um[B], uPrevious[B];
+    double radial[B], latitudinal[B], longitudinal[B];
+    for (int l = 0; l < B; ++l) {
+        pmm[l] = 1.0;
+        cosM[l] = 1.0;
+        sinM[l] = 0.0;
+        cosPrevious[l] = 1.0;
+        sinPrevious[l] = 0.0;
+        um[l] = 1.0;
+        uPrevious[l] = 1.0;
+        radial[l] = 0.0;
+        latitudinal[l] = 0.0;
+        longitudinal[l] = 0.0;
+    }
+
+    for (int m = 0; m < columns; ++m) {
+        if (m > 0) {
+            const double factor = sectorial[m];
+            for (int l = 0; l < B; ++l) {
+                pmm[l] *= factor * q[l];
+                cosPrevious[l] = cosM[l];
+                sinPrevious[l] = sinM[l];
+                cosM[l] = cosPrevious[l] * cosL[l] - sinPrevious[l] * sinL[l];
+                sinM[l] = sinPrevious[l] * cosL[l] + cosPrevious[l] * sinL[l];
+                uPrevious[l] = um[l];
+                um[l] *= u[l];
+            }
+        }
+
+        // sums along the column of the scaled Legendre functions times the coefficients
+        const size_t start = columnStart[m];
+        double sumC[B], sumS[B], sumRC[B], sumRS[B], sumEC[B], sumES[B], p1[B], p2[B];
+        {
+            const double n1 = m + 1.0;
+            for (int l = 0; l < B; ++l) {
+                sumC[l]  = pmm[l] * c[start];
+                sumS[l]  = pmm[l] * s[start];
+                sumRC[l] = n1 * sumC[l];
+                sumRS[l] = n1 * sumS[l];
+                sumEC[l] = pmm[l] * ec[start];
+                sumES[l] = pmm[l] * es[start];
+                p1[l]    = pmm[l];
+                p2[l]    = 0.0;
+            }
+        }
+        for (int n = m + 1; n <= degree; ++n) {
+            const size_t k    = start + (n - m);
+            const double gk   = g[k];
+            const double hk   = h[k];
+            const double ck   = c[k];
+            const double sk   = s[k];
+            const double eck  = ec[k];
+            const double esk  = es[k];
+            const double n1   = n + 1.0;
+            for (int l = 0; l < B; ++l) {
+                const double p = gk * tq[l] * p1[l] - hk * q2[l] * p2[l];
+                const double pc = p * ck;
+                const double ps = p * sk;
+                sumC[l]  += pc;
+                sumS[l]  += ps;
+                sumRC[l] += n1 * pc;
+                sumRS[l] += n1 * ps;
+                sumEC[l] += p * eck;
+                sumES[l] += p * esk;
+                p2[l] = p1[l];
+                p1[l] = p;
+            }
+        }
+
+        // combine the column with longitude and the cos^m(φ) scaling
+        const double dm = m;
+        for (int l = 0; l < B; ++l) {
+            radial[l] += um[l] * (sumRC[l] * cosM[l] + sumRS[l] * sinM[l]);
+            if (m > 0) {
+                const double v = sumC[l] * cosM[l] + sumS[l] * sinM[l];
+                longitudinal[l] += dm * uPrevious[l] * (sumS[l] * cosM[l] - sumC[l] * sinM[l]);
+                latitudinal[l]  += um[l] * (sumEC[l] * cosPrevious[l] + sumES[l] * sinPrevious[l]) -
+                                   dm * t[l] * uPrevious[l] * v;
+            }
+        }
+    }
+
+    // spherical to cartesian components
+    for (int l = 0; l < B; ++l) {
+        const double gr   = -f[l] * radial[l];
+        const double gphi = f[l] * latitudinal[l];
+        const double glam = f[l] * longitudinal[l];
+        const double horizontal = gr * u[l] - gphi * t[l];
+        ax[l] = horizontal * cosL[l] - glam * sinL[l];
+        ay[l] = horizontal * sinL[l] + glam * cosL[l];
+        az[l] = gr * t[l] + gphi * u[l];
+    }
+}
+
+Vector3D SphericalHarmonicsField::getAcceleration(const Vector3D& position) const
+{
+    if (columns == 0) {
+        return Vector3D::ZERO;
+    }
+    const double x = position.getX();
+    const double y = position.getY();
+    const double z = position.getZ();
+    double ax, ay, az;
+    evaluate<1>(&x, &y, &z, &ax, &ay, &az);
+    return Vector3D(ax, ay, az);
+}
+
+void SphericalHarmonicsField::getAccelerations(const double* x, const double* y, const double* z, size_t count,
+                                               double* ax, double* ay, double* az) const
+{
+    if (columns == 0) {
+        std::fill(ax, ax + count, 0.0);
+        std::fill(ay, ay + count, 0.0);
+        std::fill(az, az + count, 0.0);
+        return;
+    }
+    size_t i = 0;
+    for (; i + LANES <= count; i += LANES) {
+        evaluate<LANES>(x + i, y + i, z + i, ax + i, ay + i, az + i);
+    }
+    const size_t remaining = count - i;
+    if (remaining < LANES / 4) {
+        // short tail, cheaper one position at a time than in a padded block
+        for (size_t l = 0; l < remaining; ++l) {
+            evaluate<1>(x + i + l, y + i + l, z + i + l, ax + i + l, ay + i + l, az + i + l);
+        }
+    }
+    else {
+        // last partial block, padded with copies of its last position
+        double bx[LANES], by[LANES], bz[LANES], rx[LANES], ry[LANES], rz[LANES];
+        for (size_t l = 0; l < LANES; ++l) {
+            const size_t k = i + std::min(l, remaining - 1);
+            bx[l] = x[k];
+            by[l] = y[k];
+            bz[l] = z[k];
+        }
+        evaluate<LANES>(bx, by, bz, rx, ry, rz);
+        std::copy(rx, rx + remaining, ax + i);
+        std::copy(ry, ry + remaining, ay + i);
+        std::copy(rz, rz + remaining, az + i);
+    }
+}
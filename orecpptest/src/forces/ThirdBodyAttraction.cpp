@@ -0,0 +1,35 @@
+#include "forces/ThirdBodyAttraction.h"
+#include "bodies/LowPrecisionEphemeris.h"
+#include "utils/Constants.h"
+#include <cmath>
+
+ThirdBodyAttraction::ThirdBodyAttraction(double mu, PositionFunction position)
+    : mu(mu), position(position)
+{
+
+}
+
+ThirdBodyAttraction ThirdBodyAttraction::sun()
+{
+    return ThirdBodyAttraction(Constants::JPL_SSD_SUN_GM, &LowPrecisionEphemeris::getSunPosition);
+}
+
+ThirdBodyAttraction ThirdBodyAttraction::moon()
+{
+    return ThirdBodyAttraction(Constants::JPL_SSD_MOON_GM, &LowPrecisionEphemeris::getMoonPosition);
+}
+
+void ThirdBodyAttraction::addAcceleration(const LinearTime& date, const double* state, double* acceleration) const
+{
+    const Vector3D s = position(date);
+    const double dx = s.getX() - state[0];
+    const double dy = s.getY() - state[1];
+    const double dz = s.getZ() - state[2];
+    const double d2 = dx * dx + dy * dy + dz * dz;
+    const double s2 = s.getNormSq();
+    const double kd = mu / (d2 * std::sqrt(d2));
+    const double ks = mu / (s2 * std::sqrt(s2));
+    acceleration[0] += kd * dx - ks * s.getX();
+    acceleration[1] += kd * dy - ks * s.getY();
+    acceleration[2] += kd * dz - ks * s.getZ();
+}
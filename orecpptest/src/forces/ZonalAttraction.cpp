@@ -0,0 +1,20 @@
+#include "forces/ZonalAttraction.h"
+
+ZonalAttraction::ZonalAttraction(const ZonalGravityField& field)
+    : field(field)
+{
+
+}
+
+const ZonalGravityField& ZonalAttraction::getField() const
+{
+    return field;
+}
+
+void ZonalAttraction::addAcceleration(const LinearTime&, const double* state, double* acceleration) const
+{
+    const Vector3D a = field.getAcceleration(Vector3D(state[0], state[1], state[2]));
+    acceleration[0] += a.getX();
+    acceleration[1] += a.getY();
+    acceleration[2] += a.getZ();
+}
@@ -0,0 +1,100 @@
+#include "forces/ZonalGravityField.h"
+#include "forces/ZonalKernels.h"
+#include <algorithm>
+
+ZonalGravityField::ZonalGravityField(double ae, double mu, const double* unnormalizedZonals, int maxDegree)
+    : ae(ae), mu(mu), maxDegree(std::max(2, std::min(maxDegree, MAX_SUPPORTED_DEGREE)))
+{
+    for (int n = 0; n <= MAX_SUPPORTED_DEGREE; ++n) {
+        j[n] = (n >= 2 && n <= this->maxDegree) ? -unnormalizedZonals[n] : 0.0;
+    }
+}
+
+double ZonalGravityField::getEquatorialRadius() const
+{
+    return ae;
+}
+
+double ZonalGravityField::getMu() const
+{
+    return mu;
+}
+
+int ZonalGravityField::getMaxDegree() const
+{
+    return maxDegree;
+}
+
+double ZonalGravityField::getJ(int n) const
+{
+    return (n >= 0 && n <= MAX_SUPPORTED_DEGREE) ? j[n] : 0.0;
+}
+
+Vector3D ZonalGravityField::getAcceleration(const Vector3D& position) const
+{
+    // the unused coefficients are 0, so the highest degree kernel is always correct
+    double ax, ay, az;
+    ZonalKernels::acceleration<MAX_SUPPORTED_DEGREE>(ae, mu, j, position.getX(), position.getY(), position.getZ(),
+                                                     ax, ay, az);
+    return Vector3D(ax, ay, az);
+}
+
+Vector3D ZonalGravityField::getAcceleration(const Vector3D& position, double jacobian[3][3]) const
+{
+    const double x = position.getX();
+    const double y = position.getY();
+    const double z = position.getZ();
+    double ax, ay, az;
+    double flat[9];
+    getAccelerations(&x, &y, &z, 1, &ax, &ay, &az, flat);
+    for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 3; ++c) {
+            jacobian[r][c] = flat[3 * r + c];
+        }
+    }
+    return Vector3D(ax, ay, az);
+}
+
+void ZonalGravityField::getAccelerations(const double* x, const double* y, const double* z, size_t count,
+                                         double* ax, double* ay, double* az) const
+{
+    switch (maxDegree) {
+        case 2:
+            ZonalKernels::accelerations<2>(ae, mu, j, x, y, z, count, ax, ay, az);
+            break;
+        case 3:
+            ZonalKernels::accelerations<3>(ae, mu, j, x, y, z, count, ax, ay, az);
+            break;
+        case 4:
+            ZonalKernels::accelerations<4>(ae, mu, j, x, y, z, count, ax, ay, az);
+            break;
+        case 5:
+            ZonalKernels::accelerations<5>(ae, mu, j, x, y, z, count, ax, ay, az);
+            break;
+        default:
+            ZonalKernels::accelerations<6>(ae, mu, j, x, y, z, count, ax, ay, az);
+            break;
+    }
+}
+
+void ZonalGravityField::getAccelerations(const double* x, const double* y, const double* z, size_t count,
+                                         double* ax, double* ay, double* az, double* jacobians) const
+{
+    switch (maxDegree) {
+        case 2:
+            ZonalKernels::accelerations<2>(ae, mu, j, x, y, z, count, ax, ay, az, jacobians);
+            break;
+        case 3:
+            ZonalKernels::accelerations<3>(ae, mu, j, x, y, z, count, ax, ay, az, jacobians);
+            break;
+        case 4:
+            ZonalKernels::accelerations<4>(ae, mu, j, x, y, z, count, ax, ay, az, jacobians);
+            break;
+        case 5:
+            ZonalKernels::accelerations<5>(ae, mu, j, x, y, z, count, ax, ay, az, jacobians);
+            break;
+        default:
+            ZonalKernels::accelerations<6>(ae, mu, j, x, y, z, count, ax, ay, az, jacobians);
+            break;
+    }
+}
@@ -0,0 +1,126 @@
+#include "geometry/Vector3D.h"
+#include <cmath>
+
+const Vector3D Vector3D::ZERO(0, 0, 0);
+const Vector3D Vector3D::PLUS_I(1, 0, 0);
+const Vector3D Vector3D::PLUS_J(0, 1, 0);
+const Vector3D Vector3D::PLUS_K(0, 0, 1);
+
+Vector3D::Vector3D()
+    : x(0), y(0), z(0)
+{
+
+}
+
+Vector3D::Vector3D(double x, double y, double z)
+    : x(x), y(y), z(z)
+{
+
+}
+
+Vector3D::Vector3D(double a, const Vector3D& u)
+    : x(a * u.x), y(a * u.y), z(a * u.z)
+{
+
+}
+
+Vector3D::Vector3D(double a1, const Vector3D& u1, double a2, const Vector3D& u2)
+    : x(a1 * u1.x + a2 * u2.x), y(a1 * u1.y + a2 * u2.y), z(a1 * u1.z + a2 * u2.z)
+{
+
+}
+
+Vector3D::Vector3D(double a1, const Vector3D& u1, double a2, const Vector3D& u2, double a3, const Vector3D& u3)
+    : x(a1 * u1.x + a2 * u2.x + a3 * u3.x),
+      y(a1 * u1.y + a2 * u2.y + a3 * u3.y),
+      z(a1 * u1.z + a2 * u2.z + a3 * u3.z)
+{
+
+}
+
+double Vector3D::getX() const
+{
+    return x;
+}
+
+double Vector3D::getY() const
+{
+    return y;
+}
+
+double Vector3D::getZ() const
+{
+    return z;
+}
+
+double Vector3D::getNorm() const
+{
+    return std::sqrt(x * x + y * y + z * z);
+}
+
+double Vector3D::getNormSq() const
+{
+    return x * x + y * y + z * z;
+}
+
+Vector3D Vector3D::add(const Vector3D& v) const
+{
+    return Vector3D(x + v.x, y + v.y, z + v.z);
+}
+
+Vector3D Vector3D::add(double factor, const Vector3D& v) const
+{
+    return Vector3D(x + factor * v.x, y + factor * v.y, z + factor * v.z);
+}
+
+Vector3D Vector3D::subtract(const Vector3D& v) const
+{
+    return Vector3D(x - v.x, y - v.y, z - v.z);
+}
+
+Vector3D Vector3D::subtract(double factor, const Vector3D& v) const
+{
+    return Vector3D(x - factor * v.x, y - factor * v.y, z - factor * v.z);
+}
+
+Vector3D Vector3D::negate() const
+{
+    return Vector3D(-x, -y, -z);
+}
+
+Vector3D Vector3D::scalarMultiply(double a) const
+{
+    return Vector3D(a * x, a * y, a * z);
+}
+
+Vector3D Vector3D::normalize() const
+{
+    const double norm = getNorm();
+    return (norm == 0) ? *this : scalarMultiply(1.0 / norm);
+}
+
+double Vector3D::dotProduct(const Vector3D& v) const
+{
+    return x * v.x + y * v.y + z * v.z;
+}
+
+Vector3D Vector3D::crossProduct(const Vector3D& v) const
+{
+    return Vector3D(y * v.z - z * v.y, z * v.x - x * v.z, x * v.y - y * v.x);
+}
+
+double Vector3D::distance(const Vector3D& v) const
+{
+    return subtract(v).getNorm();
+}
+
+double Vector3D::angle(const Vector3D& v1, const Vector3D& v2)
+{
+    // atan2 of cross and dot products is accurate for both small and nearly opposite angles
+    return std::atan2(v1.crossProduct(v2).getNorm(), v1.dotProduct(v2));
+}
+
+bool Vector3D::operator==(const Vector3D& other) const
+{
+    return x == other.x && y == other.y && z == other.z;
+}
@@ -0,0 +1,116 @@
+#include "orbits/CartesianOrbit.h"
+#include "orbits/EquinoctialLongitudeArgumentUtility.h"
+#include "orbits/EquinoctialOrbit.h"
+#include "orbits/KeplerianAnomalyUtility.h"
+#include "orbits/KeplerianOrbit.h"
+#include <cmath>
+
+CartesianOrbit::CartesianOrbit(const PVCoordinates& pv, const LinearTime& date, double mu)
+    : Orbit(date, mu), pv(pv)
+{
+    initEquinoctial();
+}
+
+CartesianOrbit::CartesianOrbit(const Orbit& orbit)
+    : Orbit(orbit.getDate(), orbit.getMu()), pv(orbit.getPVCoordinates())
+{
+    initEquinoctial();
+}
+
+void CartesianOrbit::initEquinoctial()
+{
+    if (computeA(pv, getMu()) > 0) {
+        const EquinoctialOrbit equinoctial(pv, getDate(), getMu());
+        a  = equinoctial.getA();
+        ex = equinoctial.getEquinoctialEx();
+        ey = equinoctial.getEquinoctialEy();
+        hx = equinoctial.getHx();
+        hy = equinoctial.getHy();
+        lv = equinoctial.getLv();
+    }
+    else {
+        const KeplerianOrbit keplerian(pv, getDate(), getMu());
+        a  = keplerian.getA();
+        ex = keplerian.getEquinoctialEx();
+        ey = keplerian.getEquinoctialEy();
+        hx = keplerian.getHx();
+        hy = keplerian.getHy();
+        lv = keplerian.getLv();
+    }
+}
+
+Orbit::Type CartesianOrbit::getType() const
+{
+    return CARTESIAN;
+}
+
+double CartesianOrbit::getA() const
+{
+    return a;
+}
+
+double CartesianOrbit::getEquinoctialEx() const
+{
+    return ex;
+}
+
+double CartesianOrbit::getEquinoctialEy() const
+{
+    return ey;
+}
+
+double CartesianOrbit::getHx() const
+{
+    return hx;
+}
+
+double CartesianOrbit::getHy() const
+{
+    return hy;
+}
+
+double CartesianOrbit::getLv() const
+{
+    return lv;
+}
+
+double CartesianOrbit::getLE() const
+{
+    if (a > 0) {
+        return EquinoctialLongitudeArgumentUtility::trueToEccentric(ex, ey, lv);
+    }
+    const double w = std::atan2(ey, ex);
+    return w + KeplerianAnomalyUtility::hyperbolicTrueToEccentric(getE(), lv - w);
+}
+
+double CartesianOrbit::getLM() const
+{
+    if (a > 0) {
+        return EquinoctialLongitudeArgumentUtility::trueToMean(ex, ey, lv);
+    }
+    const double w = std::atan2(ey, ex);
+    return w + KeplerianAnomalyUtility::hyperbolicTrueToMean(getE(), lv - w);
+}
+
+double CartesianOrbit::getE() const
+{
+    return std::sqrt(ex * ex + ey * ey);
+}
+
+double CartesianOrbit::getI() const
+{
+    return 2.0 * std::atan(std::sqrt(hx * hx + hy * hy));
+}
+
+PVCoordinates CartesianOrbit::getPVCoordinates() const
+{
+    return pv;
+}
+
+CartesianOrbit CartesianOrbit::shiftedBy(double dt) const
+{
+    if (a > 0) {
+        return CartesianOrbit(EquinoctialOrbit(*this).shiftedBy(dt));
+    }
+    return CartesianOrbit(KeplerianOrbit(pv, getDate(), getMu()).shiftedBy(dt));
+}
@@ -0,0 +1,236 @@
+#include "orbits/CircularOrbit.h"
+#include "orbits/EquinoctialLongitudeArgumentUtility.h"
+#include "utils/MathUtils.h"
+#include <cmath>
+#include <limits>
+
+// the latitude arguments obey the same relations as the equinoctial longitude
+// arguments, with the circular eccentricity vector in place of the equinoctial one
+
+CircularOrbit::CircularOrbit(double a, double ex, double ey, double i, double raan, double alpha,
+                             PositionAngle type, const LinearTime& date, double mu)
+    : Orbit(date, mu), a(a), ex(ex), ey(ey), i(i), raan(raan)
+{
+    switch (type) {
+        case MEAN_ANOMALY:
+            alphaV = EquinoctialLongitudeArgumentUtility::meanToTrue(ex, ey, alpha);
+            break;
+        case ECCENTRIC_ANOMALY:
+            alphaV = EquinoctialLongitudeArgumentUtility::eccentricToTrue(ex, ey, alpha);
+            break;
+        default:
+            alphaV = alpha;
+            break;
+    }
+}
+
+CircularOrbit::CircularOrbit(const PVCoordinates& pv, const LinearTime& date, double mu)
+    : Orbit(date, mu)
+{
+    // compute semi-major axis
+    const Vector3D& pvP    = pv.getPosition();
+    const Vector3D& pvV    = pv.getVelocity();
+    const double r         = pvP.getNorm();
+    const double rV2OnMu   = r * pvV.getNormSq() / mu;
+    a = r / (2.0 - rV2OnMu);
+
+    // compute inclination
+    const Vector3D momentum = pv.getMomentum();
+    i = Vector3D::angle(momentum, Vector3D::PLUS_K);
+
+    // compute right ascension of ascending node
+    const Vector3D node = Vector3D::PLUS_K.crossProduct(momentum);
+    raan = std::atan2(node.getY(), node.getX());
+
+    // 2D-coordinates in the canonical frame
+    const double cosRaan = std::cos(raan);
+    const double sinRaan = std::sin(raan);
+    const double cosI    = std::cos(i);
+    const double sinI    = std::sin(i);
+    const double xP      = pvP.getX();
+    const double yP      = pvP.getY();
+    const double zP      = pvP.getZ();
+    const double x2      = (xP * cosRaan + yP * sinRaan) / a;
+    const double y2      = ((yP * cosRaan - xP * sinRaan) * cosI + zP * sinI) / a;
+
+    // compute eccentricity vector
+    const double eSE    = pvP.dotProduct(pvV) / std::sqrt(mu * a);
+    const double eCE    = rV2OnMu - 1.0;
+    const double e2     = eCE * eCE + eSE * eSE;
+    const double f      = eCE - e2;
+    const double g      = std::sqrt(1.0 - e2) * eSE;
+    const double aOnR   = a / r;
+    const double a2OnR2 = aOnR * aOnR;
+    ex = a2OnR2 * (f * x2 + g * y2);
+    ey = a2OnR2 * (f * y2 - g * x2);
+
+    // compute latitude argument
+    const double beta = 1.0 / (1.0 + std::sqrt(1.0 - ex * ex - ey * ey));
+    alphaV = EquinoctialLongitudeArgumentUtility::eccentricToTrue(
+                 ex, ey, std::atan2(y2 + ey + eSE * beta * ex, x2 + ex - eSE * beta * ey));
+}
+
+CircularOrbit::CircularOrbit(const Orbit& orbit)
+    : Orbit(orbit.getDate(), orbit.getMu()), a(orbit.getA()), i(orbit.getI())
+{
+    const double hx = orbit.getHx();
+    const double hy = orbit.getHy();
+    const double h  = std::sqrt(hx * hx + hy * hy);
+    raan = std::atan2(hy, hx);
+    const double cosRaan = (h == 0) ? std::cos(raan) : hx / h;
+    const double sinRaan = (h == 0) ? std::sin(raan) : hy / h;
+    const double equiEx  = orbit.getEquinoctialEx();
+    const double equiEy  = orbit.getEquinoctialEy();
+    ex     = equiEx * cosRaan + equiEy * sinRaan;
+    ey     = equiEy * cosRaan - equiEx * sinRaan;
+    alphaV = orbit.getLv() - raan;
+}
+
+Orbit::Type CircularOrbit::getType() const
+{
+    return CIRCULAR;
+}
+
+double CircularOrbit::getA() const
+{
+    return a;
+}
+
+double CircularOrbit::getCircularEx() const
+{
+    return ex;
+}
+
+double CircularOrbit::getCircularEy() const
+{
+    return ey;
+}
+
+double CircularOrbit::getI() const
+{
+    return i;
+}
+
+double CircularOrbit::getRightAscensionOfAscendingNode() const
+{
+    return raan;
+}
+
+double CircularOrbit::getAlpha(PositionAngle type) const
+{
+    switch (type) {
+        case MEAN_ANOMALY:
+            return getAlphaM();
+        case ECCENTRIC_ANOMALY:
+            return getAlphaE();
+        default:
+            return getAlphaV();
+    }
+}
+
+double CircularOrbit::getAlphaV() const
+{
+    return alphaV;
+}
+
+double CircularOrbit::getAlphaE() const
+{
+    return EquinoctialLongitudeArgumentUtility::trueToEccentric(ex, ey, alphaV);
+}
+
+double CircularOrbit::getAlphaM() const
+{
+    return EquinoctialLongitudeArgumentUtility::trueToMean(ex, ey, alphaV);
+}
+
+double CircularOrbit::getE() const
+{
+    return std::sqrt(ex * ex + ey * ey);
+}
+
+double CircularOrbit::getEquinoctialEx() const
+{
+    return ex * std::cos(raan) - ey * std::sin(raan);
+}
+
+double CircularOrbit::getEquinoctialEy() const
+{
+    return ey * std::cos(raan) + ex * std::sin(raan);
+}
+
+double CircularOrbit::getHx() const
+{
+    // check for equatorial retrograde orbit
+    if (std::abs(i - MathUtils::PI) < 1.0e-10) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    return std::cos(raan) * std::tan(0.5 * i);
+}
+
+double CircularOrbit::getHy() const
+{
+    // check for equatorial retrograde orbit
+    if (std::abs(i - MathUtils::PI) < 1.0e-10) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    return std::sin(raan) * std::tan(0.5 * i);
+}
+
+double CircularOrbit::getLv() const
+{
+    return alphaV + raan;
+}
+
+double CircularOrbit::getLE() const
+{
+    return getAlphaE() + raan;
+}
+
+double CircularOrbit::getLM() const
+{
+    return getAlphaM() + raan;
+}
+
+PVCoordinates CircularOrbit::getPVCoordinates() const
+{
+    // get equinoctial parameters
+    const double alphaE = getAlphaE();
+
+    // inclination-related intermediate parameters
+    const double cosRaan = std::cos(raan);
+    const double sinRaan = std::sin(raan);
+    const double cosI    = std::cos(i);
+    const double sinI    = std::sin(i);
+
+    // reference axes defining the orbital plane, the first one pointing to the ascending node
+    const Vector3D u(cosRaan, sinRaan, 0.0);
+    const Vector3D v(-sinRaan * cosI, cosRaan * cosI, sinI);
+
+    // eccentricity-related intermediate parameters
+    const double exey = ex * ey;
+    const double ex2  = ex * ex;
+    const double ey2  = ey * ey;
+    const double e2   = ex2 + ey2;
+    const double eta  = 1.0 + std::sqrt(1.0 - e2);
+    const double beta = 1.0 / eta;
+
+    // eccentric latitude argument
+    const double cosAlphaE = std::cos(alphaE);
+    const double sinAlphaE = std::sin(alphaE);
+    const double exCeyS    = ex * cosAlphaE + ey * sinAlphaE;
+
+    // coordinates of position and velocity in the orbital plane
+    const double x      = a * ((1.0 - beta * ey2) * cosAlphaE + beta * exey * sinAlphaE - ex);
+    const double y      = a * ((1.0 - beta * ex2) * sinAlphaE + beta * exey * cosAlphaE - ey);
+    const double factor = std::sqrt(getMu() / a) / (1.0 - exCeyS);
+    const double xDot   = factor * (-sinAlphaE + beta * ey * exCeyS);
+    const double yDot   = factor * ( cosAlphaE - beta * ex * exCeyS);
+
+    return PVCoordinates(Vector3D(x, u, y, v), Vector3D(xDot, u, yDot, v));
+}
+
+CircularOrbit CircularOrbit::shiftedBy(double dt) const
+{
+    return CircularOrbit(a, ex, ey, i, raan, getAlphaM() + getKeplerianMeanMotion() * dt, MEAN_ANOMALY,
+                         getDate().shiftedBy(dt), getMu());
+}
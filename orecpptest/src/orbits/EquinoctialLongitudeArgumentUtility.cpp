@@ -0,0 +1,69 @@
+#include "orbits/EquinoctialLongitudeArgumentUtility.h"
+#include <cmath>
+
+namespace {
+
+    /** Maximal number of iterations when solving Kepler's equation. */
+    const int MAX_ITERATIONS = 50;
+
+    /** Convergence threshold when solving Kepler's equation. */
+    const double THRESHOLD = 1.0e-12;
+
+}
+
+double EquinoctialLongitudeArgumentUtility::meanToEccentric(double ex, double ey, double lM)
+{
+    // Halley iterations on lE - lM, which stays small for moderate eccentricities
+    double lEmlM = 0.0;
+    double cosLE = std::cos(lM);
+    double sinLE = std::sin(lM);
+    for (int i = 0; i < MAX_ITERATIONS; ++i) {
+        const double f2  = ex * sinLE - ey * cosLE;
+        const double f1  = 1.0 - ex * cosLE - ey * sinLE;
+        const double f0  = lEmlM - f2;
+        const double f12 = 2.0 * f1;
+        const double shift = f0 * f12 / (f1 * f12 - f0 * f2);
+        lEmlM -= shift;
+        cosLE = std::cos(lM + lEmlM);
+        sinLE = std::sin(lM + lEmlM);
+        if (std::abs(shift) <= THRESHOLD) {
+            break;
+        }
+    }
+    return lM + lEmlM;
+}
+
+double EquinoctialLongitudeArgumentUtility::eccentricToMean(double ex, double ey, double lE)
+{
+    return lE - ex * std::sin(lE) + ey * std::cos(lE);
+}
+
+double EquinoctialLongitudeArgumentUtility::eccentricToTrue(double ex, double ey, double lE)
+{
+    const double epsilon = std::sqrt(1.0 - ex * ex - ey * ey);
+    const double cosLE = std::cos(lE);
+    const double sinLE = std::sin(lE);
+    const double num = ex * sinLE - ey * cosLE;
+    const double den = epsilon + 1.0 - ex * cosLE - ey * sinLE;
+    return lE + 2.0 * std::atan(num / den);
+}
+
+double EquinoctialLongitudeArgumentUtility::trueToEccentric(double ex, double ey, double lv)
+{
+    const double epsilon = std::sqrt(1.0 - ex * ex - ey * ey);
+    const double cosLv = std::cos(lv);
+    const double sinLv = std::sin(lv);
+    const double num = ey * cosLv - ex * sinLv;
+    const double den = epsilon + 1.0 + ex * cosLv + ey * sinLv;
+    return lv + 2.0 * std::atan(num / den);
+}
+
+double EquinoctialLongitudeArgumentUtility::meanToTrue(double ex, double ey, double lM)
+{
+    return eccentricToTrue(ex, ey, meanToEccentric(ex, ey, lM));
+}
+
+double EquinoctialLongitudeArgumentUtility::trueToMean(double ex, double ey, double lv)
+{
+    return eccentricToMean(ex, ey, trueToEccentric(ex, ey, lv));
+}
@@ -0,0 +1,170 @@
+#include "orbits/EquinoctialOrbit.h"
+#include "orbits/EquinoctialLongitudeArgumentUtility.h"
+#include <cmath>
+
+EquinoctialOrbit::EquinoctialOrbit(double a, double ex, double ey, double hx, double hy, double l,
+                                   PositionAngle type, const LinearTime& date, double mu)
+    : Orbit(date, mu), a(a), ex(ex), ey(ey), hx(hx), hy(hy)
+{
+    switch (type) {
+        case MEAN_ANOMALY:
+            lv = EquinoctialLongitudeArgumentUtility::meanToTrue(ex, ey, l);
+            break;
+        case ECCENTRIC_ANOMALY:
+            lv = EquinoctialLongitudeArgumentUtility::eccentricToTrue(ex, ey, l);
+            break;
+        default:
+            lv = l;
+            break;
+    }
+}
+
+EquinoctialOrbit::EquinoctialOrbit(const PVCoordinates& pv, const LinearTime& date, double mu)
+    : Orbit(date, mu)
+{
+    const Vector3D& pvP = pv.getPosition();
+    const Vector3D& pvV = pv.getVelocity();
+
+    // compute semi-major axis
+    const double r       = pvP.getNorm();
+    const double rV2OnMu = r * pvV.getNormSq() / mu;
+    a = r / (2.0 - rV2OnMu);
+
+    // compute inclination vector
+    const Vector3D w = pv.getMomentum().normalize();
+    const double d = 1.0 / (1.0 + w.getZ());
+    hx = -d * w.getY();
+    hy =  d * w.getX();
+
+    // compute true longitude argument
+    const double cLv = (pvP.getX() - d * pvP.getZ() * w.getX()) / r;
+    const double sLv = (pvP.getY() - d * pvP.getZ() * w.getY()) / r;
+    lv = std::atan2(sLv, cLv);
+
+    // compute eccentricity vector
+    const double eSE = pvP.dotProduct(pvV) / std::sqrt(mu * a);
+    const double eCE = rV2OnMu - 1.0;
+    const double e2  = eCE * eCE + eSE * eSE;
+    const double f   = eCE - e2;
+    const double g   = std::sqrt(1.0 - e2) * eSE;
+    ex = a * (f * cLv + g * sLv) / r;
+    ey = a * (f * sLv - g * cLv) / r;
+}
+
+EquinoctialOrbit::EquinoctialOrbit(const Orbit& orbit)
+    : Orbit(orbit.getDate(), orbit.getMu()),
+      a(orbit.getA()), ex(orbit.getEquinoctialEx()), ey(orbit.getEquinoctialEy()),
+      hx(orbit.getHx()), hy(orbit.getHy()), lv(orbit.getLv())
+{
+
+}
+
+Orbit::Type EquinoctialOrbit::getType() const
+{
+    return EQUINOCTIAL;
+}
+
+double EquinoctialOrbit::getA() const
+{
+    return a;
+}
+
+double EquinoctialOrbit::getEquinoctialEx() const
+{
+    return ex;
+}
+
+double EquinoctialOrbit::getEquinoctialEy() const
+{
+    return ey;
+}
+
+double EquinoctialOrbit::getHx() const
+{
+    return hx;
+}
+
+double EquinoctialOrbit::getHy() const
+{
+    return hy;
+}
+
+double EquinoctialOrbit::getL(PositionAngle type) const
+{
+    switch (type) {
+        case MEAN_ANOMALY:
+            return getLM();
+        case ECCENTRIC_ANOMALY:
+            return getLE();
+        default:
+            return getLv();
+    }
+}
+
+double EquinoctialOrbit::getLv() const
+{
+    return lv;
+}
+
+double EquinoctialOrbit::getLE() const
+{
+    return EquinoctialLongitudeArgumentUtility::trueToEccentric(ex, ey, lv);
+}
+
+double EquinoctialOrbit::getLM() const
+{
+    return EquinoctialLongitudeArgumentUtility::trueToMean(ex, ey, lv);
+}
+
+double EquinoctialOrbit::getE() const
+{
+    return std::sqrt(ex * ex + ey * ey);
+}
+
+double EquinoctialOrbit::getI() const
+{
+    return 2.0 * std::atan(std::sqrt(hx * hx + hy * hy));
+}
+
+PVCoordinates EquinoctialOrbit::getPVCoordinates() const
+{
+    // get equinoctial parameters
+    const double lE = getLE();
+
+    // inclination-related intermediate parameters
+    const double hx2   = hx * hx;
+    const double hy2   = hy * hy;
+    const double factH = 1.0 / (1.0 + hx2 + hy2);
+
+    // reference axes defining the orbital plane
+    const Vector3D f((1.0 + hx2 - hy2) * factH, 2.0 * hx * hy * factH, -2.0 * hy * factH);
+    const Vector3D g(2.0 * hx * hy * factH, (1.0 - hx2 + hy2) * factH, 2.0 * hx * factH);
+
+    // eccentricity-related intermediate parameters
+    const double exey = ex * ey;
+    const double ex2  = ex * ex;
+    const double ey2  = ey * ey;
+    const double e2   = ex2 + ey2;
+    const double eta  = 1.0 + std::sqrt(1.0 - e2);
+    const double beta = 1.0 / eta;
+
+    // eccentric longitude argument
+    const double cLe    = std::cos(lE);
+    const double sLe    = std::sin(lE);
+    const double exCeyS = ex * cLe + ey * sLe;
+
+    // coordinates of position and velocity in the orbital plane
+    const double x      = a * ((1.0 - beta * ey2) * cLe + beta * exey * sLe - ex);
+    const double y      = a * ((1.0 - beta * ex2) * sLe + beta * exey * cLe - ey);
+    const double factor = std::sqrt(getMu() / a) / (1.0 - exCeyS);
+    const double xdot   = factor * (-sLe + beta * ey * exCeyS);
+    const double ydot   = factor * ( cLe - beta * ex * exCeyS);
+
+    return PVCoordinates(Vector3D(x, f, y, g), Vector3D(xdot, f, ydot, g));
+}
+
+EquinoctialOrbit EquinoctialOrbit::shiftedBy(double dt) const
+{
+    return EquinoctialOrbit(a, ex, ey, hx, hy, getLM() + getKeplerianMeanMotion() * dt, MEAN_ANOMALY,
+                            getDate().shiftedBy(dt), getMu());
+}
@@ -0,0 +1,69 @@
+#include "orbits/KeplerianAnomalyUtility.h"
+#include "orbits/KeplerSolver.h"
+#include <cmath>
+
+double KeplerianAnomalyUtility::ellipticMeanToEccentric(double e, double M)
+{
+    return KeplerSolver::ellipticMeanToEccentric(e, M);
+}
+
+double KeplerianAnomalyUtility::ellipticEccentricToMean(double e, double E)
+{
+    return E - e * std::sin(E);
+}
+
+double KeplerianAnomalyUtility::ellipticEccentricToTrue(double e, double E)
+{
+    const double beta = e / (1.0 + std::sqrt((1.0 - e) * (1.0 + e)));
+    const double sinE = std::sin(E);
+    const double cosE = std::cos(E);
+    return E + 2.0 * std::atan(beta * sinE / (1.0 - beta * cosE));
+}
+
+double KeplerianAnomalyUtility::ellipticTrueToEccentric(double e, double v)
+{
+    const double beta = e / (1.0 + std::sqrt((1.0 - e) * (1.0 + e)));
+    const double sinV = std::sin(v);
+    const double cosV = std::cos(v);
+    return v - 2.0 * std::atan(beta * sinV / (1.0 + beta * cosV));
+}
+
+double KeplerianAnomalyUtility::ellipticMeanToTrue(double e, double M)
+{
+    return ellipticEccentricToTrue(e, ellipticMeanToEccentric(e, M));
+}
+
+double KeplerianAnomalyUtility::ellipticTrueToMean(double e, double v)
+{
+    return ellipticEccentricToMean(e, ellipticTrueToEccentric(e, v));
+}
+
+double KeplerianAnomalyUtility::hyperbolicMeanToEccentric(double e, double M)
+{
+    return KeplerSolver::hyperbolicMeanToEccentric(e, M);
+}
+
+double KeplerianAnomalyUtility::hyperbolicEccentricToMean(double e, double H)
+{
+    return e * std::sinh(H) - H;
+}
+
+double KeplerianAnomalyUtility::hyperbolicEccentricToTrue(double e, double H)
+{
+    return 2.0 * std::atan(std::sqrt((e + 1.0) / (e - 1.0)) * std::tanh(0.5 * H));
+}
+
+double KeplerianAnomalyUtility::hyperbolicTrueToEccentric(double e, double v)
+{
+    return 2.0 * std::atanh(std::sqrt((e - 1.0) / (e + 1.0)) * std::tan(0.5 * v));
+}
+
+double KeplerianAnomalyUtility::hyperbolicMeanToTrue(double e, double M)
+{
+    return hyperbolicEccentricToTrue(e, hyperbolicMeanToEccentric(e, M));
+}
+
+double KeplerianAnomalyUtility::hyperbolicTrueToMean(double e, double v)
+{
+    return hyperbolicEccentricToMean(e, hyperbolicTrueToEccentric(e, v));
+}
@@ -0,0 +1,235 @@
+#include "orbits/KeplerianOrbit.h"
+#include "orbits/KeplerianAnomalyUtility.h"
+#include "utils/MathUtils.h"
+#include <cmath>
+#include <limits>
+
+KeplerianOrbit::KeplerianOrbit(double a, double e, double i, double pa, double raan, double anomaly,
+                               PositionAngle type, const LinearTime& date, double mu)
+    : Orbit(date, mu), a(a), e(e), i(i), pa(pa), raan(raan)
+{
+    switch (type) {
+        case MEAN_ANOMALY:
+            v = (a < 0) ? KeplerianAnomalyUtility::hyperbolicMeanToTrue(e, anomaly) :
+                          KeplerianAnomalyUtility::ellipticMeanToTrue(e, anomaly);
+            break;
+        case ECCENTRIC_ANOMALY:
+            v = (a < 0) ? KeplerianAnomalyUtility::hyperbolicEccentricToTrue(e, anomaly) :
+                          KeplerianAnomalyUtility::ellipticEccentricToTrue(e, anomaly);
+            break;
+        default:
+            v = anomaly;
+            break;
+    }
+}
+
+KeplerianOrbit::KeplerianOrbit(const PVCoordinates& pv, const LinearTime& date, double mu)
+    : Orbit(date, mu)
+{
+    // compute inclination
+    const Vector3D momentum = pv.getMomentum();
+    const double m2 = momentum.getNormSq();
+    i = Vector3D::angle(momentum, Vector3D::PLUS_K);
+
+    // compute right ascension of ascending node
+    raan = std::atan2(momentum.getX(), -momentum.getY());
+
+    // preliminary computations for parameters depending on orbit shape (elliptic or hyperbolic)
+    const Vector3D& pvP    = pv.getPosition();
+    const Vector3D& pvV    = pv.getVelocity();
+    const double r         = pvP.getNorm();
+    const double rV2OnMu   = r * pvV.getNormSq() / mu;
+
+    // compute semi-major axis (will be negative for hyperbolic orbits)
+    a = r / (2.0 - rV2OnMu);
+    const double muA = mu * a;
+
+    // compute true anomaly
+    if (a > 0) {
+        // elliptic or circular orbit
+        const double eSE = pvP.dotProduct(pvV) / std::sqrt(muA);
+        const double eCE = rV2OnMu - 1.0;
+        e = std::sqrt(eSE * eSE + eCE * eCE);
+        v = KeplerianAnomalyUtility::ellipticEccentricToTrue(e, std::atan2(eSE, eCE));
+    }
+    else {
+        // hyperbolic orbit
+        const double eSH = pvP.dotProduct(pvV) / std::sqrt(-muA);
+        const double eCH = rV2OnMu - 1.0;
+        e = std::sqrt(1.0 - m2 / muA);
+        v = KeplerianAnomalyUtility::hyperbolicEccentricToTrue(e, 0.5 * std::log((eCH + eSH) / (eCH - eSH)));
+    }
+
+    // compute perigee argument
+    const Vector3D node(std::cos(raan), std::sin(raan), 0.0);
+    const double px = pvP.dotProduct(node);
+    const double py = pvP.dotProduct(momentum.crossProduct(node)) / std::sqrt(m2);
+    pa = std::atan2(py, px) - v;
+}
+
+KeplerianOrbit::KeplerianOrbit(const Orbit& orbit)
+    : KeplerianOrbit(orbit.getPVCoordinates(), orbit.getDate(), orbit.getMu())
+{
+
+}
+
+Orbit::Type KeplerianOrbit::getType() const
+{
+    return KEPLERIAN;
+}
+
+double KeplerianOrbit::getA() const
+{
+    return a;
+}
+
+double KeplerianOrbit::getE() const
+{
+    return e;
+}
+
+double KeplerianOrbit::getI() const
+{
+    return i;
+}
+
+double KeplerianOrbit::getPerigeeArgument() const
+{
+    return pa;
+}
+
+double KeplerianOrbit::getRightAscensionOfAscendingNode() const
+{
+    return raan;
+}
+
+double KeplerianOrbit::getAnomaly(PositionAngle type) const
+{
+    switch (type) {
+        case MEAN_ANOMALY:
+            return getMeanAnomaly();
+        case ECCENTRIC_ANOMALY:
+            return getEccentricAnomaly();
+        default:
+            return getTrueAnomaly();
+    }
+}
+
+double KeplerianOrbit::getTrueAnomaly() const
+{
+    return v;
+}
+
+double KeplerianOrbit::getEccentricAnomaly() const
+{
+    return (a < 0) ? KeplerianAnomalyUtility::hyperbolicTrueToEccentric(e, v) :
+                     KeplerianAnomalyUtility::ellipticTrueToEccentric(e, v);
+}
+
+double KeplerianOrbit::getMeanAnomaly() const
+{
+    return (a < 0) ? KeplerianAnomalyUtility::hyperbolicTrueToMean(e, v) :
+                     KeplerianAnomalyUtility::ellipticTrueToMean(e, v);
+}
+
+double KeplerianOrbit::getEquinoctialEx() const
+{
+    return e * std::cos(pa + raan);
+}
+
+double KeplerianOrbit::getEquinoctialEy() const
+{
+    return e * std::sin(pa + raan);
+}
+
+double KeplerianOrbit::getHx() const
+{
+    // check for equatorial retrograde orbit
+    if (std::abs(i - MathUtils::PI) < 1.0e-10) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    return std::cos(raan) * std::tan(0.5 * i);
+}
+
+double KeplerianOrbit::getHy() const
+{
+    // check for equatorial retrograde orbit
+    if (std::abs(i - MathUtils::PI) < 1.0e-10) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    return std::sin(raan) * std::tan(0.5 * i);
+}
+
+double KeplerianOrbit::getLv() const
+{
+    return pa + raan + v;
+}
+
+double KeplerianOrbit::getLE() const
+{
+    return pa + raan + getEccentricAnomaly();
+}
+
+double KeplerianOrbit::getLM() const
+{
+    return pa + raan + getMeanAnomaly();
+}
+
+PVCoordinates KeplerianOrbit::getPVCoordinates() const
+{
+    // preliminary variables
+    const double cosRaan = std::cos(raan);
+    const double sinRaan = std::sin(raan);
+    const double cosPa   = std::cos(pa);
+    const double sinPa   = std::sin(pa);
+    const double cosI    = std::cos(i);
+    const double sinI    = std::sin(i);
+
+    const double crcp    = cosRaan * cosPa;
+    const double crsp    = cosRaan * sinPa;
+    const double srcp    = sinRaan * cosPa;
+    const double srsp    = sinRaan * sinPa;
+
+    // reference axes defining the orbital plane
+    const Vector3D p(crcp - cosI * srsp, srcp + cosI * crsp, sinI * sinPa);
+    const Vector3D q(-crsp - cosI * srcp, -srsp + cosI * crcp, sinI * cosPa);
+
+    if (a > 0) {
+        // elliptical case
+
+        // elliptic eccentric anomaly
+        const double uME2   = (1.0 - e) * (1.0 + e);
+        const double s1Me2  = std::sqrt(uME2);
+        const double E      = getEccentricAnomaly();
+        const double cosE   = std::cos(E);
+        const double sinE   = std::sin(E);
+
+        // coordinates of position and velocity in the orbital plane
+        const double x      = a * (cosE - e);
+        const double y      = a * sinE * s1Me2;
+        const double factor = std::sqrt(getMu() / a) / (1.0 - e * cosE);
+        const double xDot   = -sinE * factor;
+        const double yDot   =  cosE * s1Me2 * factor;
+
+        return PVCoordinates(Vector3D(x, p, y, q), Vector3D(xDot, p, yDot, q));
+    }
+    else {
+        // hyperbolic case
+
+        // compute position and velocity factors
+        const double sinV      = std::sin(v);
+        const double cosV      = std::cos(v);
+        const double f         = a * (1.0 - e * e);
+        const double posFactor = f / (1.0 + e * cosV);
+        const double velFactor = std::sqrt(getMu() / f);
+
+        return PVCoordinates(Vector3D(posFactor * cosV, p, posFactor * sinV, q),
+                             Vector3D(-velFactor * sinV, p, velFactor * (e + cosV), q));
+    }
+}
+
+KeplerianOrbit KeplerianOrbit::shiftedBy(double dt) const
+{
+    return KeplerianOrbit(a, e, i, pa, raan, getMeanAnomaly() + getKeplerianMeanMotion() * dt, MEAN_ANOMALY,
+                          getDate().shiftedBy(dt), getMu());
+}
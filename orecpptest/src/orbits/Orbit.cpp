@@ -0,0 +1,49 @@
+#include "orbits/Orbit.h"
+#include "utils/MathUtils.h"
+#include <cmath>
+#include <limits>
+
+Orbit::Orbit(const LinearTime& date, double mu)
+    : date(date), mu(mu)
+{
+
+}
+
+Orbit::~Orbit()
+{
+
+}
+
+const LinearTime& Orbit::getDate() const
+{
+    return date;
+}
+
+double Orbit::getMu() const
+{
+    return mu;
+}
+
+double Orbit::getKeplerianPeriod() const
+{
+    const double a = getA();
+    return (a < 0) ? std::numeric_limits<double>::infinity() : MathUtils::TWO_PI * a * std::sqrt(a / mu);
+}
+
+double Orbit::getKeplerianMeanMotion() const
+{
+    const double absA = std::abs(getA());
+    return std::sqrt(mu / absA) / absA;
+}
+
+bool Orbit::isElliptical() const
+{
+    return getA() > 0;
+}
+
+double Orbit::computeA(const PVCoordinates& pv, double mu)
+{
+    const double r  = pv.getPosition().getNorm();
+    const double v2 = pv.getVelocity().getNormSq();
+    return r / (2.0 - r * v2 / mu);
+}
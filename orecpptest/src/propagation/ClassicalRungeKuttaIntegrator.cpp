@@ -0,0 +1,62 @@
+#include "propagation/ClassicalRungeKuttaIntegrator.h"
+#include <cmath>
+
+ClassicalRungeKuttaIntegrator::ClassicalRungeKuttaIntegrator(double step)
+    : fixedStep(std::fabs(step))
+{
+
+}
+
+double ClassicalRungeKuttaIntegrator::getStep() const
+{
+    return fixedStep;
+}
+
+bool ClassicalRungeKuttaIntegrator::step(Equations& equations, double& t, double* y, double* yDot, double& h,
+                                         double tEnd, StepInterpolator& interpolator)
+{
+    if (!(fixedStep > 0)) {
+        // a null step would never reach tEnd
+        return false;
+    }
+
+    const double remaining = tEnd - t;
+    const double stepSize  = (std::fabs(remaining) <= fixedStep) ? remaining :
+                             (remaining < 0) ? -fixedStep : fixedStep;
+    const double half = 0.5 * stepSize;
+
+    for (int i = 0; i < N; ++i) {
+        y0[i]   = y[i];
+        f0[i]   = yDot[i];
+        yTmp[i] = y0[i] + half * f0[i];
+    }
+    equations.computeDerivatives(t + half, yTmp, k2);
+
+    for (int i = 0; i < N; ++i) {
+        yTmp[i] = y0[i] + half * k2[i];
+    }
+    equations.computeDerivatives(t + half, yTmp, k3);
+
+    for (int i = 0; i < N; ++i) {
+        yTmp[i] = y0[i] + stepSize * k3[i];
+    }
+    const double t1 = (stepSize == remaining) ? tEnd : t + stepSize;
+    equations.computeDerivatives(t1, yTmp, k4);
+
+    const double sixth = stepSize / 6.0;
+    for (int i = 0; i < N; ++i) {
+        y[i] = y0[i] + sixth * (f0[i] + 2.0 * (k2[i] + k3[i]) + k4[i]);
+    }
+    equations.computeDerivatives(t1, y, yDot);
+
+    interpolator.initialize(t, stepSize, y0, y, f0, yDot);
+    interpolator.currentTime = t1;
+    t = t1;
+    h = stepSize;
+    return true;
+}
+
+void ClassicalRungeKuttaIntegrator::prepareInterpolation(Equations&, StepInterpolator&)
+{
+
+}
@@ -0,0 +1,279 @@
+#include "propagation/DormandPrince853Integrator.h"
+#include <cmath>
+
+namespace {
+
+    /** Number of stages. */
+    const int STAGES = DormandPrince853Integrator::STAGES;
+
+    /** Stage times. */
+    const double C[STAGES] = {
+        0.0, 0.05260015195876773, 0.0789002279381516, 0.1183503419072274, 0.2816496580927726, 0.3333333333333333,
+        0.25, 0.3076923076923077, 0.6512820512820513, 0.6, 0.8571428571428571, 1.0, 1.0, 0.1, 0.2, 0.7777777777777778
+    };
+
+    /** Runge-Kutta matrix (row 13 is unused, stage 13 is the derivative at step end). */
+    const double A[STAGES][STAGES] = {
+        { 0.0 },
+        { 0.05260015195876773 },
+        { 0.0197250569845379, 0.0591751709536137 },
+        { 0.02958758547680685, 0.0, 0.08876275643042054 },
+        { 0.2413651341592667, 0.0, -0.8845494793282861, 0.924834003261792 },
+        { 0.037037037037037035, 0.0, 0.0, 0.17082860872947386, 0.12546768756682242 },
+        { 0.037109375, 0.0, 0.0, 0.17025221101954405, 0.06021653898045596, -0.017578125 },
+        { 0.03709200011850479, 0.0, 0.0, 0.17038392571223998, 0.10726203044637328, -0.015319437748624402,
+          0.008273789163814023 },
+        { 0.6241109587160757, 0.0, 0.0, -3.3608926294469414, -0.868219346841726, 27.59209969944671,
+          20.154067550477894, -43.48988418106996 },
+        { 0.47766253643826434, 0.0, 0.0, -2.4881146199716677, -0.590290826836843, 21.230051448181193,
+          15.279233632882423, -33.28821096898486, -0.020331201708508627 },
+        { -0.9371424300859873, 0.0, 0.0, 5.186372428844064, 1.0914373489967295, -8.149787010746927,
+          -18.52006565999696, 22.739487099350505, 2.4936055526796523, -3.0467644718982196 },
+        { 2.273310147516538, 0.0, 0.0, -10.53449546673725, -2.0008720582248625, -17.9589318631188, 27.94888452941996,
+          -2.8589982771350235, -8.87285693353063, 12.360567175794303, 0.6433927460157636 },
+        { 0.0 },
+        { 0.056167502283047954, 0.0, 0.0, 0.0, 0.0, 0.0, 0.25350021021662483, -0.2462390374708025,
+          -0.12419142326381637, 0.15329179827876568, 0.00820105229563469, 0.007567897660545699, -0.008298 },
+        { 0.03183464816350214, 0.0, 0.0, 0.0, 0.0, 0.028300909672366776, 0.053541988307438566, -0.05492374857139099,
+          0.0, 0.0, -0.00010834732869724932, 0.0003825710908356584, -0.00034046500868740456, 0.1413124436746325 },
+        { -0.42889630158379194, 0.0, 0.0, 0.0, 0.0, -4.697621415361164, 7.683421196062599, 4.06898981839711,
+          0.3567271874552811, 0.0, 0.0, 0.0, -0.0013990241651590145, 2.9475147891527724, -9.15095847217987 }
+    };
+
+    /** Eighth order weights. */
+    const double B[12] = {
+        0.054293734116568765, 0.0, 0.0, 0.0, 0.0, 4.450312892752409, 1.8915178993145003, -5.801203960010585,
+        0.3111643669578199, -0.1521609496625161, 0.20136540080403034, 0.04471061572777259
+    };
+
+    /** Fifth order error estimator weights. */
+    const double E[12] = {
+        0.01312004499419488, 0.0, 0.0, 0.0, 0.0, -1.2251564463762044, -0.4957589496572502, 1.6643771824549864,
+        -0.35032884874997366, 0.3341791187130175, 0.08192320648511571, -0.022355307863886294
+    };
+
+    /** Third order error estimator weights, on stages 1, 9 and 12. */
+    const double BHH1 = 0.2440944881889764;
+    const double BHH9 = 0.7338466882816118;
+    const double BHH12 = 0.022058823529411766;
+
+    /** Dense output weights of terms r5 to r8. */
+    const double D[4][STAGES] = {
+        { -8.428938276109013, 0.0, 0.0, 0.0, 0.0, 0.5667149535193777, -3.0689499459498917, 2.38466765651207,
+          2.117034582445028, -0.871391583777973, 2.2404374302607883, 0.6315787787694688, -0.08899033645133331,
+          18.148505520854727, -9.194632392478356, -4.436036387594894 },
+        { 10.427508642579134, 0.0, 0.0, 0.0, 0.0, 242.28349177525817, 165.20045171727028, -374.5467547226902,
+          -22.113666853125306, 7.733432668472264, -30.674084731089398, -9.332130526430229, 15.697238121770845,
+          -31.139403219565178, -9.35292435884448, 35.81684148639408 },
+        { 19.985053242002433, 0.0, 0.0, 0.0, 0.0, -387.0373087493518, -189.17813819516758, 527.8081592054236,
+          -11.57390253995963, 6.8812326946963, -1.0006050966910838, 0.7777137798053443, -2.778205752353508,
+          -60.19669523126412, 84.32040550667716, 11.99229113618279 },
+        { -25.69393346270375, 0.0, 0.0, 0.0, 0.0, -154.18974869023643, -231.5293791760455, 357.6391179106141,
+          93.40532418362432, -37.45832313645163, 104.0996495089623, 29.8402934266605, -43.53345659001114,
+          96.32455395918828, -39.17726167561544, -149.72683625798564 }
+    };
+
+    /** Safety factor of the step size control. */
+    const double SAFETY = 0.9;
+
+    /** Minimal step size ratio. */
+    const double MIN_REDUCTION = 0.333;
+
+    /** Maximal step size ratio. */
+    const double MAX_GROWTH = 6.0;
+
+    /** Exponent of the step size control, 1 / (order of the error estimate + 1). */
+    const double EXPONENT = 1.0 / 8.0;
+
+}
+
+DormandPrince853Integrator::DormandPrince853Integrator(double minStep, double maxStep, double absTol, double relTol)
+    : minStep(std::fabs(minStep)), maxStep(std::fabs(maxStep)), t0(0), h0(0)
+{
+    for (int i = 0; i < N; ++i) {
+        this->absTol[i] = absTol;
+        this->relTol[i] = relTol;
+    }
+}
+
+DormandPrince853Integrator::DormandPrince853Integrator(double minStep, double maxStep,
+                                                       const double* absTol, const double* relTol)
+    : minStep(std::fabs(minStep)), maxStep(std::fabs(maxStep)), t0(0), h0(0)
+{
+    for (int i = 0; i < N; ++i) {
+        this->absTol[i] = absTol[i];
+        this->relTol[i] = relTol[i];
+    }
+}
+
+void DormandPrince853Integrator::computeStageState(int s)
+{
+    const double* a = A[s];
+    for (int i = 0; i < N; ++i) {
+        double sum = 0;
+        for (int j = 0; j < s; ++j) {
+            sum += a[j] * k[j][i];
+        }
+        yTmp[i] = y0[i] + h0 * sum;
+    }
+}
+
+double DormandPrince853Integrator::initializeStep(Equations& equations, double t, const double* y,
+                                                  const double* yDot, bool forward)
+{
+    // Hairer's estimate: the first order step size giving a 1% error on the scaled state,
+    // then the step size giving a 1% error with the second derivative, probed by an Euler step
+    double dny = 0;
+    double dnf = 0;
+    for (int i = 0; i < N; ++i) {
+        const double sk = absTol[i] + relTol[i] * std::fabs(y[i]);
+        dny += (y[i] / sk) * (y[i] / sk);
+        dnf += (yDot[i] / sk) * (yDot[i] / sk);
+    }
+    double h = (dnf <= 1.0e-10 || dny <= 1.0e-10) ? 1.0e-6 : 0.01 * std::sqrt(dny / dnf);
+    if (h > maxStep) {
+        h = maxStep;
+    }
+    const double signedH = forward ? h : -h;
+
+    for (int i = 0; i < N; ++i) {
+        yTmp[i] = y[i] + signedH * yDot[i];
+    }
+    double* f1 = k[1];
+    equations.computeDerivatives(t + signedH, yTmp, f1);
+
+    double der2 = 0;
+    for (int i = 0; i < N; ++i) {
+        const double sk = absTol[i] + relTol[i] * std::fabs(y[i]);
+        const double d  = (f1[i] - yDot[i]) / sk;
+        der2 += d * d;
+    }
+    der2 = std::sqrt(der2) / h;
+    const double der12 = std::fmax(der2, std::sqrt(dnf));
+    const double h1 = (der12 <= 1.0e-15) ? std::fmax(1.0e-6, 1.0e-3 * h) : std::pow(0.01 / der12, EXPONENT);
+
+    h = std::fmin(std::fmin(100.0 * h, h1), maxStep);
+    if (h < minStep) {
+        h = minStep;
+    }
+    return forward ? h : -h;
+}
+
+bool DormandPrince853Integrator::step(Equations& equations, double& t, double* y, double* yDot, double& h,
+                                      double tEnd, StepInterpolator& interpolator)
+{
+    if (!(maxStep > 0)) {
+        // null steps would never reach tEnd
+        return false;
+    }
+
+    const bool forward = tEnd >= t;
+    if (h == 0 || (h > 0) != forward) {
+        h = initializeStep(equations, t, y, yDot, forward);
+    }
+
+    t0 = t;
+    for (int i = 0; i < N; ++i) {
+        y0[i]   = y[i];
+        k[0][i] = yDot[i];
+    }
+
+    bool rejected = false;
+    while (true) {
+
+        // stop exactly at the integration limit
+        bool last = false;
+        h0 = h;
+        if ((forward && t0 + h0 >= tEnd) || (!forward && t0 + h0 <= tEnd)) {
+            h0   = tEnd - t0;
+            last = true;
+        }
+
+        for (int s = 1; s < 12; ++s) {
+            computeStageState(s);
+            equations.computeDerivatives(t0 + C[s] * h0, yTmp, k[s]);
+        }
+
+        // eighth order solution and error estimates
+        double err  = 0;
+        double err2 = 0;
+        for (int i = 0; i < N; ++i) {
+            double sumB = 0;
+            double sumE = 0;
+            for (int j = 0; j < 12; ++j) {
+                sumB += B[j] * k[j][i];
+                sumE += E[j] * k[j][i];
+            }
+            yTmp[i] = y0[i] + h0 * sumB;
+            const double sk = absTol[i] + relTol[i] * std::fmax(std::fabs(y0[i]), std::fabs(yTmp[i]));
+            const double e2 = (sumB - BHH1 * k[0][i] - BHH9 * k[8][i] - BHH12 * k[11][i]) / sk;
+            const double e  = sumE / sk;
+            err2 += e2 * e2;
+            err  += e * e;
+        }
+        double deno = err + 0.01 * err2;
+        if (deno <= 0) {
+            deno = 1;
+        }
+        err = std::fabs(h0) * err * std::sqrt(1.0 / (N * deno));
+
+        const double fac11 = std::pow(err, EXPONENT);
+        if (err <= 1) {
+
+            // accepted step, the derivative at step end is the first stage of the next step
+            const double t1 = last ? tEnd : t0 + h0;
+            equations.computeDerivatives(t1, yTmp, k[12]);
+            for (int i = 0; i < N; ++i) {
+                y[i]    = yTmp[i];
+                yDot[i] = k[12][i];
+            }
+            interpolator.initialize(t0, h0, y0, y, k[0], yDot);
+            interpolator.currentTime = t1;
+            t = t1;
+
+            double fac = fac11 / SAFETY;
+            fac = (fac < 1.0 / MAX_GROWTH) ? 1.0 / MAX_GROWTH : (fac > 1.0 / MIN_REDUCTION) ? 1.0 / MIN_REDUCTION : fac;
+            double hNew = std::fabs(h0) / fac;
+            if (rejected && hNew > std::fabs(h0)) {
+                hNew = std::fabs(h0);
+            }
+            if (last && std::fabs(h) > hNew) {
+                // a truncated last step says nothing about the step size the dynamics allow
+                hNew = std::fabs(h);
+            }
+            hNew = (hNew > maxStep) ? maxStep : (hNew < minStep) ? minStep : hNew;
+            h = forward ? hNew : -hNew;
+            return true;
+
+        }
+
+        // rejected step
+        const double fac = fac11 / SAFETY;
+        const double hNew = std::fabs(h0) / ((fac > 1.0 / MIN_REDUCTION) ? 1.0 / MIN_REDUCTION : fac);
+        if (!(hNew >= minStep)) {
+            return false;
+        }
+        h = forward ? hNew : -hNew;
+        rejected = true;
+
+    }
+}
+
+void DormandPrince853Integrator::prepareInterpolation(Equations& equations, StepInterpolator& interpolator)
+{
+    for (int s = 13; s < STAGES; ++s) {
+        computeStageState(s);
+        equations.computeDerivatives(t0 + C[s] * h0, yTmp, k[s]);
+    }
+
+    for (int d = 0; d < 4; ++d) {
+        for (int i = 0; i < N; ++i) {
+            double sum = 0;
+            for (int j = 0; j < STAGES; ++j) {
+                sum += D[d][j] * k[j][i];
+            }
+            interpolator.coefficients[4 + d][i] = h0 * sum;
+        }
+    }
+    interpolator.terms = StepInterpolator::MAX_TERMS;
+}
@@ -0,0 +1,98 @@
+#include "propagation/EcksteinHechlerBatchPropagator.h"
+#include "propagation/EcksteinHechlerKernels.h"
+#include "propagation/EcksteinHechlerPropagator.h"
+#include <algorithm>
+
+EcksteinHechlerBatchPropagator::EcksteinHechlerBatchPropagator(double referenceRadius, double mu,
+                                                               double c20, double c30, double c40,
+                                                               double c50, double c60)
+    : referenceRadius(referenceRadius), mu(mu), size(0), capacity(0)
+{
+    ck0[0] = 0.0;
+    ck0[1] = 0.0;
+    ck0[2] = c20;
+    ck0[3] = c30;
+    ck0[4] = c40;
+    ck0[5] = c50;
+    ck0[6] = c60;
+}
+
+void EcksteinHechlerBatchPropagator::reserve(size_t newCapacity)
+{
+    if (newCapacity <= capacity) {
+        return;
+    }
+
+    // the capacity is the stride of the table, all constants columns move
+    std::vector<double> table(EcksteinHechlerKernels::CONSTANTS * newCapacity);
+    for (int c = 0; c < EcksteinHechlerKernels::CONSTANTS; ++c) {
+        std::copy(constants.begin() + c * capacity, constants.begin() + c * capacity + size,
+                  table.begin() + c * newCapacity);
+    }
+    constants.swap(table);
+    capacity = newCapacity;
+    epochs.reserve(newCapacity);
+}
+
+bool EcksteinHechlerBatchPropagator::addOrbit(const Orbit& orbit)
+{
+    if (size == capacity) {
+        reserve(std::max(size_t(16), 2 * capacity));
+    }
+
+    // a rejected orbit leaves NaN in the free slot, which is overwritten by the next one
+    if (EcksteinHechlerPropagator::initialize(orbit, referenceRadius, mu, ck0,
+                                              constants.data() + size, capacity) != EcksteinHechlerPropagator::VALID) {
+        return false;
+    }
+    epochs.push_back(orbit.getDate());
+    ++size;
+    return true;
+}
+
+size_t EcksteinHechlerBatchPropagator::getSize() const
+{
+    return size;
+}
+
+void EcksteinHechlerBatchPropagator::propagate(const LinearTime* dates, size_t count,
+                                               double* x, double* y, double* z,
+                                               double* vx, double* vy, double* vz) const
+{
+    // dates are converted once per block, relative to the first date of the block
+    double offsets[EcksteinHechlerKernels::BLOCK_SIZE];
+    double dt[EcksteinHechlerKernels::BLOCK_SIZE];
+    for (size_t start = 0; start < count; start += EcksteinHechlerKernels::BLOCK_SIZE) {
+        const size_t blockSize = (count - start < EcksteinHechlerKernels::BLOCK_SIZE) ?
+                                 count - start : EcksteinHechlerKernels::BLOCK_SIZE;
+        const LinearTime& reference = dates[start];
+        for (size_t k = 0; k < blockSize; ++k) {
+            offsets[k] = dates[start + k].durationFrom(reference);
+        }
+        for (size_t s = 0; s < size; ++s) {
+            const double shift = reference.durationFrom(epochs[s]);
+            for (size_t k = 0; k < blockSize; ++k) {
+                dt[k] = shift + offsets[k];
+            }
+            const size_t first = s * count + start;
+            EcksteinHechlerKernels::propagate(constants.data() + s, capacity, dt, blockSize,
+                                              x + first, y + first, z + first, vx + first, vy + first, vz + first);
+        }
+    }
+}
+
+void EcksteinHechlerBatchPropagator::propagate(const LinearTime& date,
+                                               double* x, double* y, double* z,
+                                               double* vx, double* vy, double* vz) const
+{
+    double dt[EcksteinHechlerKernels::BLOCK_SIZE];
+    for (size_t start = 0; start < size; start += EcksteinHechlerKernels::BLOCK_SIZE) {
+        const size_t blockSize = (size - start < EcksteinHechlerKernels::BLOCK_SIZE) ?
+                                 size - start : EcksteinHechlerKernels::BLOCK_SIZE;
+        for (size_t k = 0; k < blockSize; ++k) {
+            dt[k] = date.durationFrom(epochs[start + k]);
+        }
+        EcksteinHechlerKernels::propagateOrbits(constants.data() + start, capacity, dt, blockSize,
+                                                x + start, y + start, z + start, vx + start, vy + start, vz + start);
+    }
+}
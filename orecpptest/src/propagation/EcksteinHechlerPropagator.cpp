@@ -0,0 +1,190 @@
+#include "propagation/EcksteinHechlerPropagator.h"
+#include "utils/MathUtils.h"
+#include <cmath>
+#include <limits>
+
+namespace {
+
+    /** Convergence threshold of the mean parameters computation. */
+    const double EPSILON = 1.0e-13;
+
+    /** Maximal number of iterations of the mean parameters computation. */
+    const int MAX_ITERATIONS = 100;
+
+    /** Check if mean parameters can be handled by the model.
+     * @param i mean inclination (rad)
+     * @param e mean eccentricity
+     * @return status of the parameters
+     */
+    EcksteinHechlerPropagator::Status check(double i, double e)
+    {
+        const double sinI  = std::sin(i);
+        const double sinI2 = sinI * sinI;
+        if (sinI2 < 1.0e-10) {
+            return EcksteinHechlerPropagator::ALMOST_EQUATORIAL_ORBIT;
+        }
+        if (std::abs(sinI2 - 4.0 / 5.0) < 1.0e-3) {
+            return EcksteinHechlerPropagator::ALMOST_CRITICALLY_INCLINED_ORBIT;
+        }
+        if (e > 0.1) {
+            // below 0.1 but above 0.005 no error is reported, but accuracy is poor
+            return EcksteinHechlerPropagator::TOO_LARGE_ECCENTRICITY;
+        }
+        return EcksteinHechlerPropagator::VALID;
+    }
+
+    /** Set all constants to NaN.
+     * @param constants orbit constants
+     * @param stride distance between two consecutive constants
+     */
+    void invalidate(double* constants, size_t stride)
+    {
+        for (int c = 0; c < EcksteinHechlerKernels::CONSTANTS; ++c) {
+            constants[c * stride] = std::numeric_limits<double>::quiet_NaN();
+        }
+    }
+
+}
+
+EcksteinHechlerPropagator::EcksteinHechlerPropagator(const Orbit& initialOrbit, double referenceRadius, double mu,
+                                                     double c20, double c30, double c40, double c50, double c60)
+    : initialOrbit(initialOrbit), referenceRadius(referenceRadius), mu(mu)
+{
+    const double ck0[] = { 0.0, 0.0, c20, c30, c40, c50, c60 };
+    status = initialize(initialOrbit, referenceRadius, mu, ck0, constants, 1);
+}
+
+EcksteinHechlerPropagator::Status EcksteinHechlerPropagator::initialize(const Orbit& osculating,
+                                                                        double referenceRadius, double mu,
+                                                                        const double* ck0,
+                                                                        double* constants, size_t stride)
+{
+    const CircularOrbit circular(osculating);
+    if (circular.getA() < referenceRadius) {
+        invalidate(constants, stride);
+        return TRAJECTORY_INSIDE_BRILLOUIN_SPHERE;
+    }
+
+    const double thresholdA      = EPSILON * (1.0 + std::abs(circular.getA()));
+    const double thresholdE      = EPSILON * (1.0 + circular.getE());
+    const double thresholdAngles = EPSILON * MathUtils::PI;
+
+    // rough initialization of the mean parameters with the osculating ones
+    double a      = circular.getA();
+    double ex     = circular.getCircularEx();
+    double ey     = circular.getCircularEy();
+    double i      = circular.getI();
+    double raan   = circular.getRightAscensionOfAscendingNode();
+    double alphaM = circular.getAlphaM();
+    for (int iteration = 0; iteration < MAX_ITERATIONS; ++iteration) {
+        const Status meanStatus = check(i, std::sqrt(ex * ex + ey * ey));
+        if (meanStatus != VALID) {
+            invalidate(constants, stride);
+            return meanStatus;
+        }
+        EcksteinHechlerKernels::initialize(a, ex, ey, i, raan, alphaM, referenceRadius, mu, ck0, constants, stride);
+
+        // recompute the osculating parameters from the current mean parameters
+        double oscA, oscEx, oscEy, oscI, oscRaan, oscAlphaM;
+        EcksteinHechlerKernels::osculatingParameters(constants, stride, 0.0,
+                                                     oscA, oscEx, oscEy, oscI, oscRaan, oscAlphaM);
+
+        // update the mean parameters with the residuals
+        const double deltaA      = circular.getA() - oscA;
+        const double deltaEx     = circular.getCircularEx() - oscEx;
+        const double deltaEy     = circular.getCircularEy() - oscEy;
+        const double deltaI      = circular.getI() - oscI;
+        const double deltaRaan   = MathUtils::normalizeAngle(circular.getRightAscensionOfAscendingNode() - oscRaan, 0.0);
+        const double deltaAlphaM = MathUtils::normalizeAngle(circular.getAlphaM() - oscAlphaM, 0.0);
+        a      += deltaA;
+        ex     += deltaEx;
+        ey     += deltaEy;
+        i      += deltaI;
+        raan   += deltaRaan;
+        alphaM += deltaAlphaM;
+
+        if (std::abs(deltaA)      < thresholdA &&
+            std::abs(deltaEx)     < thresholdE &&
+            std::abs(deltaEy)     < thresholdE &&
+            std::abs(deltaI)      < thresholdAngles &&
+            std::abs(deltaRaan)   < thresholdAngles &&
+            std::abs(deltaAlphaM) < thresholdAngles) {
+            const Status meanStatus = check(i, std::sqrt(ex * ex + ey * ey));
+            if (meanStatus != VALID) {
+                invalidate(constants, stride);
+                return meanStatus;
+            }
+            EcksteinHechlerKernels::initialize(a, ex, ey, i, raan, alphaM, referenceRadius, mu, ck0,
+                                               constants, stride);
+            return VALID;
+        }
+    }
+
+    invalidate(constants, stride);
+    return MEAN_PARAMETERS_NOT_CONVERGED;
+}
+
+EcksteinHechlerPropagator::Status EcksteinHechlerPropagator::getStatus() const
+{
+    return status;
+}
+
+bool EcksteinHechlerPropagator::isValid() const
+{
+    return status == VALID;
+}
+
+const CartesianOrbit& EcksteinHechlerPropagator::getInitialOrbit() const
+{
+    return initialOrbit;
+}
+
+CircularOrbit EcksteinHechlerPropagator::getMeanOrbit() const
+{
+    return CircularOrbit(constants[EcksteinHechlerKernels::A], constants[EcksteinHechlerKernels::EX],
+                         constants[EcksteinHechlerKernels::EY], constants[EcksteinHechlerKernels::I],
+                         constants[EcksteinHechlerKernels::RAAN], constants[EcksteinHechlerKernels::ALPHA_M],
+                         Orbit::MEAN_ANOMALY, initialOrbit.getDate(), mu);
+}
+
+double EcksteinHechlerPropagator::getReferenceRadius() const
+{
+    return referenceRadius;
+}
+
+double EcksteinHechlerPropagator::getMu() const
+{
+    return mu;
+}
+
+CircularOrbit EcksteinHechlerPropagator::propagate(const LinearTime& date) const
+{
+    double a, ex, ey, i, raan, alphaM;
+    EcksteinHechlerKernels::osculatingParameters(constants, 1, date.durationFrom(initialOrbit.getDate()),
+                                                 a, ex, ey, i, raan, alphaM);
+    return CircularOrbit(a, ex, ey, i, raan, alphaM, Orbit::MEAN_ANOMALY, date, mu);
+}
+
+PVCoordinates EcksteinHechlerPropagator::getPVCoordinates(const LinearTime& date) const
+{
+    double x, y, z, vx, vy, vz;
+    EcksteinHechlerKernels::propagate(constants, 1, date.durationFrom(initialOrbit.getDate()),
+                                      x, y, z, vx, vy, vz);
+    return PVCoordinates(Vector3D(x, y, z), Vector3D(vx, vy, vz));
+}
+
+void EcksteinHechlerPropagator::getPVCoordinates(const LinearTime* dates, size_t count,
+                                                 double* x, double* y, double* z,
+                                                 double* vx, double* vy, double* vz) const
+{
+    double dt[EcksteinHechlerKernels::BLOCK_SIZE];
+    for (size_t start = 0; start < count; start += EcksteinHechlerKernels::BLOCK_SIZE) {
+        const size_t size = (count - start < EcksteinHechlerKernels::BLOCK_SIZE) ?
+                            count - start : EcksteinHechlerKernels::BLOCK_SIZE;
+        for (size_t k = 0; k < size; ++k) {
+            dt[k] = dates[start + k].durationFrom(initialOrbit.getDate());
+        }
+        EcksteinHechlerKernels::propagate(constants, 1, dt, size,
+                                          x + start, y + start, z + start, vx + start, vy + start, vz + start);
+    }
+}
@@ -0,0 +1,90 @@
+#include "propagation/KeplerianBatchPropagator.h"
+#include "propagation/KeplerianKernels.h"
+#include <algorithm>
+
+KeplerianBatchPropagator::KeplerianBatchPropagator()
+    : size(0), capacity(0), maxIterations(0)
+{
+
+}
+
+void KeplerianBatchPropagator::reserve(size_t newCapacity)
+{
+    if (newCapacity <= capacity) {
+        return;
+    }
+
+    // the capacity is the stride of the table, all constants columns move
+    std::vector<double> table(KeplerianKernels::CONSTANTS * newCapacity);
+    for (int c = 0; c < KeplerianKernels::CONSTANTS; ++c) {
+        std::copy(constants.begin() + c * capacity, constants.begin() + c * capacity + size,
+                  table.begin() + c * newCapacity);
+    }
+    constants.swap(table);
+    capacity = newCapacity;
+    epochs.reserve(newCapacity);
+    iterations.reserve(newCapacity);
+}
+
+bool KeplerianBatchPropagator::addOrbit(const Orbit& orbit)
+{
+    if (!orbit.isElliptical()) {
+        return false;
+    }
+    if (size == capacity) {
+        reserve(std::max(size_t(16), 2 * capacity));
+    }
+    KeplerianKernels::initialize(orbit.getA(), orbit.getEquinoctialEx(), orbit.getEquinoctialEy(),
+                                 orbit.getHx(), orbit.getHy(), orbit.getLM(), orbit.getMu(),
+                                 constants.data() + size, capacity);
+    epochs.push_back(orbit.getDate());
+    iterations.push_back(KeplerianKernels::getIterations(orbit.getE()));
+    maxIterations = std::max(maxIterations, iterations.back());
+    ++size;
+    return true;
+}
+
+size_t KeplerianBatchPropagator::getSize() const
+{
+    return size;
+}
+
+void KeplerianBatchPropagator::propagate(const LinearTime* dates, size_t count,
+                                         double* x, double* y, double* z,
+                                         double* vx, double* vy, double* vz) const
+{
+    // dates are converted once per block, relative to the first date of the block
+    double offsets[KeplerianKernels::BLOCK_SIZE];
+    double dt[KeplerianKernels::BLOCK_SIZE];
+    for (size_t start = 0; start < count; start += KeplerianKernels::BLOCK_SIZE) {
+        const size_t blockSize = (count - start < KeplerianKernels::BLOCK_SIZE) ? count - start : KeplerianKernels::BLOCK_SIZE;
+        const LinearTime& reference = dates[start];
+        for (size_t k = 0; k < blockSize; ++k) {
+            offsets[k] = dates[start + k].durationFrom(reference);
+        }
+        for (size_t s = 0; s < size; ++s) {
+            const double shift = reference.durationFrom(epochs[s]);
+            for (size_t k = 0; k < blockSize; ++k) {
+                dt[k] = shift + offsets[k];
+            }
+            const size_t first = s * count + start;
+            KeplerianKernels::propagate(constants.data() + s, capacity, iterations[s], dt, blockSize,
+                                        x + first, y + first, z + first, vx + first, vy + first, vz + first);
+        }
+    }
+}
+
+void KeplerianBatchPropagator::propagate(const LinearTime& date,
+                                         double* x, double* y, double* z,
+                                         double* vx, double* vy, double* vz) const
+{
+    double dt[KeplerianKernels::BLOCK_SIZE];
+    for (size_t start = 0; start < size; start += KeplerianKernels::BLOCK_SIZE) {
+        const size_t blockSize = (size - start < KeplerianKernels::BLOCK_SIZE) ? size - start : KeplerianKernels::BLOCK_SIZE;
+        for (size_t k = 0; k < blockSize; ++k) {
+            dt[k] = date.durationFrom(epochs[start + k]);
+        }
+        KeplerianKernels::propagateOrbits(constants.data() + start, capacity, maxIterations, dt, blockSize,
+                                          x + start, y + start, z + start, vx + start, vy + start, vz + start);
+    }
+}
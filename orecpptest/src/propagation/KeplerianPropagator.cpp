@@ -0,0 +1,104 @@
+#include "propagation/KeplerianPropagator.h"
+#include "orbits/EquinoctialOrbit.h"
+#include "orbits/KeplerianOrbit.h"
+#include <algorithm>
+
+namespace {
+
+    /** Get an orbit with the same parameters and another central attraction coefficient.
+     * @param orbit orbit
+     * @param mu central attraction coefficient (m³/s²)
+     * @return orbit with the new central attraction coefficient
+     */
+    CartesianOrbit changeMu(const Orbit& orbit, double mu)
+    {
+        if (orbit.isElliptical()) {
+            return CartesianOrbit(EquinoctialOrbit(orbit.getA(), orbit.getEquinoctialEx(), orbit.getEquinoctialEy(),
+                                                   orbit.getHx(), orbit.getHy(), orbit.getLv(),
+                                                   Orbit::TRUE_ANOMALY, orbit.getDate(), mu));
+        }
+        const KeplerianOrbit keplerian(orbit);
+        return CartesianOrbit(KeplerianOrbit(keplerian.getA(), keplerian.getE(), keplerian.getI(),
+                                             keplerian.getPerigeeArgument(),
+                                             keplerian.getRightAscensionOfAscendingNode(),
+                                             keplerian.getTrueAnomaly(), Orbit::TRUE_ANOMALY,
+                                             orbit.getDate(), mu));
+    }
+
+}
+
+KeplerianPropagator::KeplerianPropagator(const Orbit& initialOrbit)
+    : initialOrbit(initialOrbit)
+{
+    initialize();
+}
+
+KeplerianPropagator::KeplerianPropagator(const Orbit& initialOrbit, double mu)
+    : initialOrbit(changeMu(initialOrbit, mu))
+{
+    initialize();
+}
+
+void KeplerianPropagator::initialize()
+{
+    iterations = KeplerianKernels::getIterations(initialOrbit.getE());
+    if (initialOrbit.isElliptical()) {
+        KeplerianKernels::initialize(initialOrbit.getA(),
+                                     initialOrbit.getEquinoctialEx(), initialOrbit.getEquinoctialEy(),
+                                     initialOrbit.getHx(), initialOrbit.getHy(), initialOrbit.getLM(),
+                                     initialOrbit.getMu(), constants, 1);
+    }
+}
+
+const CartesianOrbit& KeplerianPropagator::getInitialOrbit() const
+{
+    return initialOrbit;
+}
+
+double KeplerianPropagator::getMu() const
+{
+    return initialOrbit.getMu();
+}
+
+CartesianOrbit KeplerianPropagator::propagate(const LinearTime& date) const
+{
+    return CartesianOrbit(getPVCoordinates(date), date, initialOrbit.getMu());
+}
+
+PVCoordinates KeplerianPropagator::getPVCoordinates(const LinearTime& date) const
+{
+    const double dt = date.durationFrom(initialOrbit.getDate());
+    if (!initialOrbit.isElliptical()) {
+        return initialOrbit.shiftedBy(dt).getPVCoordinates();
+    }
+    double x, y, z, vx, vy, vz;
+    KeplerianKernels::propagate(constants, 1, iterations, dt, x, y, z, vx, vy, vz);
+    return PVCoordinates(Vector3D(x, y, z), Vector3D(vx, vy, vz));
+}
+
+void KeplerianPropagator::getPVCoordinates(const LinearTime* dates, size_t count,
+                                           double* x, double* y, double* z,
+                                           double* vx, double* vy, double* vz) const
+{
+    if (!initialOrbit.isElliptical()) {
+        for (size_t k = 0; k < count; ++k) {
+            const PVCoordinates pv = getPVCoordinates(dates[k]);
+            x[k]  = pv.getPosition().getX();
+            y[k]  = pv.getPosition().getY();
+            z[k]  = pv.getPosition().getZ();
+            vx[k] = pv.getVelocity().getX();
+            vy[k] = pv.getVelocity().getY();
+            vz[k] = pv.getVelocity().getZ();
+        }
+        return;
+    }
+    double dt[KeplerianKernels::BLOCK_SIZE];
+    for (size_t start = 0; start < count; start += KeplerianKernels::BLOCK_SIZE) {
+        const size_t size = (count - start < KeplerianKernels::BLOCK_SIZE) ? count - start : KeplerianKernels::BLOCK_SIZE;
+        for (size_t k = 0; k < size; ++k) {
+            dt[k] = dates[start + k].durationFrom(initialOrbit.getDate());
+        }
+        KeplerianKernels::propagate(constants, 1, iterations, dt, size,
+                                    x + start, y + start, z + start, vx + start, vy + start, vz + start);
+    }
+}
@@ -0,0 +1,160 @@
+#include "propagation/NumericalPropagator.h"
+#include <cmath>
+#include <limits>
+
+NumericalPropagator::NumericalPropagator(const Orbit& initialOrbit, ODEIntegrator& integrator)
+    : integrator(integrator), mu(initialOrbit.getMu()), epoch(initialOrbit.getDate()), t(0), h(0),
+      derivativesValid(false), evaluations(0), status(VALID), interpolator()
+{
+    const PVCoordinates pv = initialOrbit.getPVCoordinates();
+    state[0] = pv.getPosition().getX();
+    state[1] = pv.getPosition().getY();
+    state[2] = pv.getPosition().getZ();
+    state[3] = pv.getVelocity().getX();
+    state[4] = pv.getVelocity().getY();
+    state[5] = pv.getVelocity().getZ();
+}
+
+void NumericalPropagator::addForceModel(const ForceModel& model)
+{
+    forceModels.push_back(&model);
+    derivativesValid = false;
+}
+
+void NumericalPropagator::computeDerivatives(double t, const double* y, double* yDot)
+{
+    ++evaluations;
+
+    // central attraction, then the force models add their contributions
+    const double r2 = y[0] * y[0] + y[1] * y[1] + y[2] * y[2];
+    const double k  = -mu / (r2 * std::sqrt(r2));
+    yDot[0] = y[3];
+    yDot[1] = y[4];
+    yDot[2] = y[5];
+    yDot[3] = k * y[0];
+    yDot[4] = k * y[1];
+    yDot[5] = k * y[2];
+
+    if (!forceModels.empty()) {
+        const LinearTime date = epoch.shiftedBy(t);
+        for (size_t i = 0; i < forceModels.size(); ++i) {
+            forceModels[i]->addAcceleration(date, y, yDot + 3);
+        }
+    }
+}
+
+bool NumericalPropagator::advance(double tEnd)
+{
+    if (!derivativesValid) {
+        computeDerivatives(t, state, stateDot);
+        derivativesValid = true;
+    }
+
+    // force models may require the step to stop before tEnd
+    double stepEnd = tEnd;
+    if (!forceModels.empty()) {
+        const LinearTime date = epoch.shiftedBy(t);
+        double maxStep = std::numeric_limits<double>::infinity();
+        for (size_t i = 0; i < forceModels.size(); ++i) {
+            maxStep = std::fmin(maxStep, forceModels[i]->getMaxStep(date, state));
+        }
+        if (tEnd >= t) {
+            stepEnd = (t + maxStep < tEnd) ? t + maxStep : tEnd;
+        }
+        else {
+            stepEnd = (t - maxStep > tEnd) ? t - maxStep : tEnd;
+        }
+    }
+    return integrator.step(*this, t, state, stateDot, h, stepEnd, interpolator);
+}
+
+NumericalPropagator::Status NumericalPropagator::propagate(const LinearTime& target)
+{
+    const double tEnd = target.durationFrom(epoch);
+    status = VALID;
+    while (t != tEnd) {
+        if (!advance(tEnd)) {
+            status = STEP_SIZE_UNDERFLOW;
+            break;
+        }
+    }
+    return status;
+}
+
+NumericalPropagator::Status NumericalPropagator::propagate(const LinearTime* dates, size_t count,
+                                                           double* x, double* y, double* z,
+                                                           double* vx, double* vy, double* vz)
+{
+    status = VALID;
+    if (count == 0) {
+        return status;
+    }
+
+    const double tEnd    = dates[count - 1].durationFrom(epoch);
+    const bool   forward = tEnd >= t;
+    bool   prepared = true;
+    double output[N];
+    for (size_t i = 0; i < count; ++i) {
+
+        const double ti = dates[i].durationFrom(epoch);
+        while (forward ? (ti > t) : (ti < t)) {
+            if (!advance(tEnd)) {
+                status = STEP_SIZE_UNDERFLOW;
+                const double nan = std::numeric_limits<double>::quiet_NaN();
+                for (size_t j = i; j < count; ++j) {
+                    x[j] = y[j] = z[j] = vx[j] = vy[j] = vz[j] = nan;
+                }
+                return status;
+            }
+            prepared = false;
+        }
+
+        const double* s = state;
+        if (ti != t) {
+            if (!prepared) {
+                integrator.prepareInterpolation(*this, interpolator);
+                prepared = true;
+            }
+            interpolator.interpolate(ti, output);
+            s = output;
+        }
+        x[i]  = s[0];
+        y[i]  = s[1];
+        z[i]  = s[2];
+        vx[i] = s[3];
+        vy[i] = s[4];
+        vz[i] = s[5];
+
+    }
+    return status;
+}
+
+LinearTime NumericalPropagator::getDate() const
+{
+    return epoch.shiftedBy(t);
+}
+
+PVCoordinates NumericalPropagator::getPVCoordinates() const
+{
+    return PVCoordinates(Vector3D(state[0], state[1], state[2]), Vector3D(state[3], state[4], state[5]));
+}
+
+CartesianOrbit NumericalPropagator::getOrbit() const
+{
+    return CartesianOrbit(getPVCoordinates(), getDate(), mu);
+}
+
+double NumericalPropagator::getMu() const
+{
+    return mu;
+}
+
+long long NumericalPropagator::getEvaluations() const
+{
+    return evaluations;
+}
+
+NumericalPropagator::Status NumericalPropagator::getStatus() const
+{
+    return status;
+}
@@ -0,0 +1,147 @@
+#include "propagation/SGP4CatalogPropagator.h"
+#include "propagation/SGP4Kernels.h"
+#include "propagation/SGP4Propagator.h"
+#include <algorithm>
+
+SGP4CatalogPropagator::SGP4CatalogPropagator()
+    : nearSize(0), capacity(0)
+{
+
+}
+
+void SGP4CatalogPropagator::reserve(size_t newCapacity)
+{
+    satelliteNumbers.reserve(newCapacity);
+    if (newCapacity <= capacity) {
+        return;
+    }
+
+    // the capacity is the stride of the table, all constants columns move
+    std::vector<double> table(SGP4Kernels::CONSTANTS * newCapacity);
+    for (int c = 0; c < SGP4Kernels::CONSTANTS; ++c) {
+        std::copy(constants.begin() + c * capacity, constants.begin() + c * capacity + nearSize,
+                  table.begin() + c * newCapacity);
+    }
+    constants.swap(table);
+    capacity = newCapacity;
+    nearEpochs.reserve(newCapacity);
+    nearIndices.reserve(newCapacity);
+}
+
+bool SGP4CatalogPropagator::addTLE(const TLE& tle)
+{
+    SGP4Record record;
+    if (SGP4Propagator::initialize(tle, record) != SGP4Propagator::VALID) {
+        return false;
+    }
+
+    if (record.deepSpace) {
+        deepRecords.push_back(record);
+        deepIndices.push_back(satelliteNumbers.size());
+    }
+    else {
+        if (nearSize == capacity) {
+            reserve(std::max(size_t(16), 2 * capacity));
+        }
+        SGP4Kernels::initialize(record, constants.data() + nearSize, capacity);
+        nearEpochs.push_back(record.epoch);
+        nearIndices.push_back(satelliteNumbers.size());
+        ++nearSize;
+    }
+    satelliteNumbers.push_back(tle.getSatelliteNumber());
+    return true;
+}
+
+size_t SGP4CatalogPropagator::getSize() const
+{
+    return satelliteNumbers.size();
+}
+
+size_t SGP4CatalogPropagator::getDeepSpaceSize() const
+{
+    return deepRecords.size();
+}
+
+int SGP4CatalogPropagator::getSatelliteNumber(size_t index) const
+{
+    return satelliteNumbers[index];
+}
+
+void SGP4CatalogPropagator::propagate(ThreadPool& pool, const LinearTime* dates, size_t count,
+                                      double* x, double* y, double* z,
+                                      double* vx, double* vy, double* vz) const
+{
+    if (count == 0) {
+        return;
+    }
+    const size_t nearBlocks = (nearSize + SGP4Kernels::BLOCK_SIZE - 1) / SGP4Kernels::BLOCK_SIZE;
+    const size_t deepBlocks = (deepRecords.size() + SGP4Kernels::BLOCK_SIZE - 1) / SGP4Kernels::BLOCK_SIZE;
+    pool.parallelFor(nearBlocks + deepBlocks, 1, [&](size_t begin, size_t end) {
+        for (size_t block = begin; block < end; ++block) {
+            propagateBlock(block, dates, count, x, y, z, vx, vy, vz);
+        }
+    });
+}
+
+void SGP4CatalogPropagator::propagate(ThreadPool& pool, const LinearTime& date,
+                                      double* x, double* y, double* z,
+                                      double* vx, double* vy, double* vz) const
+{
+    propagate(pool, &date, 1, x, y, z, vx, vy, vz);
+}
+
+void SGP4CatalogPropagator::propagateBlock(size_t block, const LinearTime* dates, size_t count,
+                                           double* x, double* y, double* z,
+                                           double* vx, double* vy, double* vz) const
+{
+    const size_t nearBlocks = (nearSize + SGP4Kernels::BLOCK_SIZE - 1) / SGP4Kernels::BLOCK_SIZE;
+    if (block >= nearBlocks) {
+        // deep space satellites, one at a time
+        const size_t first = (block - nearBlocks) * SGP4Kernels::BLOCK_SIZE;
+        const size_t last  = std::min(first + SGP4Kernels::BLOCK_SIZE, deepRecords.size());
+        for (size_t s = first; s < last; ++s) {
+            const SGP4Record& record = deepRecords[s];
+            const size_t offset = deepIndices[s] * count;
+            for (size_t k = 0; k < count; ++k) {
+                const size_t i = offset + k;
+                SGP4Propagator::propagate(record, dates[k].durationFrom(record.epoch) / 60.0,
+                                          x[i], y[i], z[i], vx[i], vy[i], vz[i]);
+            }
+        }
+        return;
+    }
+
+    // near Earth satellites, one per lane, the epochs being converted once for all dates
+    const size_t first = block * SGP4Kernels::BLOCK_SIZE;
+    const size_t lanes = (nearSize - first < SGP4Kernels::BLOCK_SIZE) ?
+                         nearSize - first : SGP4Kernels::BLOCK_SIZE;
+    const LinearTime& reference = dates[0];
+    double epochOffsets[SGP4Kernels::BLOCK_SIZE];
+    for (size_t l = 0; l < lanes; ++l) {
+        epochOffsets[l] = nearEpochs[first + l].durationFrom(reference);
+    }
+
+    double tsince[SGP4Kernels::BLOCK_SIZE];
+    double px[SGP4Kernels::BLOCK_SIZE];
+    double py[SGP4Kernels::BLOCK_SIZE];
+    double pz[SGP4Kernels::BLOCK_SIZE];
+    double pvx[SGP4Kernels::BLOCK_SIZE];
+    double pvy[SGP4Kernels::BLOCK_SIZE];
+    double pvz[SGP4Kernels::BLOCK_SIZE];
+    for (size_t k = 0; k < count; ++k) {
+        const double dateOffset = dates[k].durationFrom(reference);
+        for (size_t l = 0; l < lanes; ++l) {
+            tsince[l] = (dateOffset - epochOffsets[l]) / 60.0;
+        }
+        SGP4Kernels::propagateBlock(constants.data() + first, capacity, tsince, lanes, px, py, pz, pvx, pvy, pvz);
+        for (size_t l = 0; l < lanes; ++l) {
+            const size_t i = nearIndices[first + l] * count + k;
+            x[i]  = px[l];
+            y[i]  = py[l];
+            z[i]  = pz[l];
+            vx[i] = pvx[l];
+            vy[i] = pvy[l];
+            vz[i] = pvz[l];
+        }
+    }
+}
@@ -0,0 +1,999 @@
+#include "propagation/SGP4Propagator.h"
+#include "propagation/SGP4Kernels.h"
+#include "utils/MathUtils.h"
+#include <cmath>
+#include <limits>
+
+namespace {
+
+    /** 2/3. */
+    const double X2O3 = 2.0 / 3.0;
+
+    /** Threshold on the cosine of the inclination near π. */
+    const double TEMP4 = 1.5e-12;
+
+    /** Solar perturbation constants. */
+    const double ZES = 0.01675;
+    const double ZNS = 1.19459e-5;
+
+    /** Lunar perturbation constants. */
+    const double ZEL = 0.05490;
+    const double ZNL = 1.5835218e-4;
+
+    /** Earth rotation rate (rad/min). */
+    const double RPTIM = 4.37526908801129966e-3;
+
+    /** Julian day of the 1950 epoch used by the deep space model (1949-12-31T00:00:00). */
+    const double JD1950 = 2433281.5;
+
+    /** Julian day of the J2000 epoch of {@link LinearTime} (2000-01-01T00:00:00). */
+    const double JD2000 = 2451544.5;
+
+    /** Floating point remainder of an angle by 2π, with the sign of the angle.
+     * @param angle angle (rad)
+     * @return remainder (rad)
+     */
+    inline double mod2pi(double angle)
+    {
+        return std::fmod(angle, MathUtils::TWO_PI);
+    }
+
+    /** Compute the Greenwich mean sidereal time.
+     * @param jdut1 julian day in UT1
+     * @return Greenwich mean sidereal time, in [0, 2π) (rad)
+     */
+    double gstime(double jdut1)
+    {
+        const double tut1 = (jdut1 - 2451545.0) / 36525.0;
+        double temp = -6.2e-6 * tut1 * tut1 * tut1 + 0.093104 * tut1 * tut1 +
+                      (876600.0 * 3600.0 + 8640184.812866) * tut1 + 67310.54841;
+        temp = mod2pi(temp * (MathUtils::PI / 180.0) / 240.0);
+        return (temp < 0.0) ? temp + MathUtils::TWO_PI : temp;
+    }
+
+    /** Lunisolar terms shared by the deep space initialization steps. */
+    struct DeepSpaceCommon
+    {
+        double sinim, cosim, emsq;
+        double s1, s2, s3, s4, s5;
+        double ss1, ss2, ss3, ss4, ss5;
+        double z1, z3, z11, z13, z21, z23, z31, z33;
+        double sz1, sz3, sz11, sz13, sz21, sz23, sz31, sz33;
+    };
+
+    /** Compute the lunisolar terms of a deep space satellite (dscom).
+     * @param epoch days since the 1950 epoch
+     * @param r record, whose periodics coefficients are set
+     * @param common placeholder for the terms needed by {@link #dsinit}
+     */
+    void dscom(double epoch, SGP4Record& r, DeepSpaceCommon& common)
+    {
+        const double c1ss   = 2.9864797e-6;
+        const double c1l    = 4.7968065e-7;
+        const double zsinis = 0.39785416;
+        const double zcosis = 0.91744867;
+        const double zcosgs = 0.1945905;
+        const double zsings = -0.98088458;
+
+        const double nm     = r.no;
+        const double em     = r.ecco;
+        const double snodm  = std::sin(r.nodeo);
+        const double cnodm  = std::cos(r.nodeo);
+        const double sinomm = std::sin(r.argpo);
+        const double cosomm = std::cos(r.argpo);
+        const double sinim  = std::sin(r.inclo);
+        const double cosim  = std::cos(r.inclo);
+        const double emsq   = em * em;
+        const double betasq = 1.0 - emsq;
+        const double rtemsq = std::sqrt(betasq);
+
+        // initialize lunar solar terms
+        const double day    = epoch + 18261.5;
+        const double xnodce = mod2pi(4.5236020 - 9.2422029e-4 * day);
+        const double stem   = std::sin(xnodce);
+        const double ctem   = std::cos(xnodce);
+        const double zcosil = 0.91375164 - 0.03568096 * ctem;
+        const double zsinil = std::sqrt(1.0 - zcosil * zcosil);
+        const double zsinhl = 0.089683511 * stem / zsinil;
+        const double zcoshl = std::sqrt(1.0 - zsinhl * zsinhl);
+        const double gam    = 5.8351514 + 0.0019443680 * day;
+        double zx           = 0.39785416 * stem / zsinil;
+        const double zy     = zcoshl * ctem + 0.91744867 * zsinhl * stem;
+        zx = std::atan2(zx, zy);
+        zx = gam + zx - xnodce;
+        const double zcosgl = std::cos(zx);
+        const double zsingl = std::sin(zx);
+
+        // do solar terms, then lunar terms
+        double zcosg = zcosgs;
+        double zsing = zsings;
+        double zcosi = zcosis;
+        double zsini = zsinis;
+        double zcosh = cnodm;
+        double zsinh = snodm;
+        double cc    = c1ss;
+        const double xnoi = 1.0 / nm;
+
+        double s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0;
+        double z1 = 0, z2 = 0, z3 = 0, z11 = 0, z12 = 0, z13 = 0, z21 = 0, z22 = 0, z23 = 0;
+        double z31 = 0, z32 = 0, z33 = 0;
+        double ss1 = 0, ss2 = 0, ss3 = 0, ss4 = 0, ss6 = 0, ss7 = 0;
+        double sz1 = 0, sz2 = 0, sz3 = 0, sz12 = 0, sz13 = 0, sz11 = 0, sz21 = 0, sz22 = 0, sz23 = 0;
+        double sz31 = 0, sz32 = 0, sz33 = 0;
+        for (int lsflg = 1; lsflg <= 2; ++lsflg) {
+            const double a1  =  zcosg * zcosh + zsing * zcosi * zsinh;
+            const double a3  = -zsing * zcosh + zcosg * zcosi * zsinh;
+            const double a7  = -zcosg * zsinh + zsing * zcosi * zcosh;
+            const double a8  =  zsing * zsini;
+            const double a9  =  zsing * zsinh + zcosg * zcosi * zcosh;
+            const double a10 =  zcosg * zsini;
+            const double a2  =  cosim * a7 + sinim * a8;
+            const double a4  =  cosim * a9 + sinim * a10;
+            const double a5  = -sinim * a7 + cosim * a8;
+            const double a6  = -sinim * a9 + cosim * a10;
+
+            const double x1 =  a1 * cosomm + a2 * sinomm;
+            const double x2 =  a3 * cosomm + a4 * sinomm;
+            const double x3 = -a1 * sinomm + a2 * cosomm;
+            const double x4 = -a3 * sinomm + a4 * cosomm;
+            const double x5 =  a5 * sinomm;
+            const double x6 =  a6 * sinomm;
+            const double x7 =  a5 * cosomm;
+            const double x8 =  a6 * cosomm;
+
+            z31 = 12.0 * x1 * x1 - 3.0 * x3 * x3;
+            z32 = 24.0 * x1 * x2 - 6.0 * x3 * x4;
+            z33 = 12.0 * x2 * x2 - 3.0 * x4 * x4;
+            z1  =  3.0 *  (a1 * a1 + a2 * a2) + z31 * emsq;
+            z2  =  6.0 *  (a1 * a3 + a2 * a4) + z32 * emsq;
+            z3  =  3.0 *  (a3 * a3 + a4 * a4) + z33 * emsq;
+            z11 = -6.0 * a1 * a5 + emsq * (-24.0 * x1 * x7 - 6.0 * x3 * x5);
+            z12 = -6.0 *  (a1 * a6 + a3 * a5) + emsq *
+                  (-24.0 * (x2 * x7 + x1 * x8) - 6.0 * (x3 * x6 + x4 * x5));
+            z13 = -6.0 * a3 * a6 + emsq * (-24.0 * x2 * x8 - 6.0 * x4 * x6);
+            z21 =  6.0 * a2 * a5 + emsq * (24.0 * x1 * x5 - 6.0 * x3 * x7);
+            z22 =  6.0 *  (a4 * a5 + a2 * a6) + emsq *
+                  (24.0 * (x2 * x5 + x1 * x6) - 6.0 * (x4 * x7 + x3 * x8));
+            z23 =  6.0 * a4 * a6 + emsq * (24.0 * x2 * x6 - 6.0 * x4 * x8);
+            z1  = z1 + z1 + betasq * z31;
+            z2  = z2 + z2 + betasq * z32;
+            z3  = z3 + z3 + betasq * z33;
+            s3  = cc * xnoi;
+            s2  = -0.5 * s3 / rtemsq;
+            s4  = s3 * rtemsq;
+            s1  = -15.0 * em * s4;
+            s5  = x1 * x3 + x2 * x4;
+            s6  = x2 * x3 + x1 * x4;
+            s7  = x2 * x4 - x1 * x3;
+
+            // do lunar terms
+            if (lsflg == 1) {
+                ss1  = s1;
+                ss2  = s2;
+                ss3  = s3;
+                ss4  = s4;
+                common.ss5 = s5;
+                ss6  = s6;
+                ss7  = s7;
+                sz1  = z1;
+                sz2  = z2;
+                sz3  = z3;
+                sz11 = z11;
+                sz12 = z12;
+                sz13 = z13;
+                sz21 = z21;
+                sz22 = z22;
+                sz23 = z23;
+                sz31 = z31;
+                sz32 = z32;
+                sz33 = z33;
+                zcosg = zcosgl;
+                zsing = zsingl;
+                zcosi = zcosil;
+                zsini = zsinil;
+                zcosh = zcoshl * cnodm + zsinhl * snodm;
+                zsinh = snodm * zcoshl - cnodm * zsinhl;
+                cc    = c1l;
+            }
+        }
+
+        r.zmol = mod2pi(4.7199672 + 0.22997150 * day - gam);
+        r.zmos = mod2pi(6.2565837 + 0.017201977 * day);
+
+        // solar terms
+        r.se2  =  2.0 * ss1 * ss6;
+        r.se3  =  2.0 * ss1 * ss7;
+        r.si2  =  2.0 * ss2 * sz12;
+        r.si3  =  2.0 * ss2 * (sz13 - sz11);
+        r.sl2  = -2.0 * ss3 * sz2;
+        r.sl3  = -2.0 * ss3 * (sz3 - sz1);
+        r.sl4  = -2.0 * ss3 * (-21.0 - 9.0 * emsq) * ZES;
+        r.sgh2 =  2.0 * ss4 * sz32;
+        r.sgh3 =  2.0 * ss4 * (sz33 - sz31);
+        r.sgh4 = -18.0 * ss4 * ZES;
+        r.sh2  = -2.0 * ss2 * sz22;
+        r.sh3  = -2.0 * ss2 * (sz23 - sz21);
+
+        // lunar terms
+        r.ee2  =  2.0 * s1 * s6;
+        r.e3   =  2.0 * s1 * s7;
+        r.xi2  =  2.0 * s2 * z12;
+        r.xi3  =  2.0 * s2 * (z13 - z11);
+        r.xl2  = -2.0 * s3 * z2;
+        r.xl3  = -2.0 * s3 * (z3 - z1);
+        r.xl4  = -2.0 * s3 * (-21.0 - 9.0 * emsq) * ZEL;
+        r.xgh2 =  2.0 * s4 * z32;
+        r.xgh3 =  2.0 * s4 * (z33 - z31);
+        r.xgh4 = -18.0 * s4 * ZEL;
+        r.xh2  = -2.0 * s2 * z22;
+        r.xh3  = -2.0 * s2 * (z23 - z21);
+
+        common.sinim = sinim;
+        common.cosim = cosim;
+        common.emsq  = emsq;
+        common.s1  = s1;
+        common.s2  = s2;
+        common.s3  = s3;
+        common.s4  = s4;
+        common.s5  = s5;
+        common.ss1 = ss1;
+        common.ss2 = ss2;
+        common.ss3 = ss3;
+        common.ss4 = ss4;
+        common.z1  = z1;
+        common.z3  = z3;
+        common.z11 = z11;
+        common.z13 = z13;
+        common.z21 = z21;
+        common.z23 = z23;
+        common.z31 = z31;
+        common.z33 = z33;
+        common.sz1  = sz1;
+        common.sz3  = sz3;
+        common.sz11 = sz11;
+        common.sz13 = sz13;
+        common.sz21 = sz21;
+        common.sz23 = sz23;
+        common.sz31 = sz31;
+        common.sz33 = sz33;
+    }
+
+    /** Compute the lunisolar secular rates and the resonance coefficients (dsinit).
+     * @param r record, whose deep space rates and resonance coefficients are set
+     * @param common lunisolar terms from {@link #dscom}
+     * @param xpidot secular rate of the longitude of perigee (rad/min)
+     */
+    void dsinit(SGP4Record& r, const DeepSpaceCommon& common, double xpidot)
+    {
+        const double q22    = 1.7891679e-6;
+        const double q31    = 2.1460748e-6;
+        const double q33    = 2.2123015e-7;
+        const double root22 = 1.7891679e-6;
+        const double root44 = 7.3636953e-9;
+        const double root54 = 2.1765803e-9;
+        const double root32 = 3.7393792e-7;
+        const double root52 = 1.1428639e-7;
+
+        const double nm    = r.no;
+        const double em    = r.ecco;
+        const double inclm = r.inclo;
+        const double sinim = common.sinim;
+        const double cosim = common.cosim;
+        const double emsq  = common.emsq;
+
+        // deep space resonance effects
+        r.irez = 0;
+        if ((nm < 0.0052359877) && (nm > 0.0034906585)) {
+            r.irez = 1;
+        }
+        if ((nm >= 8.26e-3) && (nm <= 9.24e-3) && (em >= 0.5)) {
+            r.irez = 2;
+        }
+
+        // solar terms
+        const double ses  = common.ss1 * ZNS * common.ss5;
+        const double sis  = common.ss2 * ZNS * (common.sz11 + common.sz13);
+        const double sls  = -ZNS * common.ss3 * (common.sz1 + common.sz3 - 14.0 - 6.0 * emsq);
+        const double sghs = common.ss4 * ZNS * (common.sz31 + common.sz33 - 6.0);
+        double shs        = -ZNS * common.ss2 * (common.sz21 + common.sz23);
+        if ((inclm < 5.2359877e-2) || (inclm > MathUtils::PI - 5.2359877e-2)) {
+            shs = 0.0;
+        }
+        if (sinim != 0.0) {
+            shs = shs / sinim;
+        }
+        const double sgs = sghs - cosim * shs;
+
+        // lunar terms
+        r.dedt = ses + common.s1 * ZNL * common.s5;
+        r.didt = sis + common.s2 * ZNL * (common.z11 + common.z13);
+        r.dmdt = sls - ZNL * common.s3 * (common.z1 + common.z3 - 14.0 - 6.0 * emsq);
+        const double sghl = common.s4 * ZNL * (common.z31 + common.z33 - 6.0);
+        double shll       = -ZNL * common.s2 * (common.z21 + common.z23);
+        if ((inclm < 5.2359877e-2) || (inclm > MathUtils::PI - 5.2359877e-2)) {
+            shll = 0.0;
+        }
+        r.domdt = sgs + sghl;
+        r.dnodt = shs;
+        if (sinim != 0.0) {
+            r.domdt = r.domdt - cosim / sinim * shll;
+            r.dnodt = r.dnodt + shll / sinim;
+        }
+
+        // calculate deep space resonance effects
+        const double theta = mod2pi(r.gsto);
+        if (r.irez == 0) {
+            return;
+        }
+        const double aonv = std::pow(nm / SGP4Kernels::XKE, X2O3);
+
+        if (r.irez == 2) {
+            // geopotential resonance for 12 hour orbits
+            const double cosisq = cosim * cosim;
+            const double eoc    = em * emsq;
+            const double g201   = -0.306 - (em - 0.64) * 0.440;
+            double g211, g310, g322, g410, g422, g520, g521, g532, g533;
+            if (em <= 0.65) {
+                g211 =    3.616  -  13.2470 * em +  16.2900 * emsq;
+                g310 =  -19.302  + 117.3900 * em - 228.4190 * emsq +  156.5910 * eoc;
+                g322 =  -18.9068 + 109.7927 * em - 214.6334 * emsq +  146.5816 * eoc;
+                g410 =  -41.122  + 242.6940 * em - 471.0940 * emsq +  313.9530 * eoc;
+                g422 = -146.407  + 841.8800 * em - 1629.014 * emsq + 1083.4350 * eoc;
+                g520 = -532.114  + 3017.977 * em - 5740.032 * emsq + 3708.2760 * eoc;
+            }
+            else {
+                g211 =   -72.099 +   331.819 * em -   508.738 * emsq +   266.724 * eoc;
+                g310 =  -346.844 +  1582.851 * em -  2415.925 * emsq +  1246.113 * eoc;
+                g322 =  -342.585 +  1554.908 * em -  2366.899 * emsq +  1215.972 * eoc;
+                g410 = -1052.797 +  4758.686 * em -  7193.992 * emsq +  3651.957 * eoc;
+                g422 = -3581.690 + 16178.110 * em - 24462.770 * emsq + 12422.520 * eoc;
+                if (em > 0.715) {
+                    g520 = -5149.66 + 29936.92 * em - 54087.36 * emsq + 31324.56 * eoc;
+                }
+                else {
+                    g520 = 1464.74 - 4664.75 * em + 3763.64 * emsq;
+                }
+            }
+            if (em < 0.7) {
+                g533 = -919.22770 + 4988.6100 * em - 9064.7700 * emsq + 5542.21  * eoc;
+                g521 = -822.71072 + 4568.6173 * em - 8491.4146 * emsq + 5337.524 * eoc;
+                g532 = -853.66600 + 4690.2500 * em - 8624.7700 * emsq + 5341.4   * eoc;
+            }
+            else {
+                g533 = -37995.780 + 161616.52 * em - 229838.20 * emsq + 109377.94 * eoc;
+                g521 = -51752.104 + 218913.95 * em - 309468.16 * emsq + 146349.42 * eoc;
+                g532 = -40023.880 + 170470.89 * em - 242699.48 * emsq + 115605.82 * eoc;
+            }
+
+            const double sini2 = sinim * sinim;
+            const double f220 = 0.75 * (1.0 + 2.0 * cosim + cosisq);
+            const double f221 = 1.5 * sini2;
+            const double f321 =  1.875 * sinim * (1.0 - 2.0 * cosim - 3.0 * cosisq);
+            const double f322 = -1.875 * sinim * (1.0 + 2.0 * cosim - 3.0 * cosisq);
+            const double f441 = 35.0 * sini2 * f220;
+            const double f442 = 39.3750 * sini2 * sini2;
+            const double f522 = 9.84375 * sinim * (sini2 * (1.0 - 2.0 * cosim - 5.0 * cosisq) +
+                                0.33333333 * (-2.0 + 4.0 * cosim + 6.0 * cosisq));
+            const double f523 = sinim * (4.92187512 * sini2 * (-2.0 - 4.0 * cosim + 10.0 * cosisq) +
+                                6.56250012 * (1.0 + 2.0 * cosim - 3.0 * cosisq));
+            const double f542 = 29.53125 * sinim * (2.0 - 8.0 * cosim + cosisq * (-12.0 + 8.0 * cosim + 10.0 * cosisq));
+            const double f543 = 29.53125 * sinim * (-2.0 - 8.0 * cosim + cosisq * (12.0 + 8.0 * cosim - 10.0 * cosisq));
+
+            const double xno2  = nm * nm;
+            const double ainv2 = aonv * aonv;
+            double temp1 = 3.0 * xno2 * ainv2;
+            double temp  = temp1 * root22;
+            r.d2201 = temp * f220 * g201;
+            r.d2211 = temp * f221 * g211;
+            temp1   = temp1 * aonv;
+            temp    = temp1 * root32;
+            r.d3210 = temp * f321 * g310;
+            r.d3222 = temp * f322 * g322;
+            temp1   = temp1 * aonv;
+            temp    = 2.0 * temp1 * root44;
+            r.d4410 = temp * f441 * g410;
+            r.d4422 = temp * f442 * g422;
+            temp1   = temp1 * aonv;
+            temp    = temp1 * root52;
+            r.d5220 = temp * f522 * g520;
+            r.d5232 = temp * f523 * g532;
+            temp    = 2.0 * temp1 * root54;
+            r.d5421 = temp * f542 * g521;
+            r.d5433 = temp * f543 * g533;
+            r.xlamo = mod2pi(r.mo + r.nodeo + r.nodeo - theta - theta);
+            r.xfact = r.mdot + r.dmdt + 2.0 * (r.nodedot + r.dnodt - RPTIM) - r.no;
+        }
+        else {
+            // synchronous resonance terms
+            const double g200 = 1.0 + emsq * (-2.5 + 0.8125 * emsq);
+            const double g310 = 1.0 + 2.0 * emsq;
+            const double g300 = 1.0 + emsq * (-6.0 + 6.60937 * emsq);
+            const double f220 = 0.75 * (1.0 + cosim) * (1.0 + cosim);
+            const double f311 = 0.9375 * sinim * sinim * (1.0 + 3.0 * cosim) - 0.75 * (1.0 + cosim);
+            double f330       = 1.0 + cosim;
+            f330 = 1.875 * f330 * f330 * f330;
+            const double del1 = 3.0 * nm * nm * aonv * aonv;
+            r.del2  = 2.0 * del1 * f220 * g200 * q22;
+            r.del3  = 3.0 * del1 * f330 * g300 * q33 * aonv;
+            r.del1  = del1 * f311 * g310 * q31 * aonv;
+            r.xlamo = mod2pi(r.mo + r.nodeo + r.argpo - theta);
+            r.xfact = r.mdot + xpidot - RPTIM + r.dmdt + r.domdt + r.dnodt - r.no;
+        }
+    }
+
+    /** Apply the lunisolar secular effects and integrate the resonances (dspace).
+     * @param r initialization record
+     * @param t offset from epoch (min)
+     * @param em placeholder for the eccentricity
+     * @param argpm placeholder for the perigee argument (rad)
+     * @param inclm placeholder for the inclination (rad)
+     * @param mm placeholder for the mean anomaly (rad)
+     * @param nodem placeholder for the node (rad)
+     * @param nm placeholder for the mean motion (rad/min)
+     */
+    void dspace(const SGP4Record& r, double t,
+                double& em, double& argpm, double& inclm, double& mm, double& nodem, double& nm)
+    {
+        const double fasx2 = 0.13130908;
+        const double fasx4 = 2.8843198;
+        const double fasx6 = 0.37448087;
+        const double g22   = 5.7686396;
+        const double g32   = 0.95240898;
+        const double g44   = 1.8014998;
+        const double g52   = 1.0508330;
+        const double g54   = 4.4108898;
+        const double stepp = 720.0;
+        const double stepn = -720.0;
+        const double step2 = 259200.0;
+
+        // calculate deep space resonance effects
+        const double theta = mod2pi(r.gsto + t * RPTIM);
+        em    += r.dedt * t;
+        inclm += r.didt * t;
+        argpm += r.domdt * t;
+        nodem += r.dnodt * t;
+        mm    += r.dmdt * t;
+        if (r.irez == 0) {
+            return;
+        }
+
+        // the integration always starts from epoch, so the record is not modified
+        const double delt = (t > 0.0) ? stepp : stepn;
+        double atime = 0.0;
+        double xni   = r.no;
+        double xli   = r.xlamo;
+        double xndt, xldot, xnddt, ft;
+        while (true) {
+            if (r.irez != 2) {
+                // near synchronous resonance terms
+                xndt  = r.del1 * std::sin(xli - fasx2) + r.del2 * std::sin(2.0 * (xli - fasx4)) +
+                        r.del3 * std::sin(3.0 * (xli - fasx6));
+                xldot = xni + r.xfact;
+                xnddt = r.del1 * std::cos(xli - fasx2) + 2.0 * r.del2 * std::cos(2.0 * (xli - fasx4)) +
+                        3.0 * r.del3 * std::cos(3.0 * (xli - fasx6));
+                xnddt = xnddt * xldot;
+            }
+            else {
+                // near half-day resonance terms
+                const double xomi  = r.argpo + r.argpdot * atime;
+                const double x2omi = xomi + xomi;
+                const double x2li  = xli + xli;
+                xndt  = r.d2201 * std::sin(x2omi + xli - g22) + r.d2211 * std::sin(xli - g22) +
+                        r.d3210 * std::sin(xomi + xli - g32) + r.d3222 * std::sin(-xomi + xli - g32) +
+                        r.d4410 * std::sin(x2omi + x2li - g44) + r.d4422 * std::sin(x2li - g44) +
+                        r.d5220 * std::sin(xomi + xli - g52) + r.d5232 * std::sin(-xomi + xli - g52) +
+                        r.d5421 * std::sin(xomi + x2li - g54) + r.d5433 * std::sin(-xomi + x2li - g54);
+                xldot = xni + r.xfact;
+                xnddt = r.d2201 * std::cos(x2omi + xli - g22) + r.d2211 * std::cos(xli - g22) +
+                        r.d3210 * std::cos(xomi + xli - g32) + r.d3222 * std::cos(-xomi + xli - g32) +
+                        r.d5220 * std::cos(xomi + xli - g52) + r.d5232 * std::cos(-xomi + xli - g52) +
+                        2.0 * (r.d4410 * std::cos(x2omi + x2li - g44) + r.d4422 * std::cos(x2li - g44) +
+                               r.d5421 * std::cos(xomi + x2li - g54) + r.d5433 * std::cos(-xomi + x2li - g54));
+                xnddt = xnddt * xldot;
+            }
+
+            if (std::fabs(t - atime) < stepp) {
+                ft = t - atime;
+                break;
+            }
+            xli   += xldot * delt + xndt * step2;
+            xni   += xndt * delt + xnddt * step2;
+            atime += delt;
+        }
+
+        nm = xni + xndt * ft + xnddt * ft * ft * 0.5;
+        const double xl = xli + xldot * ft + xndt * ft * ft * 0.5;
+        if (r.irez != 1) {
+            mm = xl - 2.0 * nodem + 2.0 * theta;
+        }
+        else {
+            mm = xl - nodem - argpm + theta;
+        }
+    }
+
+    /** Apply the lunisolar periodics (dpper).
+     * @param r initialization record
+     * @param t offset from epoch (min)
+     * @param ep placeholder for the eccentricity
+     * @param inclp placeholder for the inclination (rad)
+     * @param nodep placeholder for the node (rad)
+     * @param argpp placeholder for the perigee argument (rad)
+     * @param mp placeholder for the mean anomaly (rad)
+     */
+    void dpper(const SGP4Record& r, double t,
+               double& ep, double& inclp, double& nodep, double& argpp, double& mp)
+    {
+        // solar terms
+        double zm    = r.zmos + ZNS * t;
+        double zf    = zm + 2.0 * ZES * std::sin(zm);
+        double sinzf = std::sin(zf);
+        double f2    =  0.5 * sinzf * sinzf - 0.25;
+        double f3    = -0.5 * sinzf * std::cos(zf);
+        const double ses  = r.se2 * f2 + r.se3 * f3;
+        const double sis  = r.si2 * f2 + r.si3 * f3;
+        const double sls  = r.sl2 * f2 + r.sl3 * f3 + r.sl4 * sinzf;
+        const double sghs = r.sgh2 * f2 + r.sgh3 * f3 + r.sgh4 * sinzf;
+        const double shs  = r.sh2 * f2 + r.sh3 * f3;
+
+        // lunar terms
+        zm    = r.zmol + ZNL * t;
+        zf    = zm + 2.0 * ZEL * std::sin(zm);
+        sinzf = std::sin(zf);
+        f2    =  0.5 * sinzf * sinzf - 0.25;
+        f3    = -0.5 * sinzf * std::cos(zf);
+        const double sel  = r.ee2 * f2 + r.e3 * f3;
+        const double sil  = r.xi2 * f2 + r.xi3 * f3;
+        const double sll  = r.xl2 * f2 + r.xl3 * f3 + r.xl4 * sinzf;
+        const double sghl = r.xgh2 * f2 + r.xgh3 * f3 + r.xgh4 * sinzf;
+        const double shll = r.xh2 * f2 + r.xh3 * f3;
+
+        // the periodics at epoch are not removed, as in the reference implementation
+        const double pe   = ses + sel;
+        const double pinc = sis + sil;
+        const double pl   = sls + sll;
+        double pgh        = sghs + sghl;
+        double ph         = shs + shll;
+
+        inclp += pinc;
+        ep    += pe;
+        const double sinip = std::sin(inclp);
+        const double cosip = std::cos(inclp);
+
+        if (inclp >= 0.2) {
+            // apply periodics directly
+            ph     = ph / sinip;
+            pgh    = pgh - cosip * ph;
+            argpp += pgh;
+            nodep += ph;
+            mp    += pl;
+        }
+        else {
+            // apply periodics with Lyddane modification
+            const double sinop = std::sin(nodep);
+            const double cosop = std::cos(nodep);
+            double alfdp = sinip * sinop;
+            double betdp = sinip * cosop;
+            const double dalf =  ph * cosop + pinc * cosip * sinop;
+            const double dbet = -ph * sinop + pinc * cosip * cosop;
+            alfdp += dalf;
+            betdp += dbet;
+            nodep  = mod2pi(nodep);
+            double xls = mp + argpp + cosip * nodep;
+            const double dls = pl + pgh - pinc * nodep * sinip;
+            xls += dls;
+            const double xnoh = nodep;
+            nodep = std::atan2(alfdp, betdp);
+            if (std::fabs(xnoh - nodep) > MathUtils::PI) {
+                if (nodep < xnoh) {
+                    nodep += MathUtils::TWO_PI;
+                }
+                else {
+                    nodep -= MathUtils::TWO_PI;
+                }
+            }
+            mp   += pl;
+            argpp = xls - mp - cosip * nodep;
+        }
+    }
+
+    /** Set a state to NaN.
+     * @param x position abscissa
+     * @param y position ordinate
+     * @param z position height
+     * @param vx velocity abscissa
+     * @param vy velocity ordinate
+     * @param vz velocity height
+     */
+    void setNaN(double& x, double& y, double& z, double& vx, double& vy, double& vz)
+    {
+        x = y = z = vx = vy = vz = std::numeric_limits<double>::quiet_NaN();
+    }
+
+}
+
+SGP4Propagator::SGP4Propagator(const TLE& tle)
+    : tle(tle)
+{
+    status = initialize(tle, record);
+}
+
+SGP4Propagator::Status SGP4Propagator::initialize(const TLE& tle, SGP4Record& r)
+{
+    r = SGP4Record();
+    r.epoch           = tle.getDate();
+    r.satelliteNumber = tle.getSatelliteNumber();
+    r.bstar = tle.getBStar();
+    r.ecco  = tle.getE();
+    r.inclo = tle.getI();
+    r.nodeo = tle.getRaan();
+    r.argpo = tle.getPerigeeArgument();
+    r.mo    = tle.getMeanAnomaly();
+    const double noKozai = tle.getMeanMotion() * 60.0;
+    if (!(r.ecco >= 0.0 && r.ecco < 1.0 && noKozai > 0.0)) {
+        r.no = std::numeric_limits<double>::quiet_NaN();
+        return INVALID_ELEMENTS;
+    }
+
+    // initl: un-Kozai mean motion and mean semi-major axis
+    const double eccsq  = r.ecco * r.ecco;
+    const double omeosq = 1.0 - eccsq;
+    const double rteosq = std::sqrt(omeosq);
+    const double cosio  = std::cos(r.inclo);
+    const double cosio2 = cosio * cosio;
+    const double ak     = std::pow(SGP4Kernels::XKE / noKozai, X2O3);
+    const double d1     = 0.75 * SGP4Kernels::J2 * (3.0 * cosio2 - 1.0) / (rteosq * omeosq);
+    double del          = d1 / (ak * ak);
+    const double adel   = ak * (1.0 - del * del - del * (1.0 / 3.0 + 134.0 * del * del / 81.0));
+    del   = d1 / (adel * adel);
+    r.no  = noKozai / (1.0 + del);
+    r.ao  = std::pow(SGP4Kernels::XKE / r.no, X2O3);
+    r.sinio = std::sin(r.inclo);
+    r.cosio = cosio;
+    const double po    = r.ao * omeosq;
+    const double con42 = 1.0 - 5.0 * cosio2;
+    r.con41 = -con42 - cosio2 - cosio2;
+    const double posq  = po * po;
+    const double rp    = r.ao * (1.0 - r.ecco);
+    const double jd    = JD2000 + static_cast<double>(r.epoch.getNanos()) / LinearTime::NANOS_PER_DAY;
+    r.gsto = gstime(jd);
+
+    // sgp4init: drag and secular coefficients
+    const double ss      = 78.0 / SGP4Kernels::EARTH_RADIUS + 1.0;
+    const double qzms2tt = (120.0 - 78.0) / SGP4Kernels::EARTH_RADIUS;
+    const double qzms2t  = qzms2tt * qzms2tt * qzms2tt * qzms2tt;
+    r.simplified = rp < (220.0 / SGP4Kernels::EARTH_RADIUS + 1.0);
+    double sfour  = ss;
+    double qzms24 = qzms2t;
+    const double perige = (rp - 1.0) * SGP4Kernels::EARTH_RADIUS;
+
+    // for perigees below 156 km, s and qoms2t are altered
+    if (perige < 156.0) {
+        sfour = perige - 78.0;
+        if (perige < 98.0) {
+            sfour = 20.0;
+        }
+        const double qzms24temp = (120.0 - sfour) / SGP4Kernels::EARTH_RADIUS;
+        qzms24 = qzms24temp * qzms24temp * qzms24temp * qzms24temp;
+        sfour  = sfour / SGP4Kernels::EARTH_RADIUS + 1.0;
+    }
+    const double pinvsq = 1.0 / posq;
+    const double tsi    = 1.0 / (r.ao - sfour);
+    r.eta = r.ao * r.ecco * tsi;
+    const double etasq = r.eta * r.eta;
+    const double eeta  = r.ecco * r.eta;
+    const double psisq = std::fabs(1.0 - etasq);
+    const double coef  = qzms24 * std::pow(tsi, 4.0);
+    const double coef1 = coef / std::pow(psisq, 3.5);
+    const double cc2   = coef1 * r.no * (r.ao * (1.0 + 1.5 * etasq + eeta * (4.0 + etasq)) +
+                         0.375 * SGP4Kernels::J2 * tsi / psisq * r.con41 * (8.0 + 3.0 * etasq * (8.0 + etasq)));
+    r.cc1 = r.bstar * cc2;
+    double cc3 = 0.0;
+    if (r.ecco > 1.0e-4) {
+        cc3 = -2.0 * coef * tsi * SGP4Kernels::J3OJ2 * r.no * r.sinio / r.ecco;
+    }
+    r.x1mth2 = 1.0 - cosio2;
+    r.cc4    = 2.0 * r.no * coef1 * r.ao * omeosq *
+               (r.eta * (2.0 + 0.5 * etasq) + r.ecco * (0.5 + 2.0 * etasq) -
+                SGP4Kernels::J2 * tsi / (r.ao * psisq) *
+                (-3.0 * r.con41 * (1.0 - 2.0 * eeta + etasq * (1.5 - 0.5 * eeta)) +
+                 0.75 * r.x1mth2 * (2.0 * etasq - eeta * (1.0 + etasq)) * std::cos(2.0 * r.argpo)));
+    r.cc5 = 2.0 * coef1 * r.ao * omeosq * (1.0 + 2.75 * (etasq + eeta) + eeta * etasq);
+    const double cosio4 = cosio2 * cosio2;
+    const double temp1  = 1.5 * SGP4Kernels::J2 * pinvsq * r.no;
+    const double temp2  = 0.5 * temp1 * SGP4Kernels::J2 * pinvsq;
+    const double temp3  = -0.46875 * SGP4Kernels::J4 * pinvsq * pinvsq * r.no;
+    r.mdot    = r.no + 0.5 * temp1 * rteosq * r.con41 +
+                0.0625 * temp2 * rteosq * (13.0 - 78.0 * cosio2 + 137.0 * cosio4);
+    r.argpdot = -0.5 * temp1 * con42 + 0.0625 * temp2 * (7.0 - 114.0 * cosio2 + 395.0 * cosio4) +
+                temp3 * (3.0 - 36.0 * cosio2 + 49.0 * cosio4);
+    const double xhdot1 = -temp1 * cosio;
+    r.nodedot = xhdot1 + (0.5 * temp2 * (4.0 - 19.0 * cosio2) + 2.0 * temp3 * (3.0 - 7.0 * cosio2)) * cosio;
+    const double xpidot = r.argpdot + r.nodedot;
+    r.omgcof = r.bstar * cc3 * std::cos(r.argpo);
+    r.xmcof  = 0.0;
+    if (r.ecco > 1.0e-4) {
+        r.xmcof = -X2O3 * coef * r.bstar / eeta;
+    }
+    r.nodecf = 3.5 * omeosq * xhdot1 * r.cc1;
+    r.t2cof  = 1.5 * r.cc1;
+    if (std::fabs(cosio + 1.0) > TEMP4) {
+        r.xlcof = -0.25 * SGP4Kernels::J3OJ2 * r.sinio * (3.0 + 5.0 * cosio) / (1.0 + cosio);
+    }
+    else {
+        r.xlcof = -0.25 * SGP4Kernels::J3OJ2 * r.sinio * (3.0 + 5.0 * cosio) / TEMP4;
+    }
+    r.aycof = -0.5 * SGP4Kernels::J3OJ2 * r.sinio;
+    const double delmotemp = 1.0 + r.eta * std::cos(r.mo);
+    r.delmo  = delmotemp * delmotemp * delmotemp;
+    r.sinmao = std::sin(r.mo);
+    r.x7thm1 = 7.0 * cosio2 - 1.0;
+
+    // deep space initialization
+    r.deepSpace = MathUtils::TWO_PI / r.no >= 225.0;
+    if (r.deepSpace) {
+        r.simplified = true;
+        DeepSpaceCommon common = {};
+        dscom(jd - JD1950, r, common);
+        dsinit(r, common, xpidot);
+    }
+
+    // the full drag model terms stay at zero for simplified models
+    if (!r.simplified) {
+        const double cc1sq = r.cc1 * r.cc1;
+        r.d2 = 4.0 * r.ao * tsi * cc1sq;
+        const double temp = r.d2 * tsi * r.cc1 / 3.0;
+        r.d3 = (17.0 * r.ao + sfour) * temp;
+        r.d4 = 0.5 * temp * r.ao * tsi * (221.0 * r.ao + 31.0 * sfour) * r.cc1;
+        r.t3cof = r.d2 + 2.0 * cc1sq;
+        r.t4cof = 0.25 * (3.0 * r.d3 + r.cc1 * (12.0 * r.d2 + 10.0 * cc1sq));
+        r.t5cof = 0.2 * (3.0 * r.d4 + 12.0 * r.cc1 * r.d3 + 6.0 * r.d2 * r.d2 + 15.0 * cc1sq * (2.0 * r.d2 + cc1sq));
+    }
+    else {
+        // the kernels apply these terms unconditionally
+        r.omgcof = 0.0;
+        r.xmcof  = 0.0;
+        r.cc5    = 0.0;
+    }
+
+    return VALID;
+}
+
+SGP4Propagator::Status SGP4Propagator::propagate(const SGP4Record& r, double t,
+                                                 double& x, double& y, double& z,
+                                                 double& vx, double& vy, double& vz)
+{
+    if (!(r.no > 0.0)) {
+        setNaN(x, y, z, vx, vy, vz);
+        return INVALID_ELEMENTS;
+    }
+
+    // update for secular gravity and atmospheric drag
+    const double xmdf   = r.mo + r.mdot * t;
+    const double argpdf = r.argpo + r.argpdot * t;
+    const double nodedf = r.nodeo + r.nodedot * t;
+    double argpm = argpdf;
+    double mm    = xmdf;
+    const double t2 = t * t;
+    double nodem = nodedf + r.nodecf * t2;
+    double tempa = 1.0 - r.cc1 * t;
+    double tempe = r.bstar * r.cc4 * t;
+    double templ = r.t2cof * t2;
+
+    if (!r.simplified) {
+        const double delomg   = r.omgcof * t;
+        const double delmtemp = 1.0 + r.eta * std::cos(xmdf);
+        const double delm     = r.xmcof * (delmtemp * delmtemp * delmtemp - r.delmo);
+        const double temp     = delomg + delm;
+        mm    = xmdf + temp;
+        argpm = argpdf - temp;
+        const double t3 = t2 * t;
+        const double t4 = t3 * t;
+        tempa = tempa - r.d2 * t2 - r.d3 * t3 - r.d4 * t4;
+        tempe = tempe + r.bstar * r.cc5 * (std::sin(mm) - r.sinmao);
+        templ = templ + r.t3cof * t3 + t4 * (r.t4cof + t * r.t5cof);
+    }
+
+    double nm    = r.no;
+    double em    = r.ecco;
+    double inclm = r.inclo;
+    if (r.deepSpace) {
+        dspace(r, t, em, argpm, inclm, mm, nodem, nm);
+    }
+
+    if (nm <= 0.0) {
+        setNaN(x, y, z, vx, vy, vz);
+        return NEGATIVE_MEAN_MOTION;
+    }
+    const double am = std::pow(SGP4Kernels::XKE / nm, X2O3) * tempa * tempa;
+    nm = SGP4Kernels::XKE / std::pow(am, 1.5);
+    em = em - tempe;
+
+    if ((em >= 1.0) || (em < -0.001)) {
+        setNaN(x, y, z, vx, vy, vz);
+        return ECCENTRICITY_OUT_OF_RANGE;
+    }
+    // avoid a division by zero
+    if (em < 1.0e-6) {
+        em = 1.0e-6;
+    }
+    mm = mm + r.no * templ;
+    double xlm = mm + argpm + nodem;
+    nodem = mod2pi(nodem);
+    argpm = mod2pi(argpm);
+    xlm   = mod2pi(xlm);
+    mm    = mod2pi(xlm - argpm - nodem);
+
+    // compute extra mean quantities
+    const double sinim = std::sin(inclm);
+    const double cosim = std::cos(inclm);
+
+    // add lunar-solar periodics
+    double ep    = em;
+    double xincp = inclm;
+    double argpp = argpm;
+    double nodep = nodem;
+    double mp    = mm;
+    double sinip = sinim;
+    double cosip = cosim;
+    double aycof = r.aycof;
+    double xlcof = r.xlcof;
+    if (r.deepSpace) {
+        dpper(r, t, ep, xincp, nodep, argpp, mp);
+        if (xincp < 0.0) {
+            xincp  = -xincp;
+            nodep += MathUtils::PI;
+            argpp -= MathUtils::PI;
+        }
+        if ((ep < 0.0) || (ep > 1.0)) {
+            setNaN(x, y, z, vx, vy, vz);
+            return PERTURBED_ECCENTRICITY_OUT_OF_RANGE;
+        }
+
+        // long period periodics
+        sinip = std::sin(xincp);
+        cosip = std::cos(xincp);
+        aycof = -0.5 * SGP4Kernels::J3OJ2 * sinip;
+        if (std::fabs(cosip + 1.0) > TEMP4) {
+            xlcof = -0.25 * SGP4Kernels::J3OJ2 * sinip * (3.0 + 5.0 * cosip) / (1.0 + cosip);
+        }
+        else {
+            xlcof = -0.25 * SGP4Kernels::J3OJ2 * sinip * (3.0 + 5.0 * cosip) / TEMP4;
+        }
+    }
+
+    const double axnl = ep * std::cos(argpp);
+    double temp       = 1.0 / (am * (1.0 - ep * ep));
+    const double aynl = ep * std::sin(argpp) + temp * aycof;
+    const double xl   = mp + argpp + nodep + temp * xlcof * axnl;
+
+    // solve Kepler's equation
+    const double u = mod2pi(xl - nodep);
+    double eo1  = u;
+    double tem5 = 9999.9;
+    double sineo1 = 0.0;
+    double coseo1 = 0.0;
+    for (int ktr = 1; std::fabs(tem5) >= SGP4Kernels::KEPLER_THRESHOLD && ktr <= SGP4Kernels::MAX_ITERATIONS; ++ktr) {
+        sineo1 = std::sin(eo1);
+        coseo1 = std::cos(eo1);
+        tem5   = 1.0 - coseo1 * axnl - sineo1 * aynl;
+        tem5   = (u - aynl * coseo1 + axnl * sineo1 - eo1) / tem5;
+        if (std::fabs(tem5) >= 0.95) {
+            tem5 = (tem5 > 0.0) ? 0.95 : -0.95;
+        }
+        eo1 = eo1 + tem5;
+    }
+
+    // short period preliminary quantities
+    const double ecose = axnl * coseo1 + aynl * sineo1;
+    const double esine = axnl * sineo1 - aynl * coseo1;
+    const double el2   = axnl * axnl + aynl * aynl;
+    const double pl    = am * (1.0 - el2);
+    if (pl < 0.0) {
+        setNaN(x, y, z, vx, vy, vz);
+        return NEGATIVE_SEMI_LATUS_RECTUM;
+    }
+
+    const double rl     = am * (1.0 - ecose);
+    const double rdotl  = std::sqrt(am) * esine / rl;
+    const double rvdotl = std::sqrt(pl) / rl;
+    const double betal  = std::sqrt(1.0 - el2);
+    temp = esine / (1.0 + betal);
+    const double sinu  = am / rl * (sineo1 - aynl - axnl * temp);
+    const double cosu  = am / rl * (coseo1 - axnl + aynl * temp);
+    double su          = std::atan2(sinu, cosu);
+    const double sin2u = (cosu + cosu) * sinu;
+    const double cos2u = 1.0 - 2.0 * sinu * sinu;
+    temp = 1.0 / pl;
+    const double temp1 = 0.5 * SGP4Kernels::J2 * temp;
+    const double temp2 = temp1 * temp;
+
+    // update for short period periodics
+    double con41  = r.con41;
+    double x1mth2 = r.x1mth2;
+    double x7thm1 = r.x7thm1;
+    if (r.deepSpace) {
+        const double cosisq = cosip * cosip;
+        con41  = 3.0 * cosisq - 1.0;
+        x1mth2 = 1.0 - cosisq;
+        x7thm1 = 7.0 * cosisq - 1.0;
+    }
+    const double mrt   = rl * (1.0 - 1.5 * temp2 * betal * con41) + 0.5 * temp1 * x1mth2 * cos2u;
+    su = su - 0.25 * temp2 * x7thm1 * sin2u;
+    const double xnode = nodep + 1.5 * temp2 * cosip * sin2u;
+    const double xinc  = xincp + 1.5 * temp2 * cosip * sinip * cos2u;
+    const double mvt   = rdotl - nm * temp1 * x1mth2 * sin2u / SGP4Kernels::XKE;
+    const double rvdot = rvdotl + nm * temp1 * (x1mth2 * cos2u + 1.5 * con41) / SGP4Kernels::XKE;
+
+    // orientation vectors
+    const double sinsu = std::sin(su);
+    const double cossu = std::cos(su);
+    const double snod  = std::sin(xnode);
+    const double cnod  = std::cos(xnode);
+    const double sini  = std::sin(xinc);
+    const double cosi  = std::cos(xinc);
+    const double xmx   = -snod * cosi;
+    const double xmy   =  cnod * cosi;
+    const double ux    =  xmx * sinsu + cnod * cossu;
+    const double uy    =  xmy * sinsu + snod * cossu;
+    const double uz    =  sini * sinsu;
+    const double wx    =  xmx * cossu - cnod * sinsu;
+    const double wy    =  xmy * cossu - snod * sinsu;
+    const double wz    =  sini * cossu;
+
+    // sgp4fix for decaying satellites
+    if (mrt < 1.0) {
+        setNaN(x, y, z, vx, vy, vz);
+        return DECAYED;
+    }
+
+    const double rScale = 1000.0 * SGP4Kernels::EARTH_RADIUS * mrt;
+    const double vScale = 1000.0 * SGP4Kernels::VKMPERSEC;
+    x  = rScale * ux;
+    y  = rScale * uy;
+    z  = rScale * uz;
+    vx = vScale * (mvt * ux + rvdot * wx);
+    vy = vScale * (mvt * uy + rvdot * wy);
+    vz = vScale * (mvt * uz + rvdot * wz);
+    return VALID;
+}
+
+SGP4Propagator::Status SGP4Propagator::getStatus() const
+{
+    return status;
+}
+
+bool SGP4Propagator::isValid() const
+{
+    return status == VALID;
+}
+
+bool SGP4Propagator::isDeepSpace() const
+{
+    return record.deepSpace;
+}
+
+const TLE& SGP4Propagator::getTLE() const
+{
+    return tle;
+}
+
+const SGP4Record& SGP4Propagator::getRecord() const
+{
+    return record;
+}
+
+PVCoordinates SGP4Propagator::getPVCoordinates(const LinearTime& date) const
+{
+    double x, y, z, vx, vy, vz;
+    propagate(record, date.durationFrom(record.epoch) / 60.0, x, y, z, vx, vy, vz);
+    return PVCoordinates(Vector3D(x, y, z), Vector3D(vx, vy, vz));
+}
+
+void SGP4Propagator::getPVCoordinates(const LinearTime* dates, size_t count,
+                                      double* x, double* y, double* z, double* vx, double* vy, double* vz) const
+{
+    for (size_t k = 0; k < count; ++k) {
+        propagate(record, dates[k].durationFrom(record.epoch) / 60.0,
+                  x[k], y[k], z[k], vx[k], vy[k], vz[k]);
+    }
+}
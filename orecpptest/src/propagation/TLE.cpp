@@ -0,0 +1,87 @@
+#include "propagation/TLE.h"
+#include <cmath>
+
+TLE::TLE(int satelliteNumber, int epochYear, double epochDay,
+         double meanMotion, double meanMotionFirstDerivative, double meanMotionSecondDerivative,
+         double e, double i, double pa, double raan, double meanAnomaly, double bStar)
+    : satelliteNumber(satelliteNumber), epochYear(epochYear), epochDay(epochDay),
+      epoch(computeDate(epochYear, epochDay)),
+      meanMotion(meanMotion), meanMotionFirstDerivative(meanMotionFirstDerivative),
+      meanMotionSecondDerivative(meanMotionSecondDerivative),
+      e(e), i(i), pa(pa), raan(raan), meanAnomaly(meanAnomaly), bStar(bStar)
+{
+
+}
+
+int TLE::getSatelliteNumber() const
+{
+    return satelliteNumber;
+}
+
+int TLE::getEpochYear() const
+{
+    return epochYear;
+}
+
+double TLE::getEpochDay() const
+{
+    return epochDay;
+}
+
+const LinearTime& TLE::getDate() const
+{
+    return epoch;
+}
+
+double TLE::getMeanMotion() const
+{
+    return meanMotion;
+}
+
+double TLE::getMeanMotionFirstDerivative() const
+{
+    return meanMotionFirstDerivative;
+}
+
+double TLE::getMeanMotionSecondDerivative() const
+{
+    return meanMotionSecondDerivative;
+}
+
+double TLE::getE() const
+{
+    return e;
+}
+
+double TLE::getI() const
+{
+    return i;
+}
+
+double TLE::getPerigeeArgument() const
+{
+    return pa;
+}
+
+double TLE::getRaan() const
+{
+    return raan;
+}
+
+double TLE::getMeanAnomaly() const
+{
+    return meanAnomaly;
+}
+
+double TLE::getBStar() const
+{
+    return bStar;
+}
+
+LinearTime TLE::computeDate(int epochYear, double epochDay)
+{
+    // the integer day goes through the ordinal date, the fraction is added in nanoseconds
+    const double day = std::floor(epochDay);
+    const LinearTime midnight(DateComponents(epochYear, static_cast<int>(day)), TimeComponents::H00);
+    return midnight.shiftedBy((epochDay - day) * 86400.0);
+}
@@ -0,0 +1,494 @@
+#include "propagation/TLECatalog.h"
+#include "utils/MappedFile.h"
+#include "utils/MathUtils.h"
+#include <algorithm>
+#include <cstring>
+#include <stdint.h>
+
+namespace {
+
+    /** Length of the significant part of a line. */
+    const size_t LINE_LENGTH = 69;
+
+    /** Conversion from degrees to radians. */
+    const double DEG_TO_RAD = MathUtils::PI / 180.0;
+
+    /** Conversion from revolutions per day to radians per second. */
+    const double REV_PER_DAY = MathUtils::TWO_PI / 86400.0;
+
+    /** Exact powers of ten. */
+    const double POWERS_OF_TEN[] = {
+        1.0e0,  1.0e1,  1.0e2,  1.0e3,  1.0e4,  1.0e5,  1.0e6,  1.0e7,
+        1.0e8,  1.0e9,  1.0e10, 1.0e11, 1.0e12, 1.0e13, 1.0e14, 1.0e15,
+        1.0e16, 1.0e17, 1.0e18
+    };
+
+    /** Maximal number of digits of a decimal field. */
+    const int MAX_DIGITS = 18;
+
+    /** Get the end of the line starting at some point.
+     * @param p first character of the line
+     * @param end end of data
+     * @return end of line (newline character or end of data)
+     */
+    inline const char* endOfLine(const char* p, const char* end)
+    {
+        const char* newline = static_cast<const char*>(std::memchr(p, '\n', end - p));
+        return (newline == nullptr) ? end : newline;
+    }
+
+    /** Get the start of the next line.
+     * @param eol end of the current line
+     * @param end end of data
+     * @return first character of the next line, or end of data
+     */
+    inline const char* nextLine(const char* eol, const char* end)
+    {
+        return (eol < end) ? eol + 1 : end;
+    }
+
+    /** Check if a line starts with a line number followed by a space.
+     * @param p first character of the line
+     * @param end end of data
+     * @param number expected line number character
+     * @return true if the line starts with the number
+     */
+    inline bool startsWith(const char* p, const char* end, char number)
+    {
+        return end - p >= 2 && p[0] == number && p[1] == ' ';
+    }
+
+    /** Find the first record starting at or after a line start.
+     * @param p first character of a line
+     * @param end end of data
+     * @return first character of the first line of the record, or end of data
+     */
+    const char* findRecord(const char* p, const char* end)
+    {
+        while (p < end) {
+            const char* next = nextLine(endOfLine(p, end), end);
+            if (startsWith(p, end, '1') && startsWith(next, end, '2')) {
+                return p;
+            }
+            p = next;
+        }
+        return end;
+    }
+
+    /** Verify the checksum of a line.
+     * @param line first character of the line, with at least {@link #LINE_LENGTH} characters
+     * @return true if the last character is the checksum of the previous ones
+     */
+    bool checksum(const char* line)
+    {
+        int sum = 0;
+        for (size_t k = 0; k < LINE_LENGTH - 1; ++k) {
+            const char c = line[k];
+            if (c >= '0' && c <= '9') {
+                sum += c - '0';
+            }
+            else if (c == '-') {
+                sum += 1;
+            }
+        }
+        return line[LINE_LENGTH - 1] == '0' + sum % 10;
+    }
+
+    /** Parse a fixed width integer field, with optional leading spaces.
+     * @param p first character of the field
+     * @param length field width
+     * @param value placeholder for the value
+     * @return true if the field is a non-negative integer
+     */
+    bool parseInt(const char* p, size_t length, int& value)
+    {
+        size_t k = 0;
+        while (k < length && p[k] == ' ') {
+            ++k;
+        }
+        if (k == length) {
+            return false;
+        }
+        value = 0;
+        for (; k < length; ++k) {
+            if (p[k] < '0' || p[k] > '9') {
+                return false;
+            }
+            value = 10 * value + (p[k] - '0');
+        }
+        return true;
+    }
+
+    /** Parse a satellite number field, accepting the Alpha-5 extension.
+     * @param p first character of the five characters field
+     * @param value placeholder for the value
+     * @return true if the field is a satellite number
+     */
+    bool parseSatelliteNumber(const char* p, int& value)
+    {
+        const char c = p[0];
+        if (c >= 'A' && c <= 'Z' && c != 'I' && c != 'O') {
+            // A is 10, the letters I and O are skipped
+            const int letter = 10 + (c - 'A') - (c > 'I' ? 1 : 0) - (c > 'O' ? 1 : 0);
+            int digits;
+            if (!parseInt(p + 1, 4, digits) || p[1] == ' ') {
+                return false;
+            }
+            value = 10000 * letter + digits;
+            return true;
+        }
+        return parseInt(p, 5, value);
+    }
+
+    /** Parse a fixed width decimal field.
+     * <p>The field may have leading and trailing spaces, a sign and a
+     * decimal point. The value is the integer mantissa divided by an exact
+     * power of ten, so it is correctly rounded.</p>
+     * @param p first character of the field
+     * @param length field width
+     * @param value placeholder for the value
+     * @return true if the field is a number
+     */
+    bool parseDecimal(const char* p, size_t length, double& value)
+    {
+        const char* end = p + length;
+        while (p < end && *p == ' ') {
+            ++p;
+        }
+        while (end > p && end[-1] == ' ') {
+            --end;
+        }
+        bool negative = false;
+        if (p < end && (*p == '-' || *p == '+')) {
+            negative = (*p == '-');
+            ++p;
+        }
+        uint64_t mantissa = 0;
+        int digits   = 0;
+        int decimals = -1;
+        for (; p < end; ++p) {
+            if (*p >= '0' && *p <= '9') {
+                if (digits == MAX_DIGITS) {
+                    return false;
+                }
+                mantissa = 10 * mantissa + static_cast<uint64_t>(*p - '0');
+                ++digits;
+                if (decimals >= 0) {
+                    ++decimals;
+                }
+            }
+            else if (*p == '.' && decimals < 0) {
+                decimals = 0;
+            }
+            else {
+                return false;
+            }
+        }
+        if (digits == 0) {
+            return false;
+        }
+        value = static_cast<double>(mantissa);
+        if (decimals > 0) {
+            value /= POWERS_OF_TEN[decimals];
+        }
+        if (negative) {
+            value = -value;
+        }
+        return true;
+    }
+
+    /** Parse an eight characters field with assumed leading decimal point and exponent.
+     * <p>This is the format of the mean motion second derivative and of the
+     * ballistic coefficient: "-11606-4" is -0.11606e-4.</p>
+     * @param p first character of the field
+     * @param value placeholder for the value
+     * @return true if the field is a number
+     */
+    bool parseExponent(const char* p, double& value)
+    {
+        if ((p[0] != ' ' && p[0] != '+' && p[0] != '-') ||
+            (p[6] != '+' && p[6] != '-') || p[7] < '0' || p[7] > '9') {
+            return false;
+        }
+        double mantissa;
+        if (!parseDecimal(p + 1, 5, mantissa)) {
+            return false;
+        }
+        const int exponent = (p[6] == '-') ? -(p[7] - '0') : (p[7] - '0');
+        const int scale    = exponent - 5;
+        value = (scale < 0) ? mantissa / POWERS_OF_TEN[-scale] : mantissa * POWERS_OF_TEN[scale];
+        if (p[0] == '-') {
+            value = -value;
+        }
+        return true;
+    }
+
+    /** Move rows within a column.
+     * @param column column
+     * @param from index of the first row to move
+     * @param count number of rows to move
+     * @param to new index of the first row, not after from
+     * @param T type of the column elements
+     */
+    template <typename T>
+    void moveRows(std::vector<T>& column, size_t from, size_t count, size_t to)
+    {
+        std::copy(column.begin() + from, column.begin() + from + count, column.begin() + to);
+    }
+
+}
+
+TLECatalog::TLECatalog()
+    : size(0), rejected(0)
+{
+
+}
+
+bool TLECatalog::read(const char* path)
+{
+    MappedFile file(path);
+    if (!file.isOpen()) {
+        return false;
+    }
+    file.adviseSequential();
+    parse(file.getData(), file.getData() + file.getSize());
+    return true;
+}
+
+bool TLECatalog::read(ThreadPool& pool, const char* path)
+{
+    MappedFile file(path);
+    if (!file.isOpen()) {
+        return false;
+    }
+    file.adviseSequential();
+    parse(pool, file.getData(), file.getData() + file.getSize());
+    return true;
+}
+
+void TLECatalog::parse(const char* begin, const char* end)
+{
+    const size_t bytes = static_cast<size_t>(end - begin);
+    resize((bytes + 1) / (MIN_RECORD_BYTES + 1));
+    rejected = 0;
+    const size_t count = parseSegment(begin, end, 0, rejected);
+    resize(count);
+}
+
+void TLECatalog::parse(ThreadPool& pool, const char* begin, const char* end)
+{
+    const size_t bytes = static_cast<size_t>(end - begin);
+    if (pool.getNbThreads() < 2 || bytes < 2 * SEGMENT_BYTES) {
+        parse(begin, end);
+        return;
+    }
+
+    // cut segments at record boundaries, each one owning a slice of the columns
+    // large enough for the densest possible content
+    std::vector<const char*> bounds(1, begin);
+    std::vector<size_t> firsts(1, 0);
+    while (bounds.back() < end) {
+        const size_t remaining = static_cast<size_t>(end - bounds.back());
+        const char* p = bounds.back() + ((remaining < SEGMENT_BYTES) ? remaining : SEGMENT_BYTES);
+        if (p < end && p[-1] != '\n') {
+            p = nextLine(endOfLine(p, end), end);
+        }
+        p = findRecord(p, end);
+        firsts.push_back(firsts.back() + static_cast<size_t>(p - bounds.back() + 1) / (MIN_RECORD_BYTES + 1));
+        bounds.push_back(p);
+    }
+    const size_t segments = bounds.size() - 1;
+    resize(firsts.back());
+
+    std::vector<size_t> counts(segments);
+    std::vector<size_t> rejects(segments);
+    pool.parallelFor(segments, 1, [&](size_t first, size_t last) {
+        for (size_t s = first; s < last; ++s) {
+            rejects[s] = 0;
+            counts[s]  = parseSegment(bounds[s], bounds[s + 1], firsts[s], rejects[s]);
+        }
+    });
+
+    // pack the slices
+    size_t count = 0;
+    rejected = 0;
+    for (size_t s = 0; s < segments; ++s) {
+        move(firsts[s], counts[s], count);
+        count    += counts[s];
+        rejected += rejects[s];
+    }
+    resize(count);
+}
+
+size_t TLECatalog::getSize() const
+{
+    return size;
+}
+
+size_t TLECatalog::getRejected() const
+{
+    return rejected;
+}
+
+TLE TLECatalog::getTLE(size_t index) const
+{
+    return TLE(satelliteNumbers[index], epochYears[index], epochDays[index],
+               meanMotions[index], meanMotionFirstDerivatives[index], meanMotionSecondDerivatives[index],
+               e[index], i[index], pa[index], raan[index], meanAnomalies[index], bStars[index]);
+}
+
+const int* TLECatalog::getSatelliteNumbers() const
+{
+    return satelliteNumbers.data();
+}
+
+const int* TLECatalog::getEpochYears() const
+{
+    return epochYears.data();
+}
+
+const double* TLECatalog::getEpochDays() const
+{
+    return epochDays.data();
+}
+
+const LinearTime* TLECatalog::getEpochs() const
+{
+    return epochs.data();
+}
+
+const double* TLECatalog::getMeanMotions() const
+{
+    return meanMotions.data();
+}
+
+const double* TLECatalog::getMeanMotionFirstDerivatives() const
+{
+    return meanMotionFirstDerivatives.data();
+}
+
+const double* TLECatalog::getMeanMotionSecondDerivatives() const
+{
+    return meanMotionSecondDerivatives.data();
+}
+
+const double* TLECatalog::getE() const
+{
+    return e.data();
+}
+
+const double* TLECatalog::getI() const
+{
+    return i.data();
+}
+
+const double* TLECatalog::getPerigeeArguments() const
+{
+    return pa.data();
+}
+
+const double* TLECatalog::getRaans() const
+{
+    return raan.data();
+}
+
+const double* TLECatalog::getMeanAnomalies() const
+{
+    return meanAnomalies.data();
+}
+
+const double* TLECatalog::getBStars() const
+{
+    return bStars.data();
+}
+
+void TLECatalog::resize(size_t newSize)
+{
+    satelliteNumbers.resize(newSize);
+    epochYears.resize(newSize);
+    epochDays.resize(newSize);
+    epochs.resize(newSize);
+    meanMotions.resize(newSize);
+    meanMotionFirstDerivatives.resize(newSize);
+    meanMotionSecondDerivatives.resize(newSize);
+    e.resize(newSize);
+    i.resize(newSize);
+    pa.resize(newSize);
+    raan.resize(newSize);
+    meanAnomalies.resize(newSize);
+    bStars.resize(newSize);
+    size = newSize;
+}
+
+void TLECatalog::move(size_t from, size_t count, size_t to)
+{
+    if (from == to || count == 0) {
+        return;
+    }
+    moveRows(satelliteNumbers, from, count, to);
+    moveRows(epochYears, from, count, to);
+    moveRows(epochDays, from, count, to);
+    moveRows(epochs, from, count, to);
+    moveRows(meanMotions, from, count, to);
+    moveRows(meanMotionFirstDerivatives, from, count, to);
+    moveRows(meanMotionSecondDerivatives, from, count, to);
+    moveRows(e, from, count, to);
+    moveRows(i, from, count, to);
+    moveRows(pa, from, count, to);
+    moveRows(raan, from, count, to);
+    moveRows(meanAnomalies, from, count, to);
+    moveRows(bStars, from, count, to);
+}
+
+size_t TLECatalog::parseSegment(const char* begin, const char* end, size_t first, size_t& rejects)
+{
+    size_t row = first;
+    const char* p = begin;
+    while (p < end) {
+        const char* eol1 = endOfLine(p, end);
+        const char* line2 = nextLine(eol1, end);
+        if (!(startsWith(p, end, '1') && startsWith(line2, end, '2'))) {
+            // name line, blank line or orphan line
+            p = line2;
+            continue;
+        }
+        const char* eol2 = endOfLine(line2, end);
+        const char* line1 = p;
+        p = nextLine(eol2, end);
+
+        // fixed columns, the eccentricity having an assumed leading decimal point
+        int number1, number2, year, eccentricity;
+        double day, ndot, nddot, bStar, inclination, node, perigee, anomaly, n;
+        if (static_cast<size_t>(eol1 - line1) < LINE_LENGTH || static_cast<size_t>(eol2 - line2) < LINE_LENGTH ||
+            !checksum(line1) || !checksum(line2) ||
+            !parseSatelliteNumber(line1 + 2, number1) || !parseSatelliteNumber(line2 + 2, number2) ||
+            number1 != number2 ||
+            !parseInt(line1 + 18, 2, year) || !parseDecimal(line1 + 20, 12, day) ||
+            !parseDecimal(line1 + 33, 10, ndot) || !parseExponent(line1 + 44, nddot) ||
+            !parseExponent(line1 + 53, bStar) ||
+            !parseDecimal(line2 + 8, 8, inclination) || !parseDecimal(line2 + 17, 8, node) ||
+            !parseInt(line2 + 26, 7, eccentricity) || !parseDecimal(line2 + 34, 8, perigee) ||
+            !parseDecimal(line2 + 43, 8, anomaly) || !parseDecimal(line2 + 52, 11, n) ||
+            day < 1.0 || day >= 367.0) {
+            ++rejects;
+            continue;
+        }
+
+        const int fullYear = (year < 57) ? 2000 + year : 1900 + year;
+        satelliteNumbers[row]            = number1;
+        epochYears[row]                  = fullYear;
+        epochDays[row]                   = day;
+        epochs[row]                      = TLE::computeDate(fullYear, day);
+        meanMotions[row]                 = n * REV_PER_DAY;
+        meanMotionFirstDerivatives[row]  = 2.0 * ndot * REV_PER_DAY / 86400.0;
+        meanMotionSecondDerivatives[row] = 6.0 * nddot * REV_PER_DAY / (86400.0 * 86400.0);
+        e[row]                           = eccentricity / POWERS_OF_TEN[7];
+        i[row]                           = inclination * DEG_TO_RAD;
+        pa[row]                          = perigee * DEG_TO_RAD;
+        raan[row]                        = node * DEG_TO_RAD;
+        meanAnomalies[row]               = anomaly * DEG_TO_RAD;
+        bStars[row]                      = bStar;
+        ++row;
+    }
+    return row - first;
+}
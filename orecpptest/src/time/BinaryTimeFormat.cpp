@@ -0,0 +1,3 @@
+#include "time/BinaryTimeFormat.h"
+
+const char BinaryTimeFormat::MAGIC[8] = { 'O', 'R', 'E', 'T', 'I', 'M', 'E', '\0' };
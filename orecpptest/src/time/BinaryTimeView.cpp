@@ -0,0 +1,136 @@
+#include "time/BinaryTimeView.h"
+#include <cstring>
+
+namespace {
+
+    /** Check a column lies within the block.
+     * @param offset column offset
+     * @param elementSize size of one element
+     * @param header block header
+     * @param size block size
+     * @return true if the column is aligned and within the block
+     */
+    bool checkColumn(uint64_t offset, size_t elementSize,
+                     const BinaryTimeHeader& header, size_t size)
+    {
+        if (offset < header.headerSize || offset > size ||
+            (offset % BinaryTimeFormat::ALIGNMENT) != 0) {
+            return false;
+        }
+        return header.count <= (size - offset) / elementSize;
+    }
+
+}
+
+BinaryTimeView::BinaryTimeView()
+    : header(nullptr), days(nullptr), minutes(nullptr),
+      utcOffsets(nullptr), nanos(nullptr), count(0)
+{
+
+}
+
+BinaryTimeView::BinaryTimeView(const void* data, size_t size)
+    : BinaryTimeView()
+{
+    if (data == nullptr || size < sizeof(BinaryTimeHeader) ||
+        !BinaryTimeFormat::isHostLittleEndian()) {
+        return;
+    }
+
+    const BinaryTimeHeader* h = static_cast<const BinaryTimeHeader*>(data);
+    if (std::memcmp(h->magic, BinaryTimeFormat::MAGIC, sizeof(h->magic)) != 0 ||
+        h->version != BinaryTimeFormat::VERSION ||
+        h->headerSize < sizeof(BinaryTimeHeader) || h->headerSize > size) {
+        return;
+    }
+
+    const char* base = static_cast<const char*>(data);
+    if (!checkColumn(h->dayOffset, sizeof(int32_t), *h, size)) {
+        return;
+    }
+    if (h->kind == BinaryTimeFormat::DATE_TIMES) {
+        if (!checkColumn(h->minuteOffset,    sizeof(int16_t), *h, size) ||
+            !checkColumn(h->utcOffsetOffset, sizeof(int16_t), *h, size) ||
+            !checkColumn(h->nanosOffset,     sizeof(int64_t), *h, size)) {
+            return;
+        }
+        minutes    = reinterpret_cast<const int16_t*>(base + h->minuteOffset);
+        utcOffsets = reinterpret_cast<const int16_t*>(base + h->utcOffsetOffset);
+        nanos      = reinterpret_cast<const int64_t*>(base + h->nanosOffset);
+    }
+    else if (h->kind != BinaryTimeFormat::DATES) {
+        return;
+    }
+
+    days   = reinterpret_cast<const int32_t*>(base + h->dayOffset);
+    count  = static_cast<size_t>(h->count);
+    header = h;
+}
+
+bool BinaryTimeView::isValid() const
+{
+    return header != nullptr;
+}
+
+BinaryTimeFormat::Kind BinaryTimeView::getKind() const
+{
+    return static_cast<BinaryTimeFormat::Kind>(header->kind);
+}
+
+BinaryTimeFormat::Scale BinaryTimeView::getScale() const
+{
+    return static_cast<BinaryTimeFormat::Scale>(header->scale);
+}
+
+DateComponents BinaryTimeView::getEpoch() const
+{
+    return DateComponents(header->epochJ2000Day);
+}
+
+size_t BinaryTimeView::size() const
+{
+    return count;
+}
+
+const int32_t* BinaryTimeView::getDays() const
+{
+    return days;
+}
+
+const int16_t* BinaryTimeView::getMinutesInDay() const
+{
+    return minutes;
+}
+
+const int16_t* BinaryTimeView::getMinutesFromUTC() const
+{
+    return utcOffsets;
+}
+
+const int64_t* BinaryTimeView::getNanosInMinute() const
+{
+    return nanos;
+}
+
+int BinaryTimeView::getJ2000Day(size_t i) const
+{
+    // offsets are stored modulo 2^32, so wrap around as the writer did
+    return static_cast<int32_t>(static_cast<uint32_t>(header->epochJ2000Day) +
+                                static_cast<uint32_t>(days[i]));
+}
+
+DateComponents BinaryTimeView::getDate(size_t i) const
+{
+    return DateComponents(getJ2000Day(i));
+}
+
+DateTimeComponents BinaryTimeView::getDateTime(size_t i) const
+{
+    if (minutes == nullptr) {
+        return DateTimeComponents(getDate(i), TimeComponents::H00);
+    }
+    const int minuteInDay = minutes[i];
+    return DateTimeComponents(getDate(i),
+                              TimeComponents(minuteInDay / 60, minuteInDay % 60,
+                                             1.0e-9 * nanos[i], utcOffsets[i]));
+}
@@ -0,0 +1,176 @@
+#include "time/BinaryTimeWriter.h"
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+
+    /** Store a value in little-endian byte order.
+     * @param value value to store
+     * @param destination destination bytes
+     */
+    template<typename T>
+    void storeLittleEndian(T value, char* destination)
+    {
+        if (BinaryTimeFormat::isHostLittleEndian()) {
+            std::memcpy(destination, &value, sizeof(T));
+        }
+        else {
+            const char* bytes = reinterpret_cast<const char*>(&value);
+            for (size_t i = 0; i < sizeof(T); ++i) {
+                destination[i] = bytes[sizeof(T) - 1 - i];
+            }
+        }
+    }
+
+}
+
+BinaryTimeWriter::BinaryTimeWriter(int fd, BinaryTimeFormat::Scale scale)
+    : fd(fd), scale(scale), epochJ2000Day(0), written(0), buffer(BUFFER_SIZE)
+{
+
+}
+
+void BinaryTimeWriter::setEpoch(const DateComponents& epoch)
+{
+    epochJ2000Day = epoch.getJ2000Day();
+}
+
+bool BinaryTimeWriter::writeDates(const DateComponents* dates, size_t count)
+{
+    const uint32_t epoch = static_cast<uint32_t>(epochJ2000Day);
+    return writeHeader(BinaryTimeFormat::DATES, count) &&
+           writeColumn<int32_t>(count, [dates, epoch](size_t i) {
+               return static_cast<int32_t>(static_cast<uint32_t>(dates[i].getJ2000Day()) - epoch);
+           });
+}
+
+bool BinaryTimeWriter::writeDateTimes(const DateTimeComponents* dateTimes, size_t count)
+{
+    const uint32_t epoch = static_cast<uint32_t>(epochJ2000Day);
+    return writeHeader(BinaryTimeFormat::DATE_TIMES, count) &&
+           writeColumn<int32_t>(count, [dateTimes, epoch](size_t i) {
+               return static_cast<int32_t>(static_cast<uint32_t>(dateTimes[i].getDate().getJ2000Day()) - epoch);
+           }) &&
+           writeColumn<int16_t>(count, [dateTimes](size_t i) {
+               const TimeComponents time = dateTimes[i].getTime();
+               return static_cast<int16_t>(60 * time.getHour() + time.getMinute());
+           }) &&
+           writeColumn<int16_t>(count, [dateTimes](size_t i) {
+               return static_cast<int16_t>(dateTimes[i].getTime().getMinutesFromUTC());
+           }) &&
+           writeColumn<int64_t>(count, [dateTimes](size_t i) {
+               return getNanosInMinute(dateTimes[i].getTime());
+           });
+}
+
+uint64_t BinaryTimeWriter::getBytesWritten() const
+{
+    return written;
+}
+
+size_t BinaryTimeWriter::getEncodedSize(BinaryTimeFormat::Kind kind, size_t count)
+{
+    size_t size = BinaryTimeFormat::align(sizeof(BinaryTimeHeader) + count * sizeof(int32_t));
+    if (kind == BinaryTimeFormat::DATE_TIMES) {
+        size  = BinaryTimeFormat::align(size + count * sizeof(int16_t));
+        size  = BinaryTimeFormat::align(size + count * sizeof(int16_t));
+        size += count * sizeof(int64_t);
+    }
+    return size;
+}
+
+int64_t BinaryTimeWriter::getNanosInMinute(const TimeComponents& time)
+{
+    // round to nearest nanosecond, but never up to the next whole second,
+    // which could turn 59.9999999999 into a leap second
+    const double second    = time.getSecond();
+    const double wholePart = std::floor(second);
+    int64_t nanos          = std::llround(second * 1.0e9);
+    const int64_t limit    = static_cast<int64_t>(wholePart) * 1000000000LL + 999999999LL;
+    return (nanos > limit) ? limit : nanos;
+}
+
+bool BinaryTimeWriter::writeHeader(BinaryTimeFormat::Kind kind, size_t count)
+{
+    uint64_t dayOffset = sizeof(BinaryTimeHeader);
+    uint64_t minuteOffset = 0;
+    uint64_t utcOffsetOffset = 0;
+    uint64_t nanosOffset = 0;
+    if (kind == BinaryTimeFormat::DATE_TIMES) {
+        minuteOffset    = BinaryTimeFormat::align(dayOffset + count * sizeof(int32_t));
+        utcOffsetOffset = BinaryTimeFormat::align(minuteOffset + count * sizeof(int16_t));
+        nanosOffset     = BinaryTimeFormat::align(utcOffsetOffset + count * sizeof(int16_t));
+    }
+
+    // the header is written field by field to enforce little-endian order
+    char bytes[sizeof(BinaryTimeHeader)];
+    std::memcpy(bytes, BinaryTimeFormat::MAGIC, sizeof(BinaryTimeFormat::MAGIC));
+    storeLittleEndian<uint16_t>(BinaryTimeFormat::VERSION, bytes + 8);
+    storeLittleEndian<uint16_t>(kind, bytes + 10);
+    storeLittleEndian<uint16_t>(scale, bytes + 12);
+    storeLittleEndian<uint16_t>(sizeof(BinaryTimeHeader), bytes + 14);
+    storeLittleEndian<int32_t>(epochJ2000Day, bytes + 16);
+    storeLittleEndian<uint32_t>(0, bytes + 20);
+    storeLittleEndian<uint64_t>(count, bytes + 24);
+    storeLittleEndian<uint64_t>(dayOffset, bytes + 32);
+    storeLittleEndian<uint64_t>(minuteOffset, bytes + 40);
+    storeLittleEndian<uint64_t>(utcOffsetOffset, bytes + 48);
+    storeLittleEndian<uint64_t>(nanosOffset, bytes + 56);
+    return writeBytes(bytes, sizeof(bytes));
+}
+
+template<typename T, typename Extract>
+bool BinaryTimeWriter::writeColumn(size_t count, Extract extract)
+{
+    const size_t perChunk = BUFFER_SIZE / sizeof(T);
+    for (size_t start = 0; start < count; start += perChunk) {
+        const size_t end = (count - start > perChunk) ? start + perChunk : count;
+        char* p = buffer.data();
+        for (size_t i = start; i < end; ++i) {
+            storeLittleEndian<T>(extract(i), p);
+            p += sizeof(T);
+        }
+        if (!writeBytes(buffer.data(), p - buffer.data())) {
+            return false;
+        }
+    }
+
+    // pad the column to the format alignment
+    const size_t length  = count * sizeof(T);
+    const size_t padding = BinaryTimeFormat::align(length) - length;
+    if (padding > 0) {
+        const char zeros[BinaryTimeFormat::ALIGNMENT] = { 0 };
+        return writeBytes(zeros, padding);
+    }
+    return true;
+}
+
+bool BinaryTimeWriter::writeBytes(const void* bytes, size_t length)
+{
+    const char* p = static_cast<const char*>(bytes);
+    while (length > 0) {
+#ifdef _WIN32
+        const unsigned int chunk = (length > (1u << 30)) ? (1u << 30) : static_cast<unsigned int>(length);
+        const int n = _write(fd, p, chunk);
+#else
+        const ssize_t n = ::write(fd, p, length);
+#endif
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        p       += n;
+        length  -= static_cast<size_t>(n);
+        written += static_cast<uint64_t>(n);
+    }
+    return true;
+}
@@ -0,0 +1,203 @@
+#include "time/ChronoConversions.h"
+#include <stdint.h>
+#include <cmath>
+
+namespace {
+
+    /** Nanoseconds in one minute. */
+    const int64_t NANOS_PER_MINUTE = INT64_C(60000000000);
+
+    /** Nanoseconds in one day. */
+    const int64_t NANOS_PER_DAY = 1440 * NANOS_PER_MINUTE;
+
+    /** Floor division.
+     * @param a dividend
+     * @param b divisor (strictly positive)
+     * @return largest integer not greater than a / b
+     */
+    inline int64_t floorDiv(int64_t a, int64_t b)
+    {
+        const int64_t q = a / b;
+        return (a % b < 0) ? q - 1 : q;
+    }
+
+    /** Check if calendar fields belong to the gregorian calendar era.
+     * @param year year number
+     * @param month month number
+     * @param day day number
+     * @return true if the fields are on or after 1582-10-15
+     */
+    inline bool isGregorian(int year, unsigned month, unsigned day)
+    {
+        return (year > 1582) || ((year == 1582) && ((month > 10) || ((month == 10) && (day >= 15))));
+    }
+
+    /** Saturating conversion of a minute count and a second number to nanoseconds.
+     * @param minutes minutes since 1970-01-01
+     * @param second second in minute
+     * @return nanoseconds since 1970-01-01
+     */
+    int64_t toNanos(int64_t minutes, double second)
+    {
+        const int64_t limit = INT64_MAX / NANOS_PER_MINUTE - 1;
+        if (minutes > limit) {
+            return INT64_MAX;
+        }
+        else if (minutes < -limit) {
+            return INT64_MIN;
+        }
+        return minutes * NANOS_PER_MINUTE + std::llround(second * 1.0e9);
+    }
+
+    /** Get the minutes since 1970-01-01 of a date/time.
+     * @param j2000Day day offset of the date with respect to J2000
+     * @param time time of day
+     * @return minutes since 1970-01-01
+     */
+    inline int64_t getMinutes(int j2000Day, const TimeComponents& time)
+    {
+        return INT64_C(1440) * (static_cast<int64_t>(j2000Day) - ChronoConversions::JAVA_EPOCH_J2000_DAY) +
+               60 * time.getHour() + time.getMinute() - time.getMinutesFromUTC();
+    }
+
+}
+
+std::chrono::sys_days ChronoConversions::toSysDays(const DateComponents& date)
+{
+    return std::chrono::sys_days(std::chrono::days(date.getJ2000Day() - JAVA_EPOCH_J2000_DAY));
+}
+
+DateComponents ChronoConversions::toDateComponents(const std::chrono::sys_days& days)
+{
+    return DateComponents(static_cast<int>(days.time_since_epoch().count() + JAVA_EPOCH_J2000_DAY));
+}
+
+std::chrono::year_month_day ChronoConversions::toYearMonthDay(const DateComponents& date)
+{
+    if (isGregorian(date.getYear(), date.getMonth(), date.getDay())) {
+        // same calendar, fields can be copied as is
+        return std::chrono::year_month_day(std::chrono::year(date.getYear()),
+                                           std::chrono::month(date.getMonth()),
+                                           std::chrono::day(date.getDay()));
+    }
+    return std::chrono::year_month_day(toSysDays(date));
+}
+
+DateComponents ChronoConversions::toDateComponents(const std::chrono::year_month_day& date)
+{
+    const int year = static_cast<int>(date.year());
+    const unsigned month = static_cast<unsigned>(date.month());
+    const unsigned day = static_cast<unsigned>(date.day());
+    if (isGregorian(year, month, day)) {
+        // same calendar, fields can be copied as is
+        return DateComponents(year, static_cast<int>(month), static_cast<int>(day));
+    }
+    return toDateComponents(std::chrono::sys_days(date));
+}
+
+std::chrono::hh_mm_ss<std::chrono::nanoseconds> ChronoConversions::toHhMmSs(const TimeComponents& time)
+{
+    const int64_t minutes = 60 * time.getHour() + time.getMinute();
+    return std::chrono::hh_mm_ss<std::chrono::nanoseconds>(
+        std::chrono::nanoseconds(minutes * NANOS_PER_MINUTE + std::llround(time.getSecond() * 1.0e9)));
+}
+
+TimeComponents ChronoConversions::toTimeComponents(const std::chrono::hh_mm_ss<std::chrono::nanoseconds>& time)
+{
+    const int64_t nanos = time.to_duration().count();
+    if (nanos >= NANOS_PER_DAY) {
+        // leap second
+        return TimeComponents(23, 59, 60.0 + 1.0e-9 * static_cast<double>(nanos - NANOS_PER_DAY));
+    }
+    return TimeComponents(static_cast<int>(time.hours().count()),
+                          static_cast<int>(time.minutes().count()),
+                          static_cast<double>(time.seconds().count()) +
+                          1.0e-9 * static_cast<double>(time.subseconds().count()));
+}
+
+ChronoConversions::SysNanos ChronoConversions::toSysTime(const DateTimeComponents& dateTime)
+{
+    const TimeComponents time = dateTime.getTime();
+    return SysNanos(std::chrono::nanoseconds(toNanos(getMinutes(dateTime.getDate().getJ2000Day(), time),
+                                                     time.getSecond())));
+}
+
+DateTimeComponents ChronoConversions::toDateTimeComponents(const SysNanos& time)
+{
+    return fromNanos(time.time_since_epoch().count());
+}
+
+void ChronoConversions::toSysTimes(const DateTimeComponents* dateTimes, size_t count, SysNanos* times)
+{
+    DateComponents lastDate{};
+    int lastJ2000Day = 0;
+    bool cached = false;
+    for (size_t i = 0; i < count; ++i) {
+        const DateComponents date = dateTimes[i].getDate();
+        if (!cached || !(date == lastDate)) {
+            lastDate     = date;
+            lastJ2000Day = date.getJ2000Day();
+            cached       = true;
+        }
+        const TimeComponents time = dateTimes[i].getTime();
+        times[i] = SysNanos(std::chrono::nanoseconds(toNanos(getMinutes(lastJ2000Day, time), time.getSecond())));
+    }
+}
+
+void ChronoConversions::toDateTimeComponents(const SysNanos* times, size_t count, DateTimeComponents* dateTimes)
+{
+    DateComponents lastDate{};
+    int64_t lastDay = INT64_MIN;
+    for (size_t i = 0; i < count; ++i) {
+        const int64_t nanos = times[i].time_since_epoch().count();
+        const int64_t day   = floorDiv(nanos, NANOS_PER_DAY);
+        if (day != lastDay) {
+            lastDay  = day;
+            lastDate = DateComponents(static_cast<int>(day + JAVA_EPOCH_J2000_DAY));
+        }
+        const int64_t nanosInDay  = nanos - day * NANOS_PER_DAY;
+        const int     minuteInDay = static_cast<int>(nanosInDay / NANOS_PER_MINUTE);
+        const int64_t nanosInMin  = nanosInDay - minuteInDay * NANOS_PER_MINUTE;
+        dateTimes[i] = DateTimeComponents(lastDate,
+                                          TimeComponents(minuteInDay / 60, minuteInDay % 60,
+                                                         1.0e-9 * static_cast<double>(nanosInMin)));
+    }
+}
+
+#ifdef ORECPP_HAS_UTC_CLOCK
+std::chrono::utc_time<std::chrono::nanoseconds> ChronoConversions::toUtcTime(const DateTimeComponents& dateTime)
+{
+    // a leap second 23:59:60.x is mapped by toSysTime to 00:00:00.x of the next day,
+    // which is one second after the leap second on the UTC time line
+    const SysNanos sys = toSysTime(dateTime);
+    const std::chrono::utc_time<std::chrono::nanoseconds> utc = std::chrono::utc_clock::from_sys(sys);
+    return (dateTime.getTime().getSecond() >= 60.0) ? utc - std::chrono::seconds(1) : utc;
+}
+
+DateTimeComponents ChronoConversions::toDateTimeComponents(const std::chrono::utc_time<std::chrono::nanoseconds>& time)
+{
+    // removing the elapsed leap seconds (including the current one during a leap second)
+    // gives 23:59:59.x during a leap second, which is then shifted to 23:59:60.x
+    const std::chrono::leap_second_info info = std::chrono::get_leap_second_info(time);
+    const int64_t nanos =
+        (time.time_since_epoch() - std::chrono::duration_cast<std::chrono::nanoseconds>(info.elapsed)).count();
+    const DateTimeComponents dateTime = fromNanos(nanos);
+    if (!info.is_leap_second) {
+        return dateTime;
+    }
+    const TimeComponents time59 = dateTime.getTime();
+    return DateTimeComponents(dateTime.getDate(),
+                              TimeComponents(time59.getHour(), time59.getMinute(), time59.getSecond() + 1.0));
+}
+#endif
+
+DateTimeComponents ChronoConversions::fromNanos(long long nanos)
+{
+    const int64_t day         = floorDiv(nanos, NANOS_PER_DAY);
+    const int64_t nanosInDay  = nanos - day * NANOS_PER_DAY;
+    const int     minuteInDay = static_cast<int>(nanosInDay / NANOS_PER_MINUTE);
+    const int64_t nanosInMin  = nanosInDay - minuteInDay * NANOS_PER_MINUTE;
+    return DateTimeComponents(DateComponents(static_cast<int>(day + JAVA_EPOCH_J2000_DAY)),
+                              TimeComponents(minuteInDay / 60, minuteInDay % 60,
+                                             1.0e-9 * static_cast<double>(nanosInMin)));
+}
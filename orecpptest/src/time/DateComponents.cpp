@@ -1,4 +1,6 @@
 #include "time/DateComponents.h"
+#include "utils/Instrumentation.h"
+#include <climits>
 #include <memory>
 
 /** Interface for dealing with months sequences according to leap/common years. */
@@ -87,6 +89,58 @@ const int CommonYearFactory::PREVIOUS_MONTH_END_DAY[13] = {
     0, 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334
 };
 
+namespace {
+
+    /** Day number in year of the last julian day in 1582 (October 4th). */
+    const int LAST_JULIAN_DAY_IN_1582 = 277;
+
+    /** Number of days skipped when switching to the gregorian calendar in 1582. */
+    const int GREGORIAN_GAP = 10;
+
+    /** Day number in year of the last day of the previous month, in leap years.
+     * <p>These tables are constant initialized, so they can be used during
+     * the dynamic initialization of other translation units.</p>
+     */
+    constexpr int LEAP_YEAR_PREVIOUS_MONTH_END_DAY[13] = {
+        0, 0, 31, 60, 91, 121, 152, 182, 213, 244, 274, 305, 335
+    };
+
+    /** Day number in year of the last day of the previous month, in common years. */
+    constexpr int COMMON_YEAR_PREVIOUS_MONTH_END_DAY[13] = {
+        0, 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334
+    };
+
+    /** Get month and day from a day number within year.
+     * @param leap if true, the year is a leap year
+     * @param dayInYear day number within year (in the common months sequence for 1582)
+     * @param month placeholder for the month number
+     * @param day placeholder for the day number
+     */
+    inline void toMonthDay(bool leap, int dayInYear, int& month, int& day)
+    {
+        if (leap) {
+            month = (dayInYear < 32) ? 1 : (10 * dayInYear + 313) / 306;
+            day = dayInYear - LEAP_YEAR_PREVIOUS_MONTH_END_DAY[month];
+        }
+        else {
+            month = (dayInYear < 32) ? 1 : (10 * dayInYear + 323) / 306;
+            day = dayInYear - COMMON_YEAR_PREVIOUS_MONTH_END_DAY[month];
+        }
+    }
+
+    /** Get the day number within year from month and day.
+     * @param leap if true, the year is a leap year
+     * @param month month number
+     * @param day day number
+     * @return day number within year (in the common months sequence for 1582)
+     */
+    inline int toDayInYear(bool leap, int month, int day)
+    {
+        return day + (leap ? LEAP_YEAR_PREVIOUS_MONTH_END_DAY[month] : COMMON_YEAR_PREVIOUS_MONTH_END_DAY[month]);
+    }
+
+}
+
 
 
 /** Interface for dealing with years sequences according to some calendar. */
@@ -191,6 +245,13 @@ public:
 };
 
 
+// factories must be initialized before the epochs built from a day offset
+const YearFactory* DateComponents::PROLEPTIC_JULIAN_FACTORY = new ProlepticJulianFactory();
+const YearFactory* DateComponents::JULIAN_FACTORY = new JulianFactory();
+const YearFactory* DateComponents::GREGORIAN_FACTORY = new GregorianFactory();
+const MonthDayFactory* DateComponents::LEAP_YEAR_FACTORY = new LeapYearFactory();
+const MonthDayFactory* DateComponents::COMMON_YEAR_FACTORY = new CommonYearFactory();
+
 const DateComponents DateComponents::JULIAN_EPOCH(-4712, 1, 1);
 const DateComponents DateComponents::MODIFIED_JULIAN_EPOCH(1858, 11, 17);
 const DateComponents DateComponents::FIFTIES_EPOCH(1950, 1, 1);
@@ -206,12 +267,6 @@ const DateComponents DateComponents::JAVA_EPOCH(1970, 1, 1);
 const DateComponents DateComponents::MAX_EPOCH(INT_MAX);
 const DateComponents DateComponents::MIN_EPOCH(INT_MIN);
 
-const YearFactory* DateComponents::PROLEPTIC_JULIAN_FACTORY = new ProlepticJulianFactory();
-const YearFactory* DateComponents::JULIAN_FACTORY = new JulianFactory();
-const YearFactory* DateComponents::GREGORIAN_FACTORY = new GregorianFactory();
-const MonthDayFactory* DateComponents::LEAP_YEAR_FACTORY = new LeapYearFactory();
-const MonthDayFactory* DateComponents::COMMON_YEAR_FACTORY = new CommonYearFactory();
-
 DateComponents::DateComponents(int year, int month, int day)
     : year(year), month(month), day(day)
 {
@@ -219,13 +274,27 @@ DateComponents::DateComponents(int year, int month, int day)
 }
 
 DateComponents::DateComponents(int year, int dayNumber)
-    : DateComponents(J2000_EPOCH, DateComponents(year - 1, 12, 31).getJ2000Day() + dayNumber)
+    : year(year)
 {
+    const int yearLength = getYearLength(year);
+    if (dayNumber < 1 || dayNumber > yearLength) {
+        // out of range day numbers spill over the neighbouring years
+        *this = DateComponents(J2000_EPOCH, DateComponents(year - 1, 12, 31).getJ2000Day() + dayNumber);
+        return;
+    }
 
+    // the months sequence of 1582 is the common one, with the days of the gregorian leap skipped
+    int dayInYear = dayNumber;
+    if (year == 1582 && dayInYear > LAST_JULIAN_DAY_IN_1582) {
+        dayInYear += GREGORIAN_GAP;
+    }
+    toMonthDay(yearLength == 366, dayInYear, month, day);
 }
 
 DateComponents::DateComponents(int offset)
 {
+    ORECPP_TIMED_SCOPE(DATE_FROM_OFFSET);
+
     // we follow the astronomical convention for calendars:
     // we consider a year zero and 10 days are missing in 1582
     // from 1582-10-15: gregorian calendar
@@ -273,6 +342,8 @@ int DateComponents::getDay() const
 
 int DateComponents::getJ2000Day() const
 {
+    ORECPP_COUNT(DATE_TO_J2000_DAY);
+
     auto yFactory = GREGORIAN_FACTORY;
     if (year < 1583) {
         if (year < 1) {
@@ -295,6 +366,14 @@ int DateComponents::getMJD() const
 
 int DateComponents::getCalendarWeek() const
 {
+    ORECPP_TIMED_SCOPE(DATE_CALENDAR_WEEK);
+
+    if (year <= MIN_EPOCH.year + 1) {
+        // new year's day of this year or the previous one is before MIN_EPOCH and
+        // cannot be represented, use the same day one 28 years julian cycle later,
+        // which has the same week structure
+        return DateComponents(getJ2000Day() + 10227).getCalendarWeek();
+    }
     int firstWeekMonday = getFirstWeekMonday(year);
     int daysSincefirstMonday = getJ2000Day() - firstWeekMonday;
     if (daysSincefirstMonday < 0) {
@@ -321,13 +400,74 @@ int DateComponents::getFirstWeekMonday(int year)
 
 int DateComponents::getDayOfWeek() const 
 {
-    int dow = (getJ2000Day() + 6) % 7; // result is between -6 and +6
+    int dow = (getJ2000Day() % 7 + 6) % 7; // result is between 0 and +6, without overflow near MAX_EPOCH
     return (dow < 1) ? (dow + 7) : dow;
 }
 
 int DateComponents::getDayOfYear() const
 {
-    return getJ2000Day() - DateComponents(year - 1, 12, 31).getJ2000Day();
+    int dayInYear = toDayInYear(getYearLength(year) == 366, month, day);
+    if (year == 1582 && dayInYear > LAST_JULIAN_DAY_IN_1582) {
+        dayInYear -= GREGORIAN_GAP;
+    }
+    return dayInYear;
+}
+
+void DateComponents::createFromOrdinalDates(const int* years, const int* dayNumbers, size_t count,
+                                            DateComponents* dates)
+{
+    // schedules are mostly sorted, consecutive dates in the same year share the year length
+    int lastYear = 0;
+    int yearLength = getYearLength(lastYear);
+    for (size_t i = 0; i < count; ++i) {
+        const int year = years[i];
+        const int dayNumber = dayNumbers[i];
+        if (year != lastYear) {
+            yearLength = getYearLength(year);
+            lastYear = year;
+        }
+        if (dayNumber < 1 || dayNumber > yearLength || year == 1582) {
+            dates[i] = DateComponents(year, dayNumber);
+        }
+        else {
+            DateComponents& date = dates[i];
+            date.year = year;
+            toMonthDay(yearLength == 366, dayNumber, date.month, date.day);
+        }
+    }
+}
+
+void DateComponents::getDaysOfYear(const DateComponents* dates, size_t count, int* dayNumbers)
+{
+    int lastYear = 0;
+    int yearLength = getYearLength(lastYear);
+    for (size_t i = 0; i < count; ++i) {
+        const DateComponents& date = dates[i];
+        if (date.year != lastYear) {
+            yearLength = getYearLength(date.year);
+            lastYear = date.year;
+        }
+        if (date.year == 1582) {
+            dayNumbers[i] = date.getDayOfYear();
+        }
+        else {
+            dayNumbers[i] = toDayInYear(yearLength == 366, date.month, date.day);
+        }
+    }
+}
+
+int DateComponents::getYearLength(int year)
+{
+    // the leap years rules are those of the years factories, inlined so that
+    // ordinal conversions do not depend on the factories initialization;
+    // julian and proleptic julian calendars share the same rule
+    const bool leap = (year < 1583) ?
+                      ((year % 4) == 0) :
+                      (((year % 4) == 0) && (((year % 400) == 0) || ((year % 100) != 0)));
+    if (leap) {
+        return 366;
+    }
+    return (year == 1582) ? 365 - GREGORIAN_GAP : 365;
 }
 
 bool DateComponents::operator<(const DateComponents& other) const
@@ -1,8 +1,11 @@
 #include "time/DateTimeComponents.h"
 #include "utils/Constants.h"
+#include "utils/Instrumentation.h"
 #include <cmath>
 
-const DateTimeComponents DateTimeComponents::JULIAN_EPOCH(DateComponents::JULIAN_EPOCH, TimeComponents::H12);
+// built from fields rather than from the DateComponents and TimeComponents constants,
+// which belong to other translation units and may not be initialized yet
+const DateTimeComponents DateTimeComponents::JULIAN_EPOCH(DateComponents(-4712, 1, 1), TimeComponents(12, 0, 0));
 
 DateTimeComponents::DateTimeComponents(DateComponents date, TimeComponents time)
 	:date(date), time(time)
@@ -25,6 +28,8 @@ DateTimeComponents::DateTimeComponents(int year, int month, int day)
 
 DateTimeComponents::DateTimeComponents(const DateTimeComponents& reference, double offset)
 {
+    ORECPP_TIMED_SCOPE(DATE_TIME_SHIFT);
+
     // extract linear data from reference date/time
     int    day = reference.getDate().getJ2000Day();
     double seconds = reference.getTime().getSecondsInLocalDay();
@@ -46,6 +51,8 @@ DateTimeComponents::DateTimeComponents(const DateTimeComponents& reference, doub
 
 double DateTimeComponents::offsetFrom(const DateTimeComponents& dateTime) const
 {
+    ORECPP_TIMED_SCOPE(DATE_TIME_OFFSET_FROM);
+
     int dateOffset = date.getJ2000Day() - dateTime.date.getJ2000Day();
     double timeOffset = time.getSecondsInUTCDay() - dateTime.time.getSecondsInUTCDay();
     return Constants::JULIAN_DAY * dateOffset + timeOffset;
@@ -0,0 +1,90 @@
+#include "time/DateTimeKeys.h"
+#include <cmath>
+
+namespace {
+
+    /** Split a second number into whole seconds and fractional ticks.
+     * <p>Rounding never carries into the next whole second.</p>
+     * @param second second number from 0.0 to 61.0 (excluded)
+     * @param ticksPerSecond number of ticks in one second
+     * @param whole whole second, from 0 to 60
+     * @param ticks ticks within the whole second
+     */
+    void splitSecond(double second, int64_t ticksPerSecond, int& whole, int64_t& ticks)
+    {
+        const double floorSecond = std::floor(second);
+        whole = static_cast<int>(floorSecond);
+        ticks = static_cast<int64_t>((second - floorSecond) * ticksPerSecond + 0.5);
+        if (ticks >= ticksPerSecond) {
+            ticks = ticksPerSecond - 1;
+        }
+        if (whole < 0) {
+            whole = 0;
+            ticks = 0;
+        }
+        else if (whole > 60) {
+            whole = 60;
+            ticks = ticksPerSecond - 1;
+        }
+    }
+
+}
+
+uint64_t DateTimeKeys::toKey64(const DateTimeComponents& dateTime)
+{
+    const int64_t biased = getUTCMinute(dateTime) + KEY64_MINUTE_BIAS;
+    if (biased < 0) {
+        return KEY64_MIN;
+    }
+    else if (biased >= (INT64_C(1) << 38)) {
+        return KEY64_MAX;
+    }
+    int whole;
+    int64_t micros;
+    splitSecond(dateTime.getTime().getSecond(), 1000000, whole, micros);
+    return (static_cast<uint64_t>(biased) << 26) |
+           (static_cast<uint64_t>(whole)  << 20) |
+           static_cast<uint64_t>(micros);
+}
+
+DateTimeKey96 DateTimeKeys::toKey96(const DateTimeComponents& dateTime)
+{
+    const int64_t biased = getUTCMinute(dateTime) + KEY96_MINUTE_BIAS;
+    int whole;
+    int64_t nanos;
+    splitSecond(dateTime.getTime().getSecond(), 1000000000, whole, nanos);
+    DateTimeKey96 key;
+    key.high = (static_cast<uint64_t>(biased) << 6) | static_cast<uint64_t>(whole);
+    key.low  = static_cast<uint32_t>(nanos);
+    return key;
+}
+
+bool DateTimeKeys::toKeys64(const DateTimeComponents* dateTimes, size_t count, uint64_t* keys)
+{
+    bool inRange = true;
+    for (size_t i = 0; i < count; ++i) {
+        keys[i] = toKey64(dateTimes[i]);
+        inRange = inRange && keys[i] != KEY64_MIN && keys[i] != KEY64_MAX;
+    }
+    return inRange;
+}
+
+void DateTimeKeys::toKeys96(const DateTimeComponents* dateTimes, size_t count, DateTimeKey96* keys)
+{
+    for (size_t i = 0; i < count; ++i) {
+        keys[i] = toKey96(dateTimes[i]);
+    }
+}
+
+bool DateTimeKeys::isInKey64Range(const DateTimeComponents& dateTime)
+{
+    const int64_t biased = getUTCMinute(dateTime) + KEY64_MINUTE_BIAS;
+    return biased > 0 && biased < (INT64_C(1) << 38) - 1;
+}
+
+int64_t DateTimeKeys::getUTCMinute(const DateTimeComponents& dateTime)
+{
+    const TimeComponents time = dateTime.getTime();
+    return INT64_C(1440) * dateTime.getDate().getJ2000Day() +
+           60 * time.getHour() + time.getMinute() - time.getMinutesFromUTC();
+}
@@ -0,0 +1,299 @@
+#include "time/DateTimeSorter.h"
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+namespace {
+
+    /** Number of bits per radix digit. */
+    const int DIGIT_BITS = 16;
+
+    /** Number of buckets per radix digit. */
+    const size_t BUCKETS = size_t(1) << DIGIT_BITS;
+
+    /** Arrays smaller than this are sorted by comparison. */
+    const size_t SMALL_ARRAY = 4096;
+
+    /** Extract a 16 bits digit from a 64 bits key.
+     * @param key key
+     * @param d digit index, 0 being the least significant one
+     * @return digit
+     */
+    inline uint32_t digit(uint64_t key, int d)
+    {
+        return static_cast<uint32_t>(key >> (DIGIT_BITS * d)) & (BUCKETS - 1);
+    }
+
+    /** Extract a 16 bits digit from a 96 bits key.
+     * @param key key
+     * @param d digit index, 0 being the least significant one
+     * @return digit
+     */
+    inline uint32_t digit(const DateTimeKey96& key, int d)
+    {
+        return (d < 2) ?
+               (key.low >> (DIGIT_BITS * d)) & (BUCKETS - 1) :
+               digit(key.high, d - 2);
+    }
+
+    /** Least significant digit radix sort.
+     * @param keys keys to sort
+     * @param payload payload to reorder along with keys (may be null)
+     * @param count number of keys
+     * @param nbDigits number of 16 bits digits in keys
+     */
+    template<typename Key>
+    void radixSort(Key* keys, uint32_t* payload, size_t count, int nbDigits)
+    {
+        if (count < SMALL_ARRAY) {
+            // histograms setup would dominate, sort by comparison
+            std::vector<std::pair<Key, uint32_t>> pairs(count);
+            for (size_t i = 0; i < count; ++i) {
+                pairs[i].first  = keys[i];
+                pairs[i].second = (payload == nullptr) ? 0 : payload[i];
+            }
+            std::stable_sort(pairs.begin(), pairs.end(),
+                             [](const std::pair<Key, uint32_t>& a, const std::pair<Key, uint32_t>& b) {
+                                 return a.first < b.first;
+                             });
+            for (size_t i = 0; i < count; ++i) {
+                keys[i] = pairs[i].first;
+                if (payload != nullptr) {
+                    payload[i] = pairs[i].second;
+                }
+            }
+            return;
+        }
+
+        // all histograms are computed in a single read of the keys
+        std::vector<uint32_t> histograms(nbDigits * BUCKETS, 0);
+        for (size_t i = 0; i < count; ++i) {
+            for (int d = 0; d < nbDigits; ++d) {
+                ++histograms[d * BUCKETS + digit(keys[i], d)];
+            }
+        }
+
+        std::vector<Key> keysScratch(count);
+        std::vector<uint32_t> payloadScratch((payload == nullptr) ? 0 : count);
+        Key* srcKeys = keys;
+        Key* dstKeys = keysScratch.data();
+        uint32_t* srcPayload = payload;
+        uint32_t* dstPayload = payloadScratch.data();
+
+        for (int d = 0; d < nbDigits; ++d) {
+            uint32_t* histogram = histograms.data() + d * BUCKETS;
+
+            // skip digits shared by all keys
+            if (histogram[digit(srcKeys[0], d)] == count) {
+                continue;
+            }
+
+            // convert counts to starting positions
+            uint32_t position = 0;
+            for (size_t b = 0; b < BUCKETS; ++b) {
+                const uint32_t n = histogram[b];
+                histogram[b] = position;
+                position += n;
+            }
+
+            for (size_t i = 0; i < count; ++i) {
+                const uint32_t target = histogram[digit(srcKeys[i], d)]++;
+                dstKeys[target] = srcKeys[i];
+                if (payload != nullptr) {
+                    dstPayload[target] = srcPayload[i];
+                }
+            }
+            std::swap(srcKeys, dstKeys);
+            std::swap(srcPayload, dstPayload);
+        }
+
+        if (srcKeys != keys) {
+            std::copy(srcKeys, srcKeys + count, keys);
+            if (payload != nullptr) {
+                std::copy(srcPayload, srcPayload + count, payload);
+            }
+        }
+    }
+
+    /** Apply a permutation to an array of date/times.
+     * @param dateTimes date/times to reorder
+     * @param permutation index of the element to put at each position
+     * @param count number of elements
+     */
+    void permute(DateTimeComponents* dateTimes, const uint32_t* permutation, size_t count)
+    {
+        std::vector<DateTimeComponents> sorted;
+        sorted.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            sorted.push_back(dateTimes[permutation[i]]);
+        }
+        std::copy(sorted.begin(), sorted.end(), dateTimes);
+    }
+
+}
+
+void DateTimeSorter::sort(DateTimeComponents* dateTimes, size_t count)
+{
+    if (count > UINT32_MAX) {
+        // indices would not fit in the payload, sort by comparison
+        std::stable_sort(dateTimes, dateTimes + count,
+                         [](const DateTimeComponents& a, const DateTimeComponents& b) {
+                             return DateTimeKeys::toKey96(a) < DateTimeKeys::toKey96(b);
+                         });
+        return;
+    }
+
+    std::vector<uint32_t> permutation(count);
+    std::iota(permutation.begin(), permutation.end(), 0u);
+
+    std::vector<uint64_t> keys64(count);
+    if (DateTimeKeys::toKeys64(dateTimes, count, keys64.data())) {
+        sortKeys(keys64.data(), permutation.data(), count);
+
+        // 64 bits keys have microsecond resolution, runs of equal keys may
+        // still hold instants in the wrong order at nanosecond resolution
+        size_t start = 0;
+        for (size_t i = 1; i <= count; ++i) {
+            if (i == count || keys64[i] != keys64[start]) {
+                if (i - start > 1) {
+                    std::stable_sort(permutation.begin() + start, permutation.begin() + i,
+                                     [dateTimes](uint32_t a, uint32_t b) {
+                                         return DateTimeKeys::toKey96(dateTimes[a]) <
+                                                DateTimeKeys::toKey96(dateTimes[b]);
+                                     });
+                }
+                start = i;
+            }
+        }
+    }
+    else {
+        std::vector<uint64_t>().swap(keys64);
+        std::vector<DateTimeKey96> keys96(count);
+        DateTimeKeys::toKeys96(dateTimes, count, keys96.data());
+        sortKeys(keys96.data(), permutation.data(), count);
+    }
+
+    permute(dateTimes, permutation.data(), count);
+}
+
+void DateTimeSorter::sortKeys(uint64_t* keys, uint32_t* payload, size_t count)
+{
+    radixSort(keys, payload, count, 4);
+}
+
+void DateTimeSorter::sortKeys(DateTimeKey96* keys, uint32_t* payload, size_t count)
+{
+    radixSort(keys, payload, count, 6);
+}
+
+void DateTimeSorter::merge(const DateTimeRun* runs, size_t nbRuns,
+                           DateTimeComponents* output, uint32_t* origin)
+{
+    if (nbRuns == 0) {
+        return;
+    }
+
+    // current head key of each run, exhausted runs compare after everything else
+    std::vector<DateTimeKey96> heads(nbRuns);
+    std::vector<size_t> positions(nbRuns, 0);
+    std::vector<bool> exhausted(nbRuns, false);
+    for (size_t r = 0; r < nbRuns; ++r) {
+        if (runs[r].size > 0) {
+            heads[r] = DateTimeKeys::toKey96(runs[r].data[0]);
+        }
+        else {
+            exhausted[r] = true;
+        }
+    }
+
+    // strict ordering of runs heads, ties broken by run index for stability
+    auto before = [&](size_t a, size_t b) {
+        if (exhausted[a] || exhausted[b]) {
+            return !exhausted[a] || (exhausted[b] && a < b);
+        }
+        if (heads[a] == heads[b]) {
+            return a < b;
+        }
+        return heads[a] < heads[b];
+    };
+
+    // loser tree: internal nodes 1 to nbRuns-1 hold losers, node 0 the overall winner,
+    // leaf for run r is virtual node nbRuns + r
+    std::vector<size_t> losers(nbRuns);
+    std::vector<size_t> winners(2 * nbRuns);
+    for (size_t r = 0; r < nbRuns; ++r) {
+        winners[nbRuns + r] = r;
+    }
+    for (size_t node = nbRuns - 1; node > 0; --node) {
+        const size_t a = winners[2 * node];
+        const size_t b = winners[2 * node + 1];
+        if (before(a, b)) {
+            winners[node] = a;
+            losers[node]  = b;
+        }
+        else {
+            winners[node] = b;
+            losers[node]  = a;
+        }
+    }
+    losers[0] = (nbRuns > 1) ? winners[1] : 0;
+
+    size_t out = 0;
+    while (!exhausted[losers[0]]) {
+        size_t winner = losers[0];
+        const DateTimeRun& run = runs[winner];
+        output[out] = run.data[positions[winner]];
+        if (origin != nullptr) {
+            origin[out] = static_cast<uint32_t>(winner);
+        }
+        ++out;
+
+        // advance the winning run
+        if (++positions[winner] < run.size) {
+            heads[winner] = DateTimeKeys::toKey96(run.data[positions[winner]]);
+        }
+        else {
+            exhausted[winner] = true;
+        }
+
+        // replay the matches along the path from the leaf to the root
+        for (size_t node = (nbRuns + winner) / 2; node > 0; node /= 2) {
+            if (before(losers[node], winner)) {
+                std::swap(losers[node], winner);
+            }
+        }
+        losers[0] = winner;
+    }
+}
+
+std::vector<DateTimeComponents> DateTimeSorter::merge(const std::vector<DateTimeRun>& runs)
+{
+    size_t total = 0;
+    for (const DateTimeRun& run : runs) {
+        total += run.size;
+    }
+    if (total == 0) {
+        return std::vector<DateTimeComponents>();
+    }
+
+    // the output needs constructed elements to assign to
+    std::vector<DateTimeComponents> merged(total, DateTimeComponents::JULIAN_EPOCH);
+    merge(runs.data(), runs.size(), merged.data());
+    return merged;
+}
+
+bool DateTimeSorter::isSorted(const DateTimeComponents* dateTimes, size_t count)
+{
+    if (count < 2) {
+        return true;
+    }
+    DateTimeKey96 previous = DateTimeKeys::toKey96(dateTimes[0]);
+    for (size_t i = 1; i < count; ++i) {
+        const DateTimeKey96 current = DateTimeKeys::toKey96(dateTimes[i]);
+        if (current < previous) {
+            return false;
+        }
+        previous = current;
+    }
+    return true;
+}
@@ -0,0 +1,200 @@
+#include "time/IntervalSet.h"
+#include <algorithm>
+
+IntervalSet::IntervalSet(std::vector<TimeInterval> intervals)
+{
+    assign(intervals.data(), intervals.size());
+}
+
+void IntervalSet::assign(TimeInterval* intervals, size_t count)
+{
+    std::sort(intervals, intervals + count,
+              [](const TimeInterval& a, const TimeInterval& b) {
+                  return a.start < b.start;
+              });
+
+    boundaries.clear();
+    for (size_t i = 0; i < count; ++i) {
+        const TimeInterval& interval = intervals[i];
+        if (!(interval.start < interval.end)) {
+            // empty or reversed interval
+            continue;
+        }
+        if (!boundaries.empty() && !(boundaries.back() < interval.start)) {
+            // overlapping or touching the last interval, extend it
+            if (boundaries.back() < interval.end) {
+                boundaries.back() = interval.end;
+            }
+        }
+        else {
+            boundaries.push_back(interval.start);
+            boundaries.push_back(interval.end);
+        }
+    }
+}
+
+void IntervalSet::add(const TimeInterval& interval)
+{
+    if (!(interval.start < interval.end)) {
+        return;
+    }
+
+    // boundaries in [i, j) are swallowed by the new interval, an odd index
+    // means the corresponding bound falls inside (or touches) an existing interval
+    const size_t i = std::lower_bound(boundaries.begin(), boundaries.end(), interval.start) - boundaries.begin();
+    const size_t j = std::upper_bound(boundaries.begin(), boundaries.end(), interval.end)   - boundaries.begin();
+    LinearTime inserted[2];
+    size_t nbInserted = 0;
+    if (i % 2 == 0) {
+        inserted[nbInserted++] = interval.start;
+    }
+    if (j % 2 == 0) {
+        inserted[nbInserted++] = interval.end;
+    }
+
+    boundaries.erase(boundaries.begin() + i, boundaries.begin() + j);
+    boundaries.insert(boundaries.begin() + i, inserted, inserted + nbInserted);
+}
+
+void IntervalSet::clear()
+{
+    boundaries.clear();
+}
+
+void IntervalSet::reserve(size_t nbIntervals)
+{
+    boundaries.reserve(2 * nbIntervals);
+}
+
+bool IntervalSet::isEmpty() const
+{
+    return boundaries.empty();
+}
+
+size_t IntervalSet::size() const
+{
+    return boundaries.size() / 2;
+}
+
+TimeInterval IntervalSet::get(size_t i) const
+{
+    return TimeInterval(boundaries[2 * i], boundaries[2 * i + 1]);
+}
+
+const LinearTime* IntervalSet::getBoundaries() const
+{
+    return boundaries.data();
+}
+
+double IntervalSet::getTotalDuration() const
+{
+    double total = 0;
+    for (size_t i = 0; i < boundaries.size(); i += 2) {
+        total += boundaries[i + 1].durationFrom(boundaries[i]);
+    }
+    return total;
+}
+
+bool IntervalSet::contains(const LinearTime& t) const
+{
+    return find(t) >= 0;
+}
+
+long IntervalSet::find(const LinearTime& t) const
+{
+    const size_t k = std::upper_bound(boundaries.begin(), boundaries.end(), t) - boundaries.begin();
+    return (k % 2 == 1) ? static_cast<long>(k / 2) : -1;
+}
+
+IntervalSet IntervalSet::unionWith(const IntervalSet& other) const
+{
+    IntervalSet result;
+    unionOf(*this, other, result);
+    return result;
+}
+
+IntervalSet IntervalSet::intersectionWith(const IntervalSet& other) const
+{
+    IntervalSet result;
+    intersectionOf(*this, other, result);
+    return result;
+}
+
+IntervalSet IntervalSet::differenceWith(const IntervalSet& other) const
+{
+    IntervalSet result;
+    differenceOf(*this, other, result);
+    return result;
+}
+
+void IntervalSet::unionOf(const IntervalSet& a, const IntervalSet& b, IntervalSet& result)
+{
+    combine(a, b, UNION, result);
+}
+
+void IntervalSet::intersectionOf(const IntervalSet& a, const IntervalSet& b, IntervalSet& result)
+{
+    combine(a, b, INTERSECTION, result);
+}
+
+void IntervalSet::differenceOf(const IntervalSet& a, const IntervalSet& b, IntervalSet& result)
+{
+    combine(a, b, DIFFERENCE, result);
+}
+
+bool IntervalSet::operator==(const IntervalSet& other) const
+{
+    return boundaries == other.boundaries;
+}
+
+void IntervalSet::combine(const IntervalSet& a, const IntervalSet& b,
+                          Operation operation, IntervalSet& result)
+{
+    const std::vector<LinearTime>& ba = a.boundaries;
+    const std::vector<LinearTime>& bb = b.boundaries;
+    std::vector<LinearTime>& out = result.boundaries;
+    out.clear();
+
+    // sweep both boundary arrays in chronological order, toggling membership
+    // flags and emitting a boundary each time the combined membership changes
+    size_t i = 0;
+    size_t j = 0;
+    bool inA = false;
+    bool inB = false;
+    bool inResult = false;
+    while (i < ba.size() || j < bb.size()) {
+        LinearTime t;
+        if (j == bb.size() || (i < ba.size() && ba[i] < bb[j])) {
+            t = ba[i];
+        }
+        else {
+            t = bb[j];
+        }
+        if (i < ba.size() && ba[i] == t) {
+            inA = !inA;
+            ++i;
+        }
+        if (j < bb.size() && bb[j] == t) {
+            inB = !inB;
+            ++j;
+        }
+
+        bool in;
+        switch (operation) {
+            case UNION:
+                in = inA || inB;
+                break;
+            case INTERSECTION:
+                in = inA && inB;
+                break;
+            default:
+                in = inA && !inB;
+                break;
+        }
+
+        if (in != inResult) {
+            out.push_back(t);
+            inResult = in;
+        }
+    }
+}
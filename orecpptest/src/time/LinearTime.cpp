@@ -0,0 +1,103 @@
+#include "time/LinearTime.h"
+#include <cmath>
+
+namespace {
+
+    /** Floor division.
+     * @param a dividend
+     * @param b divisor (strictly positive)
+     * @return largest integer not greater than a / b
+     */
+    inline int64_t floorDiv(int64_t a, int64_t b)
+    {
+        const int64_t q = a / b;
+        return (a % b < 0) ? q - 1 : q;
+    }
+
+    /** Saturating conversion of a minute count and a second number to nanoseconds.
+     * @param minutes minutes since J2000 epoch
+     * @param second second in minute
+     * @return nanoseconds since J2000 epoch
+     */
+    int64_t toNanos(int64_t minutes, double second)
+    {
+        const int64_t limit = INT64_MAX / LinearTime::NANOS_PER_MINUTE - 1;
+        if (minutes > limit) {
+            return INT64_MAX;
+        }
+        else if (minutes < -limit) {
+            return INT64_MIN;
+        }
+        return minutes * LinearTime::NANOS_PER_MINUTE + std::llround(second * 1.0e9);
+    }
+
+}
+
+const LinearTime LinearTime::J2000_EPOCH(INT64_C(0));
+const LinearTime LinearTime::PAST_INFINITY(INT64_MIN);
+const LinearTime LinearTime::FUTURE_INFINITY(INT64_MAX);
+
+LinearTime::LinearTime(const DateTimeComponents& dateTime)
+    : LinearTime(dateTime.getDate(), dateTime.getTime())
+{
+
+}
+
+LinearTime::LinearTime(const DateComponents& date, const TimeComponents& time)
+    : nanos(toNanos(INT64_C(1440) * date.getJ2000Day() +
+                    60 * time.getHour() + time.getMinute() - time.getMinutesFromUTC(),
+                    time.getSecond()))
+{
+
+}
+
+LinearTime::LinearTime(const LinearTime& reference, double offset)
+    : nanos(reference.shiftedBy(offset).nanos)
+{
+
+}
+
+LinearTime LinearTime::shiftedBy(double dt) const
+{
+    // the range check is done in floating point with a safety margin
+    const double shift  = std::round(dt * 1.0e9);
+    const double target = static_cast<double>(nanos) + shift;
+    if (std::fabs(shift) >= 9.2e18) {
+        return (shift > 0) ? FUTURE_INFINITY : PAST_INFINITY;
+    }
+    else if (target >= 9.2e18) {
+        return FUTURE_INFINITY;
+    }
+    else if (target <= -9.2e18) {
+        return PAST_INFINITY;
+    }
+    return LinearTime(nanos + static_cast<int64_t>(shift));
+}
+
+double LinearTime::durationFrom(const LinearTime& other) const
+{
+    // split in whole seconds and nanoseconds to avoid overflows and rounding
+    const int64_t seconds       = nanos / NANOS_PER_SECOND;
+    const int64_t otherSeconds  = other.nanos / NANOS_PER_SECOND;
+    const int64_t fraction      = nanos % NANOS_PER_SECOND;
+    const int64_t otherFraction = other.nanos % NANOS_PER_SECOND;
+    return static_cast<double>(seconds - otherSeconds) +
+           1.0e-9 * static_cast<double>(fraction - otherFraction);
+}
+
+DateTimeComponents LinearTime::getComponents(int minutesFromUTC) const
+{
+    const int64_t minutes     = floorDiv(nanos, NANOS_PER_MINUTE);
+    const int64_t nanosInMin  = nanos - minutes * NANOS_PER_MINUTE;
+    const int64_t localMinute = minutes + minutesFromUTC;
+    const int64_t day         = floorDiv(localMinute, 1440);
+    const int minuteInDay     = static_cast<int>(localMinute - 1440 * day);
+    return DateTimeComponents(DateComponents(static_cast<int>(day)),
+                              TimeComponents(minuteInDay / 60, minuteInDay % 60,
+                                             1.0e-9 * nanosInMin, minutesFromUTC));
+}
+
+int LinearTime::getJ2000Day(int minutesFromUTC) const
+{
+    return static_cast<int>(floorDiv(floorDiv(nanos, NANOS_PER_MINUTE) + minutesFromUTC, 1440));
+}
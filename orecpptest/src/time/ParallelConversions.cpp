@@ -0,0 +1,139 @@
+#include "time/ParallelConversions.h"
+#include <atomic>
+
+void ParallelConversions::toDateComponents(ThreadPool& pool, const int* offsets, size_t count,
+                                           DateComponents* dates)
+{
+    pool.parallelFor(count, ThreadPool::getChunkSize(sizeof(int) + sizeof(DateComponents)),
+                     [offsets, dates](size_t begin, size_t end) {
+                         for (size_t i = begin; i < end; ++i) {
+                             dates[i] = DateComponents(offsets[i]);
+                         }
+                     });
+}
+
+void ParallelConversions::toJ2000Days(ThreadPool& pool, const DateComponents* dates, size_t count, int* offsets)
+{
+    pool.parallelFor(count, ThreadPool::getChunkSize(sizeof(DateComponents) + sizeof(int)),
+                     [dates, offsets](size_t begin, size_t end) {
+                         for (size_t i = begin; i < end; ++i) {
+                             offsets[i] = dates[i].getJ2000Day();
+                         }
+                     });
+}
+
+void ParallelConversions::offsetFrom(ThreadPool& pool, const DateTimeComponents* dateTimes, size_t count,
+                                     const DateTimeComponents& reference, double* offsets)
+{
+    pool.parallelFor(count, ThreadPool::getChunkSize(sizeof(DateTimeComponents) + sizeof(double)),
+                     [dateTimes, &reference, offsets](size_t begin, size_t end) {
+                         for (size_t i = begin; i < end; ++i) {
+                             offsets[i] = dateTimes[i].offsetFrom(reference);
+                         }
+                     });
+}
+
+void ParallelConversions::toLinearTimes(ThreadPool& pool, const DateTimeComponents* dateTimes, size_t count,
+                                        LinearTime* times)
+{
+    pool.parallelFor(count, ThreadPool::getChunkSize(sizeof(DateTimeComponents) + sizeof(LinearTime)),
+                     [dateTimes, times](size_t begin, size_t end) {
+                         for (size_t i = begin; i < end; ++i) {
+                             times[i] = LinearTime(dateTimes[i]);
+                         }
+                     });
+}
+
+void ParallelConversions::toDateTimeComponents(ThreadPool& pool, const LinearTime* times, size_t count,
+                                               DateTimeComponents* dateTimes)
+{
+    pool.parallelFor(count, ThreadPool::getChunkSize(sizeof(LinearTime) + sizeof(DateTimeComponents)),
+                     [times, dateTimes](size_t begin, size_t end) {
+                         for (size_t i = begin; i < end; ++i) {
+                             dateTimes[i] = times[i].getComponents();
+                         }
+                     });
+}
+
+void ParallelConversions::toDateTimeComponents(ThreadPool& pool, const ChronoConversions::SysNanos* times,
+                                               size_t count, DateTimeComponents* dateTimes)
+{
+    pool.parallelFor(count,
+                     ThreadPool::getChunkSize(sizeof(ChronoConversions::SysNanos) + sizeof(DateTimeComponents)),
+                     [times, dateTimes](size_t begin, size_t end) {
+                         ChronoConversions::toDateTimeComponents(times + begin, end - begin, dateTimes + begin);
+                     });
+}
+
+void ParallelConversions::toSysTimes(ThreadPool& pool, const DateTimeComponents* dateTimes, size_t count,
+                                     ChronoConversions::SysNanos* times)
+{
+    pool.parallelFor(count,
+                     ThreadPool::getChunkSize(sizeof(DateTimeComponents) + sizeof(ChronoConversions::SysNanos)),
+                     [dateTimes, times](size_t begin, size_t end) {
+                         ChronoConversions::toSysTimes(dateTimes + begin, end - begin, times + begin);
+                     });
+}
+
+void ParallelConversions::getComponents(ThreadPool& pool, const UTCScale& utc, const LinearTime* tai,
+                                        size_t count, DateTimeComponents* dateTimes)
+{
+    pool.parallelFor(count, ThreadPool::getChunkSize(sizeof(LinearTime) + sizeof(DateTimeComponents)),
+                     [&utc, tai, dateTimes](size_t begin, size_t end) {
+                         utc.getComponents(tai + begin, end - begin, dateTimes + begin);
+                     });
+}
+
+bool ParallelConversions::toKeys64(ThreadPool& pool, const DateTimeComponents* dateTimes, size_t count,
+                                   uint64_t* keys)
+{
+    std::atomic<bool> inRange(true);
+    pool.parallelFor(count, ThreadPool::getChunkSize(sizeof(DateTimeComponents) + sizeof(uint64_t)),
+                     [dateTimes, keys, &inRange](size_t begin, size_t end) {
+                         if (!DateTimeKeys::toKeys64(dateTimes + begin, end - begin, keys + begin)) {
+                             inRange.store(false, std::memory_order_relaxed);
+                         }
+                     });
+    return inRange.load(std::memory_order_relaxed);
+}
+
+void ParallelConversions::toKeys96(ThreadPool& pool, const DateTimeComponents* dateTimes, size_t count,
+                                   DateTimeKey96* keys)
+{
+    pool.parallelFor(count, ThreadPool::getChunkSize(sizeof(DateTimeComponents) + sizeof(DateTimeKey96)),
+                     [dateTimes, keys](size_t begin, size_t end) {
+                         DateTimeKeys::toKeys96(dateTimes + begin, end - begin, keys + begin);
+                     });
+}
+
+void ParallelConversions::getDateTimes(ThreadPool& pool, const BinaryTimeView& view, DateTimeComponents* dateTimes)
+{
+    const int16_t* minutes    = view.getMinutesInDay();
+    const int16_t* utcOffsets = view.getMinutesFromUTC();
+    const int64_t* nanos      = view.getNanosInMinute();
+    const size_t   timeBytes  = (minutes == nullptr) ? 0 : 2 * sizeof(int16_t) + sizeof(int64_t);
+    pool.parallelFor(view.size(), ThreadPool::getChunkSize(sizeof(int32_t) + timeBytes + sizeof(DateTimeComponents)),
+                     [&view, minutes, utcOffsets, nanos, dateTimes](size_t begin, size_t end) {
+                         // consecutive elements in the same day reuse the calendar decomposition
+                         DateComponents date{};
+                         int lastDay = 0;
+                         bool cached = false;
+                         for (size_t i = begin; i < end; ++i) {
+                             const int day = view.getJ2000Day(i);
+                             if (!cached || day != lastDay) {
+                                 date    = DateComponents(day);
+                                 lastDay = day;
+                                 cached  = true;
+                             }
+                             if (minutes == nullptr) {
+                                 dateTimes[i] = DateTimeComponents(date, TimeComponents::H00);
+                             }
+                             else {
+                                 const int minuteInDay = minutes[i];
+                                 dateTimes[i] = DateTimeComponents(date,
+                                                                   TimeComponents(minuteInDay / 60, minuteInDay % 60,
+                                                                                  1.0e-9 * nanos[i], utcOffsets[i]));
+                             }
+                         }
+                     });
+}
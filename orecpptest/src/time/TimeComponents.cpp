@@ -1,5 +1,6 @@
 #include "time/TimeComponents.h"
 #include "utils/Constants.h"
+#include "utils/Instrumentation.h"
 #include <cmath>
 
 const TimeComponents TimeComponents::H00(0, 0, 0);
@@ -34,6 +35,8 @@ TimeComponents::TimeComponents(int secondInDayA, double secondInDayB)
 
 TimeComponents::TimeComponents(int secondInDayA, double secondInDayB, double leap, int minuteDuration)
 {
+    ORECPP_TIMED_SCOPE(TIME_FROM_SECONDS);
+
     // split the numbers as a whole number of seconds
     // and a fractional part between 0.0 (included) and 1.0 (excluded)
     int carry = static_cast<int>(std::floor(secondInDayB));
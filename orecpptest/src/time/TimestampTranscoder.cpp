@@ -0,0 +1,692 @@
+#include "time/TimestampTranscoder.h"
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include "time/DateComponents.h"
+#include "time/TimeComponents.h"
+#include "utils/MappedFile.h"
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+
+    /** Powers of ten, for fractions. */
+    const double POWERS_OF_TEN[] = {
+        1.0e0,  1.0e1,  1.0e2,  1.0e3,  1.0e4,  1.0e5,  1.0e6,  1.0e7,  1.0e8,  1.0e9,
+        1.0e10, 1.0e11, 1.0e12, 1.0e13, 1.0e14, 1.0e15, 1.0e16, 1.0e17, 1.0e18
+    };
+
+    /** Maximum number of significant fraction digits. */
+    const int MAX_FRACTION_DIGITS = 18;
+
+    /** First year whose days all have an <code>int32</code> J2000 day number.
+     * <p>This is the year after the one of {@link DateComponents#MIN_EPOCH}.</p>
+     */
+    const int MIN_YEAR = -5877489;
+
+    /** Last year whose days all have an <code>int32</code> J2000 day number.
+     * <p>This is the year before the one of {@link DateComponents#MAX_EPOCH}.</p>
+     */
+    const int MAX_YEAR = 5881609;
+
+    /** Check if a character is a decimal digit.
+     * @param c character to check
+     * @return true if the character is a decimal digit
+     */
+    inline bool isDigit(char c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    /** Parse an unsigned decimal number.
+     * @param p current position, moved after the number
+     * @param end end of the text
+     * @param minDigits minimum number of digits
+     * @param maxDigits maximum number of digits (at most 9)
+     * @param value placeholder for the number
+     * @return true if at least minDigits digits were found
+     */
+    inline bool parseNumber(const char*& p, const char* end, int minDigits, int maxDigits, int& value)
+    {
+        int nbDigits = 0;
+        value = 0;
+        while (p < end && nbDigits < maxDigits && isDigit(*p)) {
+            value = 10 * value + (*p++ - '0');
+            ++nbDigits;
+        }
+        return nbDigits >= minDigits;
+    }
+
+    /** Parse a fraction after the decimal point.
+     * @param p current position (after the decimal point), moved after the digits
+     * @param end end of the text
+     * @param fraction placeholder for the fraction, in [0, 1)
+     * @return true if at least one digit was found
+     */
+    inline bool parseFraction(const char*& p, const char* end, double& fraction)
+    {
+        uint64_t mantissa = 0;
+        int nbDigits = 0;
+        const char* start = p;
+        for (; p < end && isDigit(*p); ++p) {
+            if (nbDigits < MAX_FRACTION_DIGITS) {
+                mantissa = 10 * mantissa + static_cast<uint64_t>(*p - '0');
+                ++nbDigits;
+            }
+        }
+        fraction = static_cast<double>(mantissa) / POWERS_OF_TEN[nbDigits];
+        return p > start;
+    }
+
+    /** Parse a year with an optional sign and at least 4 digits.
+     * @param p current position, moved after the year
+     * @param end end of the text
+     * @param year placeholder for the year
+     * @return true if a year between {@link #MIN_YEAR} and {@link #MAX_YEAR} was found
+     */
+    inline bool parseYear(const char*& p, const char* end, int& year)
+    {
+        const bool negative = (p < end) && (*p == '-');
+        if (p < end && (*p == '-' || *p == '+')) {
+            ++p;
+        }
+        if (!parseNumber(p, end, 4, 9, year)) {
+            return false;
+        }
+        year = negative ? -year : year;
+        return year >= MIN_YEAR && year <= MAX_YEAR;
+    }
+
+    /** Parse a time of day "hh:mm[:ss[.fff]]".
+     * @param p current position, moved after the time
+     * @param end end of the text
+     * @param hour placeholder for the hour
+     * @param minute placeholder for the minute
+     * @param second placeholder for the second
+     * @return true if a valid time was found
+     */
+    bool parseTime(const char*& p, const char* end, int& hour, int& minute, double& second)
+    {
+        if (!parseNumber(p, end, 2, 2, hour) || p >= end || *p++ != ':' ||
+            !parseNumber(p, end, 2, 2, minute) || hour > 23 || minute > 59) {
+            return false;
+        }
+        second = 0.0;
+        if (p < end && *p == ':') {
+            ++p;
+            int wholeSecond;
+            if (!parseNumber(p, end, 2, 2, wholeSecond) || wholeSecond > 60) {
+                return false;
+            }
+            double fraction = 0.0;
+            if (p < end && (*p == '.' || *p == ',')) {
+                ++p;
+                if (!parseFraction(p, end, fraction)) {
+                    return false;
+                }
+            }
+            second = wholeSecond + fraction;
+        }
+        return true;
+    }
+
+    /** Build a checked date from its components.
+     * @param year year number
+     * @param month month number
+     * @param day day number
+     * @param date placeholder for the date
+     * @return true if the date exists
+     */
+    inline bool makeDate(int year, int month, int day, DateComponents& date)
+    {
+        if (month < 1 || month > 12 || day < 1 || day > 31) {
+            return false;
+        }
+        date = DateComponents(year, month, day);
+        // days up to 28 exist in all months, the other ones need a round trip
+        return day <= 28 || DateComponents(date.getJ2000Day()) == date;
+    }
+
+    /** Build a checked date from a year and a day number.
+     * @param year year number
+     * @param dayNumber day number in year
+     * @param date placeholder for the date
+     * @return true if the date exists
+     */
+    inline bool makeOrdinalDate(int year, int dayNumber, DateComponents& date)
+    {
+        if (dayNumber < 1 || dayNumber > 366) {
+            return false;
+        }
+        date = DateComponents(year, dayNumber);
+        return dayNumber <= 355 || date.getYear() == year;
+    }
+
+    /** Parse an ISO-8601 timestamp.
+     * @param p first character
+     * @param end character after the last one
+     * @param dateTime placeholder for the date/time
+     * @return true if the timestamp was parsed
+     */
+    bool parseIso(const char* p, const char* end, DateTimeComponents& dateTime)
+    {
+        int year;
+        if (!parseYear(p, end, year) || p >= end || *p++ != '-') {
+            return false;
+        }
+
+        // calendar date YYYY-MM-DD or ordinal date YYYY-DDD
+        DateComponents date{};
+        const char* start = p;
+        int first;
+        if (!parseNumber(p, end, 2, 3, first)) {
+            return false;
+        }
+        if (p - start == 3) {
+            if (!makeOrdinalDate(year, first, date)) {
+                return false;
+            }
+        }
+        else {
+            int day;
+            if (p >= end || *p++ != '-' || !parseNumber(p, end, 2, 2, day) || !makeDate(year, first, day, date)) {
+                return false;
+            }
+        }
+        if (p == end) {
+            dateTime = DateTimeComponents(date, TimeComponents::H00);
+            return true;
+        }
+
+        int hour;
+        int minute;
+        double second;
+        if ((*p != 'T' && *p != 't' && *p != ' ') || !parseTime(++p, end, hour, minute, second)) {
+            return false;
+        }
+
+        // offset from UTC
+        int minutesFromUTC = 0;
+        if (p < end && (*p == 'Z' || *p == 'z')) {
+            ++p;
+        }
+        else if (p < end && (*p == '+' || *p == '-')) {
+            const int sign = (*p++ == '-') ? -1 : 1;
+            int hours;
+            int minutes = 0;
+            if (!parseNumber(p, end, 2, 2, hours)) {
+                return false;
+            }
+            // minutes are optional, but mandatory after a separator
+            const bool separator = (p < end) && (*p == ':');
+            if (separator) {
+                ++p;
+            }
+            if ((separator || p < end) && !parseNumber(p, end, 2, 2, minutes)) {
+                return false;
+            }
+            if (hours > 23 || minutes > 59) {
+                return false;
+            }
+            minutesFromUTC = sign * (60 * hours + minutes);
+        }
+        if (p != end) {
+            return false;
+        }
+
+        dateTime = DateTimeComponents(date, TimeComponents(hour, minute, second, minutesFromUTC));
+        return true;
+    }
+
+    /** Parse a "YYYY DDD hh:mm:ss" timestamp.
+     * @param p first character
+     * @param end character after the last one
+     * @param dateTime placeholder for the date/time
+     * @return true if the timestamp was parsed
+     */
+    bool parseYearDay(const char* p, const char* end, DateTimeComponents& dateTime)
+    {
+        int year;
+        int dayNumber;
+        DateComponents date{};
+        if (!parseYear(p, end, year) || p >= end || *p != ' ') {
+            return false;
+        }
+        while (p < end && *p == ' ') {
+            ++p;
+        }
+        if (!parseNumber(p, end, 1, 3, dayNumber) || !makeOrdinalDate(year, dayNumber, date) || p >= end || *p != ' ') {
+            return false;
+        }
+        while (p < end && *p == ' ') {
+            ++p;
+        }
+        int hour;
+        int minute;
+        double second;
+        if (!parseTime(p, end, hour, minute, second) || p != end) {
+            return false;
+        }
+        dateTime = DateTimeComponents(date, TimeComponents(hour, minute, second));
+        return true;
+    }
+
+    /** Parse a modified julian day.
+     * @param p first character
+     * @param end character after the last one
+     * @param dateTime placeholder for the date/time
+     * @return true if the timestamp was parsed
+     */
+    bool parseMjd(const char* p, const char* end, DateTimeComponents& dateTime)
+    {
+        const bool negative = (p < end) && (*p == '-');
+        if (p < end && (*p == '-' || *p == '+')) {
+            ++p;
+        }
+        int day;
+        double fraction = 0.0;
+        if (!parseNumber(p, end, 1, 9, day)) {
+            return false;
+        }
+        if (p < end && *p == '.') {
+            ++p;
+            if (p < end && !parseFraction(p, end, fraction)) {
+                return false;
+            }
+        }
+        if (p != end) {
+            return false;
+        }
+        if (negative) {
+            // floor to the previous day
+            day = -day;
+            if (fraction > 0.0) {
+                day     -= 1;
+                fraction = 1.0 - fraction;
+            }
+        }
+        const double secondInDay = std::min(fraction * 86400.0, std::nextafter(86400.0, 0.0));
+        dateTime = DateTimeComponents(DateComponents(DateComponents::MODIFIED_JULIAN_EPOCH, day),
+                                      TimeComponents(secondInDay));
+        return true;
+    }
+
+    /** Write a zero padded decimal number.
+     * @param p destination, moved after the digits
+     * @param value non-negative number
+     * @param nbDigits minimum number of digits
+     */
+    inline void writeNumber(char*& p, int64_t value, int nbDigits)
+    {
+        char digits[20];
+        int n = 0;
+        do {
+            digits[n++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value > 0);
+        while (n < nbDigits) {
+            digits[n++] = '0';
+        }
+        while (n > 0) {
+            *p++ = digits[--n];
+        }
+    }
+
+    /** Write all bytes to a file descriptor.
+     * @param fd file descriptor
+     * @param bytes bytes to write
+     * @param length number of bytes
+     * @return true if all bytes were written
+     */
+    bool writeAll(int fd, const char* bytes, size_t length)
+    {
+        while (length > 0) {
+#ifdef _WIN32
+            const unsigned int chunk = (length > (1u << 30)) ? (1u << 30) : static_cast<unsigned int>(length);
+            const int n = _write(fd, bytes, chunk);
+#else
+            const ssize_t n = ::write(fd, bytes, length);
+#endif
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return false;
+            }
+            bytes  += n;
+            length -= static_cast<size_t>(n);
+        }
+        return true;
+    }
+
+    /** Read bytes from a file descriptor.
+     * @param fd file descriptor
+     * @param bytes destination
+     * @param length maximum number of bytes
+     * @param count placeholder for the number of bytes read (0 at end of file)
+     * @return true if the read succeeded
+     */
+    bool readSome(int fd, char* bytes, size_t length, size_t& count)
+    {
+        for (;;) {
+#ifdef _WIN32
+            const unsigned int chunk = (length > (1u << 30)) ? (1u << 30) : static_cast<unsigned int>(length);
+            const int n = _read(fd, bytes, chunk);
+#else
+            const ssize_t n = ::read(fd, bytes, length);
+#endif
+            if (n >= 0) {
+                count = static_cast<size_t>(n);
+                return true;
+            }
+            if (errno != EINTR) {
+                return false;
+            }
+        }
+    }
+
+}
+
+TimestampTranscoder::TimestampTranscoder(ThreadPool& pool)
+    : pool(pool), column(0), delimiter(','), inputFormat(AUTO), output(TEXT),
+      scale(BinaryTimeFormat::UNSPECIFIED), batchSize(DEFAULT_BATCH_SIZE), statistics()
+{
+
+}
+
+void TimestampTranscoder::setColumn(size_t column, char delimiter)
+{
+    this->column    = column;
+    this->delimiter = delimiter;
+}
+
+void TimestampTranscoder::setFormat(Format format)
+{
+    inputFormat = format;
+}
+
+void TimestampTranscoder::setOutput(Output output, BinaryTimeFormat::Scale scale)
+{
+    this->output = output;
+    this->scale  = scale;
+}
+
+void TimestampTranscoder::setBatchSize(size_t bytes)
+{
+    batchSize = std::max<size_t>(bytes, 1);
+}
+
+const TimestampTranscoder::Statistics& TimestampTranscoder::getStatistics() const
+{
+    return statistics;
+}
+
+bool TimestampTranscoder::transcodeFile(const char* path, int fd)
+{
+    statistics = Statistics();
+    MappedFile file(path);
+    if (!file.isOpen()) {
+        return false;
+    }
+    file.adviseSequential();
+
+    const char* data = file.getData();
+    const size_t size = file.getSize();
+    statistics.bytesRead = size;
+
+    BinaryTimeWriter writer(fd, scale);
+    std::vector<Batch> batches(pool.getNbThreads());
+    size_t offset = 0;
+    while (offset < size) {
+        // cut a window of batches at line ends
+        size_t count = 0;
+        for (; count < batches.size() && offset < size; ++count) {
+            size_t stop = std::min(size, offset + batchSize);
+            if (stop < size) {
+                const void* eol = std::memchr(data + stop - 1, '\n', size - stop + 1);
+                stop = (eol == nullptr) ? size : static_cast<size_t>(static_cast<const char*>(eol) - data) + 1;
+            }
+            batches[count].begin = data + offset;
+            batches[count].end   = data + stop;
+            offset = stop;
+        }
+        if (!flush(batches, count, writer, fd)) {
+            return false;
+        }
+    }
+    if (output == BINARY) {
+        statistics.bytesWritten = writer.getBytesWritten();
+    }
+    return true;
+}
+
+bool TimestampTranscoder::transcode(int inputFd, int outputFd)
+{
+    statistics = Statistics();
+    BinaryTimeWriter writer(outputFd, scale);
+    std::vector<Batch> batches(pool.getNbThreads());
+    std::vector<char> leftover;
+    bool eof = false;
+    while (!eof) {
+        // read a window of batches, each one ending at a line end
+        size_t count = 0;
+        while (count < batches.size() && !eof) {
+            std::vector<char>& storage = batches[count].storage;
+            storage.assign(leftover.begin(), leftover.end());
+            leftover.clear();
+            size_t filled = storage.size();
+            size_t cut = 0;
+            while (!eof) {
+                storage.resize(std::max(filled + batchSize / 2, batchSize));
+                while (!eof && filled < storage.size()) {
+                    size_t n;
+                    if (!readSome(inputFd, storage.data() + filled, storage.size() - filled, n)) {
+                        return false;
+                    }
+                    eof     = (n == 0);
+                    filled += n;
+                    statistics.bytesRead += n;
+                }
+                // keep the partial last line for the next batch, growing the
+                // batch if a single line does not fit in it
+                const char* last = nullptr;
+                for (size_t i = filled; i > 0 && last == nullptr; --i) {
+                    if (storage[i - 1] == '\n') {
+                        last = storage.data() + i;
+                    }
+                }
+                if (eof) {
+                    cut = filled;
+                }
+                else if (last != nullptr) {
+                    cut = static_cast<size_t>(last - storage.data());
+                    break;
+                }
+            }
+            leftover.assign(storage.begin() + cut, storage.begin() + filled);
+            storage.resize(cut);
+            if (cut > 0) {
+                batches[count].begin = storage.data();
+                batches[count].end   = storage.data() + cut;
+                ++count;
+            }
+        }
+        if (count > 0 && !flush(batches, count, writer, outputFd)) {
+            return false;
+        }
+    }
+    if (output == BINARY) {
+        statistics.bytesWritten = writer.getBytesWritten();
+    }
+    return true;
+}
+
+bool TimestampTranscoder::flush(std::vector<Batch>& batches, size_t count, BinaryTimeWriter& writer, int fd)
+{
+    pool.parallelFor(count, 1, [this, &batches](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            process(batches[i]);
+        }
+    });
+
+    // write in input order
+    for (size_t i = 0; i < count; ++i) {
+        const Batch& batch = batches[i];
+        statistics.lines     += batch.lines;
+        statistics.rejected  += batch.rejected;
+        statistics.converted += batch.lines - batch.rejected;
+        if (output == BINARY) {
+            if (!batch.dateTimes.empty() && !writer.writeDateTimes(batch.dateTimes.data(), batch.dateTimes.size())) {
+                return false;
+            }
+        }
+        else {
+            if (!writeAll(fd, batch.text.data(), batch.text.size())) {
+                return false;
+            }
+            statistics.bytesWritten += batch.text.size();
+        }
+    }
+    return true;
+}
+
+void TimestampTranscoder::process(Batch& batch) const
+{
+    batch.lines    = 0;
+    batch.rejected = 0;
+    batch.dateTimes.clear();
+    batch.text.clear();
+
+    char formatted[MAX_FORMATTED_SIZE];
+    const char* p = batch.begin;
+    while (p < batch.end) {
+        const char* eol = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(batch.end - p)));
+        const char* lineEnd = (eol == nullptr) ? batch.end : eol;
+        const char* next    = (eol == nullptr) ? batch.end : eol + 1;
+        ++batch.lines;
+
+        // locate the column
+        const char* fieldBegin = p;
+        bool found = true;
+        for (size_t i = 0; i < column && found; ++i) {
+            const char* d = static_cast<const char*>(std::memchr(fieldBegin, delimiter,
+                                                                 static_cast<size_t>(lineEnd - fieldBegin)));
+            found = (d != nullptr);
+            fieldBegin = found ? d + 1 : lineEnd;
+        }
+        const char* fieldEnd = static_cast<const char*>(std::memchr(fieldBegin, delimiter,
+                                                                    static_cast<size_t>(lineEnd - fieldBegin)));
+        if (fieldEnd == nullptr) {
+            fieldEnd = lineEnd;
+        }
+
+        // trim blanks, carriage return and quotes
+        while (fieldBegin < fieldEnd && (*fieldBegin == ' ' || *fieldBegin == '\t' || *fieldBegin == '"')) {
+            ++fieldBegin;
+        }
+        while (fieldEnd > fieldBegin &&
+               (fieldEnd[-1] == ' ' || fieldEnd[-1] == '\t' || fieldEnd[-1] == '"' || fieldEnd[-1] == '\r')) {
+            --fieldEnd;
+        }
+
+        DateTimeComponents dateTime = DateTimeComponents::JULIAN_EPOCH;
+        if (found && parse(fieldBegin, fieldEnd, inputFormat, dateTime)) {
+            if (output == BINARY) {
+                batch.dateTimes.push_back(dateTime);
+            }
+            else {
+                const size_t length = format(dateTime, formatted);
+                formatted[length] = '\n';
+                batch.text.append(formatted, length + 1);
+            }
+        }
+        else {
+            ++batch.rejected;
+            if (output == TEXT) {
+                batch.text.push_back('\n');
+            }
+        }
+
+        p = next;
+    }
+}
+
+TimestampTranscoder::Format TimestampTranscoder::detect(const char* begin, const char* end)
+{
+    const char* p = begin;
+    if (p < end && (*p == '-' || *p == '+')) {
+        ++p;
+    }
+    const char* digits = p;
+    while (p < end && isDigit(*p)) {
+        ++p;
+    }
+    const ptrdiff_t nbDigits = p - digits;
+    if (nbDigits >= 4 && p < end && *p == '-') {
+        return ISO_8601;
+    }
+    else if (nbDigits >= 4 && p < end && *p == ' ') {
+        return YEAR_DAY;
+    }
+    else if (nbDigits >= 1 && (p == end || *p == '.')) {
+        return MJD;
+    }
+    return AUTO;
+}
+
+bool TimestampTranscoder::parse(const char* begin, const char* end, Format format, DateTimeComponents& dateTime)
+{
+    switch ((format == AUTO) ? detect(begin, end) : format) {
+        case ISO_8601:
+            return parseIso(begin, end, dateTime);
+        case YEAR_DAY:
+            return parseYearDay(begin, end, dateTime);
+        case MJD:
+            return parseMjd(begin, end, dateTime);
+        default:
+            return false;
+    }
+}
+
+size_t TimestampTranscoder::format(const DateTimeComponents& dateTime, char* buffer)
+{
+    const DateComponents date = dateTime.getDate();
+    const TimeComponents time = dateTime.getTime();
+    char* p = buffer;
+
+    if (date.getYear() < 0) {
+        *p++ = '-';
+    }
+    writeNumber(p, std::abs(static_cast<int64_t>(date.getYear())), 4);
+    *p++ = '-';
+    writeNumber(p, date.getMonth(), 2);
+    *p++ = '-';
+    writeNumber(p, date.getDay(), 2);
+    *p++ = 'T';
+    writeNumber(p, time.getHour(), 2);
+    *p++ = ':';
+    writeNumber(p, time.getMinute(), 2);
+    *p++ = ':';
+    const int64_t nanos = BinaryTimeWriter::getNanosInMinute(time);
+    writeNumber(p, nanos / 1000000000, 2);
+    *p++ = '.';
+    writeNumber(p, nanos % 1000000000, 9);
+
+    const int minutesFromUTC = time.getMinutesFromUTC();
+    if (minutesFromUTC == 0) {
+        *p++ = 'Z';
+    }
+    else {
+        *p++ = (minutesFromUTC < 0) ? '-' : '+';
+        writeNumber(p, std::abs(minutesFromUTC) / 60, 2);
+        *p++ = ':';
+        writeNumber(p, std::abs(minutesFromUTC) % 60, 2);
+    }
+    return static_cast<size_t>(p - buffer);
+}
@@ -0,0 +1,188 @@
+#include "time/UTCScale.h"
+#include <stdint.h>
+#include <algorithm>
+#include "utils/Instrumentation.h"
+
+namespace {
+
+    /** Nanoseconds in one second. */
+    const int64_t NANOS_PER_SECOND = INT64_C(1000000000);
+
+    /** Nanoseconds in one day. */
+    const int64_t NANOS_PER_DAY = 86400 * NANOS_PER_SECOND;
+
+    /** Floor division.
+     * @param a dividend
+     * @param b divisor (strictly positive)
+     * @return largest integer not greater than a / b
+     */
+    inline int64_t floorDiv(int64_t a, int64_t b)
+    {
+        const int64_t q = a / b;
+        return (a % b < 0) ? q - 1 : q;
+    }
+
+    /** Built-in leap seconds table entry. */
+    struct LeapSecondEntry
+    {
+        /** Year of the first day with the new offset. */
+        int year;
+
+        /** Month of the first day with the new offset (the day is always the 1st). */
+        int month;
+
+        /** TAI - UTC from this date, in seconds. */
+        int taiMinusUTC;
+    };
+
+    /** Built-in leap seconds table (IERS Bulletin C). */
+    const LeapSecondEntry LEAP_SECONDS[] = {
+        { 1972,  1, 10 }, { 1972,  7, 11 }, { 1973,  1, 12 }, { 1974,  1, 13 },
+        { 1975,  1, 14 }, { 1976,  1, 15 }, { 1977,  1, 16 }, { 1978,  1, 17 },
+        { 1979,  1, 18 }, { 1980,  1, 19 }, { 1981,  7, 20 }, { 1982,  7, 21 },
+        { 1983,  7, 22 }, { 1985,  7, 23 }, { 1988,  1, 24 }, { 1990,  1, 25 },
+        { 1991,  1, 26 }, { 1992,  7, 27 }, { 1993,  7, 28 }, { 1994,  7, 29 },
+        { 1996,  1, 30 }, { 1997,  7, 31 }, { 1999,  1, 32 }, { 2006,  1, 33 },
+        { 2009,  1, 34 }, { 2012,  7, 35 }, { 2015,  7, 36 }, { 2017,  1, 37 }
+    };
+
+    /** Get the built-in leap seconds table.
+     * @return offsets between TAI and UTC
+     */
+    std::vector<UTCScale::Offset> getBuiltInOffsets()
+    {
+        std::vector<UTCScale::Offset> offsets;
+        for (const LeapSecondEntry& entry : LEAP_SECONDS) {
+            offsets.push_back({ DateComponents(entry.year, entry.month, 1), entry.taiMinusUTC });
+        }
+        return offsets;
+    }
+
+}
+
+UTCScale::UTCScale()
+    : UTCScale(getBuiltInOffsets())
+{
+
+}
+
+UTCScale::UTCScale(const std::vector<Offset>& offsets)
+    : initial(offsets.front().taiMinusUTC)
+{
+    for (size_t i = 1; i < offsets.size(); ++i) {
+        // the change occurs at UTC midnight, the last minute of the previous
+        // day lasts 60 + (offset - previous) seconds
+        Transition transition;
+        transition.previous = offsets[i - 1].taiMinusUTC;
+        transition.offset   = offsets[i].taiMinusUTC;
+        const int64_t utcDayStart = offsets[i].date.getJ2000Day() * NANOS_PER_DAY;
+        transition.minuteStart = utcDayStart + (transition.previous - 60) * NANOS_PER_SECOND;
+        transition.dayStart    = utcDayStart + transition.offset * NANOS_PER_SECOND;
+        transition.leapStart   = std::min(transition.dayStart, utcDayStart + transition.previous * NANOS_PER_SECOND);
+        transitions.push_back(transition);
+    }
+}
+
+int UTCScale::getTAIMinusUTC(const LinearTime& tai) const
+{
+    const int64_t nanos = tai.getNanos();
+    const size_t index = locate(nanos);
+    if (index < transitions.size() && nanos >= transitions[index].leapStart) {
+        return transitions[index].offset;
+    }
+    return (index == 0) ? initial : transitions[index - 1].offset;
+}
+
+DateTimeComponents UTCScale::getComponents(const LinearTime& tai) const
+{
+    const int64_t nanos = tai.getNanos();
+    const Decoded decoded = decode(nanos, locate(nanos));
+    const int64_t day = floorDiv(decoded.utcNanos, NANOS_PER_DAY);
+    return DateTimeComponents(DateComponents(static_cast<int>(day)), getTime(decoded, day));
+}
+
+void UTCScale::getComponents(const LinearTime* tai, size_t count, DateTimeComponents* dateTimes) const
+{
+    size_t index = 0;
+    bool located = false;
+    DateComponents date{};
+    int64_t lastDay = INT64_MIN;
+    for (size_t i = 0; i < count; ++i) {
+        const int64_t nanos = tai[i].getNanos();
+        if (!located || (index > 0 && nanos < transitions[index - 1].dayStart)) {
+            // first time or time going backward
+            index   = locate(nanos);
+            located = true;
+        }
+        while (index < transitions.size() && nanos >= transitions[index].dayStart) {
+            ++index;
+        }
+
+        const Decoded decoded = decode(nanos, index);
+        const int64_t day = floorDiv(decoded.utcNanos, NANOS_PER_DAY);
+        if (day != lastDay) {
+            lastDay = day;
+            date    = DateComponents(static_cast<int>(day));
+        }
+        dateTimes[i] = DateTimeComponents(date, getTime(decoded, day));
+    }
+}
+
+void UTCScale::getTimeComponents(const LinearTime* tai, size_t count, TimeComponents* times) const
+{
+    size_t index = 0;
+    bool located = false;
+    for (size_t i = 0; i < count; ++i) {
+        const int64_t nanos = tai[i].getNanos();
+        if (!located || (index > 0 && nanos < transitions[index - 1].dayStart)) {
+            // first time or time going backward
+            index   = locate(nanos);
+            located = true;
+        }
+        while (index < transitions.size() && nanos >= transitions[index].dayStart) {
+            ++index;
+        }
+
+        const Decoded decoded = decode(nanos, index);
+        times[i] = getTime(decoded, floorDiv(decoded.utcNanos, NANOS_PER_DAY));
+    }
+}
+
+size_t UTCScale::locate(int64_t nanos) const
+{
+    ORECPP_COUNT(LEAP_SECOND_LOOKUP);
+    return static_cast<size_t>(std::upper_bound(transitions.begin(), transitions.end(), nanos,
+                                                [](int64_t t, const Transition& transition) {
+                                                    return t < transition.dayStart;
+                                                }) - transitions.begin());
+}
+
+UTCScale::Decoded UTCScale::decode(int64_t nanos, size_t index) const
+{
+    Decoded decoded;
+    int offset = (index == 0) ? initial : transitions[index - 1].offset;
+    decoded.leap = 0;
+    decoded.minuteDuration = 60;
+    if (index < transitions.size() && nanos >= transitions[index].minuteStart) {
+        // last minute before the change
+        const Transition& transition = transitions[index];
+        decoded.minuteDuration = 60 + transition.offset - transition.previous;
+        if (nanos >= transition.leapStart) {
+            // inside the leap: the new offset maps the time to the last second
+            // of the day, and the leap adds the extra seconds
+            offset = transition.offset;
+            decoded.leap = transition.offset - transition.previous;
+        }
+    }
+    decoded.utcNanos = nanos - offset * NANOS_PER_SECOND;
+    return decoded;
+}
+
+TimeComponents UTCScale::getTime(const Decoded& decoded, int64_t day)
+{
+    const int64_t nanosInDay = decoded.utcNanos - day * NANOS_PER_DAY;
+    const int64_t secondInDayA = nanosInDay / NANOS_PER_SECOND;
+    return TimeComponents::fromSeconds(static_cast<int>(secondInDayA),
+                                       1.0e-9 * static_cast<double>(nanosInDay - secondInDayA * NANOS_PER_SECOND),
+                                       decoded.leap, decoded.minuteDuration);
+}
@@ -0,0 +1,264 @@
+#include "time/WallClock.h"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+#ifdef __linux__
+#include <sys/timex.h>
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define ORECPP_WALL_CLOCK_TSC 1
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#include <x86intrin.h>
+#define ORECPP_WALL_CLOCK_TSC 1
+#endif
+
+namespace {
+
+    /** Nanoseconds in one second. */
+    const int64_t NANOS_PER_SECOND = INT64_C(1000000000);
+
+    /** Nanoseconds in one day. */
+    const int64_t NANOS_PER_DAY = 86400 * NANOS_PER_SECOND;
+
+    /** Nanoseconds from 1970-01-01 to 2000-01-01. */
+    const int64_t UNIX_TO_J2000 = INT64_C(946684800) * NANOS_PER_SECOND;
+
+}
+
+/** Per-thread state of the clock last used by the thread. */
+struct WallClock::ThreadCache
+{
+    /** Identifier of the clock owning the cache. */
+    uint64_t owner = 0;
+
+    /** Start of the cached day (nanoseconds since J2000). */
+    int64_t dayStart = INT64_MAX;
+
+    /** End of the cached day (nanoseconds since J2000). */
+    int64_t dayEnd = INT64_MIN;
+
+    /** Cached date. */
+    DateComponents date{};
+
+    /** Counter value of the anchor. */
+    uint64_t anchorTicks = 0;
+
+    /** System clock reading of the anchor. */
+    int64_t anchorNanos = 0;
+
+    /** Indicator for a valid anchor. */
+    bool anchored = false;
+
+    /** Last time returned, to keep readings monotonic across anchor refreshes. */
+    int64_t last = INT64_MIN;
+};
+
+namespace {
+
+    /** Get a process-wide unique identifier for a new clock.
+     * @return unique identifier
+     */
+    uint64_t nextInstance()
+    {
+        static std::atomic<uint64_t> counter(0);
+        return ++counter;
+    }
+
+    /** Floor division.
+     * @param a dividend
+     * @param b divisor (strictly positive)
+     * @return largest integer not greater than a / b
+     */
+    inline int64_t floorDiv(int64_t a, int64_t b)
+    {
+        const int64_t q = a / b;
+        return (a % b < 0) ? q - 1 : q;
+    }
+
+}
+
+WallClock::WallClock(Source source)
+    : instance(nextInstance()), source(isAvailable(source) ? source : REALTIME),
+      scale(0), ticksPerSecond(0)
+{
+    if (this->source == TSC) {
+        calibrate();
+    }
+}
+
+WallClock::ThreadCache& WallClock::getCache(uint64_t instance)
+{
+    thread_local ThreadCache cache;
+    if (cache.owner != instance) {
+        cache = ThreadCache();
+        cache.owner = instance;
+    }
+    return cache;
+}
+
+WallClock::Source WallClock::getSource() const
+{
+    return source;
+}
+
+bool WallClock::isAvailable(Source source)
+{
+    switch (source) {
+        case REALTIME:
+            return true;
+        case TAI:
+#if defined(__linux__) && defined(CLOCK_TAI)
+        {
+            struct timespec ts;
+            return clock_gettime(CLOCK_TAI, &ts) == 0;
+        }
+#else
+            return false;
+#endif
+        default:
+#if defined(ORECPP_WALL_CLOCK_TSC) && defined(_MSC_VER)
+        {
+            // invariant TSC flag
+            int registers[4];
+            __cpuid(registers, 0x80000007);
+            return (registers[3] & (1 << 8)) != 0;
+        }
+#elif defined(ORECPP_WALL_CLOCK_TSC)
+        {
+            // invariant TSC flag
+            unsigned int eax, ebx, ecx, edx;
+            return __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) && (edx & (1u << 8)) != 0;
+        }
+#else
+            return false;
+#endif
+    }
+}
+
+int WallClock::getTAIOffset()
+{
+#ifdef __linux__
+    struct timex tx = {};
+    if (adjtimex(&tx) >= 0) {
+        return tx.tai;
+    }
+#endif
+    return 0;
+}
+
+int64_t WallClock::nowNanos() const
+{
+    if (source != TSC) {
+        return readSystemClock(source);
+    }
+    return readCounterNanos(getCache(instance));
+}
+
+LinearTime WallClock::now() const
+{
+    return LinearTime(nowNanos());
+}
+
+DateTimeComponents WallClock::nowComponents() const
+{
+    ThreadCache& cache = getCache(instance);
+    const int64_t nanos = (source == TSC) ? readCounterNanos(cache) : readSystemClock(source);
+    if (nanos < cache.dayStart || nanos >= cache.dayEnd) {
+        // new day, the calendar decomposition is done only once per day and thread
+        const int64_t day = floorDiv(nanos, NANOS_PER_DAY);
+        cache.date     = DateComponents(static_cast<int>(day));
+        cache.dayStart = day * NANOS_PER_DAY;
+        cache.dayEnd   = cache.dayStart + NANOS_PER_DAY;
+    }
+    const int64_t nanosInDay  = nanos - cache.dayStart;
+    const int     minuteInDay = static_cast<int>(nanosInDay / (60 * NANOS_PER_SECOND));
+    const int64_t nanosInMin  = nanosInDay - minuteInDay * (60 * NANOS_PER_SECOND);
+    return DateTimeComponents(cache.date,
+                              TimeComponents(minuteInDay / 60, minuteInDay % 60,
+                                             1.0e-9 * static_cast<double>(nanosInMin)));
+}
+
+int64_t WallClock::readCounterNanos(ThreadCache& cache) const
+{
+    const uint64_t ticks = readCounter();
+    const uint64_t elapsed = ticks - cache.anchorTicks;
+    int64_t nanos;
+    if (cache.anchored && elapsed < ANCHOR_LIFETIME) {
+        nanos = cache.anchorNanos + static_cast<int64_t>((elapsed * scale) >> SCALE_SHIFT);
+    }
+    else {
+        // refresh the anchor, using the counter mid-point around the clock reading
+        const uint64_t before = readCounter();
+        cache.anchorNanos = readSystemClock(REALTIME);
+        const uint64_t after = readCounter();
+        cache.anchorTicks = before + (after - before) / 2;
+        cache.anchored = true;
+        nanos = cache.anchorNanos;
+    }
+
+    // anchor refreshes must not make time go backward
+    if (nanos < cache.last) {
+        nanos = cache.last;
+    }
+    cache.last = nanos;
+    return nanos;
+}
+
+double WallClock::getTicksPerSecond() const
+{
+    return ticksPerSecond;
+}
+
+int64_t WallClock::readSystemClock(Source source)
+{
+#ifdef _WIN32
+    // 100 ns intervals since 1601-01-01
+    FILETIME ft;
+    GetSystemTimePreciseAsFileTime(&ft);
+    const int64_t intervals = (static_cast<int64_t>(ft.dwHighDateTime) << 32) | ft.dwLowDateTime;
+    return (intervals - INT64_C(116444736000000000)) * 100 - UNIX_TO_J2000;
+#else
+    struct timespec ts;
+#if defined(__linux__) && defined(CLOCK_TAI)
+    clock_gettime((source == TAI) ? CLOCK_TAI : CLOCK_REALTIME, &ts);
+#else
+    clock_gettime(CLOCK_REALTIME, &ts);
+#endif
+    return static_cast<int64_t>(ts.tv_sec) * NANOS_PER_SECOND + ts.tv_nsec - UNIX_TO_J2000;
+#endif
+}
+
+uint64_t WallClock::readCounter()
+{
+#ifdef ORECPP_WALL_CLOCK_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+void WallClock::calibrate()
+{
+    // measure the counter against the real time clock over a few milliseconds
+    const uint64_t start0     = readCounter();
+    const int64_t  startNanos = readSystemClock(REALTIME);
+    const uint64_t start1     = readCounter();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const uint64_t end0       = readCounter();
+    const int64_t  endNanos   = readSystemClock(REALTIME);
+    const uint64_t end1       = readCounter();
+
+    const double ticks = static_cast<double>((end0 + (end1 - end0) / 2) - (start0 + (start1 - start0) / 2));
+    ticksPerSecond = 1.0e9 * ticks / static_cast<double>(endNanos - startNanos);
+    scale = static_cast<uint64_t>(std::llround(std::ldexp(1.0e9 / ticksPerSecond, SCALE_SHIFT)));
+}
@@ -0,0 +1,290 @@
+#include "utils/Instrumentation.h"
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    /** Counters of one thread.
+     * <p>Only the owning thread updates them, other threads only read them
+     * (or reset them), so relaxed atomics compile to plain loads and stores.</p>
+     */
+    struct ThreadCounters
+    {
+        /** Number of calls. */
+        std::atomic<uint64_t> counts[Instrumentation::NB_COUNTERS];
+
+        /** Elapsed ticks. */
+        std::atomic<uint64_t> ticks[Instrumentation::NB_COUNTERS];
+
+        /** Small thread identifier, for trace events. */
+        uint32_t threadId;
+    };
+
+    /** Trace event, stored as atomic words so export can run concurrently. */
+    struct TraceEvent
+    {
+        /** Start on the trace clock (ns). */
+        std::atomic<int64_t> start;
+
+        /** Duration on the trace clock (ns). */
+        std::atomic<int64_t> duration;
+
+        /** Counter in the low 16 bits, thread identifier above. */
+        std::atomic<uint64_t> info;
+    };
+
+    /** Process-wide registry of thread counters. */
+    struct Registry
+    {
+        /** Lock protecting the live threads list and the retired totals. */
+        std::mutex lock;
+
+        /** Counters of live threads. */
+        std::vector<ThreadCounters*> live;
+
+        /** Totals of exited threads. */
+        uint64_t retiredCounts[Instrumentation::NB_COUNTERS] = {};
+
+        /** Totals of exited threads. */
+        uint64_t retiredTicks[Instrumentation::NB_COUNTERS] = {};
+
+        /** Next thread identifier. */
+        uint32_t nextThreadId = 1;
+
+        /** Trace ring buffer (allocated when tracing is first switched on). */
+        std::atomic<TraceEvent*> trace{ nullptr };
+
+        /** Number of trace events ever recorded. */
+        std::atomic<uint64_t> traceHead{ 0 };
+    };
+
+    /** Get the registry.
+     * <p>The registry is intentionally never destroyed, as threads may
+     * exit after static destruction.</p>
+     * @return registry
+     */
+    Registry& getRegistry()
+    {
+        static Registry* registry = new Registry();
+        return *registry;
+    }
+
+    /** Owner of the current thread counters, registering and retiring them. */
+    class ThreadCountersOwner
+    {
+    public:
+        /** Register the counters of the current thread. */
+        ThreadCountersOwner()
+        {
+            for (int i = 0; i < Instrumentation::NB_COUNTERS; ++i) {
+                counters.counts[i].store(0, std::memory_order_relaxed);
+                counters.ticks[i].store(0, std::memory_order_relaxed);
+            }
+            Registry& registry = getRegistry();
+            std::lock_guard<std::mutex> guard(registry.lock);
+            counters.threadId = registry.nextThreadId++;
+            registry.live.push_back(&counters);
+        }
+
+        /** Fold the counters into the retired totals. */
+        ~ThreadCountersOwner()
+        {
+            Registry& registry = getRegistry();
+            std::lock_guard<std::mutex> guard(registry.lock);
+            for (int i = 0; i < Instrumentation::NB_COUNTERS; ++i) {
+                registry.retiredCounts[i] += counters.counts[i].load(std::memory_order_relaxed);
+                registry.retiredTicks[i]  += counters.ticks[i].load(std::memory_order_relaxed);
+            }
+            registry.live.erase(std::find(registry.live.begin(), registry.live.end(), &counters));
+        }
+
+        /** Counters of the thread. */
+        ThreadCounters counters;
+    };
+
+    /** Get the counters of the current thread.
+     * @return counters of the current thread
+     */
+    ThreadCounters& getThreadCounters()
+    {
+        thread_local ThreadCountersOwner owner;
+        return owner.counters;
+    }
+
+    /** Add a value to a counter owned by the current thread.
+     * @param counter counter
+     * @param value value to add
+     */
+    void add(std::atomic<uint64_t>& counter, uint64_t value)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    /** Display names of the counters. */
+    const char* const NAMES[Instrumentation::NB_COUNTERS] = {
+        "DateComponents(offset)",
+        "DateComponents::getJ2000Day",
+        "DateComponents::getCalendarWeek",
+        "TimeComponents(seconds)",
+        "DateTimeComponents(reference, offset)",
+        "DateTimeComponents::offsetFrom",
+        "leap second lookup"
+    };
+
+}
+
+std::atomic<bool> Instrumentation::tracing(false);
+
+const char* Instrumentation::getName(Counter counter)
+{
+    return NAMES[counter];
+}
+
+void Instrumentation::count(Counter counter)
+{
+    add(getThreadCounters().counts[counter], 1);
+}
+
+void Instrumentation::record(Counter counter, uint64_t ticks, int64_t traceStart)
+{
+    ThreadCounters& counters = getThreadCounters();
+    add(counters.counts[counter], 1);
+    add(counters.ticks[counter], ticks);
+
+    if (traceStart >= 0) {
+        Registry& registry = getRegistry();
+        TraceEvent* trace = registry.trace.load(std::memory_order_acquire);
+        if (trace != nullptr) {
+            const uint64_t index = registry.traceHead.fetch_add(1, std::memory_order_relaxed);
+            TraceEvent& event = trace[index % TRACE_CAPACITY];
+            event.start.store(traceStart, std::memory_order_relaxed);
+            event.duration.store(readNanos() - traceStart, std::memory_order_relaxed);
+            event.info.store((static_cast<uint64_t>(counters.threadId) << 16) | counter,
+                             std::memory_order_release);
+        }
+    }
+}
+
+uint64_t Instrumentation::getCount(Counter counter)
+{
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    uint64_t total = registry.retiredCounts[counter];
+    for (const ThreadCounters* counters : registry.live) {
+        total += counters->counts[counter].load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+uint64_t Instrumentation::getTicks(Counter counter)
+{
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    uint64_t total = registry.retiredTicks[counter];
+    for (const ThreadCounters* counters : registry.live) {
+        total += counters->ticks[counter].load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+double Instrumentation::getTicksPerSecond()
+{
+    static const double frequency = [] {
+#ifdef ORECPP_HAS_TSC
+        // calibrate the time stamp counter over a few milliseconds
+        const int64_t  nanos0 = readNanos();
+        const uint64_t ticks0 = readTicks();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        const int64_t  nanos1 = readNanos();
+        const uint64_t ticks1 = readTicks();
+        return 1.0e9 * static_cast<double>(ticks1 - ticks0) / static_cast<double>(nanos1 - nanos0);
+#else
+        return 1.0e9;
+#endif
+    }();
+    return frequency;
+}
+
+void Instrumentation::reset()
+{
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> guard(registry.lock);
+    for (int i = 0; i < NB_COUNTERS; ++i) {
+        registry.retiredCounts[i] = 0;
+        registry.retiredTicks[i]  = 0;
+        for (ThreadCounters* counters : registry.live) {
+            counters->counts[i].store(0, std::memory_order_relaxed);
+            counters->ticks[i].store(0, std::memory_order_relaxed);
+        }
+    }
+    registry.traceHead.store(0, std::memory_order_relaxed);
+}
+
+void Instrumentation::writeReport(FILE* out)
+{
+    const double nanosPerTick = 1.0e9 / getTicksPerSecond();
+    for (int i = 0; i < NB_COUNTERS; ++i) {
+        const Counter counter = static_cast<Counter>(i);
+        const uint64_t calls = getCount(counter);
+        const uint64_t ticks = getTicks(counter);
+        fprintf(out, "{\"counter\":\"%s\",\"calls\":%llu,\"ticks\":%llu,\"ns_per_call\":%.3f}\n",
+                getName(counter),
+                static_cast<unsigned long long>(calls), static_cast<unsigned long long>(ticks),
+                (calls == 0) ? 0.0 : nanosPerTick * static_cast<double>(ticks) / static_cast<double>(calls));
+    }
+}
+
+void Instrumentation::setTracing(bool enabled)
+{
+    if (enabled) {
+        Registry& registry = getRegistry();
+        std::lock_guard<std::mutex> guard(registry.lock);
+        if (registry.trace.load(std::memory_order_relaxed) == nullptr) {
+            TraceEvent* trace = new TraceEvent[TRACE_CAPACITY];
+            for (size_t i = 0; i < TRACE_CAPACITY; ++i) {
+                trace[i].start.store(0, std::memory_order_relaxed);
+                trace[i].duration.store(0, std::memory_order_relaxed);
+                trace[i].info.store(0, std::memory_order_relaxed);
+            }
+            registry.trace.store(trace, std::memory_order_release);
+        }
+    }
+    tracing.store(enabled, std::memory_order_relaxed);
+}
+
+bool Instrumentation::exportChromeTrace(const char* path)
+{
+    FILE* out = fopen(path, "w");
+    if (out == nullptr) {
+        return false;
+    }
+
+    Registry& registry = getRegistry();
+    const TraceEvent* trace = registry.trace.load(std::memory_order_acquire);
+    const uint64_t head  = registry.traceHead.load(std::memory_order_relaxed);
+    const uint64_t first = (head > TRACE_CAPACITY) ? head - TRACE_CAPACITY : 0;
+
+    fprintf(out, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+    const char* separator = "\n";
+    for (uint64_t i = first; trace != nullptr && i < head; ++i) {
+        const TraceEvent& event = trace[i % TRACE_CAPACITY];
+        const uint64_t info = event.info.load(std::memory_order_acquire);
+        const unsigned counter = static_cast<unsigned>(info & 0xFFFF);
+        if (info == 0 || counter >= NB_COUNTERS) {
+            // slot not written yet
+            continue;
+        }
+        // Chrome trace event times are in microseconds
+        fprintf(out, "%s{\"name\":\"%s\",\"cat\":\"orecpp\",\"ph\":\"X\",\"pid\":1,\"tid\":%llu,"
+                "\"ts\":%.3f,\"dur\":%.3f}",
+                separator, NAMES[counter], static_cast<unsigned long long>(info >> 16),
+                1.0e-3 * static_cast<double>(event.start.load(std::memory_order_relaxed)),
+                1.0e-3 * static_cast<double>(event.duration.load(std::memory_order_relaxed)));
+        separator = ",\n";
+    }
+    fprintf(out, "\n]}\n");
+
+    return fclose(out) == 0;
+}
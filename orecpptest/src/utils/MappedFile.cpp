@@ -0,0 +1,162 @@
+#include "utils/MappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile()
+    : data(nullptr), size(0), opened(false)
+#ifdef _WIN32
+    , mapping(nullptr)
+#endif
+{
+
+}
+
+MappedFile::MappedFile(const char* path)
+    : MappedFile()
+{
+    open(path);
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data(other.data), size(other.size), opened(other.opened)
+#ifdef _WIN32
+    , mapping(other.mapping)
+#endif
+{
+    other.data   = nullptr;
+    other.size   = 0;
+    other.opened = false;
+#ifdef _WIN32
+    other.mapping = nullptr;
+#endif
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other) {
+        close();
+        data   = other.data;
+        size   = other.size;
+        opened = other.opened;
+        other.data   = nullptr;
+        other.size   = 0;
+        other.opened = false;
+#ifdef _WIN32
+        mapping = other.mapping;
+        other.mapping = nullptr;
+#endif
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+bool MappedFile::open(const char* path)
+{
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        return false;
+    }
+    if (fileSize.QuadPart > 0) {
+        HANDLE m = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (m == nullptr) {
+            return false;
+        }
+        void* view = MapViewOfFile(m, FILE_MAP_READ, 0, 0, 0);
+        if (view == nullptr) {
+            CloseHandle(m);
+            return false;
+        }
+        mapping = m;
+        data    = static_cast<const char*>(view);
+        size    = static_cast<size_t>(fileSize.QuadPart);
+    }
+    else {
+        CloseHandle(file);
+    }
+#else
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        ::close(fd);
+        return false;
+    }
+    if (st.st_size > 0) {
+        void* view = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (view == MAP_FAILED) {
+            ::close(fd);
+            return false;
+        }
+        data = static_cast<const char*>(view);
+        size = static_cast<size_t>(st.st_size);
+    }
+    // the mapping remains valid once the descriptor is closed
+    ::close(fd);
+#endif
+
+    opened = true;
+    return true;
+}
+
+void MappedFile::close()
+{
+    if (data != nullptr) {
+#ifdef _WIN32
+        UnmapViewOfFile(data);
+        CloseHandle(mapping);
+        mapping = nullptr;
+#else
+        munmap(const_cast<char*>(data), size);
+#endif
+    }
+    data   = nullptr;
+    size   = 0;
+    opened = false;
+}
+
+bool MappedFile::isOpen() const
+{
+    return opened;
+}
+
+const char* MappedFile::getData() const
+{
+    return data;
+}
+
+size_t MappedFile::getSize() const
+{
+    return size;
+}
+
+void MappedFile::adviseSequential() const
+{
+#ifndef _WIN32
+    if (data != nullptr) {
+        madvise(const_cast<char*>(data), size, MADV_SEQUENTIAL);
+    }
+#endif
+}
@@ -0,0 +1,35 @@
+#include "utils/PVCoordinates.h"
+
+const PVCoordinates PVCoordinates::ZERO;
+
+PVCoordinates::PVCoordinates()
+    : position(), velocity()
+{
+
+}
+
+PVCoordinates::PVCoordinates(const Vector3D& position, const Vector3D& velocity)
+    : position(position), velocity(velocity)
+{
+
+}
+
+const Vector3D& PVCoordinates::getPosition() const
+{
+    return position;
+}
+
+const Vector3D& PVCoordinates::getVelocity() const
+{
+    return velocity;
+}
+
+Vector3D PVCoordinates::getMomentum() const
+{
+    return position.crossProduct(velocity);
+}
+
+PVCoordinates PVCoordinates::shiftedBy(double dt) const
+{
+    return PVCoordinates(position.add(dt, velocity), velocity);
+}
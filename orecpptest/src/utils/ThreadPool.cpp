@@ -0,0 +1,186 @@
+#include "utils/ThreadPool.h"
+#include <algorithm>
+
+namespace {
+
+    /** Pool whose loop the current thread is running, to detect nested loops. */
+    thread_local const ThreadPool* currentPool = nullptr;
+
+    /** Pack a chunks range.
+     * @param first first chunk
+     * @param end chunk after the last one
+     * @return packed range
+     */
+    inline uint64_t pack(uint32_t first, uint32_t end)
+    {
+        return static_cast<uint64_t>(first) | (static_cast<uint64_t>(end) << 32);
+    }
+
+    /** Get the first chunk of a packed range.
+     * @param bounds packed range
+     * @return first chunk
+     */
+    inline uint32_t first(uint64_t bounds)
+    {
+        return static_cast<uint32_t>(bounds);
+    }
+
+    /** Get the end of a packed range.
+     * @param bounds packed range
+     * @return chunk after the last one
+     */
+    inline uint32_t end(uint64_t bounds)
+    {
+        return static_cast<uint32_t>(bounds >> 32);
+    }
+
+}
+
+ThreadPool::ThreadPool(unsigned nbThreads)
+    : generation(0), pending(0), stopping(false),
+      invoker(nullptr), body(nullptr), count(0), chunkSize(1)
+{
+    if (nbThreads == 0) {
+        nbThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    ranges.reset(new Range[nbThreads]);
+    for (unsigned i = 0; i < nbThreads; ++i) {
+        ranges[i].bounds.store(0, std::memory_order_relaxed);
+    }
+    for (unsigned i = 0; i + 1 < nbThreads; ++i) {
+        threads.emplace_back(&ThreadPool::work, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    started.notify_all();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+unsigned ThreadPool::getNbThreads() const
+{
+    return static_cast<unsigned>(threads.size()) + 1;
+}
+
+size_t ThreadPool::getChunkSize(size_t bytesPerElement)
+{
+    return std::max<size_t>(1, CHUNK_BYTES / std::max<size_t>(1, bytesPerElement));
+}
+
+void ThreadPool::run(size_t count, size_t chunkSize, Invoker invoker, const void* body)
+{
+    if (count == 0) {
+        return;
+    }
+
+    // chunk indices must fit in the 32 bits halves of the packed ranges
+    chunkSize = std::max<size_t>(chunkSize, 1);
+    chunkSize = std::max<size_t>(chunkSize, count / UINT32_MAX + 1);
+    const size_t nbChunks = (count + chunkSize - 1) / chunkSize;
+    if (threads.empty() || nbChunks == 1 || currentPool == this) {
+        invoker(body, 0, count);
+        return;
+    }
+
+    std::lock_guard<std::mutex> submit(submitLock);
+
+    // deal the chunks as contiguous ranges, one per participant
+    const unsigned nbParticipants = getNbThreads();
+    for (unsigned i = 0; i < nbParticipants; ++i) {
+        ranges[i].bounds.store(pack(static_cast<uint32_t>(nbChunks * i / nbParticipants),
+                                    static_cast<uint32_t>(nbChunks * (i + 1) / nbParticipants)),
+                               std::memory_order_relaxed);
+    }
+    this->invoker   = invoker;
+    this->body      = body;
+    this->count     = count;
+    this->chunkSize = chunkSize;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        ++generation;
+        pending = static_cast<unsigned>(threads.size());
+    }
+    started.notify_all();
+
+    currentPool = this;
+    participate(nbParticipants - 1);
+    currentPool = nullptr;
+
+    // the loop data must stay alive until all pool threads left the loop
+    std::unique_lock<std::mutex> guard(lock);
+    finished.wait(guard, [this] { return pending == 0; });
+}
+
+void ThreadPool::work(unsigned index)
+{
+    currentPool = this;
+    uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            started.wait(guard, [this, seen] { return stopping || generation != seen; });
+            if (stopping) {
+                return;
+            }
+            seen = generation;
+        }
+
+        participate(index);
+
+        std::lock_guard<std::mutex> guard(lock);
+        if (--pending == 0) {
+            finished.notify_one();
+        }
+    }
+}
+
+void ThreadPool::participate(unsigned index)
+{
+    uint32_t chunk;
+    while (take(index, chunk) || steal(index, chunk)) {
+        const size_t begin = chunk * chunkSize;
+        invoker(body, begin, std::min(count, begin + chunkSize));
+    }
+}
+
+bool ThreadPool::take(unsigned index, uint32_t& chunk)
+{
+    std::atomic<uint64_t>& bounds = ranges[index].bounds;
+    uint64_t current = bounds.load(std::memory_order_acquire);
+    while (first(current) < end(current)) {
+        if (bounds.compare_exchange_weak(current, pack(first(current) + 1, end(current)),
+                                         std::memory_order_acq_rel, std::memory_order_acquire)) {
+            chunk = first(current);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ThreadPool::steal(unsigned index, uint32_t& chunk)
+{
+    const unsigned nbParticipants = getNbThreads();
+    for (unsigned i = 1; i < nbParticipants; ++i) {
+        std::atomic<uint64_t>& victim = ranges[(index + i) % nbParticipants].bounds;
+        uint64_t current = victim.load(std::memory_order_acquire);
+        while (first(current) < end(current)) {
+            // take the back half, leaving the front to the owner
+            const uint32_t split = end(current) - (end(current) - first(current) + 1) / 2;
+            if (victim.compare_exchange_weak(current, pack(first(current), split),
+                                             std::memory_order_acq_rel, std::memory_order_acquire)) {
+                // our own range is empty, so no other thread modifies it
+                chunk = split;
+                ranges[index].bounds.store(pack(split + 1, end(current)), std::memory_order_release);
+                return true;
+            }
+        }
+    }
+    return false;
+}